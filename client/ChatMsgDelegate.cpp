@@ -0,0 +1,184 @@
+﻿#include "ChatMsgDelegate.h"
+#include "ChatMsgModel.h"
+#include "avatarcache.h"
+#include "thumbnailmgr.h"
+#include <QPainter>
+#include <QFontMetrics>
+#include <climits>
+
+const int WIDTH_SANJIAO  = 8;  //三角宽
+const int ITEM_MARGIN = 3;     //条目边距，对应原ChatItemBase布局
+const int ICON_SIZE = 42;      //头像大小
+const int NAME_HEIGHT = 20;    //名字高度
+const int BUBBLE_MARGIN = 3;   //气泡内容到边框的距离
+const int TEXT_MARGIN = 4;     //文本到内容边框的距离
+const int PENDING_SIZE = 8;    //发送中标记的直径
+
+ChatMsgDelegate::ChatMsgDelegate(QObject *parent)
+    : QStyledItemDelegate(parent), _view_width(0),
+      _name_font("Microsoft YaHei"), _text_font("Microsoft YaHei")
+{
+    _name_font.setPointSize(9);
+    _text_font.setPointSize(12);
+}
+
+void ChatMsgDelegate::setViewWidth(int width)
+{
+    if(_view_width == width){
+        return;
+    }
+    _view_width = width;
+    _size_cache.clear();
+}
+
+void ChatMsgDelegate::clearCache()
+{
+    _size_cache.clear();
+}
+
+QSize ChatMsgDelegate::bubbleSize(const QModelIndex &index) const
+{
+    auto msg_id = index.data(ChatMsgModel::MsgIdRole).toString();
+    auto iter = _size_cache.find(msg_id);
+    if(iter != _size_cache.end()){
+        return iter.value();
+    }
+
+    int pad_h = WIDTH_SANJIAO + BUBBLE_MARGIN * 2;
+    int pad_v = BUBBLE_MARGIN * 2;
+    QSize size;
+    if(index.data(ChatMsgModel::TypeRole).toString() == "image"){
+        auto pic_size = index.data(ChatMsgModel::PictureSizeRole).toSize();
+        size = QSize(pic_size.width() + pad_h, pic_size.height() + pad_v);
+    }else{
+        //气泡最多占去掉头像后宽度的3/5，和原来布局的列拉伸比例一致
+        int avail = _view_width - ICON_SIZE - ITEM_MARGIN * 3;
+        int max_text_w = qMax(avail * 3 / 5 - pad_h - TEXT_MARGIN * 2, 20);
+        QFontMetrics fm(_text_font);
+        QRect text_rect = fm.boundingRect(QRect(0, 0, max_text_w, INT_MAX),
+            Qt::TextWordWrap | Qt::TextWrapAnywhere,
+            index.data(ChatMsgModel::ContentRole).toString());
+        size = QSize(text_rect.width() + TEXT_MARGIN * 2 + pad_h,
+                     text_rect.height() + TEXT_MARGIN * 2 + pad_v);
+    }
+
+    _size_cache.insert(msg_id, size);
+    return size;
+}
+
+QSize ChatMsgDelegate::sizeHint(const QStyleOptionViewItem &option,
+                                const QModelIndex &index) const
+{
+    Q_UNUSED(option);
+    QSize bubble = bubbleSize(index);
+    int height = qMax(ICON_SIZE, NAME_HEIGHT + ITEM_MARGIN + bubble.height()) + ITEM_MARGIN * 2;
+    return QSize(_view_width, height);
+}
+
+void ChatMsgDelegate::paintBubble(QPainter *painter, const QRect &rect, bool self) const
+{
+    painter->setPen(Qt::NoPen);
+    if(!self)
+    {
+        //画气泡
+        painter->setBrush(QBrush(QColor(Qt::white)));
+        QRect bk_rect = QRect(rect.x() + WIDTH_SANJIAO, rect.y(),
+                              rect.width() - WIDTH_SANJIAO, rect.height());
+        painter->drawRoundedRect(bk_rect, 5, 5);
+        //画小三角
+        QPointF points[3] = {
+            QPointF(bk_rect.x(), rect.y() + 12),
+            QPointF(bk_rect.x(), rect.y() + 10 + WIDTH_SANJIAO + 2),
+            QPointF(bk_rect.x() - WIDTH_SANJIAO, rect.y() + 10 + WIDTH_SANJIAO - WIDTH_SANJIAO/2),
+        };
+        painter->drawPolygon(points, 3);
+    }
+    else
+    {
+        painter->setBrush(QBrush(QColor(158,234,106)));
+        //画气泡
+        QRect bk_rect = QRect(rect.x(), rect.y(), rect.width() - WIDTH_SANJIAO, rect.height());
+        painter->drawRoundedRect(bk_rect, 5, 5);
+        //画三角
+        QPointF points[3] = {
+            QPointF(bk_rect.x() + bk_rect.width(), rect.y() + 12),
+            QPointF(bk_rect.x() + bk_rect.width(), rect.y() + 12 + WIDTH_SANJIAO + 2),
+            QPointF(bk_rect.x() + bk_rect.width() + WIDTH_SANJIAO, rect.y() + 10 + WIDTH_SANJIAO - WIDTH_SANJIAO/2),
+        };
+        painter->drawPolygon(points, 3);
+    }
+}
+
+void ChatMsgDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                            const QModelIndex &index) const
+{
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+
+    bool self = index.data(ChatMsgModel::ChatRoleRole).toInt() == static_cast<int>(ChatRole::Self);
+    QRect item_rect = option.rect.adjusted(ITEM_MARGIN, ITEM_MARGIN, -ITEM_MARGIN, -ITEM_MARGIN);
+    QSize bubble = bubbleSize(index);
+
+    //自己的消息头像在右边，对方的在左边
+    QRect icon_rect;
+    QRect name_rect;
+    QRect bubble_rect;
+    if(self){
+        icon_rect = QRect(item_rect.right() - ICON_SIZE + 1, item_rect.top(), ICON_SIZE, ICON_SIZE);
+        int right = icon_rect.left() - ITEM_MARGIN;
+        name_rect = QRect(item_rect.left(), item_rect.top(), right - item_rect.left() - 8, NAME_HEIGHT);
+        bubble_rect = QRect(right - bubble.width() + 1, name_rect.bottom() + ITEM_MARGIN + 1,
+                            bubble.width(), bubble.height());
+    }else{
+        icon_rect = QRect(item_rect.left(), item_rect.top(), ICON_SIZE, ICON_SIZE);
+        int left = icon_rect.right() + ITEM_MARGIN + 1;
+        name_rect = QRect(left + 8, item_rect.top(), item_rect.right() - left - 8, NAME_HEIGHT);
+        bubble_rect = QRect(left, name_rect.bottom() + ITEM_MARGIN + 1,
+                            bubble.width(), bubble.height());
+    }
+
+    //头像从共享缓存取，未加载完时画占位图，加载完成后视图会重绘
+    painter->drawPixmap(icon_rect, AvatarCache::GetInstance()->GetAvatar(
+        index.data(ChatMsgModel::IconRole).toString(), icon_rect.size(),
+        painter->device()->devicePixelRatioF()));
+
+    painter->setFont(_name_font);
+    painter->setPen(QColor(153,153,153));
+    painter->drawText(name_rect, (self ? Qt::AlignRight : Qt::AlignLeft) | Qt::AlignTop,
+                      index.data(ChatMsgModel::NameRole).toString());
+
+    paintBubble(painter, bubble_rect, self);
+
+    //自己发出的消息未收到服务器确认时，在气泡左侧画一个灰点表示发送中
+    if(self && !index.data(ChatMsgModel::AckedRole).toBool()){
+        QRect pending_rect(bubble_rect.left() - PENDING_SIZE - ITEM_MARGIN,
+                           bubble_rect.center().y() - PENDING_SIZE / 2, PENDING_SIZE, PENDING_SIZE);
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(QColor(180, 180, 180));
+        painter->drawEllipse(pending_rect);
+    }
+
+    //内容区域去掉三角和边距
+    QRect content_rect = self ?
+        bubble_rect.adjusted(BUBBLE_MARGIN, BUBBLE_MARGIN, -WIDTH_SANJIAO - BUBBLE_MARGIN, -BUBBLE_MARGIN) :
+        bubble_rect.adjusted(WIDTH_SANJIAO + BUBBLE_MARGIN, BUBBLE_MARGIN, -BUBBLE_MARGIN, -BUBBLE_MARGIN);
+    if(index.data(ChatMsgModel::TypeRole).toString() == "image"){
+        //缩略图未生成时先画占位框，生成后视图会重绘
+        QRect pic_rect(content_rect.topLeft(), index.data(ChatMsgModel::PictureSizeRole).toSize());
+        QPixmap pix = ThumbnailMgr::GetInstance()->GetThumbnail(
+            index.data(ChatMsgModel::ContentRole).toString(), QSize(PIC_MAX_WIDTH, PIC_MAX_HEIGHT));
+        if(pix.isNull()){
+            painter->fillRect(pic_rect, QColor(220, 220, 220));
+        }else{
+            painter->drawPixmap(pic_rect, pix);
+        }
+    }else{
+        painter->setFont(_text_font);
+        painter->setPen(Qt::black);
+        painter->drawText(content_rect.adjusted(TEXT_MARGIN, TEXT_MARGIN, -TEXT_MARGIN, -TEXT_MARGIN),
+                          Qt::TextWordWrap | Qt::TextWrapAnywhere,
+                          index.data(ChatMsgModel::ContentRole).toString());
+    }
+
+    painter->restore();
+}
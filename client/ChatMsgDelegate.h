@@ -0,0 +1,33 @@
+﻿#ifndef CHATMSGDELEGATE_H
+#define CHATMSGDELEGATE_H
+
+#include <QStyledItemDelegate>
+#include <QHash>
+#include <QFont>
+#include <QPixmap>
+
+//绘制聊天气泡的委托，代替原来每条消息一个ChatItemBase+TextBubble的控件树
+//文本的排版结果按消息id缓存，只有视图宽度变化时才重新测量
+class ChatMsgDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+public:
+    explicit ChatMsgDelegate(QObject *parent = nullptr);
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option,
+                   const QModelIndex &index) const override;
+    //视图宽度变化后气泡最大宽度跟着变，需要清空缓存
+    void setViewWidth(int width);
+    void clearCache();
+private:
+    QSize bubbleSize(const QModelIndex &index) const;
+    void paintBubble(QPainter *painter, const QRect &rect, bool self) const;
+
+    int _view_width;
+    QFont _name_font;
+    QFont _text_font;
+    mutable QHash<QString, QSize> _size_cache;
+};
+
+#endif // CHATMSGDELEGATE_H
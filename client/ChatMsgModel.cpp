@@ -0,0 +1,100 @@
+﻿#include "ChatMsgModel.h"
+#include "thumbnailmgr.h"
+
+ChatMsgModel::ChatMsgModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+}
+
+int ChatMsgModel::rowCount(const QModelIndex &parent) const
+{
+    if(parent.isValid()){
+        return 0;
+    }
+    return static_cast<int>(_items.size());
+}
+
+QVariant ChatMsgModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= static_cast<int>(_items.size())){
+        return QVariant();
+    }
+
+    auto& item = _items[index.row()];
+    switch (role) {
+    case MsgIdRole:
+        return item->_msg_id;
+    case ChatRoleRole:
+        return static_cast<int>(item->_role);
+    case NameRole:
+        return item->_name;
+    case IconRole:
+        return item->_icon;
+    case TypeRole:
+        return item->_type;
+    case Qt::DisplayRole:
+    case ContentRole:
+        return item->_content;
+    case PictureSizeRole:
+        return item->_picture_size;
+    case AckedRole:
+        return item->_b_acked;
+    default:
+        return QVariant();
+    }
+}
+
+void ChatMsgModel::appendMsg(std::shared_ptr<ChatMsgItem> item)
+{
+    //插入时只读图片头确定显示大小，缩略图由ThumbnailMgr在后台生成
+    if(item->_type == "image" && !item->_picture_size.isValid()){
+        item->_picture_size = ThumbnailMgr::GetInstance()->ThumbnailSize(item->_content,
+                                                                         QSize(PIC_MAX_WIDTH, PIC_MAX_HEIGHT));
+    }
+
+    int row = static_cast<int>(_items.size());
+    beginInsertRows(QModelIndex(), row, row);
+    _items.push_back(item);
+    endInsertRows();
+}
+
+void ChatMsgModel::prependMsgs(std::vector<std::shared_ptr<ChatMsgItem>> items)
+{
+    if(items.empty()){
+        return;
+    }
+
+    for(auto& item : items){
+        if(item->_type == "image" && !item->_picture_size.isValid()){
+            item->_picture_size = ThumbnailMgr::GetInstance()->ThumbnailSize(item->_content,
+                                                                             QSize(PIC_MAX_WIDTH, PIC_MAX_HEIGHT));
+        }
+    }
+
+    beginInsertRows(QModelIndex(), 0, static_cast<int>(items.size()) - 1);
+    _items.insert(_items.begin(), items.begin(), items.end());
+    endInsertRows();
+}
+
+void ChatMsgModel::ackMsgs(const QStringList &msg_ids)
+{
+    //确认的都是刚发出的消息，从尾部往前找，找齐就停
+    int remain = msg_ids.size();
+    for(int row = static_cast<int>(_items.size()) - 1; row >= 0 && remain > 0; --row){
+        auto& item = _items[row];
+        if(item->_b_acked || !msg_ids.contains(item->_msg_id)){
+            continue;
+        }
+        item->_b_acked = true;
+        --remain;
+        QModelIndex idx = index(row);
+        emit dataChanged(idx, idx, {AckedRole});
+    }
+}
+
+void ChatMsgModel::clear()
+{
+    beginResetModel();
+    _items.clear();
+    endResetModel();
+}
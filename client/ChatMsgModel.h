@@ -0,0 +1,55 @@
+﻿#ifndef CHATMSGMODEL_H
+#define CHATMSGMODEL_H
+
+#include <QAbstractListModel>
+#include <QSize>
+#include <memory>
+#include <vector>
+#include <QStringList>
+#include "global.h"
+
+//聊天记录中的一条消息，界面只保存绘制需要的数据
+struct ChatMsgItem {
+    ChatMsgItem(QString msg_id, ChatRole role, QString name, QString icon,
+                QString type, QString content)
+        :_msg_id(msg_id),_role(role),_name(name),_icon(icon),
+          _type(type),_content(content),_b_acked(true){}
+    QString _msg_id;
+    ChatRole _role;
+    QString _name;
+    QString _icon;
+    QString _type;      //text 或 image
+    QString _content;   //文本内容或图片路径
+    QSize _picture_size; //图片的显示大小，缩略图本身由ThumbnailMgr缓存
+    bool _b_acked;       //自己发出的消息是否收到服务器确认
+};
+
+//聊天记录模型，视图只为可见的行调用委托绘制，不再为每条消息创建控件
+class ChatMsgModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    enum MsgRoles {
+        MsgIdRole = Qt::UserRole + 1,
+        ChatRoleRole,
+        NameRole,
+        IconRole,
+        TypeRole,
+        ContentRole,
+        PictureSizeRole,
+        AckedRole
+    };
+
+    explicit ChatMsgModel(QObject *parent = nullptr);
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    void appendMsg(std::shared_ptr<ChatMsgItem> item);     //尾插
+    void prependMsgs(std::vector<std::shared_ptr<ChatMsgItem>> items); //头插更早的记录
+    void ackMsgs(const QStringList& msg_ids);               //按msgid标记已送达
+    void clear();
+private:
+    std::vector<std::shared_ptr<ChatMsgItem>> _items;
+};
+
+#endif // CHATMSGMODEL_H
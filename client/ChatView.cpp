@@ -1,4 +1,8 @@
 ﻿#include "ChatView.h"
+#include "ChatMsgModel.h"
+#include "ChatMsgDelegate.h"
+#include "avatarcache.h"
+#include "thumbnailmgr.h"
 #include <QScrollBar>
 #include <QVBoxLayout>
 #include <QEvent>
@@ -11,87 +15,99 @@
 ChatView::ChatView(QWidget *parent)
    : QWidget(parent)
    , isAppended(false)
+   , m_keepBottomOffset(-1)
 {
     QVBoxLayout *pMainLayout = new QVBoxLayout();
     this->setLayout(pMainLayout);
     pMainLayout->setMargin(0);
 
-    m_pScrollArea = new QScrollArea();
-    m_pScrollArea->setObjectName("chat_area");
-    pMainLayout->addWidget(m_pScrollArea);
-
-    QWidget *w = new QWidget(this);
-    w->setObjectName("chat_bg");
-    w->setAutoFillBackground(true);
-    QVBoxLayout *pHLayout_1 = new QVBoxLayout();
-    pHLayout_1->addWidget(new QWidget(), 100000);
-    w->setLayout(pHLayout_1);
-    m_pScrollArea->setWidget(w);    //应该时在QSCrollArea构造后执行 才对
-
-    m_pScrollArea->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-    QScrollBar *pVScrollBar = m_pScrollArea->verticalScrollBar();
+    m_pListView = new QListView();
+    m_pListView->setObjectName("chat_area");
+    pMainLayout->addWidget(m_pListView);
+
+    m_pModel = new ChatMsgModel(this);
+    m_pDelegate = new ChatMsgDelegate(this);
+    m_pListView->setModel(m_pModel);
+    m_pListView->setItemDelegate(m_pDelegate);
+    //头像和图片缩略图异步加载完成后重绘可见区域
+    connect(AvatarCache::GetInstance().get(), &AvatarCache::sig_avatar_ready,
+            m_pListView->viewport(), QOverload<>::of(&QWidget::update));
+    connect(ThumbnailMgr::GetInstance().get(), &ThumbnailMgr::sig_thumbnail_ready,
+            m_pListView->viewport(), QOverload<>::of(&QWidget::update));
+
+    //每条消息高度不同，按像素滚动；视图只为可见行调用委托
+    m_pListView->setUniformItemSizes(false);
+    m_pListView->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    m_pListView->setResizeMode(QListView::Adjust);
+    m_pListView->setSelectionMode(QAbstractItemView::NoSelection);
+    m_pListView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_pListView->setFocusPolicy(Qt::NoFocus);
+    m_pListView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    m_pListView->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    m_pListView->viewport()->setObjectName("chat_bg");
+    m_pListView->viewport()->setAutoFillBackground(true);
+
+    QScrollBar *pVScrollBar = m_pListView->verticalScrollBar();
+    pVScrollBar->setSingleStep(20);
     connect(pVScrollBar, &QScrollBar::rangeChanged,this, &ChatView::onVScrollBarMoved);
+    connect(pVScrollBar, &QScrollBar::valueChanged,this, &ChatView::onVScrollValueChanged);
     //把垂直ScrollBar放到上边 而不是原来的并排
     QHBoxLayout *pHLayout_2 = new QHBoxLayout();
     pHLayout_2->addWidget(pVScrollBar, 0, Qt::AlignRight);
     pHLayout_2->setMargin(0);
-    m_pScrollArea->setLayout(pHLayout_2);
+    m_pListView->setLayout(pHLayout_2);
     pVScrollBar->setHidden(true);
 
-    m_pScrollArea->setWidgetResizable(true);
-    m_pScrollArea->installEventFilter(this);
+    m_pListView->installEventFilter(this);
+    m_pListView->viewport()->installEventFilter(this);
     initStyleSheet();
 }
 
-void ChatView::appendChatItem(QWidget *item)
+void ChatView::appendChatMsg(std::shared_ptr<ChatMsgItem> item)
 {
-   QVBoxLayout *vl = qobject_cast<QVBoxLayout *>(m_pScrollArea->widget()->layout());
-   qDebug() << "vl->count() is " << vl->count();
-   vl->insertWidget(vl->count()-1, item);   
+   m_pModel->appendMsg(item);
    isAppended = true;
 }
 
-void ChatView::prependChatItem(QWidget *item)
+void ChatView::prependChatMsgs(std::vector<std::shared_ptr<ChatMsgItem>> items)
 {
+    if(items.empty()){
+        return;
+    }
 
+    QScrollBar *pVScrollBar = m_pListView->verticalScrollBar();
+    //原来内容不足一屏时不需要保持位置
+    if(pVScrollBar->maximum() > 0){
+        m_keepBottomOffset = pVScrollBar->maximum() - pVScrollBar->value();
+    }
+    m_pModel->prependMsgs(items);
 }
 
-void ChatView::insertChatItem(QWidget *before, QWidget *item)
+void ChatView::ackChatMsgs(const QStringList &msg_ids)
 {
-
+    m_pModel->ackMsgs(msg_ids);
 }
 
 void ChatView::removeAllItem()
 {
-    QVBoxLayout *layout = qobject_cast<QVBoxLayout *>(m_pScrollArea->widget()->layout());
-
-   int count = layout->count();
-
-    for (int i = 0; i < count - 1; ++i) {
-        QLayoutItem *item = layout->takeAt(0); // 始终从第一个控件开始删除
-        if (item) {
-            if (QWidget *widget = item->widget()) {
-                delete widget;
-            }
-            delete item;
-        }
-    }
-
+    m_pModel->clear();
+    m_pDelegate->clearCache();
 }
 
 bool ChatView::eventFilter(QObject *o, QEvent *e)
 {
-    /*if(e->type() == QEvent::Resize && o == )
+    if(e->type() == QEvent::Resize && o == m_pListView->viewport())
     {
-
+        //宽度变了气泡要重新换行，在视图重新布局之前更新
+        m_pDelegate->setViewWidth(m_pListView->viewport()->width());
     }
-    else */if(e->type() == QEvent::Enter && o == m_pScrollArea)
+    else if(e->type() == QEvent::Enter && o == m_pListView)
     {
-        m_pScrollArea->verticalScrollBar()->setHidden(m_pScrollArea->verticalScrollBar()->maximum() == 0);
+        m_pListView->verticalScrollBar()->setHidden(m_pListView->verticalScrollBar()->maximum() == 0);
     }
-    else if(e->type() == QEvent::Leave && o == m_pScrollArea)
+    else if(e->type() == QEvent::Leave && o == m_pListView)
     {
-         m_pScrollArea->verticalScrollBar()->setHidden(true);
+         m_pListView->verticalScrollBar()->setHidden(true);
     }
     return QWidget::eventFilter(o, e);
 }
@@ -107,9 +123,18 @@ void ChatView::paintEvent(QPaintEvent *event)
 
 void ChatView::onVScrollBarMoved(int min, int max)
 {
+    Q_UNUSED(min);
+    QScrollBar *pVScrollBar = m_pListView->verticalScrollBar();
+    if(m_keepBottomOffset >= 0)
+    {
+        //头插的记录在上方，保持当前看到的消息位置不变
+        pVScrollBar->setValue(max - m_keepBottomOffset);
+        m_keepBottomOffset = -1;
+        return;
+    }
+
     if(isAppended) //添加item可能调用多次
     {
-        QScrollBar *pVScrollBar = m_pScrollArea->verticalScrollBar();
         pVScrollBar->setSliderPosition(pVScrollBar->maximum());
         //500毫秒内可能调用多次
         QTimer::singleShot(500, [this]()
@@ -119,9 +144,20 @@ void ChatView::onVScrollBarMoved(int min, int max)
     }
 }
 
+void ChatView::onVScrollValueChanged(int value)
+{
+    QScrollBar *pVScrollBar = m_pListView->verticalScrollBar();
+    //滚到顶部并且有可以滚动的内容时加载更早的记录
+    if(value == pVScrollBar->minimum() && pVScrollBar->maximum() > 0
+            && m_keepBottomOffset < 0 && !isAppended)
+    {
+        emit sig_load_more();
+    }
+}
+
 void ChatView::initStyleSheet()
 {
-//    QScrollBar *scrollBar = m_pScrollArea->verticalScrollBar();
+//    QScrollBar *scrollBar = m_pListView->verticalScrollBar();
 //    scrollBar->setStyleSheet("QScrollBar{background:transparent;}"
 //                             "QScrollBar:vertical{background:transparent;width:8px;}"
 //                             "QScrollBar::handle:vertical{background:red; border-radius:4px;min-height:20px;}"
@@ -1,32 +1,43 @@
 ﻿#ifndef CHATVIEW_H
 #define CHATVIEW_H
-#include <QScrollArea>
+#include <QListView>
 #include <QVBoxLayout>
 #include <QTimer>
+#include <memory>
+#include <vector>
 
+class ChatMsgModel;
+class ChatMsgDelegate;
+struct ChatMsgItem;
+
+//聊天记录视图，基于model/view实现，只有可见的消息会被绘制
 class ChatView : public QWidget
 {
     Q_OBJECT
 public:
     ChatView(QWidget *parent = Q_NULLPTR);
-    void appendChatItem(QWidget *item);                 //尾插
-    void prependChatItem(QWidget *item);                //头插
-    void insertChatItem(QWidget *before, QWidget *item);//中间插
+    void appendChatMsg(std::shared_ptr<ChatMsgItem> item);                 //尾插
+    void prependChatMsgs(std::vector<std::shared_ptr<ChatMsgItem>> items); //头插更早的记录
     void removeAllItem();
+    void ackChatMsgs(const QStringList& msg_ids);                          //标记消息已送达
 protected:
     bool eventFilter(QObject *o, QEvent *e) override;
     void paintEvent(QPaintEvent *event) override;
 private slots:
     void onVScrollBarMoved(int min, int max);
-
+    void onVScrollValueChanged(int value);
+signals:
+    //滚动到顶部时请求加载更早的记录
+    void sig_load_more();
 private:
     void initStyleSheet();
 private:
-    //QWidget *m_pCenterWidget;
-    QVBoxLayout *m_pVl;
-    QScrollArea *m_pScrollArea;
+    QListView *m_pListView;
+    ChatMsgModel *m_pModel;
+    ChatMsgDelegate *m_pDelegate;
     bool isAppended;
-
+    //头插前距离底部的距离，插入后恢复，保证可见内容不跳动
+    int m_keepBottomOffset;
 };
 
 #endif // CHATVIEW_H
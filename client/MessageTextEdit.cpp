@@ -1,6 +1,8 @@
 ﻿#include "MessageTextEdit.h"
 #include <QDebug>
 #include <QMessageBox>
+#include <QTextImageFormat>
+#include "thumbnailmgr.h"
 
 
 MessageTextEdit::MessageTextEdit(QWidget *parent)
@@ -11,6 +13,8 @@ MessageTextEdit::MessageTextEdit(QWidget *parent)
     this->setMaximumHeight(60);
 
 //    connect(this,SIGNAL(textChanged()),this,SLOT(textEditChanged()));
+    connect(ThumbnailMgr::GetInstance().get(), &ThumbnailMgr::sig_thumbnail_ready,
+            this, &MessageTextEdit::slot_thumbnail_ready);
 
 }
 
@@ -105,23 +109,32 @@ void MessageTextEdit::insertFileFromUrl(const QStringList &urls)
 
 void MessageTextEdit::insertImages(const QString &url)
 {
-    QImage image(url);
-    //按比例缩放图片
-    if(image.width()>120||image.height()>80)
+    //大图不在界面线程解码，先插入同样大小的占位图，缩略图在后台生成好后再替换
+    QSize max_size(EDIT_PIC_MAX_WIDTH, EDIT_PIC_MAX_HEIGHT);
+    QPixmap pix = ThumbnailMgr::GetInstance()->GetThumbnail(url, max_size);
+    QSize size = ThumbnailMgr::GetInstance()->ThumbnailSize(url, max_size);
+    QImage image;
+    if(pix.isNull())
     {
-        if(image.width()>image.height())
-        {
-          image =  image.scaledToWidth(120,Qt::SmoothTransformation);
-        }
-        else
-            image = image.scaledToHeight(80,Qt::SmoothTransformation);
+        image = QImage(size, QImage::Format_ARGB32);
+        image.fill(QColor(220, 220, 220));
+        _pending_images.insert(url);
+    }
+    else
+    {
+        image = pix.toImage();
     }
+
+    QTextDocument *document = this->document();
+    document->addResource(QTextDocument::ImageResource, QUrl(url), QVariant(image));
+    QTextImageFormat format;
+    format.setName(url);
+    format.setWidth(size.width());
+    format.setHeight(size.height());
     QTextCursor cursor = this->textCursor();
-    // QTextDocument *document = this->document();
-    // document->addResource(QTextDocument::ImageResource, QUrl(url), QVariant(image));
-    cursor.insertImage(image,url);
+    cursor.insertImage(format);
 
-    insertMsgList(mMsgList,"image",url,QPixmap::fromImage(image));
+    insertMsgList(mMsgList,"image",url,pix);
 }
 
 void MessageTextEdit::insertTextFile(const QString &url)
@@ -262,6 +275,25 @@ QString MessageTextEdit::getFileSize(qint64 size)
     return QString::number(num,'f',2) + " " + Unit;
 }
 
+void MessageTextEdit::slot_thumbnail_ready(const QString &path, const QSize &max_size)
+{
+    if(max_size != QSize(EDIT_PIC_MAX_WIDTH, EDIT_PIC_MAX_HEIGHT) || !_pending_images.contains(path))
+        return;
+
+    _pending_images.remove(path);
+    QPixmap pix = ThumbnailMgr::GetInstance()->GetThumbnail(path, max_size);
+    if(pix.isNull())
+        return;
+
+    this->document()->addResource(QTextDocument::ImageResource, QUrl(path), QVariant(pix.toImage()));
+    for(auto &msg : mMsgList)
+    {
+        if(msg.msgFlag == "image" && msg.content == path)
+            msg.pixmap = pix;
+    }
+    this->viewport()->update();
+}
+
 void MessageTextEdit::textEditChanged()
 {
     //qDebug() << "text changed!" << endl;
@@ -12,6 +12,7 @@
 #include <QFileIconProvider>
 #include <QPainter>
 #include <QVector>
+#include <QSet>
 #include "global.h"
 
 
@@ -50,10 +51,13 @@ private:
 
 private slots:
     void textEditChanged();
+    //后台缩略图生成后替换输入框里的占位图
+    void slot_thumbnail_ready(const QString &path, const QSize &max_size);
 
 private:
     QVector<MsgInfo> mMsgList;
     QVector<MsgInfo> mGetMsgList;
+    QSet<QString> _pending_images;
 };
 
 #endif // MESSAGETEXTEDIT_H
@@ -1,10 +1,6 @@
 ﻿#include "PictureBubble.h"
 #include <QLabel>
 
-
-#define PIC_MAX_WIDTH 160
-#define PIC_MAX_HEIGHT 90
-
 PictureBubble::PictureBubble(const QPixmap &picture, ChatRole role, QWidget *parent)
     :BubbleFrame(role, parent)
 {
@@ -23,11 +23,11 @@ public:
 private:
     void resetLabels();
     Ui::ApplyFriend *ui;
-    //Ѿõıǩ
+    //已经创建好的标签
     QMap<QString, ClickedLabel*> _add_labels;
     std::vector<QString> _add_label_keys;
     QPoint _label_point;
-    //ʾºѵıǩ
+    //用来在输入框显示添加新好友的标签
     QMap<QString, FriendLabel*> _friend_labels;
     std::vector<QString> _friend_label_keys;
     void addLabel(QString name);
@@ -35,23 +35,23 @@ private:
     QPoint _tip_cur_point;
     std::shared_ptr<SearchInfo> _si;
 public slots:
-    //ʾlabelǩ
+    //显示更多label标签
     void ShowMoreLabel();
-    //label»سǩչʾ
+    //输入label按下回车触发将标签加入展示栏
     void SlotLabelEnter();
-    //رգƳչʾѱǩ
+    //点击关闭，移除展示栏好友便签
     void SlotRemoveFriendLabel(QString);
-    //ͨtipʵӺͼٺѱǩ
+    //通过点击tip实现增加和减少好友便签
     void SlotChangeFriendLabelByTip(QString, ClickLbState);
-    //ı仯ʾͬʾ
+    //输入框文本变化显示不同提示
     void SlotLabelTextChange(const QString& text);
-    //
+    //输入框输入完成
     void SlotLabelEditFinished();
-   //ǩʾʾ򣬵ʾݺӺѱǩ
+   //输入标签显示提示框，点击提示框内容后添加好友便签
     void SlotAddFirendLabelByClickTip(QString text);
-    //ȷϻص
+    //处理确认回调
     void SlotApplySure();
-    //ȡص
+    //处理取消回调
     void SlotApplyCancel();
 };
 
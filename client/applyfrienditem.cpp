@@ -1,5 +1,6 @@
 #include "applyfrienditem.h"
 #include "ui_applyfrienditem.h"
+#include "avatarcache.h"
 
 ApplyFriendItem::ApplyFriendItem(QWidget *parent) :
     ListItemBase(parent), _added(false),
@@ -22,11 +23,8 @@ ApplyFriendItem::~ApplyFriendItem()
 void ApplyFriendItem::SetInfo(std::shared_ptr<ApplyInfo> apply_info)
 {
     _apply_info = apply_info;
-    // 加载图片
-    QPixmap pixmap(_apply_info->_icon);
-
-    // 设置图片自动缩放
-    ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    // 从头像缓存加载图片，缓存未命中时先显示占位图
+    AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, _apply_info->_icon);
     ui->icon_lb->setScaledContents(true);
 
     ui->user_name_lb->setText(_apply_info->_name);
@@ -0,0 +1,162 @@
+#include "avatarcache.h"
+#include <QLabel>
+#include <QPainter>
+#include <QImageReader>
+#include <QRunnable>
+#include <QPointer>
+#include <QDebug>
+#include <functional>
+
+//后台解码头像的任务，只处理QImage，QPixmap必须回到界面线程再创建
+class AvatarLoadTask : public QRunnable
+{
+public:
+    AvatarLoadTask(AvatarCache* cache, const QString& key, const QString& icon,
+                   const QSize& size, qreal dpr, std::function<void(QString, QImage, qreal)> done)
+        :_cache(cache), _key(key), _icon(icon), _size(size), _dpr(dpr), _done(done) {}
+
+    void run() override {
+        QSize pixel_size = _size * _dpr;
+        QImageReader reader(_icon);
+        //原图比目标大很多时让解码器直接按两倍目标大小解码，再平滑缩放到目标大小
+        QSize src_size = reader.size();
+        if(src_size.isValid() && src_size.width() > pixel_size.width() * 2
+                && src_size.height() > pixel_size.height() * 2){
+            reader.setScaledSize(src_size.scaled(pixel_size * 2, Qt::KeepAspectRatio));
+        }
+
+        QImage image = reader.read();
+        if(!image.isNull()){
+            image = image.scaled(pixel_size, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+
+        auto done = _done;
+        auto key = _key;
+        auto dpr = _dpr;
+        QMetaObject::invokeMethod(_cache, [done, key, image, dpr](){
+            done(key, image, dpr);
+        }, Qt::QueuedConnection);
+    }
+private:
+    AvatarCache* _cache;
+    QString _key;
+    QString _icon;
+    QSize _size;
+    qreal _dpr;
+    std::function<void(QString, QImage, qreal)> _done;
+};
+
+AvatarCache::AvatarCache()
+{
+    _cache.setMaxCost(AVATAR_CACHE_MAX_KB);
+    //头像都很小，两个线程足够，不和其他任务抢全局线程池
+    _pool.setMaxThreadCount(AVATAR_LOAD_THREADS);
+}
+
+AvatarCache::~AvatarCache()
+{
+    _pool.waitForDone();
+}
+
+QString AvatarCache::MakeKey(const QString &icon, const QSize &size, qreal dpr) const
+{
+    return QString("%1|%2x%3@%4").arg(icon).arg(size.width()).arg(size.height()).arg(dpr);
+}
+
+QPixmap AvatarCache::Placeholder(const QSize &size, qreal dpr)
+{
+    QString key = MakeKey(QString(), size, dpr);
+    auto iter = _placeholders.find(key);
+    if(iter != _placeholders.end()){
+        return iter.value();
+    }
+
+    QPixmap pix(size * dpr);
+    pix.setDevicePixelRatio(dpr);
+    pix.fill(Qt::transparent);
+    QPainter painter(&pix);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(220, 220, 220));
+    painter.drawRoundedRect(QRect(QPoint(0, 0), size), 4, 4);
+    painter.end();
+
+    _placeholders.insert(key, pix);
+    return pix;
+}
+
+QPixmap AvatarCache::GetAvatar(const QString &icon, const QSize &size, qreal dpr)
+{
+    QString key = MakeKey(icon, size, dpr);
+    QPixmap* pix = _cache.object(key);
+    if(pix != nullptr){
+        return pix->isNull() ? Placeholder(size, dpr) : *pix;
+    }
+
+    LoadAsync(key, icon, size, dpr);
+    return Placeholder(size, dpr);
+}
+
+void AvatarCache::LoadAsync(const QString &key, const QString &icon, const QSize &size, qreal dpr)
+{
+    if(_loading.contains(key)){
+        return;
+    }
+
+    _loading.insert(key);
+    auto task = new AvatarLoadTask(this, key, icon, size, dpr,
+        [this](QString key, QImage image, qreal dpr){
+        slot_avatar_loaded(key, image, dpr);
+    });
+    _pool.start(task);
+}
+
+void AvatarCache::slot_avatar_loaded(const QString &key, const QImage &image, qreal dpr)
+{
+    _loading.remove(key);
+    QPixmap* pix = nullptr;
+    if(image.isNull()){
+        //解码失败的头像缓存一个空图，之后直接返回占位图，避免每次绘制都重新加载
+        qDebug() << "load avatar failed, key is " << key;
+        pix = new QPixmap();
+    }else{
+        pix = new QPixmap(QPixmap::fromImage(image));
+        pix->setDevicePixelRatio(dpr);
+    }
+
+    int cost = qMax(1, pix->width() * pix->height() * 4 / 1024);
+    _cache.insert(key, pix, cost);
+    emit sig_avatar_ready(key);
+}
+
+void AvatarCache::SetAvatar(QLabel *label, const QString &icon)
+{
+    QSize size = label->size();
+    qreal dpr = label->devicePixelRatioF();
+    QString key = MakeKey(icon, size, dpr);
+    //记下label当前要显示的头像，旧的加载结果回来时不能覆盖新头像
+    label->setProperty("avatar_key", key);
+    QPixmap pix = GetAvatar(icon, size, dpr);
+    label->setPixmap(pix);
+    if(_cache.contains(key)){
+        return;
+    }
+
+    QPointer<QLabel> guard(label);
+    auto conn = std::make_shared<QMetaObject::Connection>();
+    *conn = connect(this, &AvatarCache::sig_avatar_ready, label, [this, guard, key, conn](const QString& ready_key){
+        if(ready_key != key){
+            return;
+        }
+
+        QObject::disconnect(*conn);
+        if(guard.isNull() || guard->property("avatar_key").toString() != key){
+            return;
+        }
+
+        QPixmap* pix = _cache.object(key);
+        if(pix != nullptr && !pix->isNull()){
+            guard->setPixmap(*pix);
+        }
+    });
+}
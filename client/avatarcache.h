@@ -0,0 +1,43 @@
+#ifndef AVATARCACHE_H
+#define AVATARCACHE_H
+#include "singleton.h"
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QSet>
+#include <QPixmap>
+#include <QImage>
+#include <QThreadPool>
+
+class QLabel;
+
+//进程内共享的头像缓存，按(头像路径, 目标大小, 设备像素比)缓存缩放好的头像
+//解码和平滑缩放放到后台线程做，没加载好之前先返回占位图，加载完成后发出sig_avatar_ready
+//缓存按像素占用的内存计费，超过AVATAR_CACHE_MAX_KB后淘汰最久没用的头像
+class AvatarCache : public QObject, public Singleton<AvatarCache>
+{
+    Q_OBJECT
+public:
+    ~AvatarCache();
+    //取头像，未命中时异步加载并返回占位图，只能在界面线程调用
+    QPixmap GetAvatar(const QString& icon, const QSize& size, qreal dpr);
+    //给label设置头像，异步加载完成后自动替换占位图
+    void SetAvatar(QLabel* label, const QString& icon);
+private:
+    friend class Singleton<AvatarCache>;
+    AvatarCache();
+    QString MakeKey(const QString& icon, const QSize& size, qreal dpr) const;
+    QPixmap Placeholder(const QSize& size, qreal dpr);
+    void LoadAsync(const QString& key, const QString& icon, const QSize& size, qreal dpr);
+    void slot_avatar_loaded(const QString& key, const QImage& image, qreal dpr);
+
+    QCache<QString, QPixmap> _cache;
+    QHash<QString, QPixmap> _placeholders;
+    //正在加载的头像，避免同一个头像重复提交
+    QSet<QString> _loading;
+    QThreadPool _pool;
+signals:
+    void sig_avatar_ready(const QString& key);
+};
+
+#endif // AVATARCACHE_H
@@ -1,31 +1,26 @@
 #include "chatdialog.h"
 #include "ui_chatdialog.h"
 #include <QAction>
-#include "chatuserwid.h"
 #include <QDebug>
 #include <vector>
-#include <QRandomGenerator>
-#include "loadingdlg.h"
 #include "global.h"
-#include "ChatItemBase.h"
-#include "TextBubble.h"
-#include "PictureBubble.h"
 #include "MessageTextEdit.h"
+#include <QMouseEvent>
 #include "chatuserlist.h"
-#include "grouptipitem.h"
-#include "invaliditem.h"
-#include "conuseritem.h"
-#include "lineitem.h"
 #include "tcpmgr.h"
 #include "usermgr.h"
+#include "avatarcache.h"
+#include "msgdb.h"
 
 
 ChatDialog::ChatDialog(QWidget *parent) :
     QDialog(parent),
-    ui(new Ui::ChatDialog),_b_loading(false),_mode(ChatUIMode::ChatMode),
+    ui(new Ui::ChatDialog),_mode(ChatUIMode::ChatMode),
     _state(ChatUIMode::ChatMode),_last_widget(nullptr),_cur_chat_uid(0)
 {
     ui->setupUi(this);
+    //打开当前账号的本地聊天记录库
+    MsgDb::GetInstance()->Open(UserMgr::GetInstance()->GetUid());
 
     ui->add_btn->SetState("normal","hover","press");
     ui->add_btn->setProperty("state","normal");
@@ -63,14 +58,10 @@ ChatDialog::ChatDialog(QWidget *parent) :
 
     ui->search_edit->SetMaxLength(15);
 
-    //连接加载信号和槽
-    connect(ui->chat_user_list, &ChatUserList::sig_loading_chat_user, this, &ChatDialog::slot_loading_chat_user);
     addChatUserList();
     //模拟加载自己头像
     QString head_icon = UserMgr::GetInstance()->GetIcon();
-    QPixmap pixmap(head_icon); // 加载图片
-    QPixmap scaledPixmap = pixmap.scaled( ui->side_head_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation); // 将图片缩放到label的大小
-    ui->side_head_lb->setPixmap(scaledPixmap); // 将缩放后的图片设置到QLabel上
+    AvatarCache::GetInstance()->SetAvatar(ui->side_head_lb, head_icon); // 从头像缓存加载并缩放到label的大小
     ui->side_head_lb->setScaledContents(true); // 设置QLabel自动缩放图片内容以适应大小
 
     ui->side_chat_lb->setProperty("state","normal");
@@ -100,10 +91,6 @@ ChatDialog::ChatDialog(QWidget *parent) :
     //更新聊天界面信息
     SetSelectChatPage();
 
-    //连接加载联系人的信号和槽函数
-    connect(ui->con_user_list, &ContactUserList::sig_loading_contact_user,
-            this, &ChatDialog::slot_loading_contact_user);
-
     //连接联系人页面点击好友申请条目的信号
     connect(ui->con_user_list, &ContactUserList::sig_switch_apply_friend_page,
             this,&ChatDialog::slot_switch_apply_friend_page);
@@ -140,13 +127,21 @@ ChatDialog::ChatDialog(QWidget *parent) :
             &ChatDialog::slot_jump_chat_item_from_infopage);
 
     //连接聊天列表点击信号
-    connect(ui->chat_user_list, &QListWidget::itemClicked, this, &ChatDialog::slot_item_clicked);
+    connect(ui->chat_user_list, &ChatUserList::sig_user_clicked, this, &ChatDialog::slot_chat_user_clicked);
 
     //连接对端消息通知
     connect(TcpMgr::GetInstance().get(), &TcpMgr::sig_text_chat_msg,
             this, &ChatDialog::slot_text_chat_msg);
 
     connect(ui->chat_page, &ChatPage::sig_append_send_chat_msg, this, &ChatDialog::slot_append_send_chat_msg);
+
+    //连接服务器对已发送消息的确认
+    connect(TcpMgr::GetInstance().get(), &TcpMgr::sig_text_chat_ack,
+            this, &ChatDialog::slot_text_chat_ack);
+
+    //连接迁移失败后的断开提示
+    connect(TcpMgr::GetInstance().get(), &TcpMgr::sig_connection_lost,
+            this, &ChatDialog::slot_connection_lost);
 }
 
 ChatDialog::~ChatDialog()
@@ -154,74 +149,34 @@ ChatDialog::~ChatDialog()
     delete ui;
 }
 
-void ChatDialog::slot_item_clicked(QListWidgetItem *item)
+void ChatDialog::slot_chat_user_clicked(std::shared_ptr<UserInfo> user_info)
 {
-    QWidget *widget = ui->chat_user_list->itemWidget(item); // 获取自定义widget对象
-    if(!widget){
-        qDebug()<< "slot item clicked widget is nullptr";
-        return;
-    }
-
-    // 对自定义widget进行操作， 将item 转化为基类ListItemBase
-    ListItemBase *customItem = qobject_cast<ListItemBase*>(widget);
-    if(!customItem){
-        qDebug()<< "slot item clicked widget is nullptr";
-        return;
-    }
-
-    auto itemType = customItem->GetItemType();
-    if(itemType == ListItemType::INVALID_ITEM
-            || itemType == ListItemType::GROUP_TIP_ITEM){
-        qDebug()<< "slot invalid item clicked ";
-        return;
-    }
-
-
-   if(itemType == ListItemType::CHAT_USER_ITEM){
-       // 创建对话框，提示用户
-       qDebug()<< "contact user item clicked ";
-
-       auto chat_wid = qobject_cast<ChatUserWid*>(customItem);
-       auto user_info = chat_wid->GetUserInfo();
-       //跳转到聊天界面
-       ui->chat_page->SetUserInfo(user_info);
-       _cur_chat_uid = user_info->_uid;
-       return;
-   }
+    qDebug()<< "chat user item clicked ";
+    //跳转到聊天界面
+    ui->chat_page->SetUserInfo(user_info);
+    _cur_chat_uid = user_info->_uid;
 }
 
 void ChatDialog::slot_text_chat_msg(std::shared_ptr<TextChatMsg> msg)
 {
-    auto find_iter = _chat_items_added.find(msg->_from_uid);
-    if(find_iter != _chat_items_added.end()){
+    if(ui->chat_user_list->HasChatUser(msg->_from_uid)){
         qDebug() << "set chat item msg, uid is " << msg->_from_uid;
-        QWidget *widget = ui->chat_user_list->itemWidget(find_iter.value());
-        auto chat_wid = qobject_cast<ChatUserWid*>(widget);
-        if(!chat_wid){
-            return;
-        }
-        chat_wid->updateLastMsg(msg->_chat_msgs);
+        ui->chat_user_list->UpdateLastMsg(msg->_from_uid, msg->_chat_msgs);
         //更新当前聊天页面记录
         UpdateChatMsg(msg->_chat_msgs);
         UserMgr::GetInstance()->AppendFriendChatMsg(msg->_from_uid,msg->_chat_msgs);
         return;
     }
 
-    //如果没找到，则创建新的插入listwidget
-
-    auto* chat_user_wid = new ChatUserWid();
+    //如果没找到，则插入到聊天列表最前面
     //查询好友信息
     auto fi_ptr = UserMgr::GetInstance()->GetFriendById(msg->_from_uid);
-    chat_user_wid->SetInfo(fi_ptr);
-    QListWidgetItem* item = new QListWidgetItem;
-    //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-    item->setSizeHint(chat_user_wid->sizeHint());
-    chat_user_wid->updateLastMsg(msg->_chat_msgs);
-     UserMgr::GetInstance()->AppendFriendChatMsg(msg->_from_uid,msg->_chat_msgs);
-    ui->chat_user_list->insertItem(0, item);
-    ui->chat_user_list->setItemWidget(item, chat_user_wid);
-    _chat_items_added.insert(msg->_from_uid, item);
-
+    if(fi_ptr == nullptr){
+        return;
+    }
+    ui->chat_user_list->AddChatUser(std::make_shared<UserInfo>(fi_ptr), true);
+    ui->chat_user_list->UpdateLastMsg(msg->_from_uid, msg->_chat_msgs);
+    UserMgr::GetInstance()->AppendFriendChatMsg(msg->_from_uid,msg->_chat_msgs);
 }
 
 
@@ -273,40 +228,16 @@ void ChatDialog::slot_append_send_chat_msg(std::shared_ptr<TextChatData> msgdata
         return;
     }
 
-    auto find_iter = _chat_items_added.find(_cur_chat_uid);
-    if (find_iter == _chat_items_added.end()) {
-        return;
-    }
-
-    //转为widget
-    QWidget* widget = ui->chat_user_list->itemWidget(find_iter.value());
-    if (!widget) {
-        return;
-    }
-
-    //判断转化为自定义的widget
-    // 对自定义widget进行操作， 将item 转化为基类ListItemBase
-    ListItemBase* customItem = qobject_cast<ListItemBase*>(widget);
-    if (!customItem) {
-        qDebug() << "qobject_cast<ListItemBase*>(widget) is nullptr";
-        return;
-    }
-
-    auto itemType = customItem->GetItemType();
-    if (itemType == CHAT_USER_ITEM) {
-        auto con_item = qobject_cast<ChatUserWid*>(customItem);
-        if (!con_item) {
-            return;
-        }
+    std::vector<std::shared_ptr<TextChatData>> msg_vec;
+    msg_vec.push_back(msgdata);
+    UserMgr::GetInstance()->AppendFriendChatMsg(_cur_chat_uid,msg_vec);
+}
 
-        //设置信息
-        auto user_info = con_item->GetUserInfo();
-        user_info->_chat_msgs.push_back(msgdata);
-        std::vector<std::shared_ptr<TextChatData>> msg_vec;
-        msg_vec.push_back(msgdata);
-        UserMgr::GetInstance()->AppendFriendChatMsg(_cur_chat_uid,msg_vec);
-        return;
-    }
+void ChatDialog::slot_text_chat_ack(std::shared_ptr<TextChatAck> ack)
+{
+    //本地库记下服务器序号和时间，当前页面上的消息去掉发送中标记
+    MsgDb::GetInstance()->AckMsgs(ack->_acks);
+    ui->chat_page->AckChatMsgs(ack->_acks);
 }
 
 void ChatDialog::AddLBGroup(StateWidget* lb)
@@ -319,71 +250,14 @@ void ChatDialog::AddLBGroup(StateWidget* lb)
 void ChatDialog::addChatUserList()
 {
     //先按照好友列表加载聊天记录，等以后客户端实现聊天记录数据库之后再按照最后信息排序
-    auto friend_list = UserMgr::GetInstance()->GetChatListPerPage();
-    if (friend_list.empty() == false) {
-        for(auto & friend_ele : friend_list){
-            auto find_iter = _chat_items_added.find(friend_ele->_uid);
-            if(find_iter != _chat_items_added.end()){
-                continue;
-            }
-            auto *chat_user_wid = new ChatUserWid();
-            auto user_info = std::make_shared<UserInfo>(friend_ele);
-            chat_user_wid->SetInfo(user_info);
-            QListWidgetItem *item = new QListWidgetItem;
-            //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-            item->setSizeHint(chat_user_wid->sizeHint());
-            ui->chat_user_list->addItem(item);
-            ui->chat_user_list->setItemWidget(item, chat_user_wid);
-            _chat_items_added.insert(friend_ele->_uid, item);
-        }
-
-        //更新已加载条目
-        UserMgr::GetInstance()->UpdateChatLoadedCount();
-    }
-
-    //模拟测试条目
-    // 创建QListWidgetItem，并设置自定义的widget
-    for(int i = 0; i < 13; i++){
-        int randomValue = QRandomGenerator::global()->bounded(100); // 生成0到99之间的随机整数
-        int str_i = randomValue%strs.size();
-        int head_i = randomValue%heads.size();
-        int name_i = randomValue%names.size();
-
-        auto *chat_user_wid = new ChatUserWid();
-        auto user_info = std::make_shared<UserInfo>(0,names[name_i],
-                                                    names[name_i],heads[head_i],0,strs[str_i]);
-        chat_user_wid->SetInfo(user_info);
-        QListWidgetItem *item = new QListWidgetItem;
-        //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-        item->setSizeHint(chat_user_wid->sizeHint());
-        ui->chat_user_list->addItem(item);
-        ui->chat_user_list->setItemWidget(item, chat_user_wid);
-    }
-
-}
-
-void ChatDialog::loadMoreChatUser() {
-    auto friend_list = UserMgr::GetInstance()->GetChatListPerPage();
-    if (friend_list.empty() == false) {
-        for(auto & friend_ele : friend_list){
-            auto find_iter = _chat_items_added.find(friend_ele->_uid);
-            if(find_iter != _chat_items_added.end()){
-                continue;
-            }
-            auto *chat_user_wid = new ChatUserWid();
-            auto user_info = std::make_shared<UserInfo>(friend_ele);
-            chat_user_wid->SetInfo(user_info);
-            QListWidgetItem *item = new QListWidgetItem;
-            //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-            item->setSizeHint(chat_user_wid->sizeHint());
-            ui->chat_user_list->addItem(item);
-            ui->chat_user_list->setItemWidget(item, chat_user_wid);
-            _chat_items_added.insert(friend_ele->_uid, item);
-        }
-
-        //更新已加载条目
-        UserMgr::GetInstance()->UpdateChatLoadedCount();
-    }
+    //列表基于model/view，全部好友一次加载，视图只绘制可见的条目
+    auto friend_list = UserMgr::GetInstance()->GetFriendList();
+    std::vector<std::shared_ptr<UserInfo>> user_infos;
+    user_infos.reserve(friend_list.size());
+    for(auto & friend_ele : friend_list){
+        user_infos.push_back(std::make_shared<UserInfo>(friend_ele));
+    }
+    ui->chat_user_list->AddChatUsers(user_infos);
 }
 
 
@@ -398,26 +272,6 @@ void ChatDialog::ClearLabelState(StateWidget *lb)
     }
 }
 
-void ChatDialog::loadMoreConUser()
-{
-    auto friend_list = UserMgr::GetInstance()->GetConListPerPage();
-    if (friend_list.empty() == false) {
-        for(auto & friend_ele : friend_list){
-            auto *chat_user_wid = new ConUserItem();
-            chat_user_wid->SetInfo(friend_ele->_uid,friend_ele->_name,
-                                   friend_ele->_icon);
-            QListWidgetItem *item = new QListWidgetItem;
-            //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-            item->setSizeHint(chat_user_wid->sizeHint());
-            ui->con_user_list->addItem(item);
-            ui->con_user_list->setItemWidget(item, chat_user_wid);
-        }
-
-        //更新已加载条目
-        UserMgr::GetInstance()->UpdateContactLoadedCount();
-    }
-}
-
 void ChatDialog::SetSelectChatItem(int uid)
 {
     if(ui->chat_user_list->count() <= 0){
@@ -425,37 +279,22 @@ void ChatDialog::SetSelectChatItem(int uid)
     }
 
     if(uid == 0){
-        ui->chat_user_list->setCurrentRow(0);
-        QListWidgetItem *firstItem = ui->chat_user_list->item(0);
-        if(!firstItem){
-            return;
-        }
-
-        //转为widget
-        QWidget *widget = ui->chat_user_list->itemWidget(firstItem);
-        if(!widget){
-            return;
-        }
-
-        auto con_item = qobject_cast<ChatUserWid*>(widget);
-        if(!con_item){
+        ui->chat_user_list->SetCurrentUser(0);
+        auto user_info = ui->chat_user_list->GetUserInfoAt(0);
+        if(!user_info){
             return;
         }
 
-        _cur_chat_uid = con_item->GetUserInfo()->_uid;
-
+        _cur_chat_uid = user_info->_uid;
         return;
     }
 
-    auto find_iter = _chat_items_added.find(uid);
-    if(find_iter == _chat_items_added.end()){
+    if(!ui->chat_user_list->SetCurrentUser(uid)){
         qDebug() << "uid " <<uid<< " not found, set curent row 0";
-        ui->chat_user_list->setCurrentRow(0);
+        ui->chat_user_list->SetCurrentUser(0);
         return;
     }
 
-    ui->chat_user_list->setCurrentItem(find_iter.value());
-
     _cur_chat_uid = uid;
 }
 
@@ -465,58 +304,14 @@ void ChatDialog::SetSelectChatPage(int uid)
         return;
     }
 
-    if (uid == 0) {
-       auto item = ui->chat_user_list->item(0);
-       //转为widget
-       QWidget* widget = ui->chat_user_list->itemWidget(item);
-       if (!widget) {
-           return;
-       }
-
-       auto con_item = qobject_cast<ChatUserWid*>(widget);
-       if (!con_item) {
-           return;
-       }
-
-       //设置信息
-       auto user_info = con_item->GetUserInfo();
-       ui->chat_page->SetUserInfo(user_info);
-       return;
-    }
-
-    auto find_iter = _chat_items_added.find(uid);
-    if(find_iter == _chat_items_added.end()){
-        return;
-    }
-
-    //转为widget
-    QWidget *widget = ui->chat_user_list->itemWidget(find_iter.value());
-    if(!widget){
-        return;
-    }
-
-    //判断转化为自定义的widget
-    // 对自定义widget进行操作， 将item 转化为基类ListItemBase
-    ListItemBase *customItem = qobject_cast<ListItemBase*>(widget);
-    if(!customItem){
-        qDebug()<< "qobject_cast<ListItemBase*>(widget) is nullptr";
-        return;
-    }
-
-    auto itemType = customItem->GetItemType();
-    if(itemType == CHAT_USER_ITEM){
-        auto con_item = qobject_cast<ChatUserWid*>(customItem);
-        if(!con_item){
-            return;
-        }
-
-        //设置信息
-        auto user_info = con_item->GetUserInfo();
-        ui->chat_page->SetUserInfo(user_info);
-
+    auto user_info = uid == 0 ? ui->chat_user_list->GetUserInfoAt(0)
+                              : ui->chat_user_list->GetUserInfo(uid);
+    if(!user_info){
         return;
     }
 
+    //设置信息
+    ui->chat_page->SetUserInfo(user_info);
 }
 
 
@@ -546,24 +341,6 @@ void ChatDialog::ShowSearch(bool bsearch)
     }
 }
 
-void ChatDialog::slot_loading_chat_user()
-{
-    if(_b_loading){
-        return;
-    }
-
-    _b_loading = true;
-    LoadingDlg *loadingDialog = new LoadingDlg(this);
-    loadingDialog->setModal(true);
-    loadingDialog->show();
-    qDebug() << "add new data to list.....";
-    loadMoreChatUser();
-    // 加载完成后关闭对话框
-    loadingDialog->deleteLater();
-
-    _b_loading = false;
-}
-
 void ChatDialog::slot_side_chat()
 {
     qDebug()<< "receive side chat clicked";
@@ -602,25 +379,6 @@ void ChatDialog::slot_focus_out()
     ShowSearch(false);
 }
 
-void ChatDialog::slot_loading_contact_user()
-{
-    qDebug() << "slot loading contact user";
-    if(_b_loading){
-        return;
-    }
-
-    _b_loading = true;
-    LoadingDlg *loadingDialog = new LoadingDlg(this);
-    loadingDialog->setModal(true);
-    loadingDialog->show();
-    qDebug() << "add new data to list.....";
-    loadMoreConUser();
-    // 加载完成后关闭对话框
-    loadingDialog->deleteLater();
-
-    _b_loading = false;
-}
-
 void ChatDialog::slot_switch_apply_friend_page()
 {
     qDebug()<<"receive switch apply friend page sig";
@@ -670,21 +428,7 @@ void ChatDialog::slot_add_auth_friend(std::shared_ptr<AuthInfo> auth_info) {
     }
 
     UserMgr::GetInstance()->AddFriend(auth_info);
-
-    int randomValue = QRandomGenerator::global()->bounded(100); // 生成0到99之间的随机整数
-    int str_i = randomValue % strs.size();
-    int head_i = randomValue % heads.size();
-    int name_i = randomValue % names.size();
-
-    auto* chat_user_wid = new ChatUserWid();
-    auto user_info = std::make_shared<UserInfo>(auth_info);
-    chat_user_wid->SetInfo(user_info);
-    QListWidgetItem* item = new QListWidgetItem;
-    //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-    item->setSizeHint(chat_user_wid->sizeHint());
-    ui->chat_user_list->insertItem(0, item);
-    ui->chat_user_list->setItemWidget(item, chat_user_wid);
-    _chat_items_added.insert(auth_info->_uid, item);
+    ui->chat_user_list->AddChatUser(std::make_shared<UserInfo>(auth_info), true);
 }
 
 void ChatDialog::slot_auth_rsp(std::shared_ptr<AuthRsp> auth_rsp)
@@ -699,29 +443,15 @@ void ChatDialog::slot_auth_rsp(std::shared_ptr<AuthRsp> auth_rsp)
     }
 
     UserMgr::GetInstance()->AddFriend(auth_rsp);
-    int randomValue = QRandomGenerator::global()->bounded(100); // 生成0到99之间的随机整数
-    int str_i = randomValue % strs.size();
-    int head_i = randomValue % heads.size();
-    int name_i = randomValue % names.size();
-
-    auto* chat_user_wid = new ChatUserWid();
-    auto user_info = std::make_shared<UserInfo>(auth_rsp);
-    chat_user_wid->SetInfo(user_info);
-    QListWidgetItem* item = new QListWidgetItem;
-    //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-    item->setSizeHint(chat_user_wid->sizeHint());
-    ui->chat_user_list->insertItem(0, item);
-    ui->chat_user_list->setItemWidget(item, chat_user_wid);
-    _chat_items_added.insert(auth_rsp->_uid, item);
+    ui->chat_user_list->AddChatUser(std::make_shared<UserInfo>(auth_rsp), true);
 }
 
 void ChatDialog::slot_jump_chat_item(std::shared_ptr<SearchInfo> si)
 {
     qDebug() << "slot jump chat item " << endl;
-    auto find_iter = _chat_items_added.find(si->_uid);
-    if(find_iter != _chat_items_added.end()){
+    if(ui->chat_user_list->HasChatUser(si->_uid)){
         qDebug() << "jump to chat item , uid is " << si->_uid;
-        ui->chat_user_list->scrollToItem(find_iter.value());
+        ui->chat_user_list->ScrollToUser(si->_uid);
         ui->side_chat_lb->SetSelected(true);
         SetSelectChatItem(si->_uid);
         //更新聊天界面信息
@@ -730,18 +460,8 @@ void ChatDialog::slot_jump_chat_item(std::shared_ptr<SearchInfo> si)
         return;
     }
 
-    //如果没找到，则创建新的插入listwidget
-
-    auto* chat_user_wid = new ChatUserWid();
-    auto user_info = std::make_shared<UserInfo>(si);
-    chat_user_wid->SetInfo(user_info);
-    QListWidgetItem* item = new QListWidgetItem;
-    //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-    item->setSizeHint(chat_user_wid->sizeHint());
-    ui->chat_user_list->insertItem(0, item);
-    ui->chat_user_list->setItemWidget(item, chat_user_wid);
-
-    _chat_items_added.insert(si->_uid, item);
+    //如果没找到，则插入到聊天列表最前面
+    ui->chat_user_list->AddChatUser(std::make_shared<UserInfo>(si), true);
 
     ui->side_chat_lb->SetSelected(true);
     SetSelectChatItem(si->_uid);
@@ -754,10 +474,9 @@ void ChatDialog::slot_jump_chat_item(std::shared_ptr<SearchInfo> si)
 void ChatDialog::slot_jump_chat_item_from_infopage(std::shared_ptr<UserInfo> user_info)
 {
     qDebug() << "slot jump chat item " << endl;
-    auto find_iter = _chat_items_added.find(user_info->_uid);
-    if(find_iter != _chat_items_added.end()){
+    if(ui->chat_user_list->HasChatUser(user_info->_uid)){
         qDebug() << "jump to chat item , uid is " << user_info->_uid;
-        ui->chat_user_list->scrollToItem(find_iter.value());
+        ui->chat_user_list->ScrollToUser(user_info->_uid);
         ui->side_chat_lb->SetSelected(true);
         SetSelectChatItem(user_info->_uid);
         //更新聊天界面信息
@@ -766,17 +485,8 @@ void ChatDialog::slot_jump_chat_item_from_infopage(std::shared_ptr<UserInfo> use
         return;
     }
 
-    //如果没找到，则创建新的插入listwidget
-
-    auto* chat_user_wid = new ChatUserWid();
-    chat_user_wid->SetInfo(user_info);
-    QListWidgetItem* item = new QListWidgetItem;
-    //qDebug()<<"chat_user_wid sizeHint is " << chat_user_wid->sizeHint();
-    item->setSizeHint(chat_user_wid->sizeHint());
-    ui->chat_user_list->insertItem(0, item);
-    ui->chat_user_list->setItemWidget(item, chat_user_wid);
-
-    _chat_items_added.insert(user_info->_uid, item);
+    //如果没找到，则插入到聊天列表最前面
+    ui->chat_user_list->AddChatUser(user_info, true);
 
     ui->side_chat_lb->SetSelected(true);
     SetSelectChatItem(user_info->_uid);
@@ -785,3 +495,8 @@ void ChatDialog::slot_jump_chat_item_from_infopage(std::shared_ptr<UserInfo> use
     slot_side_chat();
 }
 
+void ChatDialog::slot_connection_lost()
+{
+    qDebug() << "connection lost";
+    ui->chat_page->SetDisconnected(true);
+}
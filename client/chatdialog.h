@@ -9,7 +9,6 @@
 #include "statewidget.h"
 #include <memory>
 #include "userdata.h"
-#include <QListWidgetItem>
 
 namespace Ui {
 class ChatDialog;
@@ -32,28 +31,21 @@ protected:
 private:
     void AddLBGroup(StateWidget* lb);
     void addChatUserList();
-    void loadMoreChatUser();
     void ClearLabelState(StateWidget* lb);
-    void loadMoreConUser();
     void SetSelectChatItem(int uid = 0);
     void SetSelectChatPage(int uid = 0);
     Ui::ChatDialog *ui;
-    bool _b_loading;
     QList<StateWidget*> _lb_list;
     void ShowSearch(bool bsearch = false);
     ChatUIMode _mode;
     ChatUIMode _state;
     QWidget* _last_widget;
-    //todo...
-    QMap<int, QListWidgetItem*> _chat_items_added;
     int _cur_chat_uid;
 public slots:
-    void slot_loading_chat_user();
     void slot_side_chat();
     void slot_side_contact();
     void slot_text_changed(const QString & str);
     void slot_focus_out();
-    void slot_loading_contact_user();
     void slot_switch_apply_friend_page();
     void slot_friend_info_page(std::shared_ptr<UserInfo> user_info);
     void slot_show_search(bool show);
@@ -62,9 +54,11 @@ public slots:
     void slot_auth_rsp(std::shared_ptr<AuthRsp> auth_rsp);
     void slot_jump_chat_item(std::shared_ptr<SearchInfo> si);
     void slot_jump_chat_item_from_infopage(std::shared_ptr<UserInfo> ui);
-    void slot_item_clicked(QListWidgetItem *item);
+    void slot_chat_user_clicked(std::shared_ptr<UserInfo> user_info);
     void slot_text_chat_msg(std::shared_ptr<TextChatMsg> msg);
     void slot_append_send_chat_msg(std::shared_ptr<TextChatData> msgdata);
+    void slot_text_chat_ack(std::shared_ptr<TextChatAck> ack);
+    void slot_connection_lost();
 private slots:
 
 };
@@ -2,19 +2,21 @@
 #include "ui_chatpage.h"
 #include <QStyleOption>
 #include <QPainter>
-#include "ChatItemBase.h"
-#include "TextBubble.h"
-#include "PictureBubble.h"
+#include "ChatMsgModel.h"
 #include "applyfrienditem.h"
 #include "usermgr.h"
 #include <QJsonArray>
 #include <QJsonObject>
 #include "tcpmgr.h"
 #include <QUuid>
+#include "msgdb.h"
 
 ChatPage::ChatPage(QWidget *parent) :
     QWidget(parent),
-    ui(new Ui::ChatPage)
+    ui(new Ui::ChatPage),
+    _history_cursor(0),
+    _b_history_fin(true),
+    _b_disconnected(false)
 {
     ui->setupUi(this);
     //设置按钮样式
@@ -25,6 +27,8 @@ ChatPage::ChatPage(QWidget *parent) :
     ui->emo_lb->SetState("normal","hover","press","normal","hover","press");
     ui->file_lb->SetState("normal","hover","press","normal","hover","press");
 
+    //滚动到顶部时加载更早的聊天记录
+    connect(ui->chat_data_list, &ChatView::sig_load_more, this, &ChatPage::slot_load_more);
 }
 
 ChatPage::~ChatPage()
@@ -36,45 +40,85 @@ void ChatPage::SetUserInfo(std::shared_ptr<UserInfo> user_info)
 {
     _user_info = user_info;
     //设置ui界面
-    ui->title_lb->setText(_user_info->_name);
+    updateTitle();
     ui->chat_data_list->removeAllItem();
-    for(auto & msg : user_info->_chat_msgs){
+    //只从本地库加载最近一页，更早的记录滚动到顶部时再加载
+    auto msgs = MsgDb::GetInstance()->LoadMsgs(user_info->_uid, 0, CHAT_HISTORY_PAGE, _history_cursor);
+    _b_history_fin = static_cast<int>(msgs.size()) < CHAT_HISTORY_PAGE;
+    for(auto& msg : msgs){
         AppendChatMsg(msg);
     }
 }
 
-void ChatPage::AppendChatMsg(std::shared_ptr<TextChatData> msg)
+void ChatPage::SetDisconnected(bool disconnected)
+{
+    _b_disconnected = disconnected;
+    ui->send_btn->setEnabled(!disconnected);
+    updateTitle();
+}
+
+void ChatPage::updateTitle()
+{
+    QString title = _user_info ? _user_info->_name : QString();
+    if(_b_disconnected){
+        title += tr("（连接已断开）");
+    }
+    ui->title_lb->setText(title);
+}
+
+std::shared_ptr<ChatMsgItem> ChatPage::makeMsgItem(std::shared_ptr<TextChatData> msg)
 {
     auto self_info = UserMgr::GetInstance()->GetUserInfo();
-    ChatRole role;
-    //todo... 添加聊天显示
     if (msg->_from_uid == self_info->_uid) {
-        role = ChatRole::Self;
-        ChatItemBase* pChatItem = new ChatItemBase(role);
-        
-        pChatItem->setUserName(self_info->_name);
-        pChatItem->setUserIcon(QPixmap(self_info->_icon));
-        QWidget* pBubble = nullptr;
-        pBubble = new TextBubble(role, msg->_msg_content);
-        pChatItem->setWidget(pBubble);
-        ui->chat_data_list->appendChatItem(pChatItem);
+        auto item = std::make_shared<ChatMsgItem>(msg->_msg_id, ChatRole::Self,
+            self_info->_name, self_info->_icon, "text", msg->_msg_content);
+        item->_b_acked = msg->_b_acked;
+        return item;
     }
-    else {
-        role = ChatRole::Other;
-        ChatItemBase* pChatItem = new ChatItemBase(role);
-        auto friend_info = UserMgr::GetInstance()->GetFriendById(msg->_from_uid);
-        if (friend_info == nullptr) {
-            return;
-        }
-        pChatItem->setUserName(friend_info->_name);
-        pChatItem->setUserIcon(QPixmap(friend_info->_icon));
-        QWidget* pBubble = nullptr;
-        pBubble = new TextBubble(role, msg->_msg_content);
-        pChatItem->setWidget(pBubble);
-        ui->chat_data_list->appendChatItem(pChatItem);
+
+    auto friend_info = UserMgr::GetInstance()->GetFriendById(msg->_from_uid);
+    if (friend_info == nullptr) {
+        return nullptr;
     }
+    return std::make_shared<ChatMsgItem>(msg->_msg_id, ChatRole::Other,
+        friend_info->_name, friend_info->_icon, "text", msg->_msg_content);
+}
 
+void ChatPage::AppendChatMsg(std::shared_ptr<TextChatData> msg)
+{
+    auto item = makeMsgItem(msg);
+    if (item == nullptr) {
+        return;
+    }
+    ui->chat_data_list->appendChatMsg(item);
+}
 
+void ChatPage::AckChatMsgs(const std::vector<std::shared_ptr<TextChatAckData>>& acks)
+{
+    QStringList msg_ids;
+    for (auto& ack : acks) {
+        msg_ids.append(ack->_msg_id);
+    }
+    ui->chat_data_list->ackChatMsgs(msg_ids);
+}
+
+void ChatPage::slot_load_more()
+{
+    if (_user_info == nullptr || _b_history_fin) {
+        return;
+    }
+
+    auto msgs = MsgDb::GetInstance()->LoadMsgs(_user_info->_uid, _history_cursor,
+                                               CHAT_HISTORY_PAGE, _history_cursor);
+    _b_history_fin = static_cast<int>(msgs.size()) < CHAT_HISTORY_PAGE;
+    std::vector<std::shared_ptr<ChatMsgItem>> items;
+    for (auto& msg : msgs) {
+        auto item = makeMsgItem(msg);
+        if (item != nullptr) {
+            items.push_back(item);
+        }
+    }
+    ui->chat_data_list->prependChatMsgs(items);
 }
 
 void ChatPage::paintEvent(QPaintEvent *event)
@@ -92,6 +136,11 @@ void ChatPage::on_send_btn_clicked()
         return;
     }
 
+    if (_b_disconnected) {
+        qDebug() << "connection lost, can not send";
+        return;
+    }
+
     auto user_info = UserMgr::GetInstance()->GetUserInfo();
     auto pTextEdit = ui->chatEdit;
     ChatRole role = ChatRole::Self;
@@ -111,19 +160,18 @@ void ChatPage::on_send_btn_clicked()
         }
 
         QString type = msgList[i].msgFlag;
-        ChatItemBase *pChatItem = new ChatItemBase(role);
-        pChatItem->setUserName(userName);
-        pChatItem->setUserIcon(QPixmap(userIcon));
-        QWidget *pBubble = nullptr;
+        //生成唯一id
+        QUuid uuid = QUuid::createUuid();
+        //转为字符串
+        QString uuidString = uuid.toString();
+        std::shared_ptr<ChatMsgItem> pItem = nullptr;
 
         if(type == "text")
-        {   
-            //生成唯一id
-            QUuid uuid = QUuid::createUuid();
-            //转为字符串
-            QString uuidString = uuid.toString();
-
-            pBubble = new TextBubble(role, msgList[i].content);
+        {
+            pItem = std::make_shared<ChatMsgItem>(uuidString, role, userName, userIcon,
+                                                  type, msgList[i].content);
+            //收到服务器确认前显示发送中
+            pItem->_b_acked = false;
             if(txt_size + msgList[i].content.length()> 1024){
                 textObj["fromuid"] = user_info->_uid;
                 textObj["touid"] = _user_info->_uid;
@@ -147,22 +195,22 @@ void ChatPage::on_send_btn_clicked()
             obj["msgid"] = uuidString;
             textArray.append(obj);
             auto txt_msg = std::make_shared<TextChatData>(uuidString, obj["content"].toString(),
-                user_info->_uid, _user_info->_uid);
+                user_info->_uid, _user_info->_uid, false);
             emit sig_append_send_chat_msg(txt_msg);
         }
         else if(type == "image")
         {
-             pBubble = new PictureBubble(QPixmap(msgList[i].content) , role);
+             pItem = std::make_shared<ChatMsgItem>(uuidString, role, userName, userIcon,
+                                                   type, msgList[i].content);
         }
         else if(type == "file")
         {
 
         }
         //发送消息
-        if(pBubble != nullptr)
+        if(pItem != nullptr)
         {
-            pChatItem->setWidget(pBubble);
-            ui->chat_data_list->appendChatItem(pChatItem);
+            ui->chat_data_list->appendChatMsg(pItem);
         }
 
     }
@@ -193,26 +241,19 @@ void ChatPage::on_receive_btn_clicked()
     for(int i=0; i<msgList.size(); ++i)
     {
         QString type = msgList[i].msgFlag;
-        ChatItemBase *pChatItem = new ChatItemBase(role);
-        pChatItem->setUserName(userName);
-        pChatItem->setUserIcon(QPixmap(userIcon));
-        QWidget *pBubble = nullptr;
-        if(type == "text")
-        {
-            pBubble = new TextBubble(role, msgList[i].content);
-        }
-        else if(type == "image")
+        std::shared_ptr<ChatMsgItem> pItem = nullptr;
+        if(type == "text" || type == "image")
         {
-            pBubble = new PictureBubble(QPixmap(msgList[i].content) , role);
+            pItem = std::make_shared<ChatMsgItem>(QUuid::createUuid().toString(), role,
+                                                  userName, userIcon, type, msgList[i].content);
         }
         else if(type == "file")
         {
 
         }
-        if(pBubble != nullptr)
+        if(pItem != nullptr)
         {
-            pChatItem->setWidget(pBubble);
-            ui->chat_data_list->appendChatItem(pChatItem);
+            ui->chat_data_list->appendChatMsg(pItem);
         }
     }
 }
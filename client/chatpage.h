@@ -5,6 +5,8 @@
 #include "userdata.h"
 #include <QMap>
 
+struct ChatMsgItem;
+
 namespace Ui {
 class ChatPage;
 }
@@ -17,18 +19,30 @@ public:
     ~ChatPage();
     void SetUserInfo(std::shared_ptr<UserInfo> user_info);
     void AppendChatMsg(std::shared_ptr<TextChatData> msg);
+    //按msgid把自己发出的消息标记为已送达
+    void AckChatMsgs(const std::vector<std::shared_ptr<TextChatAckData>>& acks);
+    //连接断开后标题提示断开，不能再发送
+    void SetDisconnected(bool disconnected);
 protected:
     void paintEvent(QPaintEvent *event);
 private slots:
     void on_send_btn_clicked();
 
     void on_receive_btn_clicked();
+    void slot_load_more();
 
 private:
     void clearItems();
+    void updateTitle();
+    std::shared_ptr<ChatMsgItem> makeMsgItem(std::shared_ptr<TextChatData> msg);
     Ui::ChatPage *ui;
     std::shared_ptr<UserInfo> _user_info;
     QMap<QString, QWidget*>  _bubble_map;
+    //已经加载到界面的最早一条消息在本地库中的id，向上翻页的游标
+    qint64 _history_cursor;
+    //本地库中更早的记录已经全部加载
+    bool _b_history_fin;
+    bool _b_disconnected;
 signals:
     void sig_append_send_chat_msg(std::shared_ptr<TextChatData> msg);
 };
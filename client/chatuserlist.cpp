@@ -1,16 +1,127 @@
 #include "chatuserlist.h"
 #include<QScrollBar>
 #include "usermgr.h"
-#include <QTimer>
-#include <QCoreApplication>
+#include "userlistmodel.h"
+#include "userlistdelegate.h"
+#include "avatarcache.h"
 
-ChatUserList::ChatUserList(QWidget *parent):QListWidget(parent), _load_pending(false)
+ChatUserList::ChatUserList(QWidget *parent):QListView(parent)
 {
-    Q_UNUSED(parent);
      this->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
      this->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+     this->setUniformItemSizes(true);
+     this->setMouseTracking(true);
+     this->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+     _model = new UserListModel(this);
+     _delegate = new UserListDelegate(this);
+     this->setModel(_model);
+     this->setItemDelegate(_delegate);
+     //头像异步加载完成后重绘可见区域
+     connect(AvatarCache::GetInstance().get(), &AvatarCache::sig_avatar_ready,
+             this->viewport(), QOverload<>::of(&QWidget::update));
+
     // 安装事件过滤器
     this->viewport()->installEventFilter(this);
+
+    connect(this, &QListView::clicked, [this](const QModelIndex& index){
+        auto item = _model->itemAt(index.row());
+        if(item == nullptr || item->_type != ListItemType::CHAT_USER_ITEM){
+            qDebug()<< "slot invalid item clicked ";
+            return;
+        }
+        emit sig_user_clicked(item->_info);
+    });
+}
+
+void ChatUserList::AddChatUser(std::shared_ptr<UserInfo> user_info, bool bfront)
+{
+    if(HasChatUser(user_info->_uid)){
+        return;
+    }
+
+    auto item = std::make_shared<UserListItem>(ListItemType::CHAT_USER_ITEM, user_info);
+    if(bfront){
+        _model->insertItem(0, item);
+        return;
+    }
+    _model->appendItem(item);
+}
+
+void ChatUserList::AddChatUsers(std::vector<std::shared_ptr<UserInfo>> user_infos)
+{
+    std::vector<std::shared_ptr<UserListItem>> items;
+    items.reserve(user_infos.size());
+    for(auto& user_info : user_infos){
+        items.push_back(std::make_shared<UserListItem>(ListItemType::CHAT_USER_ITEM, user_info));
+    }
+    _model->appendItems(items);
+}
+
+bool ChatUserList::HasChatUser(int uid)
+{
+    return _model->rowOfUid(uid) >= 0;
+}
+
+std::shared_ptr<UserInfo> ChatUserList::GetUserInfo(int uid)
+{
+    auto item = _model->itemAt(_model->rowOfUid(uid));
+    if(item == nullptr){
+        return nullptr;
+    }
+    return item->_info;
+}
+
+std::shared_ptr<UserInfo> ChatUserList::GetUserInfoAt(int row)
+{
+    auto item = _model->itemAt(row);
+    if(item == nullptr){
+        return nullptr;
+    }
+    return item->_info;
+}
+
+void ChatUserList::UpdateLastMsg(int uid, std::vector<std::shared_ptr<TextChatData>> msgs)
+{
+    int row = _model->rowOfUid(uid);
+    auto item = _model->itemAt(row);
+    if(item == nullptr){
+        return;
+    }
+
+    QString last_msg = "";
+    for (auto& msg : msgs) {
+        last_msg = msg->_msg_content;
+    }
+
+    item->_info->_last_msg = last_msg;
+    //只重绘这一行
+    _model->updateRow(row);
+}
+
+bool ChatUserList::SetCurrentUser(int uid)
+{
+    int row = uid == 0 ? 0 : _model->rowOfUid(uid);
+    if(row < 0 || row >= _model->rowCount()){
+        return false;
+    }
+
+    this->setCurrentIndex(_model->index(row));
+    return true;
+}
+
+void ChatUserList::ScrollToUser(int uid)
+{
+    int row = _model->rowOfUid(uid);
+    if(row < 0){
+        return;
+    }
+    this->scrollTo(_model->index(row));
+}
+
+int ChatUserList::count() const
+{
+    return _model->rowCount();
 }
 
 bool ChatUserList::eventFilter(QObject *watched, QEvent *event)
@@ -26,44 +137,5 @@ bool ChatUserList::eventFilter(QObject *watched, QEvent *event)
         }
     }
 
-    // 检查事件是否是鼠标滚轮事件
-    if (watched == this->viewport() && event->type() == QEvent::Wheel) {
-        QWheelEvent *wheelEvent = static_cast<QWheelEvent*>(event);
-        int numDegrees = wheelEvent->angleDelta().y() / 8;
-        int numSteps = numDegrees / 15; // 计算滚动步数
-
-        // 设置滚动幅度
-        this->verticalScrollBar()->setValue(this->verticalScrollBar()->value() - numSteps);
-
-        // 检查是否滚动到底部
-        QScrollBar *scrollBar = this->verticalScrollBar();
-        int maxScrollValue = scrollBar->maximum();
-        int currentValue = scrollBar->value();
-        //int pageSize = 10; // 每页加载的联系人数量
-
-        if (maxScrollValue - currentValue <= 0) {
-             auto b_loaded = UserMgr::GetInstance()->IsLoadChatFin();
-             if(b_loaded){
-                 return true;
-             }
-
-             if(_load_pending){
-                 return true;
-             }
-            // 滚动到底部，加载新的联系人
-            qDebug()<<"load more chat user";
-            _load_pending = true;
-
-            QTimer::singleShot(100, [this](){
-                _load_pending = false;
-                QCoreApplication::quit(); // 完成后退出应用程序
-                });
-            //发送信号通知聊天界面加载更多聊天内容
-            emit sig_loading_chat_user();
-         }
-
-        return true; // 停止事件传递
-    }
-
-    return QListWidget::eventFilter(watched, event);
+    return QListView::eventFilter(watched, event);
 }
@@ -1,23 +1,41 @@
 #ifndef CHATUSERLIST_H
 #define CHATUSERLIST_H
-#include <QListWidget>
-#include <QWheelEvent>
+#include <QListView>
 #include <QEvent>
 #include <QScrollBar>
 #include <QDebug>
+#include <memory>
+#include <vector>
+#include "userdata.h"
 
-class ChatUserList: public QListWidget
+class UserListModel;
+class UserListDelegate;
+
+//聊天列表，基于model/view实现，好友再多也只绘制可见的条目
+class ChatUserList: public QListView
 {
     Q_OBJECT
 public:
     ChatUserList(QWidget *parent = nullptr);
+    //添加聊天条目，已经存在的uid不会重复添加
+    void AddChatUser(std::shared_ptr<UserInfo> user_info, bool bfront = false);
+    void AddChatUsers(std::vector<std::shared_ptr<UserInfo>> user_infos);
+    bool HasChatUser(int uid);
+    std::shared_ptr<UserInfo> GetUserInfo(int uid);
+    std::shared_ptr<UserInfo> GetUserInfoAt(int row);
+    //追加消息并刷新这一行显示的最后一条消息
+    void UpdateLastMsg(int uid, std::vector<std::shared_ptr<TextChatData>> msgs);
+    bool SetCurrentUser(int uid);
+    void ScrollToUser(int uid);
+    int count() const;
 
 protected:
     bool eventFilter(QObject *watched, QEvent *event) override;
 private:
-    bool _load_pending;
+    UserListModel* _model;
+    UserListDelegate* _delegate;
 signals:
-    void sig_loading_chat_user();
+    void sig_user_clicked(std::shared_ptr<UserInfo> user_info);
 };
 
 #endif // CHATUSERLIST_H
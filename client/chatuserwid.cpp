@@ -1,5 +1,6 @@
 #include "chatuserwid.h"
 #include "ui_chatuserwid.h"
+#include "avatarcache.h"
 
 ChatUserWid::ChatUserWid(QWidget *parent) :
     ListItemBase(parent),
@@ -24,11 +25,8 @@ QSize ChatUserWid::sizeHint() const
 void ChatUserWid::SetInfo(std::shared_ptr<UserInfo> user_info)
 {
     _user_info = user_info;
-    // 加载图片
-    QPixmap pixmap(_user_info->_icon);
-
-    // 设置图片自动缩放
-    ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    // 从头像缓存加载图片，缓存未命中时先显示占位图
+    AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, _user_info->_icon);
     ui->icon_lb->setScaledContents(true);
 
     ui->user_name_lb->setText(_user_info->_name);
@@ -38,11 +36,8 @@ void ChatUserWid::SetInfo(std::shared_ptr<UserInfo> user_info)
 void ChatUserWid::SetInfo(std::shared_ptr<FriendInfo> friend_info)
 {
     _user_info = std::make_shared<UserInfo>(friend_info);
-    // 加载图片
-    QPixmap pixmap(_user_info->_icon);
-
-    // 设置图片自动缩放
-    ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    // 从头像缓存加载图片，缓存未命中时先显示占位图
+    AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, _user_info->_icon);
     ui->icon_lb->setScaledContents(true);
 
     ui->user_name_lb->setText(_user_info->_name);
@@ -68,7 +63,6 @@ void ChatUserWid::updateLastMsg(std::vector<std::shared_ptr<TextChatData>> msgs)
     QString last_msg = "";
     for (auto& msg : msgs) {
         last_msg = msg->_msg_content;
-        _user_info->_chat_msgs.push_back(msg);
     }
     
     _user_info->_last_msg = last_msg;
@@ -1,15 +1,17 @@
 #ifndef CONTACTUSERLIST_H
 #define CONTACTUSERLIST_H
-#include <QListWidget>
+#include <QListView>
 #include <QEvent>
-#include <QWheelEvent>
 #include <QScrollBar>
 #include <QDebug>
 #include <memory>
 #include "userdata.h"
-class ConUserItem;
 
-class ContactUserList : public QListWidget
+class UserListModel;
+class UserListDelegate;
+
+//联系人列表，基于model/view实现，好友再多也只绘制可见的条目
+class ContactUserList : public QListView
 {
     Q_OBJECT
 public:
@@ -19,19 +21,21 @@ protected:
     bool eventFilter(QObject *watched, QEvent *event) override ;
 private:
     void addContactUserList();
+    //在联系人分组提示之后插入新好友
+    void addNewContact(std::shared_ptr<UserInfo> user_info);
 
 public slots:
-     void slot_item_clicked(QListWidgetItem *item);
+     void slot_item_clicked(const QModelIndex &index);
      void slot_add_auth_firend(std::shared_ptr<AuthInfo>);
      void slot_auth_rsp(std::shared_ptr<AuthRsp>);
 signals:
-    void sig_loading_contact_user();
     void sig_switch_apply_friend_page();
     void sig_switch_friend_info_page(std::shared_ptr<UserInfo> user_info);
 private:
-    bool _load_pending;
-    ConUserItem* _add_friend_item;
-    QListWidgetItem * _groupitem;
+    UserListModel* _model;
+    UserListDelegate* _delegate;
+    int _add_friend_row;
+    int _group_row;
 };
 
 #endif // CONTACTUSERLIST_H
@@ -1,5 +1,6 @@
 #include "conuseritem.h"
 #include "ui_conuseritem.h"
+#include "avatarcache.h"
 
 ConUserItem::ConUserItem(QWidget *parent) :
     ListItemBase(parent),
@@ -24,11 +25,8 @@ QSize ConUserItem::sizeHint() const
 void ConUserItem::SetInfo(std::shared_ptr<AuthInfo> auth_info)
 {
     _info = std::make_shared<UserInfo>(auth_info);
-    // 加载图片
-    QPixmap pixmap(_info->_icon);
-
-    // 设置图片自动缩放
-    ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    // 从头像缓存加载图片，缓存未命中时先显示占位图
+    AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, _info->_icon);
     ui->icon_lb->setScaledContents(true);
 
     ui->user_name_lb->setText(_info->_name);
@@ -38,11 +36,8 @@ void ConUserItem::SetInfo(int uid, QString name, QString icon)
 {
      _info = std::make_shared<UserInfo>(uid,name, name, icon, 0);
 
-     // 加载图片
-     QPixmap pixmap(_info->_icon);
-
-     // 设置图片自动缩放
-     ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+     // 从头像缓存加载图片，缓存未命中时先显示占位图
+     AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, _info->_icon);
      ui->icon_lb->setScaledContents(true);
 
      ui->user_name_lb->setText(_info->_name);
@@ -51,11 +46,8 @@ void ConUserItem::SetInfo(int uid, QString name, QString icon)
 void ConUserItem::SetInfo(std::shared_ptr<AuthRsp> auth_rsp){
     _info = std::make_shared<UserInfo>(auth_rsp);
 
-    // 加载图片
-    QPixmap pixmap(_info->_icon);
-
-    // 设置图片自动缩放
-    ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    // 从头像缓存加载图片，缓存未命中时先显示占位图
+    AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, _info->_icon);
     ui->icon_lb->setScaledContents(true);
 
     ui->user_name_lb->setText(_info->_name);
@@ -3,6 +3,7 @@
 #include <QDir>
 #include "applyfriend.h"
 #include <memory>
+#include "avatarcache.h"
 FindSuccessDlg::FindSuccessDlg(QWidget *parent) :
     QDialog(parent),
     ui(new Ui::FindSuccessDlg),_parent(parent)
@@ -17,10 +18,7 @@ FindSuccessDlg::FindSuccessDlg(QWidget *parent) :
     QString app_path = QCoreApplication::applicationDirPath();
     QString pix_path = QDir::toNativeSeparators(app_path +
                              QDir::separator() + "static"+QDir::separator()+"head_1.jpg");
-    QPixmap head_pix(pix_path);
-    head_pix = head_pix.scaled(ui->head_lb->size(),
-            Qt::KeepAspectRatio, Qt::SmoothTransformation);
-    ui->head_lb->setPixmap(head_pix);
+    AvatarCache::GetInstance()->SetAvatar(ui->head_lb, pix_path);
     ui->add_friend_btn->SetState("normal","hover","press");
     this->setModal(true);
 }
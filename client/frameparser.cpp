@@ -0,0 +1,89 @@
+#include "frameparser.h"
+
+//消息头长度：消息ID + 消息长度，和global.h中的TCP_HEAD_LEN一致
+static const std::size_t FRAME_HEAD_LEN = 4;
+
+FrameParser::FrameParser(std::size_t reserve):_size(0),_read_pos(0),_b_recv_pending(false),
+    _message_id(0),_message_len(0)
+{
+    //预留容量后清空缓冲区不会释放内存
+    _buffer.reserve(reserve);
+}
+
+char* FrameParser::Prepare(int len)
+{
+    if(_buffer.size() < _size + len){
+        _buffer.resize(_size + len);
+    }
+    return &_buffer[_size];
+}
+
+void FrameParser::Commit(int len)
+{
+    if(len > 0){
+        _size += len;
+    }
+}
+
+void FrameParser::Append(const char *data, int len)
+{
+    if(len <= 0){
+        return;
+    }
+    _buffer.replace(_size, _buffer.size() - _size, data, len);
+    _size += len;
+}
+
+void FrameParser::Parse(const FrameHandler &handler)
+{
+    // _read_pos之前是已经处理过的数据，解析时只移动读位置，不搬动缓冲区
+    for(;;){
+        //先解析头部
+        if(!_b_recv_pending){
+            // 检查剩余数据是否足够解析出一个消息头（消息ID + 消息长度）
+            if(_size - _read_pos < FRAME_HEAD_LEN){
+                break; // 数据不够，等待更多数据
+            }
+
+            // 消息头是网络字节序
+            const unsigned char* head = reinterpret_cast<const unsigned char*>(_buffer.data() + _read_pos);
+            _message_id = static_cast<uint16_t>((head[0] << 8) | head[1]);
+            _message_len = static_cast<uint16_t>((head[2] << 8) | head[3]);
+            _read_pos += FRAME_HEAD_LEN;
+        }
+
+        //剩余长度是否满足消息体长度，不满足则退出继续等待接受
+        if(_size - _read_pos < _message_len){
+            _b_recv_pending = true;
+            break;
+        }
+
+        _b_recv_pending = false;
+        //先移动读位置再回调，回调里可以安全地Reset
+        std::size_t body_pos = _read_pos;
+        _read_pos += _message_len;
+        handler(_message_id, _buffer.data() + body_pos, _message_len);
+    }
+
+    //全部处理完直接清空，否则已处理部分超过一半时再把剩余数据挪到开头
+    if(_read_pos >= _size){
+        _size = 0;
+        _read_pos = 0;
+    }else if(_read_pos > _size / 2){
+        _buffer.erase(0, _read_pos);
+        _size -= _read_pos;
+        _read_pos = 0;
+    }
+}
+
+void FrameParser::Reset()
+{
+    _size = 0;
+    _read_pos = 0;
+    _b_recv_pending = false;
+}
+
+int FrameParser::Pending() const
+{
+    return static_cast<int>(_size - _read_pos);
+}
@@ -0,0 +1,40 @@
+#ifndef FRAMEPARSER_H
+#define FRAMEPARSER_H
+#include <string>
+#include <cstdint>
+#include <functional>
+
+//聊天协议的拆包：2字节消息id + 2字节消息长度(网络字节序) + 消息体
+//只依赖标准库，不涉及socket和界面，TcpMgr在网络线程使用，基准测试也直接使用
+//解析时只移动读位置，已处理部分超过缓冲区一半时才把剩余数据挪到开头，整体是线性的
+class FrameParser
+{
+public:
+    //回调参数：消息id(含压缩标志位)、消息体指针和长度，指针只在回调期间有效
+    typedef std::function<void(uint16_t id, const char* data, int len)> FrameHandler;
+
+    explicit FrameParser(std::size_t reserve = 0);
+    //返回缓冲区尾部可写入len字节的位置，写入后用Commit提交实际写入的长度，省去临时拷贝
+    char* Prepare(int len);
+    void Commit(int len);
+    //把数据追加到缓冲区尾部
+    void Append(const char* data, int len);
+    //解析出缓冲区中所有完整的帧，逐个交给handler
+    void Parse(const FrameHandler& handler);
+    //断开重连时丢弃未处理的数据
+    void Reset();
+    //缓冲区中还没有处理的字节数
+    int Pending() const;
+
+private:
+    std::string _buffer;
+    //缓冲区中有效数据的长度，Prepare之后未提交的部分不算
+    std::size_t _size;
+    //缓冲区中下一个未解析字节的位置
+    std::size_t _read_pos;
+    bool _b_recv_pending;
+    uint16_t _message_id;
+    uint16_t _message_len;
+};
+
+#endif // FRAMEPARSER_H
@@ -1,6 +1,7 @@
 #include "friendinfopage.h"
 #include "ui_friendinfopage.h"
 #include <QDebug>
+#include "avatarcache.h"
 
 FriendInfoPage::FriendInfoPage(QWidget *parent) :
     QWidget(parent),
@@ -20,11 +21,8 @@ FriendInfoPage::~FriendInfoPage()
 void FriendInfoPage::SetInfo(std::shared_ptr<UserInfo> user_info)
 {
     _user_info = user_info;
-    // 加载图片
-    QPixmap pixmap(user_info->_icon);
-
-    // 设置图片自动缩放
-    ui->icon_lb->setPixmap(pixmap.scaled(ui->icon_lb->size(), Qt::KeepAspectRatio, Qt::SmoothTransformation));
+    // 从头像缓存加载图片，缓存未命中时先显示占位图
+    AvatarCache::GetInstance()->SetAvatar(ui->icon_lb, user_info->_icon);
     ui->icon_lb->setScaledContents(true);
 
     ui->name_lb->setText(user_info->_name);
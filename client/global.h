@@ -37,6 +37,7 @@ enum ReqId{
     ID_TEXT_CHAT_MSG_REQ  = 1017,  //文本聊天信息请求
     ID_TEXT_CHAT_MSG_RSP  = 1018,  //文本聊天信息回复
     ID_NOTIFY_TEXT_CHAT_MSG_REQ = 1019, //通知用户文本聊天信息
+    ID_NOTIFY_MIGRATE_REQ = 1021, //通知用户迁移到其他服务器
 };
 
 enum ErrorCodes{
@@ -144,5 +145,36 @@ const std::vector<QString> names = {
 
 const int CHAT_COUNT_PER_PAGE = 13;
 
+//聊天记录每次加载的条数
+const int CHAT_HISTORY_PAGE = 50;
+
+//tcp消息头长度(消息ID + 消息长度)
+const int TCP_HEAD_LEN = 4;
+//tcp接收缓冲区预留大小
+const int TCP_RECV_BUFFER_RESERVE = 64 * 1024;
+//消息id最高位表示消息体经过zstd压缩
+const quint16 TCP_COMPRESS_FLAG = 0x8000;
+//小于这个长度的消息不压缩，和服务器的阈值一致
+const int TCP_COMPRESS_MIN_LEN = 256;
+//压缩级别
+const int TCP_COMPRESS_LEVEL = 3;
+//解压后的长度上限
+const int TCP_DECOMPRESS_MAX_LEN = 4 * 1024 * 1024;
+
+//头像缓存上限(KB)，按缩放后像素占用的内存计算
+const int AVATAR_CACHE_MAX_KB = 16 * 1024;
+//后台解码头像的线程数
+const int AVATAR_LOAD_THREADS = 2;
+//图片缩略图内存缓存上限(KB)
+const int THUMB_CACHE_MAX_KB = 32 * 1024;
+//后台解码图片的线程数
+const int THUMB_LOAD_THREADS = 2;
+//聊天记录里图片的最大显示大小
+const int PIC_MAX_WIDTH = 160;
+const int PIC_MAX_HEIGHT = 90;
+//输入框里图片的最大显示大小
+const int EDIT_PIC_MAX_WIDTH = 120;
+const int EDIT_PIC_MAX_HEIGHT = 80;
+
 
 #endif // GLOBAL_H
@@ -4,7 +4,7 @@
 #
 #-------------------------------------------------
 
-QT       += core gui network
+QT       += core gui network sql
 
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
@@ -25,9 +25,16 @@ DEFINES += QT_DEPRECATED_WARNINGS
 
 CONFIG += c++11
 
+#聊天协议按帧压缩使用zstd
+win32: INCLUDEPATH += D:/cppsoft/zstd/lib
+win32: LIBS += -LD:/cppsoft/zstd/build/VS2010/bin/x64_Release -llibzstd_static
+unix: LIBS += -lzstd
+
 SOURCES += \
         BubbleFrame.cpp \
         ChatItemBase.cpp \
+        ChatMsgDelegate.cpp \
+        ChatMsgModel.cpp \
         ChatView.cpp \
         MessageTextEdit.cpp \
         PictureBubble.cpp \
@@ -38,6 +45,7 @@ SOURCES += \
         applyfriendlist.cpp \
         applyfriendpage.cpp \
         authenfriend.cpp \
+        avatarcache.cpp \
         chatdialog.cpp \
         chatpage.cpp \
         chatuserlist.cpp \
@@ -51,6 +59,7 @@ SOURCES += \
         customizetextedit.cpp \
         findfaildlg.cpp \
         findsuccessdlg.cpp \
+        frameparser.cpp \
         friendinfopage.cpp \
         friendlabel.cpp \
         global.cpp \
@@ -63,19 +72,25 @@ SOURCES += \
         logindialog.cpp \
         main.cpp \
         mainwindow.cpp \
+        msgdb.cpp \
         registerdialog.cpp \
         resetdialog.cpp \
         searchlist.cpp \
         statelabel.cpp \
         statewidget.cpp \
         tcpmgr.cpp \
+        thumbnailmgr.cpp \
         timerbtn.cpp \
         userdata.cpp \
+        userlistdelegate.cpp \
+        userlistmodel.cpp \
         usermgr.cpp
 
 HEADERS += \
         BubbleFrame.h \
         ChatItemBase.h \
+        ChatMsgDelegate.h \
+        ChatMsgModel.h \
         ChatView.h \
         MessageTextEdit.h \
         PictureBubble.h \
@@ -86,6 +101,7 @@ HEADERS += \
         applyfriendlist.h \
         applyfriendpage.h \
         authenfriend.h \
+        avatarcache.h \
         chatdialog.h \
         chatpage.h \
         chatuserlist.h \
@@ -99,6 +115,7 @@ HEADERS += \
         customizetextedit.h \
         findfaildlg.h \
         findsuccessdlg.h \
+        frameparser.h \
         friendinfopage.h \
         friendlabel.h \
         global.h \
@@ -110,6 +127,7 @@ HEADERS += \
         loadingdlg.h \
         logindialog.h \
         mainwindow.h \
+        msgdb.h \
         registerdialog.h \
         resetdialog.h \
         searchlist.h \
@@ -117,8 +135,11 @@ HEADERS += \
         statelabel.h \
         statewidget.h \
         tcpmgr.h \
+        thumbnailmgr.h \
         timerbtn.h \
         userdata.h \
+        userlistdelegate.h \
+        userlistmodel.h \
         usermgr.h
 
 FORMS += \
@@ -3,6 +3,7 @@
 #include <QDebug>
 #include "httpmgr.h"
 #include "tcpmgr.h"
+#include "usermgr.h"
 #include <QRegExp>
 #include <QRegularExpression>
 #include <QPainter>
@@ -215,6 +216,14 @@ void LoginDialog::slot_tcp_con_finish(bool bsuccess)
       QJsonObject jsonObj;
       jsonObj["uid"] = _uid;
       jsonObj["token"] = _token;
+      //本地已有同步过的列表，带上版本号只拉取增量
+      if(UserMgr::GetInstance()->HasSyncVer(_uid)){
+          jsonObj["friend_ver"] = UserMgr::GetInstance()->GetFriendVer();
+          jsonObj["apply_ver"] = UserMgr::GetInstance()->GetApplyVer();
+      }
+      //声明支持zstd压缩，带上本地字典id
+      jsonObj["compress"] = "zstd";
+      jsonObj["dict_id"] = static_cast<qint64>(TcpMgr::GetInstance()->GetDictId());
 
       QJsonDocument doc(jsonObj);
       QByteArray jsonData = doc.toJson(QJsonDocument::Indented);
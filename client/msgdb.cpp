@@ -0,0 +1,177 @@
+#include "msgdb.h"
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QStandardPaths>
+#include <QDateTime>
+#include <QVariant>
+#include <QDebug>
+#include <algorithm>
+
+//记录库使用的连接名，避免和默认连接冲突
+static const char* MSG_DB_CONNECTION = "msg_db";
+
+MsgDb::MsgDb():_uid(0)
+{
+
+}
+
+MsgDb::~MsgDb()
+{
+    Close();
+}
+
+bool MsgDb::Open(int uid)
+{
+    if(_db.isOpen() && _uid == uid){
+        return true;
+    }
+
+    Close();
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation)
+            + QDir::separator() + QString::number(uid);
+    QDir().mkpath(dir);
+
+    _db = QSqlDatabase::addDatabase("QSQLITE", MSG_DB_CONNECTION);
+    _db.setDatabaseName(dir + QDir::separator() + "msg.db");
+    if(!_db.open()){
+        qDebug() << "open msg db failed: " << _db.lastError().text();
+        return false;
+    }
+
+    //WAL模式下写入不阻塞读取，NORMAL在WAL下只在检查点时刷盘
+    QSqlQuery query(_db);
+    query.exec("PRAGMA journal_mode=WAL");
+    query.exec("PRAGMA synchronous=NORMAL");
+    if(!CreateTables()){
+        Close();
+        return false;
+    }
+
+    _uid = uid;
+    return true;
+}
+
+void MsgDb::Close()
+{
+    if(!_db.isValid()){
+        return;
+    }
+
+    _db.close();
+    _db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(MSG_DB_CONNECTION);
+    _uid = 0;
+}
+
+bool MsgDb::CreateTables()
+{
+    QSqlQuery query(_db);
+    bool b_success = query.exec("CREATE TABLE IF NOT EXISTS chat_msg ("
+                                "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                                "msg_id TEXT NOT NULL UNIQUE,"
+                                "peer_uid INTEGER NOT NULL,"
+                                "from_uid INTEGER NOT NULL,"
+                                "to_uid INTEGER NOT NULL,"
+                                "content TEXT NOT NULL,"
+                                "create_time INTEGER NOT NULL,"
+                                "seq INTEGER NOT NULL DEFAULT 0,"
+                                "acked INTEGER NOT NULL DEFAULT 1)")
+            && query.exec("CREATE INDEX IF NOT EXISTS idx_chat_msg_peer ON chat_msg(peer_uid, id)");
+    if(!b_success){
+        qDebug() << "create msg table failed: " << query.lastError().text();
+    }
+    return b_success;
+}
+
+bool MsgDb::AppendMsgs(int peer_uid, const std::vector<std::shared_ptr<TextChatData>>& msgs)
+{
+    if(!_db.isOpen() || msgs.empty()){
+        return false;
+    }
+
+    //一批消息放在一个事务里，只提交一次
+    _db.transaction();
+    QSqlQuery query(_db);
+    query.prepare("INSERT OR IGNORE INTO chat_msg(msg_id, peer_uid, from_uid, to_uid, content, create_time, acked) "
+                  "VALUES(?, ?, ?, ?, ?, ?, ?)");
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    for(auto& msg : msgs){
+        query.addBindValue(msg->_msg_id);
+        query.addBindValue(peer_uid);
+        query.addBindValue(msg->_from_uid);
+        query.addBindValue(msg->_to_uid);
+        query.addBindValue(msg->_msg_content);
+        query.addBindValue(now);
+        query.addBindValue(msg->_b_acked ? 1 : 0);
+        if(!query.exec()){
+            qDebug() << "insert chat msg failed: " << query.lastError().text();
+            _db.rollback();
+            return false;
+        }
+    }
+
+    return _db.commit();
+}
+
+bool MsgDb::AckMsgs(const std::vector<std::shared_ptr<TextChatAckData>>& acks)
+{
+    if(!_db.isOpen() || acks.empty()){
+        return false;
+    }
+
+    //一帧里的确认放在一个事务里提交
+    _db.transaction();
+    QSqlQuery query(_db);
+    query.prepare("UPDATE chat_msg SET seq = ?, create_time = ?, acked = 1 WHERE msg_id = ?");
+    for(auto& ack : acks){
+        query.addBindValue(ack->_seq);
+        query.addBindValue(ack->_ts);
+        query.addBindValue(ack->_msg_id);
+        if(!query.exec()){
+            qDebug() << "ack chat msg failed: " << query.lastError().text();
+            _db.rollback();
+            return false;
+        }
+    }
+
+    return _db.commit();
+}
+
+std::vector<std::shared_ptr<TextChatData>> MsgDb::LoadMsgs(int peer_uid, qint64 before_id,
+                                                           int count, qint64& first_id)
+{
+    std::vector<std::shared_ptr<TextChatData>> msgs;
+    first_id = 0;
+    if(!_db.isOpen()){
+        return msgs;
+    }
+
+    //按索引倒序取一页，再翻转成正序
+    QSqlQuery query(_db);
+    query.setForwardOnly(true);
+    if(before_id > 0){
+        query.prepare("SELECT id, msg_id, from_uid, to_uid, content, acked FROM chat_msg "
+                      "WHERE peer_uid = ? AND id < ? ORDER BY id DESC LIMIT ?");
+        query.addBindValue(peer_uid);
+        query.addBindValue(before_id);
+    }else{
+        query.prepare("SELECT id, msg_id, from_uid, to_uid, content, acked FROM chat_msg "
+                      "WHERE peer_uid = ? ORDER BY id DESC LIMIT ?");
+        query.addBindValue(peer_uid);
+    }
+    query.addBindValue(count);
+    if(!query.exec()){
+        qDebug() << "load chat msg failed: " << query.lastError().text();
+        return msgs;
+    }
+
+    while(query.next()){
+        first_id = query.value(0).toLongLong();
+        msgs.push_back(std::make_shared<TextChatData>(query.value(1).toString(),
+            query.value(4).toString(), query.value(2).toInt(), query.value(3).toInt(),
+            query.value(5).toInt() != 0));
+    }
+
+    std::reverse(msgs.begin(), msgs.end());
+    return msgs;
+}
@@ -0,0 +1,35 @@
+#ifndef MSGDB_H
+#define MSGDB_H
+#include "singleton.h"
+#include "userdata.h"
+#include <QSqlDatabase>
+#include <vector>
+
+//本地聊天记录库，每个账号一个sqlite文件，开启WAL
+//消息按自增id排序，(peer_uid, id)上建索引，翻页时按id游标只查一页，不会把整个会话读进内存
+//只能在界面线程使用
+class MsgDb : public Singleton<MsgDb>
+{
+public:
+    ~MsgDb();
+    //登录后打开当前账号的记录库，换账号时关闭之前的库
+    bool Open(int uid);
+    void Close();
+    //保存和peer_uid之间的消息，同一个msg_id只保存一次
+    bool AppendMsgs(int peer_uid, const std::vector<std::shared_ptr<TextChatData>>& msgs);
+    //取id小于before_id的最近count条消息，按时间正序返回，before_id为0表示从最新一条开始
+    //first_id返回这一页最早一条的id，作为下一次翻页的游标
+    std::vector<std::shared_ptr<TextChatData>> LoadMsgs(int peer_uid, qint64 before_id,
+                                                        int count, qint64& first_id);
+    //收到服务器确认后记下序号，并用服务器时间替换本地时间
+    bool AckMsgs(const std::vector<std::shared_ptr<TextChatAckData>>& acks);
+private:
+    friend class Singleton<MsgDb>;
+    MsgDb();
+    bool CreateTables();
+
+    QSqlDatabase _db;
+    int _uid;
+};
+
+#endif // MSGDB_H
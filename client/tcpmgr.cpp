@@ -1,57 +1,56 @@
 #include "tcpmgr.h"
 #include <QAbstractSocket>
 #include "usermgr.h"
-
-TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_message_len(0)
+#include <QTimer>
+#include <QtEndian>
+#include <QCoreApplication>
+#include <QSettings>
+#include <QFile>
+
+TcpMgr::TcpMgr():_socket(this),_host(""),_port(0),_parser(TCP_RECV_BUFFER_RESERVE),
+    _b_migrating(false),_old_port(0),_cctx(ZSTD_createCCtx()),_dctx(ZSTD_createDCtx()),
+    _cdict(nullptr),_ddict(nullptr),_dict_id(0),_b_compress(false),_b_compress_dict(false)
 {
+    //跨线程的信号参数需要注册
+    qRegisterMetaType<ReqId>("ReqId");
+    qRegisterMetaType<ServerInfo>("ServerInfo");
+    qRegisterMetaType<std::shared_ptr<SearchInfo>>("std::shared_ptr<SearchInfo>");
+    qRegisterMetaType<std::shared_ptr<AddFriendApply>>("std::shared_ptr<AddFriendApply>");
+    qRegisterMetaType<std::shared_ptr<AuthInfo>>("std::shared_ptr<AuthInfo>");
+    qRegisterMetaType<std::shared_ptr<AuthRsp>>("std::shared_ptr<AuthRsp>");
+    qRegisterMetaType<std::shared_ptr<TextChatMsg>>("std::shared_ptr<TextChatMsg>");
+    qRegisterMetaType<std::shared_ptr<TextChatAck>>("std::shared_ptr<TextChatAck>");
+
+    //UserMgr要在界面线程创建，网络线程只往它投递修改
+    UserMgr::GetInstance();
+
+    loadCompressDict();
     QObject::connect(&_socket, &QTcpSocket::connected, [&]() {
            qDebug() << "Connected to server!";
+           //压缩按连接协商，新连接登录成功前不压缩
+           _b_compress = false;
+           _b_compress_dict = false;
+           //迁移时直接用新token登录，界面已经在聊天页
+           if(_b_migrating){
+               sendChatLogin();
+               return;
+           }
            // 连接建立后发送消息
             emit sig_con_success(true);
        });
 
        QObject::connect(&_socket, &QTcpSocket::readyRead, [&]() {
-           // 当有数据可读时，读取所有数据
-           // 读取所有数据并追加到缓冲区
-           _buffer.append(_socket.readAll());
-
-           QDataStream stream(&_buffer, QIODevice::ReadOnly);
-           stream.setVersion(QDataStream::Qt_5_0);
-
-           forever {
-                //先解析头部
-               if(!_b_recv_pending){
-                   // 检查缓冲区中的数据是否足够解析出一个消息头（消息ID + 消息长度）
-                   if (_buffer.size() < static_cast<int>(sizeof(quint16) * 2)) {
-                       return; // 数据不够，等待更多数据
-                   }
-
-                   // 预读取消息ID和消息长度，但不从缓冲区中移除
-                   stream >> _message_id >> _message_len;
-
-                   //将buffer 中的前四个字节移除
-                   _buffer = _buffer.mid(sizeof(quint16) * 2);
-
-                   // 输出读取的数据
-                   qDebug() << "Message ID:" << _message_id << ", Length:" << _message_len;
-
-               }
-
-                //buffer剩余长读是否满足消息体长度，不满足则退出继续等待接受
-               if(_buffer.size() < _message_len){
-                    _b_recv_pending = true;
-                    return;
-               }
-
-               _b_recv_pending = false;
-               // 读取消息体
-               QByteArray messageBody = _buffer.mid(0, _message_len);
-               qDebug() << "receive body msg is " << messageBody ;
-
-               _buffer = _buffer.mid(_message_len);
-               handleMsg(ReqId(_message_id),_message_len, messageBody);
+           // 当有数据可读时，直接读到缓冲区尾部，省去readAll的临时拷贝
+           qint64 avail = _socket.bytesAvailable();
+           if (avail <= 0) {
+               return;
            }
 
+           char* dst = _parser.Prepare(static_cast<int>(avail));
+           qint64 read_len = _socket.read(dst, avail);
+           _parser.Commit(static_cast<int>(qMax<qint64>(read_len, 0)));
+
+           parseFrames();
        });
 
        //5.15 之后版本
@@ -64,6 +63,25 @@ TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_messa
         QObject::connect(&_socket, static_cast<void (QTcpSocket::*)(QTcpSocket::SocketError)>(&QTcpSocket::error),
                             [&](QTcpSocket::SocketError socketError) {
                qDebug() << "Error:" << _socket.errorString() ;
+               //新服务器连不上时回到原服务器，只重试一次
+               if(_b_migrating && _socket.state() != QAbstractSocket::ConnectedState
+                       && !_old_host.isEmpty()){
+                   qDebug() << "migrate failed, fall back to " << _old_host << ":" << _old_port;
+                   QString host = _old_host;
+                   _old_host.clear();
+                   _host = host;
+                   _port = _old_port;
+                   _socket.abort();
+                   _socket.connectToHost(_host, _port);
+                   return;
+               }
+               //回退原服务器也失败，界面在聊天页，不能再走登录界面的连接结果
+               if(_b_migrating && _socket.state() != QAbstractSocket::ConnectedState){
+                   qDebug() << "migrate fall back failed, connection lost";
+                   _b_migrating = false;
+                   emit sig_connection_lost();
+                   return;
+               }
                switch (socketError) {
                    case QTcpSocket::ConnectionRefusedError:
                        qDebug() << "Connection Refused!";
@@ -97,10 +115,115 @@ TcpMgr::TcpMgr():_host(""),_port(0),_b_recv_pending(false),_message_id(0),_messa
         QObject::connect(this, &TcpMgr::sig_send_data, this, &TcpMgr::slot_send_data);
         //注册消息
         initHandlers();
+
+        //socket收发、拆包和json解析都放到网络线程，界面只接收解析好的对象
+        //_socket的父对象是this，会一起移到网络线程
+        _thread.setObjectName("TcpMgrThread");
+        moveToThread(&_thread);
+        _thread.start();
+        //程序退出前断开连接并停止网络线程
+        QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, [this]() {
+            Stop();
+        });
 }
 
 TcpMgr::~TcpMgr(){
+    Stop();
+    ZSTD_freeCCtx(_cctx);
+    ZSTD_freeDCtx(_dctx);
+    ZSTD_freeCDict(_cdict);
+    ZSTD_freeDDict(_ddict);
+}
+
+unsigned int TcpMgr::GetDictId()
+{
+    return _dict_id;
+}
+
+void TcpMgr::loadCompressDict()
+{
+    QString app_path = QCoreApplication::applicationDirPath();
+    QSettings settings(app_path + QDir::separator() + "config.ini", QSettings::IniFormat);
+    QString dict_path = settings.value("Compress/Dict").toString();
+    if(dict_path.isEmpty()){
+        return;
+    }
+
+    //字典由服务器traindict生成，和程序一起发布
+    QFile file(QDir(app_path).filePath(dict_path));
+    if(!file.open(QIODevice::ReadOnly)){
+        qDebug() << "compress dict " << dict_path << " not found";
+        return;
+    }
+
+    QByteArray dict = file.readAll();
+    _cdict = ZSTD_createCDict(dict.constData(), dict.size(), TCP_COMPRESS_LEVEL);
+    _ddict = ZSTD_createDDict(dict.constData(), dict.size());
+    if(_cdict == nullptr || _ddict == nullptr){
+        ZSTD_freeCDict(_cdict);
+        ZSTD_freeDDict(_ddict);
+        _cdict = nullptr;
+        _ddict = nullptr;
+        return;
+    }
+    _dict_id = ZSTD_getDictID_fromDict(dict.constData(), dict.size());
+}
+
+bool TcpMgr::compressBody(const QByteArray &data, QByteArray &out)
+{
+    if(!_b_compress || data.size() < TCP_COMPRESS_MIN_LEN){
+        return false;
+    }
+
+    out.resize(static_cast<int>(ZSTD_compressBound(data.size())));
+    size_t ret = _b_compress_dict && _cdict != nullptr
+            ? ZSTD_compress_usingCDict(_cctx, out.data(), out.size(), data.constData(), data.size(), _cdict)
+            : ZSTD_compressCCtx(_cctx, out.data(), out.size(), data.constData(), data.size(), TCP_COMPRESS_LEVEL);
+    //压缩后没有变小就按原文发送
+    if(ZSTD_isError(ret) || ret >= static_cast<size_t>(data.size())){
+        return false;
+    }
+
+    out.resize(static_cast<int>(ret));
+    return true;
+}
+
+bool TcpMgr::decompressBody(const QByteArray &data, QByteArray &out)
+{
+    auto content_size = ZSTD_getFrameContentSize(data.constData(), data.size());
+    if(content_size == ZSTD_CONTENTSIZE_ERROR || content_size == ZSTD_CONTENTSIZE_UNKNOWN
+            || content_size > TCP_DECOMPRESS_MAX_LEN){
+        return false;
+    }
+
+    //帧头里带了字典id，和本地字典不一致时无法解压
+    auto dict_id = ZSTD_getDictID_fromFrame(data.constData(), data.size());
+    if(dict_id != 0 && (dict_id != _dict_id || _ddict == nullptr)){
+        return false;
+    }
+
+    out.resize(static_cast<int>(content_size));
+    size_t ret = dict_id != 0
+            ? ZSTD_decompress_usingDDict(_dctx, out.data(), out.size(), data.constData(), data.size(), _ddict)
+            : ZSTD_decompressDCtx(_dctx, out.data(), out.size(), data.constData(), data.size());
+    return !ZSTD_isError(ret) && ret == content_size;
+}
 
+void TcpMgr::Stop()
+{
+    if(!_thread.isRunning()){
+        return;
+    }
+
+    //socket只能在所属线程关闭，关闭后把对象移回主线程再析构
+    QThread* main_thread = QCoreApplication::instance() ?
+                QCoreApplication::instance()->thread() : QThread::currentThread();
+    QMetaObject::invokeMethod(this, [this, main_thread]() {
+        _socket.abort();
+        moveToThread(main_thread);
+    }, Qt::BlockingQueuedConnection);
+    _thread.quit();
+    _thread.wait();
 }
 void TcpMgr::initHandlers()
 {
@@ -130,9 +253,22 @@ void TcpMgr::initHandlers()
         int err = jsonObj["error"].toInt();
         if(err != ErrorCodes::SUCCESS){
             qDebug() << "Login Failed, err is " << err ;
+            //迁移时的重新登录失败，界面在聊天页，按断开处理
+            if(_b_migrating){
+                _b_migrating = false;
+                _old_host.clear();
+                _socket.abort();
+                emit sig_connection_lost();
+                return;
+            }
             emit sig_login_failed(err);
             return;
         }
+
+        //服务器确认压缩后，本连接上超过阈值的消息压缩发送
+        _b_compress = jsonObj["compress"].toString() == "zstd";
+        _b_compress_dict = _b_compress && _dict_id != 0
+                && static_cast<unsigned int>(jsonObj["dict_id"].toDouble()) == _dict_id;
         
         auto uid = jsonObj["uid"].toInt();
         auto name = jsonObj["name"].toString();
@@ -140,21 +276,88 @@ void TcpMgr::initHandlers()
         auto icon = jsonObj["icon"].toString();
         auto sex = jsonObj["sex"].toInt();
         auto user_info = std::make_shared<UserInfo>(uid, name, nick, icon, sex);
- 
-        UserMgr::GetInstance()->SetUserInfo(user_info);
-        UserMgr::GetInstance()->SetToken(jsonObj["token"].toString());
-        if(jsonObj.contains("apply_list")){
-            UserMgr::GetInstance()->AppendApplyList(jsonObj["apply_list"].toArray());
+        auto token = jsonObj["token"].toString();
+
+        //列表在网络线程解析成对象，界面线程只负责合并
+        bool has_apply_ver = jsonObj.contains("apply_ver");
+        auto apply_sync = jsonObj["apply_sync"].toString();
+        auto apply_ver = jsonObj["apply_ver"].toInt();
+        auto apply_list = parseApplyList(jsonObj["apply_list"].toArray());
+
+        bool has_friend_ver = jsonObj.contains("friend_ver");
+        auto friend_sync = jsonObj["friend_sync"].toString();
+        auto friend_ver = jsonObj["friend_ver"].toInt();
+        auto friend_list = parseFriendList(jsonObj["friend_list"].toArray());
+        std::vector<int> friend_del;
+        for (const QJsonValue& value : jsonObj["friend_del"].toArray()) {
+            friend_del.push_back(value.toInt());
         }
 
-        //添加好友列表
-        if (jsonObj.contains("friend_list")) {
-            UserMgr::GetInstance()->AppendFriendList(jsonObj["friend_list"].toArray());
+        //UserMgr属于界面线程，投递过去修改，排在后面发出的切换界面信号之前执行
+        QMetaObject::invokeMethod(UserMgr::GetInstance().get(), [=]() {
+            UserMgr::GetInstance()->SetUserInfo(user_info);
+            UserMgr::GetInstance()->SetToken(token);
+            //服务器带了版本号，按同步方式(full/delta/none)合并到本地
+            if(has_apply_ver){
+                UserMgr::GetInstance()->SyncApplyList(apply_sync, apply_ver, apply_list);
+            }else{
+                UserMgr::GetInstance()->AppendApplyList(apply_list);
+            }
+
+            //添加好友列表
+            if(has_friend_ver){
+                UserMgr::GetInstance()->SyncFriendList(friend_sync, friend_ver, friend_list, friend_del);
+            }else{
+                UserMgr::GetInstance()->AppendFriendList(friend_list);
+            }
+        }, Qt::QueuedConnection);
+
+        //迁移后的重新登录只刷新列表，不再切换界面
+        if(_b_migrating){
+            _b_migrating = false;
+            qDebug() << "migrate to " << _host << ":" << _port << " success";
+            return;
         }
 
         emit sig_swich_chatdlg();
     });
 
+    _handlers.insert(ID_NOTIFY_MIGRATE_REQ, [this](ReqId id, int len, QByteArray data) {
+        Q_UNUSED(len);
+        qDebug() << "handle id is " << id << " data is " << data;
+        // 将QByteArray转换为QJsonDocument
+        QJsonDocument jsonDoc = QJsonDocument::fromJson(data);
+
+        // 检查转换是否成功
+        if (jsonDoc.isNull()) {
+            qDebug() << "Failed to create QJsonDocument.";
+            return;
+        }
+
+        QJsonObject jsonObj = jsonDoc.object();
+
+        if (!jsonObj.contains("error")) {
+            int err = ErrorCodes::ERR_JSON;
+            qDebug() << "Notify Migrate Failed, err is Json Parse Err" << err;
+            return;
+        }
+
+        int err = jsonObj["error"].toInt();
+        if (err != ErrorCodes::SUCCESS) {
+            qDebug() << "Notify Migrate Failed, err is " << err;
+            return;
+        }
+
+        //新服务器的token已经由状态服务器写好，重连时直接使用
+        auto token = jsonObj["token"].toString();
+        QMetaObject::invokeMethod(UserMgr::GetInstance().get(), [token]() {
+            UserMgr::GetInstance()->SetToken(token);
+        }, Qt::QueuedConnection);
+        startMigrate(jsonObj["host"].toString(),
+                     static_cast<uint16_t>(jsonObj["port"].toString().toUInt()),
+                     jsonObj["delay"].toInt());
+      });
+
 
 	_handlers.insert(ID_SEARCH_USER_RSP, [this](ReqId id, int len, QByteArray data) {
 		Q_UNUSED(len);
@@ -365,8 +568,9 @@ void TcpMgr::initHandlers()
             return;
         }
 
-        qDebug() << "Receive Text Chat Rsp Success " ;
-        //ui设置送达等标记 todo...
+        //回包只带msgid、序号和时间戳，按msgid把本地已经显示的消息标记为送达
+        auto ack_ptr = std::make_shared<TextChatAck>(jsonObj["acks"].toArray());
+        emit sig_text_chat_ack(ack_ptr);
       });
 
     _handlers.insert(ID_NOTIFY_TEXT_CHAT_MSG_REQ, [this](ReqId id, int len, QByteArray data) {
@@ -402,6 +606,26 @@ void TcpMgr::initHandlers()
       });
 }
 
+void TcpMgr::parseFrames()
+{
+    _parser.Parse([this](uint16_t message_id, const char* data, int len) {
+        // 只拷贝消息体本身交给处理函数
+        QByteArray messageBody(data, len);
+        //消息id最高位是压缩标志，解压后按原消息id处理
+        if(message_id & TCP_COMPRESS_FLAG){
+            QByteArray plain;
+            quint16 msg_id = message_id & ~TCP_COMPRESS_FLAG;
+            if(!decompressBody(messageBody, plain)){
+                qDebug() << "decompress msg failed, id is " << msg_id;
+                return;
+            }
+            handleMsg(ReqId(msg_id), plain.size(), plain);
+            return;
+        }
+        handleMsg(ReqId(message_id), len, messageBody);
+    });
+}
+
 void TcpMgr::handleMsg(ReqId id, int len, QByteArray data)
 {
    auto find_iter =  _handlers.find(id);
@@ -413,6 +637,85 @@ void TcpMgr::handleMsg(ReqId id, int len, QByteArray data)
    find_iter.value()(id,len,data);
 }
 
+void TcpMgr::startMigrate(QString host, uint16_t port, int delay)
+{
+    if(_b_migrating){
+        return;
+    }
+
+    _b_migrating = true;
+    _old_host = _host;
+    _old_port = _port;
+    //服务器给每个客户端分配了随机延迟，错开重连避免新服务器被瞬间打满
+    QTimer::singleShot(delay, this, [this, host, port]() {
+        qDebug() << "migrate to " << host << ":" << port;
+        _socket.flush();
+        _socket.abort();
+        _parser.Reset();
+        _host = host;
+        _port = port;
+        _socket.connectToHost(_host, _port);
+    });
+}
+
+void TcpMgr::sendChatLogin()
+{
+    //登录信息在UserMgr中，到界面线程组包后再通过信号交回网络线程发送
+    QMetaObject::invokeMethod(UserMgr::GetInstance().get(), []() {
+        QJsonObject jsonObj;
+        jsonObj["uid"] = UserMgr::GetInstance()->GetUid();
+        jsonObj["token"] = UserMgr::GetInstance()->GetToken();
+        //本地列表已经是最新的，只需拉取迁移期间的增量
+        if(UserMgr::GetInstance()->HasSyncVer(UserMgr::GetInstance()->GetUid())){
+            jsonObj["friend_ver"] = UserMgr::GetInstance()->GetFriendVer();
+            jsonObj["apply_ver"] = UserMgr::GetInstance()->GetApplyVer();
+        }
+        //声明支持zstd压缩，带上本地字典id
+        jsonObj["compress"] = "zstd";
+        jsonObj["dict_id"] = static_cast<qint64>(TcpMgr::GetInstance()->GetDictId());
+
+        QJsonDocument doc(jsonObj);
+        QByteArray jsonData = doc.toJson(QJsonDocument::Indented);
+        emit TcpMgr::GetInstance()->sig_send_data(ReqId::ID_CHAT_LOGIN, jsonData);
+    }, Qt::QueuedConnection);
+}
+
+std::vector<std::shared_ptr<ApplyInfo>> TcpMgr::parseApplyList(QJsonArray array)
+{
+    std::vector<std::shared_ptr<ApplyInfo>> apply_list;
+    // 遍历 QJsonArray 构造申请信息
+    for (const QJsonValue &value : array) {
+        auto name = value["name"].toString();
+        auto desc = value["desc"].toString();
+        auto icon = value["icon"].toString();
+        auto nick = value["nick"].toString();
+        auto sex = value["sex"].toInt();
+        auto uid = value["uid"].toInt();
+        auto status = value["status"].toInt();
+        apply_list.push_back(std::make_shared<ApplyInfo>(uid, name,
+                           desc, icon, nick, sex, status));
+    }
+    return apply_list;
+}
+
+std::vector<std::shared_ptr<FriendInfo>> TcpMgr::parseFriendList(QJsonArray array)
+{
+    std::vector<std::shared_ptr<FriendInfo>> friend_list;
+    // 遍历 QJsonArray 构造好友信息
+    for (const QJsonValue& value : array) {
+        auto name = value["name"].toString();
+        auto desc = value["desc"].toString();
+        auto icon = value["icon"].toString();
+        auto nick = value["nick"].toString();
+        auto sex = value["sex"].toInt();
+        auto uid = value["uid"].toInt();
+        auto back = value["back"].toString();
+        friend_list.push_back(std::make_shared<FriendInfo>(uid, name,
+            nick, icon, sex, desc, back));
+    }
+    return friend_list;
+}
+
 void TcpMgr::slot_tcp_connect(ServerInfo si)
 {
     qDebug()<< "receive tcp connect signal";
@@ -427,6 +730,13 @@ void TcpMgr::slot_send_data(ReqId reqId, QByteArray dataBytes)
 {
     uint16_t id = reqId;
 
+    //协商过压缩时，超过阈值的消息压缩后发送并在id上打标志
+    QByteArray compressed;
+    if(compressBody(dataBytes, compressed)){
+        id |= TCP_COMPRESS_FLAG;
+        dataBytes = compressed;
+    }
+
     // 计算长度（使用网络字节序转换）
     quint16 len = static_cast<quint16>(dataBytes.length());
 
@@ -7,6 +7,10 @@
 #include <QObject>
 #include "userdata.h"
 #include <QJsonArray>
+#include <QThread>
+#include <vector>
+#include <zstd.h>
+#include "frameparser.h"
 
 class TcpMgr:public QObject, public Singleton<TcpMgr>,
         public std::enable_shared_from_this<TcpMgr>
@@ -14,24 +18,53 @@ class TcpMgr:public QObject, public Singleton<TcpMgr>,
     Q_OBJECT
 public:
    ~ TcpMgr();
+    void Stop();
+    //本地压缩字典的id，登录时告诉服务器，没有字典时为0
+    unsigned int GetDictId();
 private:
     friend class Singleton<TcpMgr>;
+    //测试在界面线程直接驱动拆包，对比旧的线程模型
+    friend class TestTcpMgrThread;
     TcpMgr();
     void initHandlers();
+    void parseFrames();
     void handleMsg(ReqId id, int len, QByteArray data);
+    void startMigrate(QString host, uint16_t port, int delay);
+    void sendChatLogin();
+    static std::vector<std::shared_ptr<ApplyInfo>> parseApplyList(QJsonArray array);
+    static std::vector<std::shared_ptr<FriendInfo>> parseFriendList(QJsonArray array);
+    //加载和服务器相同的压缩字典
+    void loadCompressDict();
+    bool compressBody(const QByteArray& data, QByteArray& out);
+    bool decompressBody(const QByteArray& data, QByteArray& out);
+    QThread _thread;
     QTcpSocket _socket;
     QString _host;
     uint16_t _port;
-    QByteArray _buffer;
-    bool _b_recv_pending;
-    quint16 _message_id;
-    quint16 _message_len;
+    //拆包不依赖socket，读到的数据直接写进解析器的缓冲区
+    FrameParser _parser;
     QMap<ReqId, std::function<void(ReqId id, int len, QByteArray data)>> _handlers;
+    //服务器排空时迁移到新服务器，迁移中的重连不走登录界面
+    bool _b_migrating;
+    QString _old_host;
+    uint16_t _old_port;
+    //压缩上下文只在网络线程使用
+    ZSTD_CCtx* _cctx;
+    ZSTD_DCtx* _dctx;
+    ZSTD_CDict* _cdict;
+    ZSTD_DDict* _ddict;
+    unsigned int _dict_id;
+    //服务器在登录回包里确认了压缩，之后超过阈值的消息压缩发送
+    bool _b_compress;
+    //服务器和本地的字典一致
+    bool _b_compress_dict;
 public slots:
     void slot_tcp_connect(ServerInfo);
     void slot_send_data(ReqId reqId, QByteArray data);
 signals:
     void sig_con_success(bool bsuccess);
+    //已经在聊天页时迁移和回退原服务器都失败，连接断开
+    void sig_connection_lost();
     void sig_send_data(ReqId reqId, QByteArray data);
     void sig_swich_chatdlg();
     void sig_load_apply_list(QJsonArray json_array);
@@ -41,6 +74,16 @@ signals:
     void sig_add_auth_friend(std::shared_ptr<AuthInfo>);
     void sig_auth_rsp(std::shared_ptr<AuthRsp>);
     void sig_text_chat_msg(std::shared_ptr<TextChatMsg> msg);
+    void sig_text_chat_ack(std::shared_ptr<TextChatAck> ack);
 };
 
+Q_DECLARE_METATYPE(ReqId)
+Q_DECLARE_METATYPE(ServerInfo)
+Q_DECLARE_METATYPE(std::shared_ptr<SearchInfo>)
+Q_DECLARE_METATYPE(std::shared_ptr<AddFriendApply>)
+Q_DECLARE_METATYPE(std::shared_ptr<AuthInfo>)
+Q_DECLARE_METATYPE(std::shared_ptr<AuthRsp>)
+Q_DECLARE_METATYPE(std::shared_ptr<TextChatMsg>)
+Q_DECLARE_METATYPE(std::shared_ptr<TextChatAck>)
+
 #endif // TCPMGR_H
@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# ChatMsgModel/ChatMsgDelegate的QtTest，只依赖Qt，不需要服务器
+# qmake chatmsgview.pro && make && ./tst_chatmsgview
+# 没有显示器时加 -platform offscreen
+#
+#-------------------------------------------------
+
+QT       += core gui network widgets testlib
+
+TARGET = tst_chatmsgview
+TEMPLATE = app
+CONFIG += c++11 testcase console
+CONFIG -= app_bundle
+
+CLIENT_DIR = $$PWD/../..
+INCLUDEPATH += $$CLIENT_DIR
+
+SOURCES += \
+        tst_chatmsgview.cpp \
+        $$CLIENT_DIR/ChatMsgDelegate.cpp \
+        $$CLIENT_DIR/ChatMsgModel.cpp \
+        $$CLIENT_DIR/avatarcache.cpp \
+        $$CLIENT_DIR/global.cpp \
+        $$CLIENT_DIR/thumbnailmgr.cpp
+
+HEADERS += \
+        $$CLIENT_DIR/ChatMsgDelegate.h \
+        $$CLIENT_DIR/ChatMsgModel.h \
+        $$CLIENT_DIR/avatarcache.h \
+        $$CLIENT_DIR/global.h \
+        $$CLIENT_DIR/singleton.h \
+        $$CLIENT_DIR/thumbnailmgr.h
@@ -0,0 +1,165 @@
+#include <QtTest>
+#include <QListView>
+#include <QScrollBar>
+#include "ChatMsgModel.h"
+#include "ChatMsgDelegate.h"
+
+//统计委托绘制的行数，用来确认只有可见行会被绘制
+class CountingDelegate : public ChatMsgDelegate
+{
+public:
+    explicit CountingDelegate(QObject *parent = nullptr)
+        : ChatMsgDelegate(parent), _paint_count(0){}
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const override
+    {
+        ++_paint_count;
+        ChatMsgDelegate::paint(painter, option, index);
+    }
+    mutable int _paint_count;
+};
+
+class TestChatMsgView : public QObject
+{
+    Q_OBJECT
+private slots:
+    void heightCache();
+    void heightFollowsWidth();
+    void ackMsgs();
+    void scroll100k();
+private:
+    static std::shared_ptr<ChatMsgItem> makeText(int i, const QString& content);
+};
+
+std::shared_ptr<ChatMsgItem> TestChatMsgView::makeText(int i, const QString &content)
+{
+    return std::make_shared<ChatMsgItem>(QString("msg_%1").arg(i),
+        i % 2 ? ChatRole::Self : ChatRole::Other, QString("user_%1").arg(i % 2),
+        ":/res/head_1.jpg", "text", content);
+}
+
+//高度按msgid缓存：内容变了但宽度没变时不重新测量，宽度变化或清空缓存后才重新测量
+void TestChatMsgView::heightCache()
+{
+    ChatMsgModel model;
+    ChatMsgDelegate delegate;
+    delegate.setViewWidth(400);
+    auto item = makeText(1, "short");
+    model.appendMsg(item);
+    QStyleOptionViewItem option;
+    QModelIndex idx = model.index(0);
+    int short_height = delegate.sizeHint(option, idx).height();
+
+    item->_content = QString(2000, QChar('a'));
+    QCOMPARE(delegate.sizeHint(option, idx).height(), short_height);
+
+    delegate.setViewWidth(400);
+    QCOMPARE(delegate.sizeHint(option, idx).height(), short_height);
+
+    delegate.setViewWidth(401);
+    int long_height = delegate.sizeHint(option, idx).height();
+    QVERIFY(long_height > short_height);
+
+    item->_content = "short";
+    QCOMPARE(delegate.sizeHint(option, idx).height(), long_height);
+    delegate.clearCache();
+    QCOMPARE(delegate.sizeHint(option, idx).height(), short_height);
+}
+
+//视图变窄后长文本换行更多，气泡变高
+void TestChatMsgView::heightFollowsWidth()
+{
+    ChatMsgModel model;
+    ChatMsgDelegate delegate;
+    model.appendMsg(makeText(1, QString(300, QChar('a'))));
+    QStyleOptionViewItem option;
+    QModelIndex idx = model.index(0);
+
+    delegate.setViewWidth(800);
+    QSize wide = delegate.sizeHint(option, idx);
+    delegate.setViewWidth(300);
+    QSize narrow = delegate.sizeHint(option, idx);
+    QCOMPARE(wide.width(), 800);
+    QCOMPARE(narrow.width(), 300);
+    QVERIFY(narrow.height() > wide.height());
+}
+
+void TestChatMsgView::ackMsgs()
+{
+    ChatMsgModel model;
+    for(int i = 0; i < 10; ++i){
+        auto item = makeText(i, "hello");
+        item->_b_acked = false;
+        model.appendMsg(item);
+    }
+
+    QSignalSpy spy(&model, &QAbstractItemModel::dataChanged);
+    model.ackMsgs(QStringList() << "msg_8" << "msg_3" << "msg_missing");
+    QCOMPARE(spy.count(), 2);
+    for(int i = 0; i < 10; ++i){
+        QCOMPARE(model.index(i).data(ChatMsgModel::AckedRole).toBool(), i == 8 || i == 3);
+    }
+}
+
+//10万条消息：滚动到底部后逐屏往上翻，每一屏只绘制可见的几行，首尾两端都能定位到
+void TestChatMsgView::scroll100k()
+{
+    const int msg_count = 100000;
+    ChatMsgModel model;
+    std::vector<std::shared_ptr<ChatMsgItem>> items;
+    items.reserve(msg_count);
+    for(int i = 0; i < msg_count; ++i){
+        items.push_back(makeText(i, QString("message %1 ").arg(i).repeated(1 + i % 7)));
+    }
+    model.prependMsgs(items);
+    QCOMPARE(model.rowCount(), msg_count);
+
+    QListView view;
+    CountingDelegate delegate;
+    view.setModel(&model);
+    view.setItemDelegate(&delegate);
+    view.setUniformItemSizes(false);
+    view.setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    view.resize(400, 600);
+    delegate.setViewWidth(view.viewport()->width());
+
+    QElapsedTimer timer;
+    timer.start();
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    view.scrollToBottom();
+    QCoreApplication::processEvents();
+    qDebug() << "layout" << msg_count << "msgs in" << timer.elapsed() << "ms";
+
+    QScrollBar *bar = view.verticalScrollBar();
+    QVERIFY(bar->maximum() > 0);
+    QCOMPARE(bar->value(), bar->maximum());
+    QCOMPARE(view.indexAt(QPoint(10, view.viewport()->height() - 5)).row(), msg_count - 1);
+
+    //从底部往上翻100屏
+    int page = view.viewport()->height();
+    int pages = 0;
+    timer.restart();
+    for(; pages < 100 && bar->value() > bar->minimum(); ++pages){
+        delegate._paint_count = 0;
+        bar->setValue(bar->value() - page);
+        view.viewport()->repaint();
+        //一屏600像素，每条至少48像素高，绘制的行数不会超过一屏能放下的数量
+        QVERIFY2(delegate._paint_count <= page / 48 + 2,
+                 qPrintable(QString("painted %1 rows").arg(delegate._paint_count)));
+        QVERIFY(delegate._paint_count > 0);
+    }
+    qDebug() << "scrolled" << pages << "pages in" << timer.elapsed() << "ms";
+
+    //跳到顶部再回到底部
+    bar->setValue(bar->minimum());
+    view.viewport()->repaint();
+    QCOMPARE(view.indexAt(QPoint(10, 5)).row(), 0);
+    bar->setValue(bar->maximum());
+    view.viewport()->repaint();
+    QCOMPARE(view.indexAt(QPoint(10, view.viewport()->height() - 5)).row(), msg_count - 1);
+}
+
+QTEST_MAIN(TestChatMsgView)
+
+#include "tst_chatmsgview.moc"
@@ -0,0 +1,40 @@
+#-------------------------------------------------
+#
+# TcpMgr网络线程的QtTest：本地起一个服务器连续推5000条聊天通知，
+# 统计界面线程事件循环的最大间隔，对比拆包和解析在界面线程(旧)和网络线程(新)的差别
+# qmake tcpmgrthread.pro && make && ./tst_tcpmgrthread
+# 没有显示器时加 -platform offscreen
+#
+#-------------------------------------------------
+
+QT       += core gui network sql widgets testlib
+
+TARGET = tst_tcpmgrthread
+TEMPLATE = app
+CONFIG += c++11 testcase console
+CONFIG -= app_bundle
+
+CLIENT_DIR = $$PWD/../..
+INCLUDEPATH += $$CLIENT_DIR
+
+win32: INCLUDEPATH += D:/cppsoft/zstd/lib
+win32: LIBS += -LD:/cppsoft/zstd/build/VS2010/bin/x64_Release -llibzstd_static
+unix: LIBS += -lzstd
+
+SOURCES += \
+        tst_tcpmgrthread.cpp \
+        $$CLIENT_DIR/tcpmgr.cpp \
+        $$CLIENT_DIR/frameparser.cpp \
+        $$CLIENT_DIR/usermgr.cpp \
+        $$CLIENT_DIR/userdata.cpp \
+        $$CLIENT_DIR/msgdb.cpp \
+        $$CLIENT_DIR/global.cpp
+
+HEADERS += \
+        $$CLIENT_DIR/tcpmgr.h \
+        $$CLIENT_DIR/frameparser.h \
+        $$CLIENT_DIR/usermgr.h \
+        $$CLIENT_DIR/userdata.h \
+        $$CLIENT_DIR/msgdb.h \
+        $$CLIENT_DIR/global.h \
+        $$CLIENT_DIR/singleton.h
@@ -0,0 +1,218 @@
+#include <QtTest>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QThread>
+#include <QtEndian>
+#include <QJsonArray>
+#include "tcpmgr.h"
+
+//本地服务器，放在单独线程里，客户端连上后一次写完所有帧
+class FrameServer : public QObject
+{
+public:
+    explicit FrameServer(const QByteArray& frames)
+        : _frames(frames), _server(this), _port(0)
+    {
+        connect(&_server, &QTcpServer::newConnection, this, [this]() {
+            QTcpSocket* socket = _server.nextPendingConnection();
+            socket->write(_frames);
+        });
+    }
+    //在服务器线程中调用
+    void listen()
+    {
+        _server.listen(QHostAddress::LocalHost, 0);
+        _port = _server.serverPort();
+    }
+    quint16 port() const { return _port; }
+private:
+    QByteArray _frames;
+    QTcpServer _server;
+    quint16 _port;
+};
+
+//界面线程上1ms的定时器，记录两次触发之间的最大间隔，就是界面最长卡住的时间
+class LoopGapProbe
+{
+public:
+    LoopGapProbe() : _last(0), _max_gap(0)
+    {
+        _timer.setTimerType(Qt::PreciseTimer);
+        _timer.setInterval(1);
+        QObject::connect(&_timer, &QTimer::timeout, [this]() {
+            qint64 now = _clock.elapsed();
+            _max_gap = qMax(_max_gap, now - _last);
+            _last = now;
+        });
+    }
+    void start()
+    {
+        _clock.start();
+        _last = 0;
+        _max_gap = 0;
+        _timer.start();
+    }
+    qint64 stop()
+    {
+        _timer.stop();
+        return _max_gap;
+    }
+private:
+    QTimer _timer;
+    QElapsedTimer _clock;
+    qint64 _last;
+    qint64 _max_gap;
+};
+
+class TestTcpMgrThread : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void notifyGap();
+private:
+    static QByteArray makeFrames(int count);
+    //旧的线程模型：socket、拆包和json解析都在界面线程
+    void runGuiThread(quint16 port, int count, qint64& gap);
+    //新的线程模型：TcpMgr在网络线程，界面线程只接收解析好的对象
+    void runNetThread(quint16 port, int count, qint64& gap);
+    QThread _server_thread;
+};
+
+static QtMessageHandler s_prev_handler = nullptr;
+
+//TcpMgr每帧都用qDebug打印消息体，测试期间丢掉，只保留结果
+static void dropDebug(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    if(type == QtDebugMsg){
+        return;
+    }
+    s_prev_handler(type, context, msg);
+}
+
+void TestTcpMgrThread::initTestCase()
+{
+    s_prev_handler = qInstallMessageHandler(dropDebug);
+    _server_thread.start();
+}
+
+void TestTcpMgrThread::cleanupTestCase()
+{
+    _server_thread.quit();
+    _server_thread.wait();
+    TcpMgr::GetInstance()->Stop();
+    qInstallMessageHandler(s_prev_handler);
+}
+
+QByteArray TestTcpMgrThread::makeFrames(int count)
+{
+    QByteArray frames;
+    for(int i = 0; i < count; ++i){
+        QJsonObject text;
+        text["msgid"] = QString("{3f2504e0-4f89-11d3-9a0c-0305e82c%1}").arg(1000 + i);
+        text["content"] = QString("notify text message %1 ").arg(i).repeated(8);
+        QJsonArray text_array;
+        text_array.append(text);
+        QJsonObject obj;
+        obj["error"] = 0;
+        obj["fromuid"] = 1019;
+        obj["touid"] = 1020;
+        obj["text_array"] = text_array;
+        QByteArray body = QJsonDocument(obj).toJson();
+
+        quint16 id = qToBigEndian<quint16>(ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+        quint16 len = qToBigEndian<quint16>(static_cast<quint16>(body.size()));
+        frames.append(reinterpret_cast<const char*>(&id), sizeof(id));
+        frames.append(reinterpret_cast<const char*>(&len), sizeof(len));
+        frames.append(body);
+    }
+    return frames;
+}
+
+void TestTcpMgrThread::runGuiThread(quint16 port, int count, qint64& gap)
+{
+    auto mgr = TcpMgr::GetInstance();
+    int received = 0;
+    QObject receiver;
+    connect(mgr.get(), &TcpMgr::sig_text_chat_msg, &receiver, [&received](std::shared_ptr<TextChatMsg>) {
+        ++received;
+    });
+
+    //和改动前TcpMgr的readyRead一样在界面线程读数据、拆包，处理函数里解析json并直接发出信号
+    QTcpSocket socket;
+    connect(&socket, &QTcpSocket::readyRead, [&socket, mgr]() {
+        qint64 avail = socket.bytesAvailable();
+        char* dst = mgr->_parser.Prepare(static_cast<int>(avail));
+        qint64 read_len = socket.read(dst, avail);
+        mgr->_parser.Commit(static_cast<int>(qMax<qint64>(read_len, 0)));
+        mgr->parseFrames();
+    });
+
+    LoopGapProbe probe;
+    probe.start();
+    socket.connectToHost(QHostAddress::LocalHost, port);
+    QTRY_COMPARE_WITH_TIMEOUT(received, count, 60000);
+    gap = probe.stop();
+    socket.abort();
+    mgr->_parser.Reset();
+}
+
+void TestTcpMgrThread::runNetThread(quint16 port, int count, qint64& gap)
+{
+    auto mgr = TcpMgr::GetInstance();
+    int received = 0;
+    QObject receiver;
+    connect(mgr.get(), &TcpMgr::sig_text_chat_msg, &receiver, [&received](std::shared_ptr<TextChatMsg>) {
+        ++received;
+    });
+
+    LoopGapProbe probe;
+    probe.start();
+    ServerInfo si;
+    si.Host = "127.0.0.1";
+    si.Port = QString::number(port);
+    si.Uid = 0;
+    QMetaObject::invokeMethod(mgr.get(), [mgr, si]() {
+        mgr->slot_tcp_connect(si);
+    }, Qt::QueuedConnection);
+    QTRY_COMPARE_WITH_TIMEOUT(received, count, 60000);
+    gap = probe.stop();
+}
+
+//5000条通知分别走两种线程模型，所有通知都要收到，输出界面事件循环的最大间隔
+void TestTcpMgrThread::notifyGap()
+{
+    const int count = 5000;
+    QByteArray frames = makeFrames(count);
+
+    FrameServer gui_server(frames);
+    FrameServer net_server(frames);
+    gui_server.moveToThread(&_server_thread);
+    net_server.moveToThread(&_server_thread);
+    QMetaObject::invokeMethod(&gui_server, [&gui_server]() { gui_server.listen(); }, Qt::BlockingQueuedConnection);
+    QMetaObject::invokeMethod(&net_server, [&net_server]() { net_server.listen(); }, Qt::BlockingQueuedConnection);
+    QVERIFY(gui_server.port() != 0);
+    QVERIFY(net_server.port() != 0);
+
+    qint64 gui_gap = 0;
+    qint64 net_gap = 0;
+    runGuiThread(gui_server.port(), count, gui_gap);
+    if(!QTest::currentTestFailed()){
+        runNetThread(net_server.port(), count, net_gap);
+    }
+    qInfo() << count << "notify frames, max gui event loop gap: gui thread" << gui_gap
+            << "ms, network thread" << net_gap << "ms";
+
+    //服务器对象在测试线程析构，先从服务器线程移回来
+    QMetaObject::invokeMethod(&gui_server, [&gui_server, this]() {
+        gui_server.moveToThread(thread());
+    }, Qt::BlockingQueuedConnection);
+    QMetaObject::invokeMethod(&net_server, [&net_server, this]() {
+        net_server.moveToThread(thread());
+    }, Qt::BlockingQueuedConnection);
+}
+
+QTEST_MAIN(TestTcpMgrThread)
+
+#include "tst_tcpmgrthread.moc"
@@ -0,0 +1,179 @@
+#include "thumbnailmgr.h"
+#include <QImageReader>
+#include <QCryptographicHash>
+#include <QStandardPaths>
+#include <QFileInfo>
+#include <QFile>
+#include <QSaveFile>
+#include <QDateTime>
+#include <QDir>
+#include <functional>
+#include <QDebug>
+#include <QRunnable>
+
+//后台生成缩略图的任务，完成后回到界面线程写入内存缓存
+class ThumbnailTask : public QRunnable
+{
+public:
+    ThumbnailTask(ThumbnailMgr* mgr, const QString& path, const QSize& max_size,
+                  const QString& cache_dir, std::function<void(QImage)> done)
+        :_mgr(mgr), _path(path), _max_size(max_size), _cache_dir(cache_dir), _done(done) {}
+
+    void run() override {
+        QImage image = ThumbnailMgr::LoadThumbnail(_path, _max_size, _cache_dir);
+        auto done = _done;
+        QMetaObject::invokeMethod(_mgr, [done, image](){
+            done(image);
+        }, Qt::QueuedConnection);
+    }
+private:
+    ThumbnailMgr* _mgr;
+    QString _path;
+    QSize _max_size;
+    QString _cache_dir;
+    std::function<void(QImage)> _done;
+};
+
+ThumbnailMgr::ThumbnailMgr()
+{
+    _cache_dir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+            + QDir::separator() + "thumbs";
+    QDir().mkpath(_cache_dir);
+    _cache.setMaxCost(THUMB_CACHE_MAX_KB);
+    _pool.setMaxThreadCount(THUMB_LOAD_THREADS);
+}
+
+ThumbnailMgr::~ThumbnailMgr()
+{
+    _pool.waitForDone();
+}
+
+QString ThumbnailMgr::MakeKey(const QString &path, const QSize &max_size) const
+{
+    return QString("%1|%2x%3").arg(path).arg(max_size.width()).arg(max_size.height());
+}
+
+QSize ThumbnailMgr::ThumbnailSize(const QString &path, const QSize &max_size)
+{
+    QString key = MakeKey(path, max_size);
+    auto iter = _size_cache.find(key);
+    if(iter != _size_cache.end()){
+        return iter.value();
+    }
+
+    //QImageReader::size只解析文件头，不解码像素
+    QSize src_size = QImageReader(path).size();
+    QSize size = max_size;
+    if(src_size.isValid()){
+        size = src_size.scaled(max_size, Qt::KeepAspectRatio);
+    }
+    _size_cache.insert(key, size);
+    return size;
+}
+
+QString ThumbnailMgr::LookupContentHash(const QFileInfo &info, const QString &cache_dir)
+{
+    //路径、大小、修改时间都没变时认为内容没变，直接用上次算出的内容哈希，不再读整个文件
+    QString index_src = QString("%1|%2|%3").arg(info.absoluteFilePath()).arg(info.size())
+            .arg(info.lastModified().toMSecsSinceEpoch());
+    QString index_path = QString("%1%2%3.idx").arg(cache_dir).arg(QDir::separator())
+            .arg(QString(QCryptographicHash::hash(index_src.toUtf8(), QCryptographicHash::Sha1).toHex()));
+
+    QFile index_file(index_path);
+    if(index_file.open(QIODevice::ReadOnly)){
+        QString content_hash = QString::fromLatin1(index_file.readAll()).trimmed();
+        if(content_hash.length() == 40){
+            return content_hash;
+        }
+    }
+
+    QFile file(info.absoluteFilePath());
+    if(!file.open(QIODevice::ReadOnly)){
+        return QString();
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+    file.close();
+    QString content_hash = QString(hash.result().toHex());
+
+    //多个后台线程可能同时写同一条索引，QSaveFile先写临时文件再改名，读到的总是完整内容
+    QSaveFile save(index_path);
+    if(save.open(QIODevice::WriteOnly)){
+        save.write(content_hash.toLatin1());
+        if(!save.commit()){
+            qDebug() << "save thumbnail index failed: " << index_path;
+        }
+    }
+    return content_hash;
+}
+
+QImage ThumbnailMgr::LoadThumbnail(const QString &path, const QSize &max_size, const QString &cache_dir)
+{
+    QFileInfo info(path);
+    if(!info.isFile()){
+        return QImage();
+    }
+
+    //按内容哈希命名，同一张图片换了路径也能命中磁盘缓存
+    QString content_hash = LookupContentHash(info, cache_dir);
+    if(content_hash.isEmpty()){
+        return QImage();
+    }
+    QString thumb_path = QString("%1%2%3_%4x%5.png").arg(cache_dir).arg(QDir::separator())
+            .arg(content_hash).arg(max_size.width()).arg(max_size.height());
+
+    QImage image;
+    if(QFileInfo::exists(thumb_path) && image.load(thumb_path)){
+        return image;
+    }
+
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+    QSize src_size = reader.size();
+    if(src_size.isValid() && (src_size.width() > max_size.width() || src_size.height() > max_size.height())){
+        //直接按缩略图分辨率解码，jpeg等格式在解码阶段就完成缩小
+        reader.setScaledSize(src_size.scaled(max_size, Qt::KeepAspectRatio));
+    }
+
+    if(!reader.read(&image)){
+        qDebug() << "decode image failed: " << path << " " << reader.errorString();
+        return QImage();
+    }
+
+    //PNG无损且带透明通道，缩略图都很小
+    if(!image.save(thumb_path, "PNG")){
+        qDebug() << "save thumbnail failed: " << thumb_path;
+    }
+    return image;
+}
+
+QPixmap ThumbnailMgr::GetThumbnail(const QString &path, const QSize &max_size)
+{
+    QString key = MakeKey(path, max_size);
+    QPixmap* pix = _cache.object(key);
+    if(pix != nullptr){
+        return *pix;
+    }
+
+    if(_loading.contains(key)){
+        return QPixmap();
+    }
+
+    _loading.insert(key);
+    _pool.start(new ThumbnailTask(this, path, max_size, _cache_dir,
+        [this, key, path, max_size](QImage image){
+        slot_thumbnail_loaded(key, path, max_size, image);
+    }));
+    return QPixmap();
+}
+
+void ThumbnailMgr::slot_thumbnail_loaded(const QString &key, const QString &path,
+                                         const QSize &max_size, const QImage &image)
+{
+    _loading.remove(key);
+    //解码失败也缓存一个空图，避免反复提交
+    QPixmap* pix = new QPixmap(QPixmap::fromImage(image));
+    int cost = qMax(1, pix->width() * pix->height() * 4 / 1024);
+    _cache.insert(key, pix, cost);
+    emit sig_thumbnail_ready(path, max_size);
+}
@@ -0,0 +1,46 @@
+#ifndef THUMBNAILMGR_H
+#define THUMBNAILMGR_H
+#include "singleton.h"
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QSet>
+#include <QPixmap>
+#include <QImage>
+#include <QThreadPool>
+#include <QFileInfo>
+
+//图片缩略图管理，聊天图片和输入框里的图片都从这里取缩略图
+//后台线程用QImageReader::setScaledSize直接按缩略图分辨率解码，大图不会整张解码
+//生成的缩略图按文件内容的哈希存到磁盘缓存目录，同一张图片以后不再解码原图
+//(路径,大小,修改时间)到内容哈希的索引也存在缓存目录，文件没变时命中缓存不需要读原图
+class ThumbnailMgr : public QObject, public Singleton<ThumbnailMgr>
+{
+    Q_OBJECT
+public:
+    ~ThumbnailMgr();
+    //取缩略图，未生成时提交后台任务并返回空图，生成后发出sig_thumbnail_ready，只能在界面线程调用
+    QPixmap GetThumbnail(const QString& path, const QSize& max_size);
+    //只读图片头计算缩略图大小，用于在缩略图生成前确定布局
+    QSize ThumbnailSize(const QString& path, const QSize& max_size);
+    //后台线程使用：解码或从磁盘缓存读取缩略图
+    static QImage LoadThumbnail(const QString& path, const QSize& max_size, const QString& cache_dir);
+private:
+    friend class Singleton<ThumbnailMgr>;
+    ThumbnailMgr();
+    QString MakeKey(const QString& path, const QSize& max_size) const;
+    //后台线程使用：按(路径,大小,修改时间)查内容哈希，索引未命中时才读整个文件计算
+    static QString LookupContentHash(const QFileInfo& info, const QString& cache_dir);
+    void slot_thumbnail_loaded(const QString& key, const QString& path,
+                               const QSize& max_size, const QImage& image);
+
+    QString _cache_dir;
+    QCache<QString, QPixmap> _cache;
+    QHash<QString, QSize> _size_cache;
+    QSet<QString> _loading;
+    QThreadPool _pool;
+signals:
+    void sig_thumbnail_ready(const QString& path, const QSize& max_size);
+};
+
+#endif // THUMBNAILMGR_H
@@ -94,8 +94,6 @@ struct FriendInfo {
     _nick(auth_rsp->_nick),_icon(auth_rsp->_icon),_name(auth_rsp->_name),
       _sex(auth_rsp->_sex){}
 
-    void AppendChatMsgs(const std::vector<std::shared_ptr<TextChatData>> text_vec);
-
     int _uid;
     QString _name;
     QString _nick;
@@ -104,7 +102,6 @@ struct FriendInfo {
     QString _desc;
     QString _back;
     QString _last_msg;
-    std::vector<std::shared_ptr<TextChatData>> _chat_msgs;
 };
 
 struct UserInfo {
@@ -134,7 +131,6 @@ struct UserInfo {
     UserInfo(std::shared_ptr<FriendInfo> friend_info):
         _uid(friend_info->_uid),_name(friend_info->_name),_nick(friend_info->_nick),
         _icon(friend_info->_icon),_sex(friend_info->_sex),_last_msg(""){
-            _chat_msgs = friend_info->_chat_msgs;
         }
 
     int _uid;
@@ -143,18 +139,20 @@ struct UserInfo {
     QString _icon;
     int _sex;
     QString _last_msg;
-    std::vector<std::shared_ptr<TextChatData>> _chat_msgs;
 };
 
 struct TextChatData{
-    TextChatData(QString msg_id, QString msg_content, int fromuid, int touid)
-        :_msg_id(msg_id),_msg_content(msg_content),_from_uid(fromuid),_to_uid(touid){
+    TextChatData(QString msg_id, QString msg_content, int fromuid, int touid, bool b_acked = true)
+        :_msg_id(msg_id),_msg_content(msg_content),_from_uid(fromuid),_to_uid(touid),
+          _b_acked(b_acked){
 
     }
     QString _msg_id;
     QString _msg_content;
     int _from_uid;
     int _to_uid;
+    //自己发出的消息收到服务器确认前为false，收到的消息总是true
+    bool _b_acked;
 };
 
 struct TextChatMsg{
@@ -173,4 +171,25 @@ struct TextChatMsg{
     std::vector<std::shared_ptr<TextChatData>> _chat_msgs;
 };
 
+//服务器对一条消息的确认，seq为会话内的序号，ts为服务器收到的时间(毫秒)
+struct TextChatAckData{
+    TextChatAckData(QString msg_id, qint64 seq, qint64 ts)
+        :_msg_id(msg_id),_seq(seq),_ts(ts){}
+    QString _msg_id;
+    qint64 _seq;
+    qint64 _ts;
+};
+
+//服务器把同一次写操作期间的确认合并成一帧发送
+struct TextChatAck{
+    TextChatAck(QJsonArray arrays){
+        for(auto ack_data : arrays){
+            auto ack_obj = ack_data.toObject();
+            _acks.push_back(std::make_shared<TextChatAckData>(ack_obj["msgid"].toString(),
+                ack_obj["seq"].toVariant().toLongLong(), ack_obj["ts"].toVariant().toLongLong()));
+        }
+    }
+    std::vector<std::shared_ptr<TextChatAckData>> _acks;
+};
+
 #endif
@@ -0,0 +1,101 @@
+#include "userlistdelegate.h"
+#include "userlistmodel.h"
+#include "avatarcache.h"
+#include <QPainter>
+#include <QFontMetrics>
+
+const int USER_ITEM_HEIGHT = 70;   //用户条目高度，和原ChatUserWid一致
+const int TIP_ITEM_HEIGHT = 25;    //分组提示高度，和原GroupTipItem一致
+const int ITEM_ICON_SIZE = 45;     //头像大小
+const int ITEM_LEFT_MARGIN = 10;   //头像左边距
+const int RED_POINT_SIZE = 30;     //红点大小
+
+UserListDelegate::UserListDelegate(QObject *parent)
+    : QStyledItemDelegate(parent),
+      _name_font("Microsoft YaHei"), _msg_font("Microsoft YaHei"),
+      _tip_font("Microsoft YaHei"), _red_point(":/res/red_point.png")
+{
+    _name_font.setPixelSize(16);
+    _msg_font.setPixelSize(14);
+    _tip_font.setPixelSize(12);
+}
+
+QSize UserListDelegate::sizeHint(const QStyleOptionViewItem &option,
+                                 const QModelIndex &index) const
+{
+    Q_UNUSED(option);
+    auto type = index.data(UserListModel::ItemTypeRole).toInt();
+    if(type == ListItemType::GROUP_TIP_ITEM){
+        return QSize(250, TIP_ITEM_HEIGHT);
+    }
+    return QSize(250, USER_ITEM_HEIGHT);
+}
+
+void UserListDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option,
+                             const QModelIndex &index) const
+{
+    painter->save();
+    QRect rect = option.rect;
+    auto type = index.data(UserListModel::ItemTypeRole).toInt();
+
+    //分组提示只画背景和文字
+    if(type == ListItemType::GROUP_TIP_ITEM){
+        painter->fillRect(rect, QColor("#eaeaea"));
+        painter->setFont(_tip_font);
+        painter->setPen(QColor("#2e2f30"));
+        painter->drawText(rect.adjusted(ITEM_LEFT_MARGIN, 0, 0, 0), Qt::AlignLeft | Qt::AlignVCenter,
+                          index.data(UserListModel::TipRole).toString());
+        painter->restore();
+        return;
+    }
+
+    //选中和悬浮的背景色，和原来样式表中的颜色一致
+    if(option.state & QStyle::State_Selected){
+        painter->fillRect(rect, QColor("#d3d7d4"));
+    }else if(option.state & QStyle::State_MouseOver){
+        painter->fillRect(rect, QColor(206,207,208));
+    }
+
+    QRect icon_rect(rect.x() + ITEM_LEFT_MARGIN, rect.y() + (rect.height() - ITEM_ICON_SIZE) / 2,
+                    ITEM_ICON_SIZE, ITEM_ICON_SIZE);
+    painter->drawPixmap(icon_rect, AvatarCache::GetInstance()->GetAvatar(
+        index.data(UserListModel::IconRole).toString(), icon_rect.size(),
+        painter->device()->devicePixelRatioF()));
+
+    if(index.data(UserListModel::RedPointRole).toBool()){
+        QRect red_rect(icon_rect.x() + 27, icon_rect.y() - 10, RED_POINT_SIZE, RED_POINT_SIZE);
+        painter->drawPixmap(red_rect, _red_point);
+    }
+
+    int text_left = icon_rect.right() + 1 + ITEM_LEFT_MARGIN;
+    int text_width = rect.right() - text_left - ITEM_LEFT_MARGIN;
+    QString last_msg = index.data(UserListModel::LastMsgRole).toString();
+    painter->setFont(_name_font);
+    painter->setPen(Qt::black);
+    QFontMetrics name_fm(_name_font);
+    QString name = name_fm.elidedText(index.data(UserListModel::NameRole).toString(),
+                                      Qt::ElideRight, text_width);
+    //聊天条目名字在上、最后一条消息在下，其他条目名字垂直居中
+    if(type == ListItemType::CHAT_USER_ITEM){
+        QRect name_rect(text_left, rect.y() + 12, text_width, name_fm.height());
+        painter->drawText(name_rect, Qt::AlignLeft | Qt::AlignVCenter, name);
+
+        QFontMetrics msg_fm(_msg_font);
+        painter->setFont(_msg_font);
+        painter->setPen(QColor(153,153,153));
+        QRect msg_rect(text_left, name_rect.bottom() + 6, text_width, msg_fm.height());
+        painter->drawText(msg_rect, Qt::AlignLeft | Qt::AlignVCenter,
+                          msg_fm.elidedText(last_msg, Qt::ElideRight, text_width));
+    }else{
+        QRect name_rect(text_left, rect.y(), text_width, rect.height());
+        painter->drawText(name_rect, Qt::AlignLeft | Qt::AlignVCenter, name);
+    }
+
+    //新的朋友条目底部有分割线
+    if(type == ListItemType::APPLY_FRIEND_ITEM){
+        painter->setPen(QColor("#eaeaea"));
+        painter->drawLine(rect.bottomLeft(), rect.bottomRight());
+    }
+
+    painter->restore();
+}
@@ -0,0 +1,25 @@
+#ifndef USERLISTDELEGATE_H
+#define USERLISTDELEGATE_H
+
+#include <QStyledItemDelegate>
+#include <QPixmap>
+#include <QFont>
+
+//绘制聊天列表和联系人列表条目的委托，代替每个好友一个ChatUserWid/ConUserItem控件
+class UserListDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+public:
+    explicit UserListDelegate(QObject *parent = nullptr);
+    void paint(QPainter *painter, const QStyleOptionViewItem &option,
+               const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option,
+                   const QModelIndex &index) const override;
+private:
+    QFont _name_font;
+    QFont _msg_font;
+    QFont _tip_font;
+    QPixmap _red_point;
+};
+
+#endif // USERLISTDELEGATE_H
@@ -0,0 +1,133 @@
+#include "userlistmodel.h"
+
+UserListModel::UserListModel(QObject *parent)
+    : QAbstractListModel(parent)
+{
+}
+
+int UserListModel::rowCount(const QModelIndex &parent) const
+{
+    if(parent.isValid()){
+        return 0;
+    }
+    return static_cast<int>(_items.size());
+}
+
+QVariant UserListModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= static_cast<int>(_items.size())){
+        return QVariant();
+    }
+
+    auto& item = _items[index.row()];
+    switch (role) {
+    case ItemTypeRole:
+        return static_cast<int>(item->_type);
+    case TipRole:
+        return item->_tip;
+    case RedPointRole:
+        return item->_red_point;
+    default:
+        break;
+    }
+
+    if(item->_info == nullptr){
+        return QVariant();
+    }
+
+    switch (role) {
+    case UidRole:
+        return item->_info->_uid;
+    case Qt::DisplayRole:
+    case NameRole:
+        return item->_info->_name;
+    case IconRole:
+        return item->_info->_icon;
+    case LastMsgRole:
+        return item->_info->_last_msg;
+    default:
+        return QVariant();
+    }
+}
+
+Qt::ItemFlags UserListModel::flags(const QModelIndex &index) const
+{
+    if(!index.isValid()){
+        return Qt::NoItemFlags;
+    }
+
+    //分组提示不可选中
+    if(_items[index.row()]->_type == ListItemType::GROUP_TIP_ITEM){
+        return Qt::ItemIsEnabled;
+    }
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void UserListModel::appendItem(std::shared_ptr<UserListItem> item)
+{
+    insertItem(static_cast<int>(_items.size()), item);
+}
+
+void UserListModel::appendItems(std::vector<std::shared_ptr<UserListItem>> items)
+{
+    if(items.empty()){
+        return;
+    }
+
+    int first = static_cast<int>(_items.size());
+    beginInsertRows(QModelIndex(), first, first + static_cast<int>(items.size()) - 1);
+    _items.insert(_items.end(), items.begin(), items.end());
+    endInsertRows();
+}
+
+void UserListModel::insertItem(int row, std::shared_ptr<UserListItem> item)
+{
+    beginInsertRows(QModelIndex(), row, row);
+    _items.insert(_items.begin() + row, item);
+    endInsertRows();
+}
+
+std::shared_ptr<UserListItem> UserListModel::itemAt(int row) const
+{
+    if(row < 0 || row >= static_cast<int>(_items.size())){
+        return nullptr;
+    }
+    return _items[row];
+}
+
+int UserListModel::rowOfUid(int uid) const
+{
+    for(int i = 0; i < static_cast<int>(_items.size()); ++i){
+        auto& item = _items[i];
+        if(item->_info == nullptr){
+            continue;
+        }
+
+        if((item->_type == ListItemType::CHAT_USER_ITEM
+                || item->_type == ListItemType::CONTACT_USER_ITEM)
+                && item->_info->_uid == uid){
+            return i;
+        }
+    }
+    return -1;
+}
+
+void UserListModel::updateRow(int row)
+{
+    if(row < 0 || row >= static_cast<int>(_items.size())){
+        return;
+    }
+    QModelIndex idx = index(row);
+    emit dataChanged(idx, idx);
+}
+
+void UserListModel::setRedPoint(int row, bool bshow)
+{
+    auto item = itemAt(row);
+    if(item == nullptr || item->_red_point == bshow){
+        return;
+    }
+    item->_red_point = bshow;
+    QModelIndex idx = index(row);
+    emit dataChanged(idx, idx, {RedPointRole});
+}
@@ -0,0 +1,54 @@
+#ifndef USERLISTMODEL_H
+#define USERLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <memory>
+#include <vector>
+#include "global.h"
+#include "userdata.h"
+
+//列表中的一行，可以是用户条目，也可以是分组提示
+struct UserListItem {
+    UserListItem(ListItemType type, std::shared_ptr<UserInfo> info, QString tip = "")
+        :_type(type),_info(info),_tip(tip),_red_point(false){}
+    ListItemType _type;
+    std::shared_ptr<UserInfo> _info;
+    QString _tip;
+    bool _red_point;
+};
+
+//聊天列表和联系人列表共用的模型，数据直接引用UserMgr中的用户信息
+//更新某个用户只通知对应的一行，视图只重绘这一行
+class UserListModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    enum UserRoles {
+        ItemTypeRole = Qt::UserRole + 1,
+        UidRole,
+        NameRole,
+        IconRole,
+        LastMsgRole,
+        TipRole,
+        RedPointRole
+    };
+
+    explicit UserListModel(QObject *parent = nullptr);
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    void appendItem(std::shared_ptr<UserListItem> item);
+    void appendItems(std::vector<std::shared_ptr<UserListItem>> items);
+    void insertItem(int row, std::shared_ptr<UserListItem> item);
+    std::shared_ptr<UserListItem> itemAt(int row) const;
+    //按uid查找用户条目所在行，找不到返回-1
+    int rowOfUid(int uid) const;
+    //用户信息已经修改，通知视图重绘对应行
+    void updateRow(int row);
+    void setRedPoint(int row, bool bshow);
+private:
+    std::vector<std::shared_ptr<UserListItem>> _items;
+};
+
+#endif // USERLISTMODEL_H
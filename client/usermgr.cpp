@@ -1,6 +1,8 @@
 #include "usermgr.h"
 #include <QJsonArray>
+#include <algorithm>
 #include "tcpmgr.h"
+#include "msgdb.h"
 
 UserMgr::~UserMgr()
 {
@@ -16,6 +18,11 @@ void UserMgr::SetToken(QString token)
     _token = token;
 }
 
+QString UserMgr::GetToken()
+{
+    return _token;
+}
+
 int UserMgr::GetUid()
 {
     return _user_info->_uid;
@@ -36,38 +43,16 @@ std::shared_ptr<UserInfo> UserMgr::GetUserInfo()
     return _user_info;
 }
 
-void UserMgr::AppendApplyList(QJsonArray array)
-{
-    // 遍历 QJsonArray 并输出每个元素
-    for (const QJsonValue &value : array) {
-        auto name = value["name"].toString();
-        auto desc = value["desc"].toString();
-        auto icon = value["icon"].toString();
-        auto nick = value["nick"].toString();
-        auto sex = value["sex"].toInt();
-        auto uid = value["uid"].toInt();
-        auto status = value["status"].toInt();
-        auto info = std::make_shared<ApplyInfo>(uid, name,
-                           desc, icon, nick, sex, status);
-        _apply_list.push_back(info);
-    }
-}
-
-void UserMgr::AppendFriendList(QJsonArray array) {
-    // 遍历 QJsonArray 并输出每个元素
-    for (const QJsonValue& value : array) {
-        auto name = value["name"].toString();
-        auto desc = value["desc"].toString();
-        auto icon = value["icon"].toString();
-        auto nick = value["nick"].toString();
-        auto sex = value["sex"].toInt();
-        auto uid = value["uid"].toInt();
-        auto back = value["back"].toString();
-
-        auto info = std::make_shared<FriendInfo>(uid, name,
-            nick, icon, sex, desc, back);
+void UserMgr::AppendApplyList(std::vector<std::shared_ptr<ApplyInfo>> apply_list)
+{
+    //数据已经在网络线程解析成对象，这里只做插入
+    _apply_list.insert(_apply_list.end(), apply_list.begin(), apply_list.end());
+}
+
+void UserMgr::AppendFriendList(std::vector<std::shared_ptr<FriendInfo>> friend_list) {
+    for (auto& info : friend_list) {
         _friend_list.push_back(info);
-        _friend_map.insert(uid, info);
+        _friend_map.insert(info->_uid, info);
     }
 }
 
@@ -133,7 +118,8 @@ std::vector<std::shared_ptr<FriendInfo>> UserMgr::GetConListPerPage() {
 }
 
 
-UserMgr::UserMgr():_user_info(nullptr), _chat_loaded(0),_contact_loaded(0)
+UserMgr::UserMgr():_user_info(nullptr), _chat_loaded(0),_contact_loaded(0),
+    _sync_uid(-1), _friend_ver(0), _apply_ver(0)
 {
 
 }
@@ -231,13 +217,114 @@ std::shared_ptr<FriendInfo> UserMgr::GetFriendById(int uid)
 
 void UserMgr::AppendFriendChatMsg(int friend_id,std::vector<std::shared_ptr<TextChatData> > msgs)
 {
-    auto find_iter = _friend_map.find(friend_id);
-    if(find_iter == _friend_map.end()){
-        qDebug()<<"append friend uid  " << friend_id << " not found";
+    //聊天记录只保存在本地库，界面打开会话时按页读取
+    if(!MsgDb::GetInstance()->AppendMsgs(friend_id, msgs)){
+        qDebug()<<"save chat msg with friend uid  " << friend_id << " failed";
+    }
+}
+
+std::vector<std::shared_ptr<FriendInfo>> UserMgr::GetFriendList()
+{
+    return _friend_list;
+}
+
+bool UserMgr::HasSyncVer(int uid)
+{
+    return _sync_uid == uid;
+}
+
+int UserMgr::GetFriendVer()
+{
+    return _friend_ver;
+}
+
+int UserMgr::GetApplyVer()
+{
+    return _apply_ver;
+}
+
+void UserMgr::SyncApplyList(QString sync, int ver, std::vector<std::shared_ptr<ApplyInfo>> apply_list)
+{
+    //换了账号时登录请求不会带版本号，服务器下发的是全量
+    _sync_uid = _user_info->_uid;
+    _apply_ver = ver;
+    if(sync == "none"){
+        return;
+    }
+
+    if(sync != "delta"){
+        _apply_list.clear();
+        AppendApplyList(apply_list);
         return;
     }
 
-    find_iter.value()->AppendChatMsgs(msgs);
+    //增量数据，已存在的申请更新状态，不存在的追加
+    for (auto& info : apply_list) {
+        auto uid = info->_uid;
+        auto iter = std::find_if(_apply_list.begin(), _apply_list.end(),
+            [uid](const std::shared_ptr<ApplyInfo>& apply){ return apply->_uid == uid; });
+        if(iter == _apply_list.end()){
+            _apply_list.push_back(info);
+            continue;
+        }
+
+        (*iter)->_name = info->_name;
+        (*iter)->_desc = info->_desc;
+        (*iter)->_icon = info->_icon;
+        (*iter)->_nick = info->_nick;
+        (*iter)->_sex = info->_sex;
+        (*iter)->_status = info->_status;
+    }
 }
 
+void UserMgr::SyncFriendList(QString sync, int ver, std::vector<std::shared_ptr<FriendInfo>> friend_list,
+                             std::vector<int> del_list)
+{
+    _sync_uid = _user_info->_uid;
+    _friend_ver = ver;
+    if(sync == "none"){
+        return;
+    }
+
+    if(sync != "delta"){
+        _friend_list.clear();
+        _friend_map.clear();
+        _chat_loaded = 0;
+        _contact_loaded = 0;
+        AppendFriendList(friend_list);
+        return;
+    }
 
+    //删除的好友
+    for (auto uid : del_list) {
+        _friend_map.remove(uid);
+        _friend_list.erase(std::remove_if(_friend_list.begin(), _friend_list.end(),
+            [uid](const std::shared_ptr<FriendInfo>& info){ return info->_uid == uid; }),
+            _friend_list.end());
+    }
+
+    //新增或者资料变化的好友，已存在的保留聊天记录只更新资料
+    for (auto& info : friend_list) {
+        auto iter = _friend_map.find(info->_uid);
+        if(iter == _friend_map.end()){
+            _friend_list.push_back(info);
+            _friend_map.insert(info->_uid, info);
+            continue;
+        }
+
+        iter.value()->_name = info->_name;
+        iter.value()->_desc = info->_desc;
+        iter.value()->_icon = info->_icon;
+        iter.value()->_nick = info->_nick;
+        iter.value()->_sex = info->_sex;
+        iter.value()->_back = info->_back;
+    }
+
+    if(_chat_loaded > _friend_list.size()){
+        _chat_loaded = _friend_list.size();
+    }
+
+    if(_contact_loaded > _friend_list.size()){
+        _contact_loaded = _friend_list.size();
+    }
+}
@@ -14,12 +14,13 @@ public:
     ~ UserMgr();
     void SetUserInfo(std::shared_ptr<UserInfo> user_info);
     void SetToken(QString token);
+    QString GetToken();
     int GetUid();
     QString GetName();
     QString GetIcon();
      std::shared_ptr<UserInfo> GetUserInfo();
-    void AppendApplyList(QJsonArray array);
-    void AppendFriendList(QJsonArray array);
+    void AppendApplyList(std::vector<std::shared_ptr<ApplyInfo>> apply_list);
+    void AppendFriendList(std::vector<std::shared_ptr<FriendInfo>> friend_list);
     std::vector<std::shared_ptr<ApplyInfo>> GetApplyList();
     void AddApplyList(std::shared_ptr<ApplyInfo> app);
     bool AlreadyApply(int uid);
@@ -33,7 +34,14 @@ public:
     void AddFriend(std::shared_ptr<AuthRsp> auth_rsp);
     void AddFriend(std::shared_ptr<AuthInfo> auth_info);
     std::shared_ptr<FriendInfo> GetFriendById(int uid);
+    std::vector<std::shared_ptr<FriendInfo>> GetFriendList();
     void AppendFriendChatMsg(int friend_id,std::vector<std::shared_ptr<TextChatData>>);
+    bool HasSyncVer(int uid);
+    int GetFriendVer();
+    int GetApplyVer();
+    void SyncApplyList(QString sync, int ver, std::vector<std::shared_ptr<ApplyInfo>> apply_list);
+    void SyncFriendList(QString sync, int ver, std::vector<std::shared_ptr<FriendInfo>> friend_list,
+                        std::vector<int> del_list);
 private:
     UserMgr();
     std::shared_ptr<UserInfo> _user_info;
@@ -43,6 +51,10 @@ private:
     QString _token;
     int _chat_loaded;
     int _contact_loaded;
+    //本地好友列表、申请列表对应的服务器版本号，重新登录时只拉取增量
+    int _sync_uid;
+    int _friend_ver;
+    int _apply_ver;
 
 public slots:
     void SlotAddFriendRsp(std::shared_ptr<AuthRsp> rsp);
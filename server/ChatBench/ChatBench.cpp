@@ -0,0 +1,242 @@
+// ChatBench.cpp : ChatServer热点路径的微基准测试，基于Google Benchmark
+// 直接编译ChatServer的源文件，不需要redis、mysql和gRPC对端。
+// 逻辑队列分发的测试读取ChatServer的config.ini(构建时复制到构建目录)，需要在构建目录下运行。
+// 默认把结果同时写到chatbench.json，两次提交的结果可以用benchmark自带的tools/compare.py比较。
+//
+
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <streambuf>
+#include <random>
+#include <atomic>
+#include <condition_variable>
+#include <json/json.h>
+#include <json/value.h>
+#include <json/reader.h>
+#include "const.h"
+#include "MsgNode.h"
+#include "UserMgr.h"
+#include "AsioIOServicePool.h"
+#ifdef CHATBENCH_WITH_LOGIC
+#include "LogicQueue.h"
+#endif
+
+// 服务器代码里有大量std::cout日志，测试期间输出到空缓冲区，结果包含格式化的开销但不包含终端输出
+class NullBuffer : public std::streambuf {
+protected:
+	int overflow(int c) override {
+		return c;
+	}
+	std::streamsize xsputn(const char*, std::streamsize n) override {
+		return n;
+	}
+};
+
+static bool s_pool_used = false;
+
+// 典型的文本聊天请求，和客户端ChatPage发出的格式一致
+static std::string MakeChatPayload(int text_count, int text_len) {
+	Json::Value root;
+	root["fromuid"] = 1019;
+	root["touid"] = 1020;
+	for (int i = 0; i < text_count; ++i) {
+		Json::Value text;
+		text["msgid"] = "{3f2504e0-4f89-11d3-9a0c-0305e82c" + std::to_string(1000 + i) + "}";
+		text["content"] = std::string(text_len, 'a' + i % 26);
+		root["text_array"].append(text);
+	}
+	Json::FastWriter writer;
+	return writer.write(root);
+}
+
+// SendNode构造：分配缓冲区、写入网络字节序的消息头并拷贝消息体
+static void BM_SendNodeEncode(benchmark::State& state) {
+	std::string body(static_cast<size_t>(state.range(0)), 'x');
+	for (auto _ : state) {
+		SendNode node(body.data(), static_cast<short>(body.size()), ID_TEXT_CHAT_MSG_RSP);
+		benchmark::DoNotOptimize(node._data);
+	}
+	state.SetBytesProcessed(state.iterations() * (body.size() + HEAD_TOTAL_LEN));
+}
+BENCHMARK(BM_SendNodeEncode)->Arg(64)->Arg(512)->Arg(2048);
+
+// 消息头解析，和CSession::AsyncReadHead一样解析后检查id和长度
+static void BM_ParseMsgHead(benchmark::State& state) {
+	const int frame_count = 1024;
+	std::vector<std::unique_ptr<SendNode>> frames;
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int> len_dist(0, MAX_LENGTH);
+	const short ids[] = { MSG_CHAT_LOGIN, ID_SEARCH_USER_REQ, ID_ADD_FRIEND_REQ, ID_TEXT_CHAT_MSG_REQ };
+	std::string body(MAX_LENGTH, 'x');
+	for (int i = 0; i < frame_count; ++i) {
+		short len = static_cast<short>(len_dist(rng));
+		frames.emplace_back(new SendNode(body.data(), len, ids[i % 4]));
+	}
+
+	size_t i = 0;
+	for (auto _ : state) {
+		short msg_id = 0;
+		short msg_len = 0;
+		ParseMsgHead(frames[i]->_data, msg_id, msg_len);
+		bool b_valid = msg_id <= MAX_LENGTH && msg_len <= MAX_LENGTH;
+		benchmark::DoNotOptimize(b_valid);
+		benchmark::DoNotOptimize(msg_len);
+		i = (i + 1) % frame_count;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ParseMsgHead);
+
+// DealChatTextMsg的json处理：解析请求，构造回包并toStyledString
+static void BM_ChatJsonStyled(benchmark::State& state) {
+	auto payload = MakeChatPayload(static_cast<int>(state.range(0)), 64);
+	for (auto _ : state) {
+		Json::Reader reader;
+		Json::Value root;
+		reader.parse(payload, root);
+		Json::Value rtvalue;
+		rtvalue["error"] = ErrorCodes::Success;
+		rtvalue["text_array"] = root["text_array"];
+		rtvalue["fromuid"] = root["fromuid"].asInt();
+		rtvalue["touid"] = root["touid"].asInt();
+		std::string return_str = rtvalue.toStyledString();
+		benchmark::DoNotOptimize(return_str.data());
+	}
+	state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(BM_ChatJsonStyled)->Arg(1)->Arg(8)->Arg(32);
+
+// 同样的处理用FastWriter输出，和上面对比缩进格式化的开销
+static void BM_ChatJsonFast(benchmark::State& state) {
+	auto payload = MakeChatPayload(static_cast<int>(state.range(0)), 64);
+	for (auto _ : state) {
+		Json::Reader reader;
+		Json::Value root;
+		reader.parse(payload, root);
+		Json::Value rtvalue;
+		rtvalue["error"] = ErrorCodes::Success;
+		rtvalue["text_array"] = root["text_array"];
+		rtvalue["fromuid"] = root["fromuid"].asInt();
+		rtvalue["touid"] = root["touid"].asInt();
+		Json::FastWriter writer;
+		std::string return_str = writer.write(rtvalue);
+		benchmark::DoNotOptimize(return_str.data());
+	}
+	state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(BM_ChatJsonFast)->Arg(1)->Arg(8)->Arg(32);
+
+// UserMgr::GetSession多线程竞争，所有线程抢同一把_session_mtx
+static void BM_UserMgrGetSession(benchmark::State& state) {
+	const int user_count = 10000;
+	// 会话对象本身不会被访问，用别名构造共享同一个控制块，只测锁、查找和引用计数
+	static std::shared_ptr<int> s_owner = std::make_shared<int>(0);
+	static bool s_init = [&]() {
+		for (int uid = 0; uid < user_count; ++uid) {
+			UserMgr::GetInstance()->SetUserSession(uid, std::shared_ptr<CSession>(s_owner, nullptr));
+		}
+		return true;
+	}();
+	benchmark::DoNotOptimize(s_init);
+
+	std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+	std::uniform_int_distribution<int> uid_dist(0, user_count - 1);
+	for (auto _ : state) {
+		auto session = UserMgr::GetInstance()->GetSession(uid_dist(rng));
+		benchmark::DoNotOptimize(session);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UserMgrGetSession)->ThreadRange(1, 8)->UseRealTime();
+
+// AsioIOServicePool轮询取io_context，线上只有接收连接的线程调用，所以只测单线程
+static void BM_IOServicePoolGet(benchmark::State& state) {
+	auto pool = AsioIOServicePool::GetInstance();
+	s_pool_used = true;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(&pool->GetIOService());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IOServicePoolGet);
+
+#ifdef CHATBENCH_WITH_LOGIC
+// LogicSystem分发：投递到逻辑队列，工作线程通过_fun_callbacks找到处理函数并调用
+// LogicSystem的队列和分发都在LogicQueue里，这里直接用一个LogicQueue，不需要存储和gRPC
+// 注册一个空的处理函数，测的是队列、条件变量唤醒、查表、std::function调用和延迟统计的开销
+#define BENCH_MSG_ID 2000
+static void BM_LogicQueueDispatch(benchmark::State& state) {
+	static std::mutex s_mutex;
+	static std::condition_variable s_cond;
+	static std::atomic<long long> s_handled(0);
+	static LogicQueue* s_queue = []() {
+		auto* queue = new LogicQueue();
+		queue->RegisterCallBack(BENCH_MSG_ID,
+			[](shared_ptr<CSession>, const short&, const string& msg_data) {
+			benchmark::DoNotOptimize(msg_data.data());
+			s_handled++;
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_cond.notify_one();
+		});
+		return queue;
+	}();
+
+	const int batch = static_cast<int>(state.range(0));
+	std::string body = MakeChatPayload(1, 64);
+	for (auto _ : state) {
+		long long target = s_handled + batch;
+		for (int i = 0; i < batch; ++i) {
+			auto recv_node = make_shared<RecvNode>(static_cast<short>(body.size()), BENCH_MSG_ID);
+			memcpy(recv_node->_data, body.data(), body.size());
+			recv_node->_cur_len = static_cast<short>(body.size());
+			s_queue->PostMsgToQue(make_shared<LogicNode>(nullptr, recv_node));
+		}
+
+		std::unique_lock<std::mutex> lock(s_mutex);
+		s_cond.wait(lock, [target]() {
+			return s_handled >= target;
+		});
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_LogicQueueDispatch)->Arg(1)->Arg(64)->UseRealTime();
+#endif
+
+int main(int argc, char** argv) {
+	// 没有指定输出文件时默认写json，方便不同提交之间对比
+	std::vector<char*> args(argv, argv + argc);
+	bool b_has_out = false;
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]).find("--benchmark_out=") == 0) {
+			b_has_out = true;
+		}
+	}
+	std::string out_arg = "--benchmark_out=chatbench.json";
+	std::string format_arg = "--benchmark_out_format=json";
+	if (!b_has_out) {
+		args.push_back(&out_arg[0]);
+		args.push_back(&format_arg[0]);
+	}
+	int arg_count = static_cast<int>(args.size());
+
+	benchmark::Initialize(&arg_count, args.data());
+	if (benchmark::ReportUnrecognizedArguments(arg_count, args.data())) {
+		return 1;
+	}
+
+	// 报告写到原来的标准输出，服务器代码的日志丢弃
+	std::ostream console(std::cout.rdbuf());
+	NullBuffer null_buffer;
+	std::cout.rdbuf(&null_buffer);
+	benchmark::ConsoleReporter reporter;
+	reporter.SetOutputStream(&console);
+	reporter.SetErrorStream(&console);
+	benchmark::RunSpecifiedBenchmarks(&reporter);
+	benchmark::Shutdown();
+
+	if (s_pool_used) {
+		AsioIOServicePool::GetInstance()->Stop();
+	}
+	std::cout.rdbuf(console.rdbuf());
+	return 0;
+}
@@ -0,0 +1,137 @@
+// ClientFrameBench.cpp : 客户端拆包(client/frameparser)的微基准测试，基于Google Benchmark
+// 把10000个帧按不同的分段大小喂给解析器，模拟一次readyRead读到的数据量；
+// 同时保留改造前每解析一帧就用mid()复制剩余缓冲区的写法作为对照，对比两者随积压数据量的增长。
+//
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "frameparser.h"
+
+static const int FRAME_COUNT = 10000;
+
+// 按客户端协议组帧：2字节id + 2字节长度(网络字节序) + 消息体，消息体长度随机
+static std::string MakeFrames(int count, int max_body) {
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int> len_dist(16, max_body);
+	std::string stream;
+	for (int i = 0; i < count; ++i) {
+		int len = len_dist(rng);
+		uint16_t id = static_cast<uint16_t>(1000 + i % 32);
+		stream.push_back(static_cast<char>(id >> 8));
+		stream.push_back(static_cast<char>(id & 0xff));
+		stream.push_back(static_cast<char>(len >> 8));
+		stream.push_back(static_cast<char>(len & 0xff));
+		stream.append(static_cast<size_t>(len), static_cast<char>('a' + i % 26));
+	}
+	return stream;
+}
+
+// 改造前的写法：每解析出头部或消息体都把剩余数据复制成新的缓冲区，积压越多越慢
+class MidCopyParser {
+public:
+	MidCopyParser() :_b_recv_pending(false), _message_id(0), _message_len(0) {}
+
+	template <typename Handler>
+	void Feed(const char* data, int len, Handler&& handler) {
+		_buffer.append(data, len);
+		for (;;) {
+			if (!_b_recv_pending) {
+				if (_buffer.size() < 4) {
+					return;
+				}
+				const unsigned char* head = reinterpret_cast<const unsigned char*>(_buffer.data());
+				_message_id = static_cast<uint16_t>((head[0] << 8) | head[1]);
+				_message_len = static_cast<uint16_t>((head[2] << 8) | head[3]);
+				_buffer = _buffer.substr(4);
+			}
+			if (_buffer.size() < _message_len) {
+				_b_recv_pending = true;
+				return;
+			}
+			_b_recv_pending = false;
+			std::string body = _buffer.substr(0, _message_len);
+			_buffer = _buffer.substr(_message_len);
+			handler(_message_id, body.data(), static_cast<int>(body.size()));
+		}
+	}
+
+private:
+	std::string _buffer;
+	bool _b_recv_pending;
+	uint16_t _message_id;
+	uint16_t _message_len;
+};
+
+// 参数：每次读到的字节数，0表示10000帧一次全部到达
+static void BM_FrameParser(benchmark::State& state) {
+	const std::string stream = MakeFrames(FRAME_COUNT, 512);
+	const size_t chunk = state.range(0) > 0 ? static_cast<size_t>(state.range(0)) : stream.size();
+	int64_t frames = 0;
+	for (auto _ : state) {
+		FrameParser parser(64 * 1024);
+		for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+			int len = static_cast<int>(std::min(chunk, stream.size() - pos));
+			parser.Append(stream.data() + pos, len);
+			parser.Parse([&frames](uint16_t id, const char* data, int body_len) {
+				benchmark::DoNotOptimize(data);
+				frames += id != 0 && body_len > 0;
+			});
+		}
+	}
+	if (frames != static_cast<int64_t>(state.iterations()) * FRAME_COUNT) {
+		state.SkipWithError("frame count mismatch");
+	}
+	state.SetItemsProcessed(frames);
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+}
+BENCHMARK(BM_FrameParser)->Arg(1460)->Arg(64 * 1024)->Arg(0);
+
+static void BM_FrameParserMidCopy(benchmark::State& state) {
+	const std::string stream = MakeFrames(FRAME_COUNT, 512);
+	const size_t chunk = state.range(0) > 0 ? static_cast<size_t>(state.range(0)) : stream.size();
+	int64_t frames = 0;
+	for (auto _ : state) {
+		MidCopyParser parser;
+		for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+			int len = static_cast<int>(std::min(chunk, stream.size() - pos));
+			parser.Feed(stream.data() + pos, len, [&frames](uint16_t id, const char* data, int body_len) {
+				benchmark::DoNotOptimize(data);
+				frames += id != 0 && body_len > 0;
+			});
+		}
+	}
+	if (frames != static_cast<int64_t>(state.iterations()) * FRAME_COUNT) {
+		state.SkipWithError("frame count mismatch");
+	}
+	state.SetItemsProcessed(frames);
+	state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stream.size()));
+}
+BENCHMARK(BM_FrameParserMidCopy)->Arg(1460)->Arg(64 * 1024)->Arg(0);
+
+// 半包：每次只到达几个字节，检查跨读取拆开的头部和消息体
+static void BM_FrameParserTrickle(benchmark::State& state) {
+	const std::string stream = MakeFrames(FRAME_COUNT, 512);
+	const size_t chunk = static_cast<size_t>(state.range(0));
+	int64_t frames = 0;
+	for (auto _ : state) {
+		FrameParser parser(64 * 1024);
+		for (size_t pos = 0; pos < stream.size(); pos += chunk) {
+			int len = static_cast<int>(std::min(chunk, stream.size() - pos));
+			char* dst = parser.Prepare(len);
+			std::copy(stream.data() + pos, stream.data() + pos + len, dst);
+			parser.Commit(len);
+			parser.Parse([&frames](uint16_t, const char*, int) {
+				++frames;
+			});
+		}
+	}
+	if (frames != static_cast<int64_t>(state.iterations()) * FRAME_COUNT) {
+		state.SkipWithError("frame count mismatch");
+	}
+	state.SetItemsProcessed(frames);
+}
+BENCHMARK(BM_FrameParserTrickle)->Arg(3)->Arg(97);
+
+BENCHMARK_MAIN();
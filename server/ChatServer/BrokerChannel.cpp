@@ -0,0 +1,166 @@
+#include "BrokerChannel.h"
+#include "ConfigMgr.h"
+#include "MetricsMgr.h"
+#include "TraceMgr.h"
+#include "const.h"
+
+// [Broker] 没有配置时收件箱保留的消息数
+#define BROKER_DEFAULT_MAX_LEN  100000
+
+BrokerChannel::BrokerChannel(const std::string& self_name, const std::string& name, std::shared_ptr<KvStore> store,
+	const PeerChannelConfig& config, Fallback fallback)
+	: _self_name(self_name), _name(name), _inbox(PEER_INBOX_PREFIX + name), _store(store), _config(config),
+	_fallback(fallback), _breaker(name, config._breaker_failures, config._breaker_open_ms),
+	_epoch(PeerSeq::Epoch()), _next_seq(PeerSeq::Counter(name)), _pending_bytes(0), _b_stop(false) {
+	auto max_len = ConfigMgr::Inst()["Broker"]["MaxLen"];
+	_max_len = max_len.empty() ? BROKER_DEFAULT_MAX_LEN : atoll(max_len.c_str());
+
+	auto metrics = MetricsMgr::GetInstance();
+	_batch_count = metrics->GetCounter("chat_broker_batch_total");
+	_event_count = metrics->GetCounter("chat_broker_event_total");
+	_error_count = metrics->GetCounter("chat_broker_error_total");
+
+	_write_thread = std::thread([this]() {
+		WriteLoop();
+	});
+}
+
+BrokerChannel::~BrokerChannel() {
+	Stop();
+}
+
+void BrokerChannel::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_b_stop) {
+			return;
+		}
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	if (_write_thread.joinable()) {
+		_write_thread.join();
+	}
+}
+
+void BrokerChannel::Post(PeerEventItem item) {
+	item._bytes = item._event.ByteSizeLong();
+	item._event.set_trace_id(TraceMgr::Current());
+	if (item._event.trace_id() != 0) {
+		item._start_us = TraceMgr::NowMicros();
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (_b_stop || _pending.size() >= _config._max_pending) {
+		bool b_stop = _b_stop;
+		lock.unlock();
+		if (!b_stop) {
+			std::cout << "broker [" << _name << "] too many pending events" << std::endl;
+		}
+		_fallback(item);
+		return;
+	}
+
+	item._event.set_seq(++*_next_seq);
+	item._enqueue_time = std::chrono::steady_clock::now();
+	_pending_bytes += item._bytes;
+	_pending.push_back(std::move(item));
+	// 第一个事件让发送线程开始计时，攒够一批时立即发送，其余情况不需要唤醒
+	if (_pending.size() == 1 || _pending.size() >= static_cast<size_t>(_config._batch_size)
+		|| _pending_bytes >= _config._batch_bytes) {
+		_cond.notify_all();
+	}
+}
+
+void BrokerChannel::WriteLoop() {
+	auto flush_time = std::chrono::microseconds(_config._flush_us);
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_stop) {
+		if (_pending.empty()) {
+			_cond.wait(lock);
+			continue;
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		bool b_full = _pending.size() >= static_cast<size_t>(_config._batch_size)
+			|| _pending_bytes >= _config._batch_bytes;
+		if (!b_full && now < _pending.front()._enqueue_time + flush_time) {
+			_cond.wait_until(lock, _pending.front()._enqueue_time + flush_time);
+			continue;
+		}
+		if (!_breaker.Allow()) {
+			FallbackAll(lock);
+			continue;
+		}
+		WriteBatch(lock);
+	}
+
+	// 退出前把待发送的事件追加完，熔断时剩下的走降级
+	while (!_pending.empty() && _breaker.Allow()) {
+		WriteBatch(lock);
+	}
+	FallbackAll(lock);
+}
+
+void BrokerChannel::WriteBatch(std::unique_lock<std::mutex>& lock) {
+	message::PeerBatch batch;
+	batch.set_from_server(_self_name);
+	batch.set_epoch(_epoch);
+	std::deque<PeerEventItem> items;
+	size_t bytes = 0;
+	while (!_pending.empty() && batch.events_size() < _config._batch_size && bytes < _config._batch_bytes) {
+		auto& item = _pending.front();
+		*batch.add_events() = item._event;
+		bytes += item._bytes;
+		_pending_bytes -= item._bytes;
+		items.push_back(std::move(item));
+		_pending.pop_front();
+	}
+
+	// 追加期间Post继续往待发送队列里放
+	lock.unlock();
+	std::string id;
+	bool b_add = _store->XAdd(_inbox, batch.SerializeAsString(), _max_len, id);
+	if (!b_add) {
+		// 超时的追加可能已经写入，宁可重复也不丢
+		_breaker.OnFailure();
+		_error_count->fetch_add(1, std::memory_order_relaxed);
+		std::cout << "broker [" << _name << "] append failed, " << items.size() << " events fallback" << std::endl;
+		FallbackItems(items);
+		lock.lock();
+		return;
+	}
+
+	_breaker.OnSuccess();
+	_batch_count->fetch_add(1, std::memory_order_relaxed);
+	_event_count->fetch_add(batch.events_size(), std::memory_order_relaxed);
+	auto now_us = TraceMgr::NowMicros();
+	for (auto& item : items) {
+		if (item._event.trace_id() != 0) {
+			TraceMgr::GetInstance()->Record(item._event.trace_id(), "broker.client", "XADD",
+				item._start_us, now_us - item._start_us);
+		}
+	}
+	lock.lock();
+}
+
+void BrokerChannel::FallbackAll(std::unique_lock<std::mutex>& lock) {
+	std::deque<PeerEventItem> items;
+	items.swap(_pending);
+	_pending_bytes = 0;
+	if (items.empty()) {
+		return;
+	}
+
+	lock.unlock();
+	FallbackItems(items);
+	lock.lock();
+}
+
+void BrokerChannel::FallbackItems(std::deque<PeerEventItem>& items) {
+	for (auto& item : items) {
+		// 降级处理里的存储调用挂在发起通知的trace下
+		TraceScope trace_scope(item._event.trace_id());
+		_fallback(item);
+	}
+}
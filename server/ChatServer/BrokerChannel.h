@@ -0,0 +1,49 @@
+#pragma once
+#include "PeerChannel.h"
+#include "KvStore.h"
+#include <memory>
+
+// BrokerChannel：broker模式下发给一个对端ChatServer的通道，配置在 [PeerServer] 和 [Broker] 中
+// 和PeerChannel一样在发送线程上攒批，每批序列化成一个PeerBatch追加到对端的收件箱 PEER_INBOX_PREFIX+对端名(redis流)，
+// 对端的PeerInbox按顺序消费；不和对端直接连接，N个ChatServer只需要N个到redis的连接，不需要N*(N-1)条对端连接。
+// 追加成功即认为送达，收件箱保留MaxLen条，对端短暂下线重启后从上次的位置继续读；
+// 熔断、追加失败、积压超过MaxInflight时事件交给fallback降级
+class BrokerChannel : public PeerSender
+{
+public:
+	// store：发送线程专用的存储，追加不和业务代码抢公共连接池
+	BrokerChannel(const std::string& self_name, const std::string& name, std::shared_ptr<KvStore> store,
+		const PeerChannelConfig& config, Fallback fallback);
+	~BrokerChannel();
+	void Post(PeerEventItem item) override;
+	// 把待发送的事件追加完后返回，追加失败的事件走降级
+	void Stop() override;
+private:
+	void WriteLoop();
+	void WriteBatch(std::unique_lock<std::mutex>& lock);
+	void FallbackAll(std::unique_lock<std::mutex>& lock);
+	void FallbackItems(std::deque<PeerEventItem>& items);
+
+	std::string _self_name;
+	std::string _name;
+	std::string _inbox;
+	std::shared_ptr<KvStore> _store;
+	PeerChannelConfig _config;
+	long long _max_len;
+	Fallback _fallback;
+	CircuitBreaker _breaker;
+	// 进程内共用，和PeerChannel一样见PeerSeq
+	uint64_t _epoch;
+	std::shared_ptr<std::atomic<uint64_t>> _next_seq;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::deque<PeerEventItem> _pending;
+	size_t _pending_bytes;
+	bool _b_stop;
+	std::thread _write_thread;
+
+	std::atomic<uint64_t>* _batch_count;
+	std::atomic<uint64_t>* _event_count;
+	std::atomic<uint64_t>* _error_count;
+};
@@ -2,70 +2,212 @@
 #include <iostream>
 #include "AsioIOServicePool.h"
 #include "UserMgr.h"
+#include "LogicSystem.h"
+#include <chrono>
 
-// 캯ʼI/Oġ˿ԼTCPӵĹ
+// 构造函数，初始化I/O上下文、监听端口以及TCP接收器，启动接受新连接的过程
 CServer::CServer(boost::asio::io_context& io_context, short port)
     : _io_context(io_context), _port(port),
-      _acceptor(io_context, tcp::endpoint(tcp::v4(), port))  // ʼTCP󶨶˿
+      _acceptor(io_context, tcp::endpoint(tcp::v4(), port)),  // 初始化TCP接收器，绑定端口
+      _b_handoff(false), _b_accepting(false)
 {
-    // ӡɹϢ
+    // 打印服务器启动成功的消息
     cout << "Server start success, listen on port : " << _port << endl;
 
-    // ʼ
+    // 开始接受新连接
     StartAccept();
 }
 
-// ӡʱϢ
+// 接管旧进程的监听socket，端口已经处于监听状态，不需要重新绑定
+CServer::CServer(boost::asio::io_context& io_context, short port, int listen_fd)
+    : _io_context(io_context), _port(port),
+      _acceptor(io_context, tcp::v4(), listen_fd),
+      _b_handoff(false), _b_accepting(false)
+{
+    cout << "Server take over success, listen on port : " << _port << endl;
+    StartAccept();
+}
+
+// 析构函数，打印服务器销毁时的消息
 CServer::~CServer() {
     cout << "Server destruct listen on port : " << _port << endl;
 }
 
-// ½ܵ
+// 处理新接受的连接请求
 void CServer::HandleAccept(shared_ptr<CSession> new_session, const boost::system::error_code& error) {
-    if (!error) {  // ûд
-        new_session->Start();  // »Ự
+    if (!error) {  // 如果没有错误
+        new_session->Start();  // 启动新会话
 
-        // ʹûỰбķʣȷ̰߳ȫ
+        // 使用互斥锁保护会话列表的访问，确保线程安全
         lock_guard<mutex> lock(_mutex);
 
-        // »ỰӵԾỰӳУΪỰID
+        // 将新会话添加到活跃会话映射表中，键为会话ID
         _sessions.insert(make_pair(new_session->GetSessionId(), new_session));
     } else {
-        // ʱִ󣬴ӡϢ
+        // 如果接收新连接时出现错误，打印错误消息
         cout << "Session accept failed, error is: " << error.message() << endl;
     }
 
-    // Ƿɹǰӣµ
+    // 平滑升级中不再接受新连接，监听socket要交给新进程
+    if (_b_handoff) {
+        _b_accepting = false;
+        return;
+    }
+
+    // 无论是否成功处理当前连接，都继续监听并接受新的连接
     StartAccept();
 }
 
 
-// ʼӵĺ
+// 开始监听并接受新连接的函数
 void CServer::StartAccept() {
-    // ȡһI/OķеI/Oڴ첽I/O
+    // 获取一个I/O上下文服务池中的I/O服务对象，用于处理异步I/O操作
     auto &io_context = AsioIOServicePool::GetInstance()->GetIOService();
 
-    // һµĻỰ
+    // 创建一个新的会话对象
     shared_ptr<CSession> new_session = make_shared<CSession>(io_context, this);
 
-    // 첽ӣɹHandleAccept
+    // 异步接受新连接，成功后调用HandleAccept处理该连接
+    _b_accepting = true;
     _acceptor.async_accept(new_session->GetSocket(), 
         std::bind(&CServer::HandleAccept, this, new_session, placeholders::_1));
 }
 
 
-// ָỰݻỰIDƳỰ
+// 清除指定会话，根据会话ID移除会话
 void CServer::ClearSession(std::string uuid) {
-    // ỰǷ
+    // 检查会话是否存在
     if (_sessions.find(uuid) != _sessions.end()) {
-        // ûƳûͻỰ֮Ĺ
+        // 调用用户管理器移除用户和会话之间的关联
         UserMgr::GetInstance()->RmvUserSession(_sessions[uuid]->GetUserId());
     }
 
-    // ʹûỰӳķʣȷ̰߳ȫ
+    // 使用互斥锁保护会话映射表的访问，确保线程安全
     {
         lock_guard<mutex> lock(_mutex);
-        // ӻỰӳƳָỰ
+        // 从会话映射表中移除指定会话
         _sessions.erase(uuid);
     }
-}
\ No newline at end of file
+}
+
+void CServer::SetHandoffHooks(std::function<void()> on_prepare, std::function<void()> on_abort) {
+    _on_handoff_prepare = on_prepare;
+    _on_handoff_abort = on_abort;
+}
+
+bool CServer::PrepareHandoff(int& listen_fd, std::vector<int>& session_fds, Json::Value& state) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(HANDOFF_TIMEOUT_SEC);
+
+    // 先停止接收对端的通知，之后发进会话的只有已经在逻辑队列里的消息，WaitIdle后全部在发送队列里一起导出
+    if (_on_handoff_prepare) {
+        _on_handoff_prepare();
+    }
+
+    // 停止accept，等accept回调退出后会话表就不会再增加
+    _b_handoff = true;
+    boost::asio::post(_io_context, [this]() {
+        boost::system::error_code ec;
+        _acceptor.cancel(ec);
+    });
+
+    while (_b_accepting) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            cout << "handoff wait accept stop timeout" << endl;
+            AbortHandoff();
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // 冻结所有会话，等待读写都停下来，期间断开的会话会从会话表中移除
+    {
+        lock_guard<mutex> lock(_mutex);
+        for (auto& iter : _sessions) {
+            iter.second->PrepareHandoff();
+        }
+    }
+
+    for (;;) {
+        bool b_parked = true;
+        {
+            lock_guard<mutex> lock(_mutex);
+            for (auto& iter : _sessions) {
+                if (!iter.second->IsParked()) {
+                    b_parked = false;
+                    break;
+                }
+            }
+        }
+
+        if (b_parked) {
+            break;
+        }
+
+        if (std::chrono::steady_clock::now() > deadline) {
+            cout << "handoff wait sessions park timeout" << endl;
+            AbortHandoff();
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // 已经投递到逻辑队列的消息处理完，回包会留在各个会话的发送队列中一起交接
+    LogicSystem::GetInstance()->WaitIdle();
+
+    lock_guard<mutex> lock(_mutex);
+    listen_fd = _acceptor.native_handle();
+    state["sessions"] = Json::arrayValue;
+    for (auto& iter : _sessions) {
+        session_fds.push_back(iter.second->GetSocket().native_handle());
+        state["sessions"].append(iter.second->DumpHandoff());
+    }
+
+    return true;
+}
+
+void CServer::AbortHandoff() {
+    _b_handoff = false;
+    if (_on_handoff_abort) {
+        _on_handoff_abort();
+    }
+    {
+        lock_guard<mutex> lock(_mutex);
+        for (auto& iter : _sessions) {
+            iter.second->Resume();
+        }
+    }
+
+    boost::asio::post(_io_context, [this]() {
+        if (!_b_accepting) {
+            StartAccept();
+        }
+    });
+}
+
+void CServer::ResumeSessions(const std::vector<int>& session_fds, const Json::Value& state) {
+    auto& sessions = state["sessions"];
+    for (Json::ArrayIndex i = 0; i < sessions.size() && i < session_fds.size(); ++i) {
+        auto& io_context = AsioIOServicePool::GetInstance()->GetIOService();
+        auto session = make_shared<CSession>(io_context, this);
+        boost::system::error_code ec;
+        session->GetSocket().assign(tcp::v4(), session_fds[i], ec);
+        if (ec) {
+            cout << "assign handoff socket failed, error is " << ec.message() << endl;
+            continue;
+        }
+
+        session->LoadHandoff(sessions[i]);
+        // 已登录的会话重新绑定uid，redis中的uip_记录指向的还是本服务器，不需要修改
+        if (session->GetUserId() > 0) {
+            UserMgr::GetInstance()->SetUserSession(session->GetUserId(), session);
+        }
+
+        {
+            lock_guard<mutex> lock(_mutex);
+            _sessions.insert(make_pair(session->GetSessionId(), session));
+        }
+        session->Resume();
+    }
+
+    cout << "resume handoff sessions count is " << _sessions.size() << endl;
+}
@@ -4,6 +4,10 @@
 #include <memory.h>
 #include <map>
 #include <mutex>
+#include <atomic>
+#include <vector>
+#include <functional>
+#include <json/json.h>
 using namespace std;
 using boost::asio::ip::tcp;    // 使用Boost.Asio的TCP接口
 
@@ -13,6 +17,9 @@ class CServer
 public:
 	// 构造函数，初始化I/O上下文和监听端口
 	CServer(boost::asio::io_context& io_context, short port);
+
+	// 平滑升级时使用旧进程交出的监听socket构造
+	CServer(boost::asio::io_context& io_context, short port, int listen_fd);
 	
 	// 析构函数，清理资源
 	~CServer();
@@ -20,6 +27,19 @@ public:
 	// 清除指定的会话，通过会话的标识符（字符串）
 	void ClearSession(std::string);
 
+	// 平滑升级开始和失败时的回调：on_prepare停止接收对端ChatServer发来的通知，on_abort恢复
+	// 导出会话状态之后再发进会话的通知不会交给新进程，所以on_prepare返回前要让在途的通知处理完
+	void SetHandoffHooks(std::function<void()> on_prepare, std::function<void()> on_abort);
+
+	// 平滑升级：停止accept并冻结所有会话，导出监听socket、会话socket和会话状态
+	bool PrepareHandoff(int& listen_fd, std::vector<int>& session_fds, Json::Value& state);
+
+	// 交接失败，恢复accept和所有会话的读写
+	void AbortHandoff();
+
+	// 新进程根据旧进程交出的socket和状态恢复会话
+	void ResumeSessions(const std::vector<int>& session_fds, const Json::Value& state);
+
 private:
 	// 处理新的连接请求
 	void HandleAccept(shared_ptr<CSession>, const boost::system::error_code & error);
@@ -41,6 +61,16 @@ private:
 	
 	// 互斥锁，确保对会话映射表的线程安全访问
 	std::mutex _mutex;
+
+	// 平滑升级中，不再接受新连接
+	std::atomic<bool> _b_handoff;
+
+	// 是否有accept操作在进行
+	std::atomic<bool> _b_accepting;
+
+	// 见SetHandoffHooks
+	std::function<void()> _on_handoff_prepare;
+	std::function<void()> _on_handoff_abort;
 };
 
 /*
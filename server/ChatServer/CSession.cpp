@@ -6,11 +6,16 @@
 #include <json/value.h>
 #include <json/reader.h>
 #include "LogicSystem.h"
+#include "HandoffMgr.h"
+#include "CompressMgr.h"
+#include "TraceMgr.h"
 
-// CSession 캯ʼTCP socketָ롢ỰʶͽϢͷ
+// CSession 构造函数，初始化TCP socket、服务器指针、会话标识和接收消息头
 CSession::CSession(boost::asio::io_context& io_context, CServer* server)
-	: _socket(io_context), _server(server), _b_close(false), _b_head_parse(false), _user_uid(0) {
-    // ΨһĻỰID
+	: _socket(io_context), _server(server), _b_close(false), _b_head_parse(false), _user_uid(0),
+	_b_handoff(false), _b_read_parked(false), _b_write_parked(false), _resume_len(0),
+	_b_compress(false), _b_compress_dict(false) {
+    // 生成唯一的会话ID
 	boost::uuids::uuid a_uuid = boost::uuids::random_generator()();
 	_session_id = boost::uuids::to_string(a_uuid);
 	_recv_head_node = make_shared<MsgNode>(HEAD_TOTAL_LEN);    // HEAD_TOTAL_LEN = 4
@@ -38,41 +43,42 @@ int CSession::GetUserId()
 	return _user_uid;
 }
 
-// ʼỰȶȡϢͷ
+// 开始会话，首先读取消息头部
 void CSession::Start() {
-	AsyncReadHead(HEAD_TOTAL_LEN);        // HEAD_TOTAL_LEN = 4 ϢID(2) + Ϣȣ2
+	AsyncReadHead(HEAD_TOTAL_LEN);        // HEAD_TOTAL_LEN = 4 （消息ID(2) + 消息长度（2））
 }
 
 void CSession::Send(std::string msg, short msgid) {
-    // ʹstd::lock_guardԶȷ̰߳ȫ
+    // 使用std::lock_guard自动管理互斥锁，确保线程安全
     std::lock_guard<std::mutex> lock(_send_lock);
 
-    // ȡǰͶеĴС
+    // 获取当前发送队列的大小
     int send_que_size = _send_que.size();
 
-    // 鷢ͶǷ
+    // 检查发送队列是否已满
     if (send_que_size > MAX_SENDQUE) {
-        // ӡϢ
+        // 如果队列已满，打印调试信息并返回
         std::cout << "session: " << _session_id << " send que fulled, size is " << MAX_SENDQUE << endl;
         return;
     }
 
-    // һµSendNode󣬲뷢Ͷ
-    _send_que.push(make_shared<SendNode>(msg.c_str(), msg.length(), msgid));
+    // 创建一个新的SendNode对象(协商过压缩时可能是压缩帧)，并将其推入发送队列
+    _send_que.push(MakeSendNode(msg.c_str(), msg.length(), msgid));
 
-    // ͶѾϢڵȴֱͣӷ
-    if (send_que_size > 0) {
+    // 如果发送队列中已经有其他消息在等待发送，则直接返回
+    // 平滑升级冻结期间只入队不发送，队列会随会话一起交给新进程
+    if (send_que_size > 0 || _b_handoff) {
         return;
     }
 
-    // ȡͶеĵһϢڵ
+    // 获取发送队列中的第一个消息节点
     auto& msgnode = _send_que.front();
 
-    // 첽дݵsocket
+    // 异步写入数据到socket
     boost::asio::async_write(
-        _socket,  // Ŀsocket
-        boost::asio::buffer(msgnode->_data, msgnode->_total_len),  // Ҫ͵ݻ
-        std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf())  // ɴص
+        _socket,  // 目标socket
+        boost::asio::buffer(msgnode->_data, msgnode->_total_len),  // 要发送的数据缓冲区
+        std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf())  // 完成处理回调
     );
 }
 
@@ -84,8 +90,8 @@ void CSession::Send(char* msg, short max_length, short msgid) {
 		return;
 	}
 
-	_send_que.push(make_shared<SendNode>(msg, max_length, msgid));
-	if (send_que_size>0) {
+	_send_que.push(MakeSendNode(msg, max_length, msgid));
+	if (send_que_size>0 || _b_handoff) {
 		return;
 	}
 	auto& msgnode = _send_que.front();
@@ -93,6 +99,72 @@ void CSession::Send(char* msg, short max_length, short msgid) {
 		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
 }
 
+void CSession::SetCompress(bool b_dict) {
+	_b_compress_dict = b_dict;
+	_b_compress = true;
+}
+
+void CSession::SendAck(const std::string& msgid, long long seq, long long ts) {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	Json::Value ack;
+	ack["msgid"] = msgid;
+	ack["seq"] = (Json::Int64)seq;
+	ack["ts"] = (Json::Int64)ts;
+	_pending_acks.append(ack);
+
+	// 有写操作在进行时先攒着，HandleWrite写完当前节点后合并成一帧发送
+	// 攒够一帧的上限时直接入队，避免单帧过大
+	if (_pending_acks.size() >= MAX_ACK_BATCH) {
+		PushAcks();
+	}
+	if (!_send_que.empty() || _b_handoff) {
+		return;
+	}
+
+	PushAcks();
+	auto& msgnode = _send_que.front();
+	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+}
+
+void CSession::PushAcks() {
+	if (_pending_acks.empty()) {
+		return;
+	}
+
+	Json::Value rtvalue;
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["acks"] = _pending_acks;
+	_pending_acks = Json::Value(Json::arrayValue);
+
+	// 确认帧不需要缩进，用FastWriter输出紧凑格式
+	Json::FastWriter writer;
+	writer.omitEndingLineFeed();
+	std::string return_str = writer.write(rtvalue);
+	_send_que.push(MakeSendNode(return_str.c_str(), return_str.length(), ID_TEXT_CHAT_MSG_RSP));
+}
+
+std::shared_ptr<SendNode> CSession::MakeSendNode(const char* msg, short max_length, short msgid) {
+	auto compress_mgr = CompressMgr::GetInstance();
+	// 发出的帧抽样用于训练字典，未配置抽样时直接返回
+	compress_mgr->AddSample(msg, max_length);
+	std::string compressed;
+	std::shared_ptr<SendNode> node;
+	if (_b_compress && compress_mgr->Compress(msg, max_length, _b_compress_dict, compressed)) {
+		node = make_shared<SendNode>(compressed.data(), compressed.size(), msgid | MSG_COMPRESS_FLAG);
+	}
+	else {
+		node = make_shared<SendNode>(msg, max_length, msgid);
+	}
+
+	// 在追踪中发出的消息记下入队时间，写完后记录排队加发送的耗时
+	node->_trace_id = TraceMgr::Current();
+	if (node->_trace_id != 0) {
+		node->_enqueue_us = TraceMgr::NowMicros();
+	}
+	return node;
+}
+
 void CSession::Close() {
 	_socket.close();
 	_b_close = true;
@@ -102,14 +174,20 @@ std::shared_ptr<CSession>CSession::SharedSelf() {
 	return shared_from_this();
 }
 
-// ʵ첽ȡϢĹܣڶȡɺϢͶݵ߼ϵͳндҲǻڻص첽
+// 实现了异步读取消息体的功能，并在读取完成后将消息投递到逻辑系统中进行处理。整个过程也是基于回调函数进行异步操作处理
 void CSession::AsyncReadBody(int total_len)
 {
-	 // ֵǰỰĹָ룬Ա첽ʱ
+	 // 保持当前会话的共享指针，以避免在异步操作时对象被销毁
 	auto self = shared_from_this();
-	// 첽ȡϢ壬ȡֽΪ total_len
+	// 异步读取消息体，读取总字节数为 total_len
 	asyncReadFull(total_len, [self, this, total_len](const boost::system::error_code& ec, std::size_t bytes_transfered) {
 		try {
+			// 平滑升级取消了读操作，保存半包等待交接
+			if (ec == boost::asio::error::operation_aborted && _b_handoff) {
+				ParkRead(bytes_transfered, true);
+				return;
+			}
+
 			if (ec) {
 				std::cout << "handle read failed, error is " << ec.what() << endl;
 				Close();
@@ -117,28 +195,74 @@ void CSession::AsyncReadBody(int total_len)
 				return;
 			}
 
-            // ȡֽǷԤڵϢ峤һ
+            // 检查读取的字节数是否与预期的消息体长度一致
             if (bytes_transfered < total_len) {
                 std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
                     << total_len << "]" << endl;
-                // ȡֽСԤڣرջỰ
+                // 如果读取字节数小于预期，关闭会话并清理
                 Close();
                 _server->ClearSession(_session_id);
                 return;
             }
 
-            // ȡϢݴʱ _data  _recv_msg_node  _data 
+            // 将读取到的消息体数据从临时缓冲区 _data 拷贝到 _recv_msg_node 的 _data 中
             memcpy(_recv_msg_node->_data, _data, bytes_transfered);
-            //  _recv_msg_node ĵǰȣӱζȡֽ
+            // 更新 _recv_msg_node 的当前长度，增加本次读取的字节数
             _recv_msg_node->_cur_len += bytes_transfered;
-            // ȷݵһλǽ '\0'֤ϢַĺϷ
+            // 确保数据的最后一位是结束符 '\0'，保证消息字符串的合法性
             _recv_msg_node->_data[_recv_msg_node->_total_len] = '\0';
-            // ӡյϢ
+
+            short raw_id = 0;
+            memcpy(&raw_id, _recv_head_node->_data, HEAD_ID_LEN);
+            raw_id = boost::asio::detail::socket_ops::network_to_host_short(raw_id);
+            short msg_id = raw_id & ~(MSG_COMPRESS_FLAG | MSG_TRACE_FLAG);
+            const char* body = _recv_msg_node->_data;
+            std::size_t body_len = bytes_transfered;
+
+            // 消息头中带追踪标志时消息体前TRACE_ID_LEN字节是trace id，不参与压缩
+            uint64_t trace_id = 0;
+            if (raw_id & MSG_TRACE_FLAG) {
+                if (body_len < TRACE_ID_LEN) {
+                    std::cout << "trace msg too short, msg_id is " << msg_id << endl;
+                    Close();
+                    _server->ClearSession(_session_id);
+                    return;
+                }
+                trace_id = ParseTraceId(body);
+                body += TRACE_ID_LEN;
+                body_len -= TRACE_ID_LEN;
+            }
+
+            // 消息头中带压缩标志时先解压，解压后的长度同样受MAX_LENGTH限制
+            if (raw_id & MSG_COMPRESS_FLAG) {
+                std::string plain;
+                if (!CompressMgr::GetInstance()->Decompress(body, body_len,
+                    MAX_LENGTH, plain)) {
+                    std::cout << "decompress msg failed, msg_id is " << msg_id << endl;
+                    Close();
+                    _server->ClearSession(_session_id);
+                    return;
+                }
+                _recv_msg_node = make_shared<RecvNode>(plain.size(), msg_id);
+                memcpy(_recv_msg_node->_data, plain.data(), plain.size());
+                _recv_msg_node->_cur_len = plain.size();
+            }
+            else if (raw_id & MSG_TRACE_FLAG) {
+                auto plain_node = make_shared<RecvNode>(body_len, msg_id);
+                memcpy(plain_node->_data, body, body_len);
+                plain_node->_cur_len = body_len;
+                _recv_msg_node = plain_node;
+            }
+            // 客户端没有带trace id的按抽样率决定是否追踪
+            if (trace_id == 0) {
+                trace_id = TraceMgr::GetInstance()->Sample();
+            }
+            // 打印接收到的消息数据
             cout << "receive data is " << _recv_msg_node->_data << endl;
 			
-			//˴ϢͶݵ߼
-			LogicSystem::GetInstance()->PostMsgToQue(make_shared<LogicNode>(shared_from_this(), _recv_msg_node));
-			//ͷ¼
+			//此处将消息投递到逻辑队列中
+			LogicSystem::GetInstance()->PostMsgToQue(make_shared<LogicNode>(shared_from_this(), _recv_msg_node, trace_id));
+			//继续监听头部接受事件
 			AsyncReadHead(HEAD_TOTAL_LEN);
 		}
 		catch (std::exception& e) {
@@ -149,75 +273,72 @@ void CSession::AsyncReadBody(int total_len)
 
 void CSession::AsyncReadHead(int total_len)
 {
-	// ֵǰỰĹָ룬Ա첽ʱỰ
+	// 保持当前会话的共享指针，以避免在异步操作时会话对象被销毁
 	auto self = shared_from_this();
-	// 첽ȡϢͷHEAD_TOTAL_LEN ֽڣͨصȡ      asyncReadFullעص
+	// 异步读取完整的消息头（HEAD_TOTAL_LEN 字节），并通过回调函数处理读取结果      asyncReadFull注册回调
 	asyncReadFull(HEAD_TOTAL_LEN, [self, this](const boost::system::error_code& ec, std::size_t bytes_transfered) {
 		try {
-			 // ȡĴ
+			// 平滑升级取消了读操作，保存半包等待交接
+			if (ec == boost::asio::error::operation_aborted && _b_handoff) {
+				ParkRead(bytes_transfered, false);
+				return;
+			}
+
+			 // 处理读取操作的错误
 			if (ec) {
 				std::cout << "handle read failed, error is " << ec.what() << endl;
-				// رյǰỰ
+				// 关闭当前会话并清理
 				Close();
 				_server->ClearSession(_session_id);
 				return;
 			}
 
-			// ȡֽǷԤڵϢͷһ
+			// 检查读取到的字节数是否与预期的消息头长度一致
 			if (bytes_transfered < HEAD_TOTAL_LEN) {
 				std::cout << "read length not match, read [" << bytes_transfered << "] , total ["
 					<< HEAD_TOTAL_LEN << "]" << endl;
-				// ȡֽСԤڣرջỰԴ
+				// 如果读取的字节数小于预期，关闭会话并清理资源
 				Close();
 				_server->ClearSession(_session_id);
 				return;
 			}
 
-			// սջеľ
+			// 清空接收缓冲区中的旧数据
 			_recv_head_node->Clear();
 
-			// ȡֽݴ _dataʱƵ _recv_head_node->_data У
-			// רڴ洢ϢͷݵĻ
+			// 将读取到的字节数据从 _data（临时缓冲区）复制到 _recv_head_node->_data 中，
+			// 这是专门用于存储消息头部数据的缓冲区
 			memcpy(_recv_head_node->_data, _data, bytes_transfered);
 
 
-		// Ϣͷе MSGIDϢʶ
+		// 解析消息头中的 MSGID（消息标识符）和消息长度（msg_len），都转换为主机字节序
+			// 压缩标志已经去掉，消息体读完后再根据消息头解压
 			short msg_id = 0;
-			// ӽջиϢ ID 
-			memcpy(&msg_id, _recv_head_node->_data, HEAD_ID_LEN);
-
-			// ֽ msg_id תΪֽ򣨲ͬϵͳܲòֽͬʾ
-			msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+			short msg_len = 0;
+			ParseMsgHead(_recv_head_node->_data, msg_id, msg_len);
 			std::cout << "msg_id is " << msg_id << endl;
 
-			// Ϣ ID ǷЧ ID ֵΪǷǷ ID
+			// 检查消息 ID 是否有效，如果 ID 超过最大允许值，则认为是非法 ID
 			if (msg_id > MAX_LENGTH) {
 				std::cout << "invalid msg_id is " << msg_id << endl;
-				// Ựر
+				// 清理会话，关闭连接
 				_server->ClearSession(_session_id);
 				return;
 			}
 
-		// ϢͷеϢȣmsg_len
-			short msg_len = 0;
-			// ӽջиϢ
-			memcpy(&msg_len, _recv_head_node->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-
-			// ֽ msg_len תΪֽ
-			msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
 			std::cout << "msg_len is " << msg_len << endl;
 
-			// ϢǷЧȳ󳤶ȣΪǷǷ
+			// 检查消息长度是否有效，如果长度超出允许的最大长度，则认为是非法长度
 			if (msg_len > MAX_LENGTH) {
 				std::cout << "invalid data length is " << msg_len << endl;
-				// Ựر
+				// 清理会话，关闭连接
 				_server->ClearSession(_session_id);
 				return;
 			}
 
-			// һϢڵ㣬ڴ洢յϢݣϢ岿֣
+			// 创建一个接收消息节点，用于存储接收的消息数据（包括消息体部分）
 			_recv_msg_node = make_shared<RecvNode>(msg_len, msg_id);
-			//  AsyncReadBody ʼ첽ȡϢ岿
+			// 调用 AsyncReadBody 函数，开始异步读取消息体部分
 			AsyncReadBody(msg_len);
 		}
 		catch (std::exception& e) {
@@ -227,84 +348,247 @@ void CSession::AsyncReadHead(int total_len)
 }
 
 void CSession::HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self) {
-    // 쳣
+    // 增加异常处理
     try {
-        // Ƿд
+        // 检查是否有错误发生
         if (!error) {
-            // ûдʹstd::lock_guardԶȷ̰߳ȫ
+            // 如果没有错误，使用std::lock_guard自动管理互斥锁，确保线程安全
             std::lock_guard<std::mutex> lock(_send_lock);
 
-            // ӷͶƳѳɹ͵Ϣڵ
+            // 在追踪中的消息记录从入队到写完的耗时，tag是接收方uid
+            auto& sent = _send_que.front();
+            if (sent->_trace_id != 0) {
+                TraceMgr::GetInstance()->Record(sent->_trace_id, "tcp.send", std::to_string(_user_uid),
+                    sent->_enqueue_us, TraceMgr::NowMicros() - sent->_enqueue_us);
+            }
+
+            // 从发送队列中移除已成功发送的消息节点
             _send_que.pop();
 
-            // 鷢ͶǷϢҪ
+            // 写操作期间攒下的消息确认合并成一帧放到队尾
+            PushAcks();
+
+            // 平滑升级中不再继续发送，写操作停下来后再取消读
+            if (_b_handoff) {
+                _b_write_parked = true;
+                CancelRead();
+                return;
+            }
+
+            // 检查发送队列是否还有其他消息需要发送
             if (!_send_que.empty()) {
-                // ȡͶеһϢڵ
+                // 获取发送队列中的下一个消息节点
                 auto& msgnode = _send_que.front();
 
-                // 첽дݵsocket
+                // 异步写入数据到socket
                 boost::asio::async_write(
-                    _socket,  // Ŀsocket
-                    boost::asio::buffer(msgnode->_data, msgnode->_total_len),  // Ҫ͵ݻ
-                    std::bind(&CSession::HandleWrite, this, std::placeholders::_1, shared_self)  // ɴص
+                    _socket,  // 目标socket
+                    boost::asio::buffer(msgnode->_data, msgnode->_total_len),  // 要发送的数据缓冲区
+                    std::bind(&CSession::HandleWrite, this, std::placeholders::_1, shared_self)  // 完成处理回调
                 );
             }
         } else {
-            // дӡϢرջỰ
+            // 如果有错误发生，打印错误信息并关闭会话
             std::cout << "handle write failed, error is " << error.what() << endl;
 
-            // رյǰỰ
+            // 关闭当前会话
             Close();
 
-            // ӷǰỰ
+            // 从服务器中清除当前会话
             _server->ClearSession(_session_id);
         }
     } catch (std::exception& e) {
-        // 񲢴׼쳣
+        // 捕获并处理标准异常
         std::cerr << "Exception code : " << e.what() << endl;
     }
 }
 
-//ȡ
+//读取完整长度
 void CSession::asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code&, std::size_t)> handler )
 {
-	// ջ
+	// 从交接的半包恢复时，_data中已经有部分数据
+	if (_resume_len > 0) {
+		auto read_len = _resume_len;
+		_resume_len = 0;
+		asyncReadLen(read_len, maxLength, handler);
+		return;
+	}
+
+	// 清空缓冲区
 	::memset(_data, 0, MAX_LENGTH);
-	// ʼȡָȵ 4ֽ
+	// 开始读取指定长度的数据 4个字节
 	asyncReadLen(0, maxLength, handler);
 }
 
-//ȡָֽ
+//读取指定字节数
 void CSession::asyncReadLen(std::size_t read_len, std::size_t total_len, std::function<void(const boost::system::error_code&, std::size_t)> handler)
 {
 	auto self = shared_from_this();
-	// 첽ȡݲ洢 _data 
+	// 平滑升级中不再发起新的读操作，按取消处理
+	if (_b_handoff) {
+		handler(boost::asio::error::operation_aborted, read_len);
+		return;
+	}
+
+	// 异步读取数据并存储到 _data 缓冲区中
 	_socket.async_read_some(boost::asio::buffer(_data + read_len, total_len-read_len),
 		[read_len, total_len, handler, self](const boost::system::error_code& ec, std::size_t  bytesTransfered) {
 			if (ec) {
-				// ִ󣬵ûص
+				// 出现错误，调用回调函数
 				handler(ec, read_len + bytesTransfered);
 				return;
 			}
-			// ȡֽﵽԤڵܳȣûص	
+			// 如果读取的字节数达到了预期的总长度，则调用回调函数处理数据	
 			if (read_len + bytesTransfered >= total_len) {
-				//ȹ˾͵ûص
+				//长度够了就调用回调函数
 				handler(ec, read_len + bytesTransfered);
 				return;
 			}
 
-			// ûдҳȲȡ
+			// 没有错误，且长度不足则继续读取
 			self->asyncReadLen(read_len + bytesTransfered, total_len, handler);
 	});
 }
-/*
-_data һַڴ洢 socket 첽ȡֽݡÿζȡʱ
+void CSession::PrepareHandoff() {
+	{
+		std::lock_guard<std::mutex> lock(_send_lock);
+		_b_handoff = true;
+		// 发送队列不为空说明还有写操作在进行，等HandleWrite写完当前节点再取消读
+		// 因为cancel会同时取消读和写，写到一半的节点无法交接
+		_b_write_parked = _send_que.empty();
+		if (!_b_write_parked) {
+			return;
+		}
+	}
 
-_data ᱻգȻ socket нյݻᱻ洢С
-ݽϺ_data еݻᱻƵϢڵ㣨 _recv_head_node  _recv_msg_nodeУʹ
-*/
+	CancelRead();
+}
+
+bool CSession::IsParked() {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	return _b_read_parked && _b_write_parked;
+}
+
+void CSession::CancelRead() {
+	auto self = shared_from_this();
+	// socket不是线程安全的，投递到会话所在的io_context上执行
+	boost::asio::post(_socket.get_executor(), [self, this]() {
+		boost::system::error_code ec;
+		_socket.cancel(ec);
+	});
+}
+
+void CSession::ParkRead(std::size_t bytes_transfered, bool b_body) {
+	_handoff_partial.clear();
+	if (b_body) {
+		// 消息头已经解析过了，连同消息头一起保存
+		_handoff_partial.append(_recv_head_node->_data, HEAD_TOTAL_LEN);
+	}
+	_handoff_partial.append(_data, bytes_transfered);
+	_b_read_parked = true;
+}
+
+Json::Value CSession::DumpHandoff() {
+	Json::Value state;
+	state["session_id"] = _session_id;
+	state["uid"] = _user_uid;
+	state["partial"] = HandoffMgr::HexEncode(_handoff_partial);
+	state["compress"] = _b_compress.load();
+	state["compress_dict"] = _b_compress_dict.load();
+	state["send_que"] = Json::arrayValue;
+
+	std::lock_guard<std::mutex> lock(_send_lock);
+	// 冻结期间攒下的确认也一起交给新进程
+	PushAcks();
+	auto send_que = _send_que;
+	while (!send_que.empty()) {
+		auto& msgnode = send_que.front();
+		short msg_id = 0;
+		memcpy(&msg_id, msgnode->_data, HEAD_ID_LEN);
+		msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+
+		Json::Value msg;
+		msg["id"] = msg_id;
+		msg["data"] = HandoffMgr::HexEncode(std::string(msgnode->_data + HEAD_TOTAL_LEN,
+			msgnode->_total_len - HEAD_TOTAL_LEN));
+		state["send_que"].append(msg);
+		send_que.pop();
+	}
+
+	return state;
+}
 
-LogicNode::LogicNode(shared_ptr<CSession>  session, 
-	shared_ptr<RecvNode> recvnode):_session(session),_recvnode(recvnode) {
-	
+void CSession::LoadHandoff(const Json::Value& state) {
+	_session_id = state["session_id"].asString();
+	_user_uid = state["uid"].asInt();
+	_handoff_partial = HandoffMgr::HexDecode(state["partial"].asString());
+	_b_compress = state["compress"].asBool();
+	_b_compress_dict = state["compress_dict"].asBool();
+
+	std::lock_guard<std::mutex> lock(_send_lock);
+	// Resume之前保持冻结，防止其他线程Send时提前发起写操作
+	_b_handoff = true;
+	_b_read_parked = true;
+	_b_write_parked = true;
+	for (auto& msg : state["send_que"]) {
+		auto data = HandoffMgr::HexDecode(msg["data"].asString());
+		_send_que.push(make_shared<SendNode>(data.c_str(), data.length(), msg["id"].asInt()));
+	}
+}
+
+void CSession::Resume() {
+	auto self = shared_from_this();
+	boost::asio::post(_socket.get_executor(), [self, this]() {
+		{
+			std::lock_guard<std::mutex> lock(_send_lock);
+			_b_handoff = false;
+			// 写操作已经停下来的才需要重新发起，否则HandleWrite会接着发送队列中的数据
+			if (_b_write_parked && !_send_que.empty()) {
+				auto& msgnode = _send_que.front();
+				boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+					std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+			}
+			_b_write_parked = false;
+		}
+
+		if (_b_read_parked) {
+			_b_read_parked = false;
+			ResumeRead();
+		}
+	});
+}
+
+void CSession::ResumeRead() {
+	auto partial = std::move(_handoff_partial);
+	_handoff_partial.clear();
+
+	// 消息头还没读完，继续读消息头
+	if (partial.size() < HEAD_TOTAL_LEN) {
+		::memset(_data, 0, MAX_LENGTH);
+		memcpy(_data, partial.data(), partial.size());
+		_resume_len = partial.size();
+		AsyncReadHead(HEAD_TOTAL_LEN);
+		return;
+	}
+
+	// 消息头已经读完，恢复消息头并继续读消息体
+	_recv_head_node->Clear();
+	memcpy(_recv_head_node->_data, partial.data(), HEAD_TOTAL_LEN);
+
+	short msg_id = 0;
+	short msg_len = 0;
+	ParseMsgHead(_recv_head_node->_data, msg_id, msg_len);
+
+	_recv_msg_node = make_shared<RecvNode>(msg_len, msg_id);
+	::memset(_data, 0, MAX_LENGTH);
+	memcpy(_data, partial.data() + HEAD_TOTAL_LEN, partial.size() - HEAD_TOTAL_LEN);
+	_resume_len = partial.size() - HEAD_TOTAL_LEN;
+	AsyncReadBody(msg_len);
 }
+
+/*
+_data 是一个字符缓冲区，用于存储从网络 socket 中异步读取的字节数据。在每次读取操作时：
+
+_data 会被清空，然后从 socket 中接收到的数据会被存储在这个缓冲区中。
+在数据接收完毕后，_data 中的数据会被复制到消息节点（如 _recv_head_node 或 _recv_msg_node）中，供后续解析和处理。
+*/
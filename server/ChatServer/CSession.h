@@ -8,6 +8,9 @@
 #include <queue>
 #include <mutex>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <json/json.h>
 #include "const.h"
 #include "MsgNode.h"
 using namespace std;
@@ -19,10 +22,10 @@ namespace net = boost::asio;            // from <boost/asio.hpp>
 using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
 
 
-class CServer;  // ԤCServer
-class LogicSystem;  // ԤLogicSystem
+class CServer;  // 预声明CServer类
+class LogicSystem;  // 预声明LogicSystem类
 
-// CSessionࣺÿͻ˻Ự
+// CSession类：管理每个客户端会话
 class CSession: public std::enable_shared_from_this<CSession>
 {
 public:
@@ -36,60 +39,107 @@ public:
 	void Send(char* msg,  short max_length, short msgid);
 	void Send(std::string msg, short msgid);
 	void Close();
-	// ع
+	// 返回共享的自身对象
 	std::shared_ptr<CSession> SharedSelf();
-	// 첽ȡϢ
+	// 异步读取消息体
 	void AsyncReadBody(int length);
-	// 첽ȡϢͷ
+	// 异步读取消息头
 	void AsyncReadHead(int total_len);
+	// 平滑升级：冻结读写，当前的写操作完成后取消读
+	void PrepareHandoff();
+	// 读写是否都已经停下来
+	bool IsParked();
+	// 导出会话状态(会话id、uid、半包、发送队列)交给新进程
+	Json::Value DumpHandoff();
+	// 新进程根据旧进程导出的状态恢复会话
+	void LoadHandoff(const Json::Value& state);
+	// 恢复读写
+	void Resume();
+	// 登录时协商压缩，之后超过阈值的帧压缩发送，b_dict表示客户端和服务器的字典一致
+	void SetCompress(bool b_dict);
+	// 发送消息确认，一次写操作期间产生的确认合并成一帧发送
+	void SendAck(const std::string& msgid, long long seq, long long ts);
 private:
-	// 첽ȡϢ
+	// 把攒下的确认打包成一帧放入发送队列，调用方持有_send_lock
+	void PushAcks();
+	// 按协商结果压缩消息并生成发送节点
+	std::shared_ptr<SendNode> MakeSendNode(const char* msg, short max_length, short msgid);
+	// 取消正在进行的读操作
+	void CancelRead();
+	// 读操作被取消时保存已经读到的半包
+	void ParkRead(std::size_t bytes_transfered, bool b_body);
+	// 从保存的半包继续读取
+	void ResumeRead();
+	// 异步读取完整消息
 	void asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code& , std::size_t)> handler);
-	// 첽ȡָȵ
+	// 异步读取指定长度的数据
 	void asyncReadLen(std::size_t  read_len, std::size_t total_len,
 		std::function<void(const boost::system::error_code&, std::size_t)> handler);
 	
-	// дʱĻص
+	// 处理写操作完成时的回调
 	void HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self);
-	// TCPӵsocket
+	// TCP连接的socket对象
 	tcp::socket _socket;
-	// ỰΨһʶ (UUID)
+	// 会话的唯一标识符 (UUID)
 	std::string _session_id;
 
-	// 洢ݵĻ
+	// 存储传输数据的缓冲区
 	char _data[MAX_LENGTH];
 
-	// ָָ룬
+	// 指向服务器对象的指针，用于与服务器交互
 	CServer* _server;
-	// Ựرձ־
+	// 会话关闭标志
 	bool _b_close;
-	// ϢͶ
+	// 消息发送队列
 	std::queue<shared_ptr<SendNode> > _send_que;
-	// ͶеĻȷ̰߳ȫ
+	// 发送队列的互斥锁，确保线程安全
 	std::mutex _send_lock;
 
-	// յϢṹָ
+	// 接收的消息结构体指针
 	std::shared_ptr<RecvNode> _recv_msg_node;
-	// ־ǷڽϢͷ
+	// 标志是否正在解析消息头
 	bool _b_head_parse;
 
-	// յϢͷṹ
+	// 接收到的消息头部结构体
 	std::shared_ptr<MsgNode> _recv_head_node;
-	// ûΨһID
+	// 用户的唯一ID
 	int _user_uid;
+
+	// 平滑升级中，读写冻结
+	std::atomic<bool> _b_handoff;
+	// 读操作已经停止
+	std::atomic<bool> _b_read_parked;
+	// 写操作已经停止，受_send_lock保护
+	bool _b_write_parked;
+	// 冻结时未读完的半包(包含已读到的消息头)
+	std::string _handoff_partial;
+	// 恢复读取时_data中已有的字节数
+	std::size_t _resume_len;
+	// 客户端支持解压缩
+	std::atomic<bool> _b_compress;
+	// 客户端加载了相同的字典
+	std::atomic<bool> _b_compress_dict;
+	// 等待合并发送的消息确认，受_send_lock保护
+	Json::Value _pending_acks;
 };
 
 
-// LogicNodeࣺڹ߼еĻỰͽսڵ
+// LogicNode类：用于管理逻辑处理中的会话和接收节点
 class LogicNode {
-	friend class LogicSystem;  // LogicSystemԷLogicNode˽гԱ
+	friend class LogicQueue;  // LogicQueue类可以访问LogicNode的私有成员
 public:
-	// 캯ʼỰͽսڵ
-	LogicNode(shared_ptr<CSession>, shared_ptr<RecvNode>);
+	// 构造函数，初始化会话和接收节点
+	LogicNode(shared_ptr<CSession>, shared_ptr<RecvNode>, uint64_t trace_id = 0);
 private:
-	// 洢Ự
+	// 存储会话对象
 	shared_ptr<CSession> _session;
 
-	// 洢Ϣڵ
+	// 存储接收消息节点对象
 	shared_ptr<RecvNode> _recvnode;
+
+	// 投递到逻辑队列的时间，用于统计排队等待时间
+	std::chrono::steady_clock::time_point _enqueue_time;
+
+	// 帧头带过来或者抽样生成的trace id，为0表示不追踪
+	uint64_t _trace_id;
 };
\ No newline at end of file
@@ -5,84 +5,151 @@
 
 #include "CSession.h"
 #include "MysqlMgr.h"
+#include "MetricsMgr.h"
+#include "BrokerChannel.h"
+
+// 对端通道的默认参数
+#define PEER_DEFAULT_DEADLINE_MS  500
+#define PEER_DEFAULT_MAX_INFLIGHT  1000
+#define PEER_DEFAULT_BREAKER_FAILURES  5
+#define PEER_DEFAULT_BREAKER_OPEN_MS  5000
+#define PEER_DEFAULT_BATCH_SIZE  256
+#define PEER_DEFAULT_BATCH_BYTES  65536
+#define PEER_DEFAULT_FLUSH_US  200
+// broker模式下追加收件箱的连接数
+#define BROKER_PUBLISH_CONNECTIONS  2
+
+static int CfgIntOr(const std::string& key, int def) {
+	auto value = ConfigMgr::Inst()["PeerServer"][key];
+	return value.empty() ? def : atoi(value.c_str());
+}
 
 ChatGrpcClient::ChatGrpcClient()
 {
 	auto& cfg = ConfigMgr::Inst();
-	auto server_list = cfg["PeerServer"]["Servers"];
-
-	std::vector<std::string> words;
+	_config._batch_size = (std::max)(CfgIntOr("BatchSize", PEER_DEFAULT_BATCH_SIZE), 1);
+	_config._batch_bytes = (std::max)(CfgIntOr("BatchBytes", PEER_DEFAULT_BATCH_BYTES), 1);
+	_config._flush_us = (std::max)(CfgIntOr("FlushUs", PEER_DEFAULT_FLUSH_US), 0);
+	// 流上没有单次调用的超时，DeadlineMs用作确认超时
+	_config._ack_timeout_ms = CfgIntOr("DeadlineMs", PEER_DEFAULT_DEADLINE_MS);
+	_config._max_pending = (std::max)(CfgIntOr("MaxInflight", PEER_DEFAULT_MAX_INFLIGHT), 1);
+	_config._breaker_failures = CfgIntOr("BreakerFailures", PEER_DEFAULT_BREAKER_FAILURES);
+	_config._breaker_open_ms = CfgIntOr("BreakerOpenMs", PEER_DEFAULT_BREAKER_OPEN_MS);
+	_self_name = cfg["SelfServer"]["Name"];
+	_fallback_count = MetricsMgr::GetInstance()->GetCounter("chat_peer_fallback_total");
+	std::atomic_store(&_peers, std::shared_ptr<const PeerMap>(std::make_shared<PeerMap>()));
+	if (cfg["PeerServer"]["Transport"] == "broker") {
+		_broker_store = RedisMgr::GetInstance()->OpenStore(BROKER_PUBLISH_CONNECTIONS);
+		std::cout << "peer transport: broker" << std::endl;
+	}
 
-	std::stringstream ss(server_list);
-	std::string word;
+	// 订阅时立即按当前成员表打开通道
+	MembershipMgr::GetInstance()->Subscribe([this](std::shared_ptr<const Membership> members) {
+		UpdatePeers(members);
+	});
+}
 
-	while (std::getline(ss, word, ',')) {
-		words.push_back(word);
+ChatGrpcClient::~ChatGrpcClient() {
+	// 每个通道发完积压的事件并等对端确认后再退出
+	auto peers = std::atomic_load(&_peers);
+	for (auto& peer : *peers) {
+		peer.second._channel->Stop();
 	}
+}
 
-	for (auto& word : words) {
-		if (cfg[word]["Name"].empty()) {
+void ChatGrpcClient::UpdatePeers(std::shared_ptr<const Membership> members) {
+	auto current = std::atomic_load(&_peers);
+	auto next = std::make_shared<PeerMap>();
+	for (auto& item : members->_servers) {
+		auto& info = item.second;
+		if (info.name() == _self_name) {
 			continue;
 		}
-		_pools[cfg[word]["Name"]] = std::make_unique<ChatConPool>(5, cfg[word]["Host"], cfg[word]["Port"]);
+		// 地址没变的对端沿用原来的通道，流和未确认的事件不受影响；broker模式下地址就是对端的收件箱
+		auto address = _broker_store ? PEER_INBOX_PREFIX + info.name() : info.rpc_host() + ":" + info.rpc_port();
+		auto find_iter = current->find(info.name());
+		if (find_iter != current->end() && find_iter->second._address == address) {
+			(*next)[info.name()] = find_iter->second;
+			continue;
+		}
+		// 换了地址的对端先把旧通道发完再建新通道：两个通道共用seq，旧通道后发出的小seq会被对端当成重复丢掉
+		if (find_iter != current->end()) {
+			find_iter->second._channel->Stop();
+		}
+		std::cout << "open peer [" << info.name() << "] " << address << std::endl;
+		PeerEntry entry;
+		entry._address = address;
+		auto fallback = [this](PeerEventItem& item) {
+			OnFallback(item);
+		};
+		if (_broker_store) {
+			entry._channel = std::make_shared<BrokerChannel>(_self_name, info.name(), _broker_store, _config, fallback);
+		}
+		else {
+			entry._channel = std::make_shared<PeerChannel>(_self_name, info.name(), info.rpc_host(), info.rpc_port(),
+				_config, fallback);
+		}
+		(*next)[info.name()] = entry;
 	}
-}
-
-// ܣָķ "Ӻ"  gRPC 󣬲Ӧ
-// 
-//   - server_ip: Ŀ IP ַ
-//   - req: ӺѵϢû ID Ŀû ID Ϣ
-//  AddFriendRsp 󣬱ʾӦ
-AddFriendRsp ChatGrpcClient::NotifyAddFriend(std::string server_ip, const AddFriendReq& req)
-{
-    // ʼӦ rspʹ Defer ȷںʱĬϵĳɹ״̬û ID Ϣ
-    AddFriendRsp rsp;
-    Defer defer([&rsp, &req]() {
-        rsp.set_error(ErrorCodes::Success);   // Ĭϳɹ״̬
-        rsp.set_applyuid(req.applyuid());     // û ID
-        rsp.set_touid(req.touid());           // Ŀû ID
-    });
-
-    // ҷӳأҵӦӳض
-    auto find_iter = _pools.find(server_ip);
-    if (find_iter == _pools.end()) {
-        // ҲӦķ IPֱӷصǰ rspĬϵĳɹ״̬
-        return rsp;
-    }
-
-    // ȡҵķӳض
-    auto &pool = find_iter->second;
 
-    //  gRPC Ķά״̬
-    ClientContext context;
+	std::vector<std::shared_ptr<PeerSender>> removed;
+	for (auto& item : *current) {
+		auto find_iter = next->find(item.first);
+		if (find_iter == next->end() || find_iter->second._channel != item.second._channel) {
+			std::cout << "close peer [" << item.first << "] " << item.second._address << std::endl;
+			removed.push_back(item.second._channel);
+		}
+	}
+	std::atomic_store(&_peers, std::shared_ptr<const PeerMap>(next));
 
-    // ӳлȡ gRPC ͻ˵Ӷ
-    auto stub = pool->getConnection();
+	// 新的通道表发布后不会再有调用方拿到这些通道；已经拿到的调用方在Stop之后投递的事件走降级
+	for (auto& channel : removed) {
+		channel->Stop();
+	}
+}
 
-    //  "Ӻ"  gRPC 󣬴ġ req Ӧ rsp
-    Status status = stub->NotifyAddFriend(&context, req, &rsp);
+std::shared_ptr<PeerSender> ChatGrpcClient::FindChannel(const std::string& server_ip, const char* method) {
+	auto peers = std::atomic_load(&_peers);
+	auto find_iter = peers->find(server_ip);
+	if (find_iter == peers->end()) {
+		std::cout << method << " unknown peer [" << server_ip << "]" << std::endl;
+		return nullptr;
+	}
+	return find_iter->second._channel;
+}
 
-    // ʹ Defer ȷʱӷصӳС
-    Defer defercon([&stub, this, &pool]() {
-        pool->returnConnection(std::move(stub));  // ӹ黹ӳ
-    });
+void ChatGrpcClient::OnFallback(PeerEventItem& item) {
+	if (item._event.body_case() == message::PeerEvent::kTextMsg) {
+		std::cout << "notify text msg uid " << item._touid << " fallback to offline" << std::endl;
+		SaveOfflineText(item._touid, item._offline);
+		return;
+	}
+	_fallback_count->fetch_add(1, std::memory_order_relaxed);
+	std::cout << "notify uid " << item._touid << " dropped, synced at login" << std::endl;
+}
 
-    //  gRPC ״̬
-    if (!status.ok()) {
-        // ʧܣ򽫴Ϊ RPC ʧ
-        rsp.set_error(ErrorCodes::RPCFailed);
-        return rsp;
+// 函数功能：异步通知对端服务器 "添加好友"，立即返回。
+// 输入参数：
+//   - server_ip: 目标服务器的名称。
+//   - req: 添加好友的请求消息，包含申请用户 ID 和目标用户 ID 等信息。
+// 对端不可用时不需要额外处理：申请已经写入mysql和申请同步日志，接收方下次登录时会增量同步。
+void ChatGrpcClient::NotifyAddFriend(std::string server_ip, const AddFriendReq& req)
+{
+    auto channel = FindChannel(server_ip, "NotifyAddFriend");
+    if (channel == nullptr) {
+        _fallback_count->fetch_add(1, std::memory_order_relaxed);
+        return;
     }
 
-    // ɹӦ
-    return rsp;
+    PeerEventItem item;
+    *item._event.mutable_add_friend() = req;
+    item._touid = req.touid();
+    channel->Post(std::move(item));
 }
 
-
-
 bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
 {
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -101,8 +168,8 @@ bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<
 			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
 	}
 	else {
-		//redisûѯmysql
-		//ѯݿ
+		//redis中没有则查询mysql
+		//查询数据库
 		std::shared_ptr<UserInfo> user_info = nullptr;
 		user_info = MysqlMgr::GetInstance()->GetUser(uid);
 		if (user_info == nullptr) {
@@ -111,7 +178,7 @@ bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<
 
 		userinfo = user_info;
 
-		//ݿдredis
+		//将数据库内容写入redis缓存
 		Json::Value redis_root;
 		redis_root["uid"] = uid;
 		redis_root["pwd"] = userinfo->pwd;
@@ -126,80 +193,44 @@ bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<
 
 }
 
-AuthFriendRsp ChatGrpcClient::NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req) {
-	AuthFriendRsp rsp;
-	rsp.set_error(ErrorCodes::Success);
-
-	Defer defer([&rsp, &req]() {
-		rsp.set_fromuid(req.fromuid());
-		rsp.set_touid(req.touid());
-		});
-
-	auto find_iter = _pools.find(server_ip);
-	if (find_iter == _pools.end()) {
-		return rsp;
-	}
-
-	auto& pool = find_iter->second;
-	ClientContext context;
-	auto stub = pool->getConnection();
-	Status status = stub->NotifyAuthFriend(&context, req, &rsp);
-	Defer defercon([&stub, this, &pool]() {
-		pool->returnConnection(std::move(stub));
-		});
-
-	if (!status.ok()) {
-		rsp.set_error(ErrorCodes::RPCFailed);
-		return rsp;
+// 和NotifyAddFriend一样，认证结果已经写入好友同步日志，失败时只计数
+void ChatGrpcClient::NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req) {
+	auto channel = FindChannel(server_ip, "NotifyAuthFriend");
+	if (channel == nullptr) {
+		_fallback_count->fetch_add(1, std::memory_order_relaxed);
+		return;
 	}
 
-	return rsp;
+	PeerEventItem item;
+	*item._event.mutable_auth_friend() = req;
+	item._touid = req.touid();
+	channel->Post(std::move(item));
 }
 
-TextChatMsgRsp ChatGrpcClient::NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req, const Json::Value& rtvalue) {
-    // ӦóʼΪɹ
-    TextChatMsgRsp rsp;
-    rsp.set_error(ErrorCodes::Success);
-
-    // ʹ Defer ģʽȷںǰӦ
-    Defer defer([&rsp, &req]() {
-        rsp.set_fromuid(req.fromuid()); // ÷ UID
-        rsp.set_touid(req.touid());     // ý UID
-        
-        // еϢӵӦ
-        for (const auto& text_data : req.textmsgs()) {
-            TextChatData* new_msg = rsp.add_textmsgs(); // Ϣ
-            new_msg->set_msgid(text_data.msgid());      // Ϣ ID
-            new_msg->set_msgcontent(text_data.msgcontent()); // Ϣ
-        }
-    });
-
-    // ӳвָķ IP
-    auto find_iter = _pools.find(server_ip);
-    if (find_iter == _pools.end()) {
-        // ûҵӦӳأصǰӦ
-        return rsp;
+// 函数功能：异步把聊天消息转发给接收方所在的服务器，立即返回。
+// 对端熔断、积压过多或者没有等到确认时把通知内容rtvalue写入接收方的离线消息列表，接收方下次登录时下发。
+void ChatGrpcClient::NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req, const Json::Value& rtvalue) {
+    auto channel = FindChannel(server_ip, "NotifyTextChatMsg");
+    if (channel == nullptr) {
+        SaveOfflineText(req.touid(), rtvalue);
+        return;
     }
 
-    // ȡӳе
-    auto& pool = find_iter->second;
-    ClientContext context; //  gRPC ͻ
-    auto stub = pool->getConnection(); // ȡ
-
-    //  gRPC 󲢻ȡӦ״̬
-    Status status = stub->NotifyTextChatMsg(&context, req, &rsp);
-
-    // ʹ Defer ģʽȷںǰ黹
-    Defer defercon([&stub, this, &pool]() {
-        pool->returnConnection(std::move(stub)); // 黹ӵӳ
-    });
+    PeerEventItem item;
+    *item._event.mutable_text_msg() = req;
+    item._touid = req.touid();
+    item._offline = rtvalue;
+    channel->Post(std::move(item));
+}
 
-    //  gRPC Ƿɹ
-    if (!status.ok()) {
-        rsp.set_error(ErrorCodes::RPCFailed); // ôΪ RPC ʧ
-        return rsp; // Ӧ
+void ChatGrpcClient::SaveOfflineText(int touid, const Json::Value& rtvalue) {
+    _fallback_count->fetch_add(1, std::memory_order_relaxed);
+    auto key = OFFLINE_MSG_PREFIX + std::to_string(touid);
+    auto redis = RedisMgr::GetInstance();
+    if (!redis->RPush(key, rtvalue.toStyledString())) {
+        std::cout << "save offline msg of uid " << touid << " failed" << std::endl;
+        return;
     }
-
-    return rsp; // سɹӦ
+    // 接收方长时间不登录时只保留最近的MAX_OFFLINE_MSG条
+    redis->LTrim(key, -MAX_OFFLINE_MSG, -1);
 }
-// úʵּͨ gRPC ָķıϢȷڴȷӦ
\ No newline at end of file
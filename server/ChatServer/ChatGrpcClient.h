@@ -5,7 +5,10 @@
 #include <grpcpp/grpcpp.h> 
 #include "message.grpc.pb.h"
 #include "message.pb.h"
-#include <queue>
+#include "PeerChannel.h"
+#include "KvStore.h"
+#include "MembershipMgr.h"
+#include <atomic>
 #include "const.h"
 #include "data.h"
 #include <json/json.h>
@@ -32,85 +35,42 @@ using message::TextChatMsgRsp;
 using message::TextChatData;
 
 
-class ChatConPool {
-public:
-	ChatConPool(size_t poolSize, std::string host, std::string port): poolSize_(poolSize), host_(host), port_(port), b_stop_(false) {
-		for (size_t i = 0; i < poolSize_; ++i) {
-
-			std::shared_ptr<Channel> channel = grpc::CreateChannel(host + ":" + port,
-				grpc::InsecureChannelCredentials());
-
-			connections_.push(ChatService::NewStub(channel));
-		}
-	}
-
-	~ChatConPool() {
-		std::lock_guard<std::mutex> lock(mutex_);
-		Close();
-		while (!connections_.empty()) {
-			connections_.pop();
-		}
-	}
-
-	std::unique_ptr<ChatService::Stub> getConnection() {
-		std::unique_lock<std::mutex> lock(mutex_);
-		// ͨ cond_.wait() ȴ״ֱ̬һ
-		cond_.wait(lock, [this] {
-			if (b_stop_) {
-				return true;
-			}
-			return !connections_.empty();
-			});
-		//ֱֹͣӷؿָ
-		if (b_stop_) {
-			return  nullptr;
-		}
-		auto context = std::move(connections_.front());  //  connections_ еǰ˻ȡӣʹ std::move תȨ  unique_ptrֿ֧
-		connections_.pop();
-		return context;
-	}
-
-	void returnConnection(std::unique_ptr<ChatService::Stub> context) {
-		std::lock_guard<std::mutex> lock(mutex_);
-		if (b_stop_) {
-			return;
-		}
-		connections_.push(std::move(context));
-		cond_.notify_one();
-	}
-
-	void Close() {
-		b_stop_ = true;
-		cond_.notify_all();
-	}
-
-private:
-	atomic<bool> b_stop_;
-	size_t poolSize_;
-	std::string host_;
-	std::string port_;
-	std::queue<std::unique_ptr<ChatService::Stub> > connections_;
-	std::mutex mutex_;
-	std::condition_variable cond_;
-};
-
-
+// ChatGrpcClient：通知对端ChatServer，配置在 [PeerServer] 中
+// 每个对端一个PeerChannel，通知合批后在长连接双向流上发送，调用方(逻辑线程)立即返回；
+// 对端列表来自MembershipMgr，成员表变化时打开新加入的对端的通道，关闭离开或者换了地址的通道；
+// Transport=broker时不和对端直接连接，每个对端一个BrokerChannel，事件追加到对端在redis上的收件箱，由对端的PeerInbox消费；
+// 对端熔断、积压超过MaxInflight或者流断开后确认超时的事件降级处理：
+// 聊天消息写入接收方的离线消息列表，登录时下发；好友申请和认证已经写入mysql和同步日志，登录时增量同步
 class ChatGrpcClient :public Singleton<ChatGrpcClient>
 {
 	friend class Singleton<ChatGrpcClient>;
 public:
-	~ChatGrpcClient() {
+	~ChatGrpcClient();
 
-	}
-
-	AddFriendRsp NotifyAddFriend(std::string server_ip, const AddFriendReq& req);
-	AuthFriendRsp NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req);
+	void NotifyAddFriend(std::string server_ip, const AddFriendReq& req);
+	void NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req);
 	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
-	TextChatMsgRsp NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req, const Json::Value& rtvalue);
+	void NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req, const Json::Value& rtvalue);
 private:
 	ChatGrpcClient();
-	unordered_map<std::string, std::unique_ptr<ChatConPool>> _pools;	
+	// 找到对端的通道，返回nullptr时调用方走降级
+	std::shared_ptr<PeerSender> FindChannel(const std::string& server_ip, const char* method);
+	// 在心跳线程上调用，按新的成员表生成通道表并发布
+	void UpdatePeers(std::shared_ptr<const Membership> members);
+	void OnFallback(PeerEventItem& item);
+	void SaveOfflineText(int touid, const Json::Value& rtvalue);
+
+	struct PeerEntry {
+		std::string _address;
+		std::shared_ptr<PeerSender> _channel;
+	};
+	typedef unordered_map<std::string, PeerEntry> PeerMap;
+
+	// 通道表快照，只通过std::atomic_load/atomic_store访问，逻辑线程查找不需要加锁
+	std::shared_ptr<const PeerMap> _peers;
+	std::string _self_name;
+	PeerChannelConfig _config;
+	// broker模式下所有BrokerChannel共用的存储，为空时是网格模式
+	std::shared_ptr<KvStore> _broker_store;
+	std::atomic<uint64_t>* _fallback_count;
 };
-
-
-
@@ -10,6 +10,21 @@
 #include "ConfigMgr.h"
 #include "RedisMgr.h"
 #include "ChatServiceImpl.h"
+#include "HandoffMgr.h"
+#include "DrainMgr.h"
+#include "FileServer.h"
+#include "FileBench.h"
+#include "BlobStore.h"
+#include "CompressMgr.h"
+#include "CompressBench.h"
+#include "RpcBench.h"
+#include "RouteBench.h"
+#include "PeerInbox.h"
+#include "MembershipMgr.h"
+#include "ChatGrpcClient.h"
+#include "MetricsMgr.h"
+#include "TraceMgr.h"
+#include <sstream>
 
 using namespace std;
 bool bstop = false;
@@ -26,24 +41,60 @@ int main()
 	try {
 		// 获取Asio I/O服务池单例实例
 		auto pool = AsioIOServicePool::GetInstance();
-		// 初始化登录计数为0，并将其存储在Redis中
-		RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name,"0");
+
+		// 平滑升级：如果旧进程还在运行，接管它的监听socket和所有会话
+		int listen_fd = -1;
+		std::vector<int> session_fds;
+		Json::Value handoff_state;
+		bool b_old_found = false;
+		bool b_takeover = HandoffMgr::GetInstance()->TakeOver(listen_fd, session_fds, handoff_state, b_old_found);
+		// 收到socket后立即确认并等旧进程提交，不能等后面耗时的初始化，否则旧进程超时恢复会话后两个进程会同时读写这些socket
+		if (b_takeover && !HandoffMgr::GetInstance()->AckTakeOver(listen_fd, session_fds)) {
+			RedisMgr::GetInstance()->Close();
+			return EXIT_FAILURE;
+		}
+		// 旧进程还在服务，不能清空它的登录计数，也绑定不了同一个端口
+		if (!b_takeover && b_old_found) {
+			std::cout << "take over failed, old server keeps serving" << std::endl;
+			RedisMgr::GetInstance()->Close();
+			return EXIT_FAILURE;
+		}
+
+		// 初始化登录计数为0，并将其存储在Redis中，接管时沿用旧进程的登录计数
+		if (!b_takeover) {
+			RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, "0");
+			// 重新启动的服务器可以正常分配用户
+			RedisMgr::GetInstance()->HDel(DRAIN_SERVERS, server_name);
+		}
+
+		// memory存储里没有StatusServer写入的token，按 [Storage] 预置压测用户的token，和LoadGen的TokenPrefix一致
+		if (RedisMgr::GetInstance()->IsMemory()) {
+			int seed_users = atoi(cfg["Storage"]["SeedUsers"].c_str());
+			int uid_start = atoi(cfg["Storage"]["SeedUidStart"].c_str());
+			auto token_prefix = cfg["Storage"]["SeedTokenPrefix"];
+			for (int i = 0; i < seed_users; ++i) {
+				auto uid_str = std::to_string(uid_start + i);
+				RedisMgr::GetInstance()->Set(USERTOKENPREFIX + uid_str, token_prefix + uid_str);
+			}
+		}
 
 		//定义一个GrpcServer
 
 		std::string server_address(cfg["SelfServer"]["Host"] + ":" + cfg["SelfServer"]["RPCPort"]);
 		ChatServiceImpl service;
-		grpc::ServerBuilder builder;
-		// 监听端口和添加服务
-		builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-		builder.RegisterService(&service);
-		// 构建并启动gRPC服务器
-		std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-		std::cout << "RPC Server listening on " << server_address << std::endl;
+		// 异步gRPC服务，完成队列、轮询线程和工作线程数在 [Grpc] 中配置
+		AsyncRpcServer rpc_server;
+		if (!rpc_server.Start(server_address, service.GetService())) {
+			RedisMgr::GetInstance()->Close();
+			return EXIT_FAILURE;
+		}
+		service.Serve(rpc_server);
+		// 按 [Metrics] Port 启动指标监听，Prometheus从 /metrics 抓取
+		MetricsMgr::GetInstance()->Start();
 
         // 启动一个单独的线程来运行gRPC服务器
-        std::thread grpc_server_thread([&server]() {
-            server->Wait();  // 等待直到服务器被要求关闭
+        std::thread grpc_server_thread([&rpc_server]() {
+            rpc_server.Wait();  // 等待直到服务器被要求关闭
         });
 
  		// 创建Boost.Asio的I/O上下文对象
@@ -51,19 +102,152 @@ int main()
 		// 设置信号集以捕获SIGINT (Ctrl+C) 和 SIGTERM 信号
 		boost::asio::signal_set signals(io_context, SIGINT, SIGTERM);
 		// 当接收到信号时执行的回调函数
-		signals.async_wait([&io_context, pool, &server](auto, auto) {
+		signals.async_wait([&io_context, pool, &rpc_server](auto, auto) {
 			io_context.stop();
 			pool->Stop();
-			server->Shutdown();
+			rpc_server.Shutdown();
 			});
+
+#ifdef SIGUSR1
+		// Linux下收到SIGUSR1开始排空，把在线用户分批迁移到其他服务器
+		boost::asio::signal_set drain_signals(io_context, SIGUSR1);
+		drain_signals.async_wait([](auto, auto) {
+			DrainMgr::GetInstance()->Drain();
+			});
+#endif
+		// 文件传输使用单独的端口和io线程，不和聊天连接共用socket和逻辑队列
+		auto file_port = atoi(cfg["FileServer"]["Port"].c_str());
+		auto file_path = cfg["FileServer"]["Path"];
+		std::unique_ptr<FileServer> file_server;
+		if (file_port > 0) {
+			file_server = std::make_unique<FileServer>(file_port, file_path,
+				atoi(cfg["FileServer"]["Threads"].c_str()));
+			BlobStore::GetInstance()->Start();
+		}
+
+		// 控制台输入drain同样开始排空，输入 filebench [总大小MB] [块大小KB] 测试文件传输吞吐量，输入blobstat查看去重率，
+		//输入traindict用抽样的帧训练压缩字典，输入compressbench [级别]测试压缩率和耗时
+		//输入rpcbench [p99毫秒] [chat|status]测试固定p99下的RPC吞吐量，输入members查看当前成员表
+		//输入routebench [每个节点的事件数] [mesh|broker|all]对比网格和broker两种跨服务器路由
+		std::thread([file_port, file_path]() {
+			std::string cmd;
+			while (std::getline(std::cin, cmd)) {
+				std::istringstream iss(cmd);
+				std::string name;
+				iss >> name;
+				if (name == "drain") {
+					DrainMgr::GetInstance()->Drain();
+				}
+				else if (name == "filebench" && file_port > 0) {
+					long long total_mb = 100, chunk_kb = 1024;
+					iss >> total_mb >> chunk_kb;
+					FileBench::Run(file_port, file_path, total_mb, chunk_kb);
+				}
+				else if (name == "blobstat" && file_port > 0) {
+					long long logical = 0, physical = 0;
+					double ratio = BlobStore::GetInstance()->DedupRatio(logical, physical);
+					std::cout << "blob store logical bytes " << logical << ", physical bytes " << physical
+						<< ", dedup ratio " << ratio << std::endl;
+				}
+				else if (name == "traindict") {
+					CompressMgr::GetInstance()->TrainDict();
+				}
+				else if (name == "compressbench") {
+					int level = CompressMgr::GetInstance()->GetLevel();
+					iss >> level;
+					CompressBench::Run(level);
+				}
+				else if (name == "rpcbench") {
+					int p99_ms = 10;
+					std::string target = "chat";
+					iss >> p99_ms >> target;
+					RpcBench::Run(p99_ms, target);
+				}
+				else if (name == "routebench") {
+					int events = 10000;
+					std::string mode = "all";
+					iss >> events >> mode;
+					RouteBench::Run(events, mode);
+				}
+				else if (name == "members") {
+					auto members = MembershipMgr::GetInstance()->Snapshot();
+					std::cout << "membership version " << members->_version << std::endl;
+					for (auto& item : members->_servers) {
+						std::cout << item.first << " client " << item.second.host() << ":" << item.second.port()
+							<< " rpc " << item.second.rpc_host() << ":" << item.second.rpc_port() << std::endl;
+					}
+				}
+			}
+			}).detach();
 		
        // 从配置中读取TCP端口号并启动CServer
         auto port_str = cfg["SelfServer"]["Port"];
-        CServer s(io_context, atoi(port_str.c_str()));
+        std::shared_ptr<CServer> s;
+        if (b_takeover) {
+            s = std::make_shared<CServer>(io_context, atoi(port_str.c_str()), listen_fd);
+            s->ResumeSessions(session_fds, handoff_state);
+        }
+        else {
+            s = std::make_shared<CServer>(io_context, atoi(port_str.c_str()));
+        }
+
+        // broker模式下对端把通知追加到本服务器的收件箱，读线程按批交给ChatService处理，和流上收到的一样按(epoch, seq)去重
+        std::unique_ptr<PeerInbox> inbox;
+        if (cfg["PeerServer"]["Transport"] == "broker") {
+            inbox = std::make_unique<PeerInbox>(server_name, RedisMgr::GetInstance()->OpenStore(1),
+                [&service](const message::PeerBatch& batch) {
+                message::PeerAck ack;
+                service.DeliverBatch(nullptr, batch, &ack);
+            });
+            inbox->Start();
+        }
+
+        // 交接会话前停止处理对端通知：收件箱停止消费，剩下的由新进程继续读；流上后到的批次被拒绝，对端重发给新进程或者转存离线
+        s->SetHandoffHooks([&service, &inbox]() {
+            if (inbox) {
+                inbox->Stop();
+            }
+            service.PauseDelivery();
+            }, [&service, &inbox]() {
+            service.ResumeDelivery();
+            if (inbox) {
+                inbox->Start();
+            }
+            });
+
+        // 等待下一次升级，连接交给新进程后和收到退出信号一样停止服务
+        HandoffMgr::GetInstance()->Listen(s.get(), [&io_context, pool, &rpc_server]() {
+            io_context.stop();
+            pool->Stop();
+            rpc_server.Shutdown();
+            });
+
+        // CServer开始监听后再向StatusServer注册，对端通道随成员表变化打开和关闭
+        MembershipMgr::GetInstance()->Start();
+        ChatGrpcClient::GetInstance();
+
         io_context.run();  // 运行I/O上下文
+        // 先停止消费收件箱，没处理的通知留在收件箱里，由重启后的进程继续处理
+        if (inbox) {
+            inbox->Stop();
+        }
+        // 正常退出时从成员表注销，连接交给新进程时由新进程继续心跳
+        MembershipMgr::GetInstance()->Stop(!HandoffMgr::GetInstance()->IsHandedOff());
+        // 停止文件传输服务
+        if (file_server) {
+            file_server->Stop();
+            BlobStore::GetInstance()->Stop();
+        }
+        HandoffMgr::GetInstance()->Stop();
+        DrainMgr::GetInstance()->Stop();
+        MetricsMgr::GetInstance()->Stop();
+        TraceMgr::GetInstance()->Stop();
 
-        // 清理工作：从Redis中删除登录计数键值对
-        RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
+        // 清理工作：从Redis中删除登录计数键值对，连接交给新进程时由新进程继续维护
+        if (!HandoffMgr::GetInstance()->IsHandedOff()) {
+            RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
+            RedisMgr::GetInstance()->HDel(DRAIN_SERVERS, server_name);
+        }
         // 关闭Redis连接
         RedisMgr::GetInstance()->Close();
         // 等待gRPC服务器线程退出
@@ -6,15 +6,250 @@
 #include <json/reader.h>
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
+#include "TraceMgr.h"
 
-ChatServiceImpl::ChatServiceImpl()
+// 取对端通过metadata带过来的trace id；没有带时沿用当前线程的，流上的事件由DeliverStream按事件设置
+static uint64_t ExtractTrace(::grpc::ServerContext* context) {
+	// 从broker收件箱取出的事件没有gRPC上下文，trace id已经由DeliverBatch设置
+	if (context == nullptr) {
+		return TraceMgr::Current();
+	}
+	auto& metadata = context->client_metadata();
+	auto iter = metadata.find(TRACE_METADATA_KEY);
+	if (iter == metadata.end()) {
+		return TraceMgr::Current();
+	}
+	return TraceMgr::FromHex(std::string(iter->second.data(), iter->second.length()));
+}
+
+// 一次对端通知的处理范围，暂停投递时Entered()为false，调用方直接拒绝
+class DeliveryScope {
+public:
+	explicit DeliveryScope(ChatServiceImpl* impl) : _impl(impl), _b_entered(impl->EnterDelivery()) {}
+	~DeliveryScope() {
+		if (_b_entered) {
+			_impl->LeaveDelivery();
+		}
+	}
+	bool Entered() const { return _b_entered; }
+private:
+	ChatServiceImpl* _impl;
+	bool _b_entered;
+};
+
+// 拒绝时的状态码，对端PeerChannel据此知道最后一个确认之后的事件都没有处理过
+static Status RefusedStatus() {
+	return Status(grpc::StatusCode::ABORTED, "server is handing off");
+}
+
+ChatServiceImpl::ChatServiceImpl() : _b_delivery_paused(false), _delivering(0)
 {
+	auto metrics = MetricsMgr::GetInstance();
+	_add_friend_metric = metrics->GetLatency("chat_rpc", "method", "NotifyAddFriend");
+	_auth_friend_metric = metrics->GetLatency("chat_rpc", "method", "NotifyAuthFriend");
+	_text_chat_metric = metrics->GetLatency("chat_rpc", "method", "NotifyTextChatMsg");
+}
+
+// 对端的长连接流：读一批 -> 工作线程上处理 -> 回复累计确认 -> 再读下一批，同一个流上同时只有一个操作在途，
+// 同一个对端的事件按发送顺序处理
+class DeliverStreamCall : public RpcCall {
+public:
+	DeliverStreamCall(AsyncRpcServer* server, grpc::ServerCompletionQueue* cq, ChatServiceImpl* impl)
+		: _server(server), _cq(cq), _impl(impl), _stream(&_context), _state(REQUEST) {
+		_impl->GetService()->RequestDeliverStream(&_context, &_stream, _cq, _cq, this);
+	}
+
+	void Proceed(bool ok) override {
+		switch (_state) {
+		case REQUEST:
+			if (!ok) {
+				delete this;
+				return;
+			}
+			new DeliverStreamCall(_server, _cq, _impl);
+			std::cout << "peer stream from " << _context.peer() << " opened" << std::endl;
+			_state = READ;
+			_stream.Read(&_batch, this);
+			break;
+		case READ:
+			// 读失败是对端WritesDone或者流断开
+			if (!ok) {
+				std::cout << "peer stream from " << _context.peer() << " closed" << std::endl;
+				_state = FINISH;
+				_stream.Finish(Status::OK, this);
+				break;
+			}
+			_server->Post([this]() {
+				// 本进程正在把会话交给新进程，拒绝这一批并结束流，对端重连后发给新进程或者转存离线
+				if (!_impl->DeliverBatch(&_context, _batch, &_ack)) {
+					_state = FINISH;
+					_stream.Finish(RefusedStatus(), this);
+					return;
+				}
+				_state = WRITE;
+				_stream.Write(_ack, this);
+			});
+			break;
+		case WRITE:
+			if (!ok) {
+				_state = FINISH;
+				_stream.Finish(Status::OK, this);
+				break;
+			}
+			_state = READ;
+			_stream.Read(&_batch, this);
+			break;
+		case FINISH:
+			delete this;
+			break;
+		}
+	}
 
+private:
+	enum State {
+		REQUEST,
+		READ,
+		WRITE,
+		FINISH,
+	};
+
+	AsyncRpcServer* _server;
+	grpc::ServerCompletionQueue* _cq;
+	ChatServiceImpl* _impl;
+	grpc::ServerContext _context;
+	grpc::ServerAsyncReaderWriter<PeerAck, PeerBatch> _stream;
+	PeerBatch _batch;
+	PeerAck _ack;
+	State _state;
+};
+
+void ChatServiceImpl::Serve(AsyncRpcServer& server)
+{
+	server.AddUnary(&_service, &ChatService::AsyncService::RequestNotifyAddFriend,
+		[this](ServerContext* context, const AddFriendReq* request, AddFriendRsp* reply) {
+		DeliveryScope scope(this);
+		if (!scope.Entered()) {
+			return RefusedStatus();
+		}
+		return NotifyAddFriend(context, request, reply);
+	}, _add_friend_metric);
+	server.AddUnary(&_service, &ChatService::AsyncService::RequestNotifyAuthFriend,
+		[this](ServerContext* context, const AuthFriendReq* request, AuthFriendRsp* reply) {
+		DeliveryScope scope(this);
+		if (!scope.Entered()) {
+			return RefusedStatus();
+		}
+		return NotifyAuthFriend(context, request, reply);
+	}, _auth_friend_metric);
+	server.AddUnary(&_service, &ChatService::AsyncService::RequestNotifyTextChatMsg,
+		[this](ServerContext* context, const TextChatMsgReq* request, TextChatMsgRsp* reply) {
+		DeliveryScope scope(this);
+		if (!scope.Entered()) {
+			return RefusedStatus();
+		}
+		return NotifyTextChatMsg(context, request, reply);
+	}, _text_chat_metric);
+	for (size_t i = 0; i < server.CqCount(); ++i) {
+		new DeliverStreamCall(&server, server.GetCq(i), this);
+	}
+}
+
+// 流上的每个事件交给对应的单次调用处理，处理完一批回复一次累计确认；
+// 断流重连后对端会重发没有确认的事件，同一个epoch里seq不大于已处理的直接跳过
+bool ChatServiceImpl::DeliverBatch(ServerContext* context, const PeerBatch& batch, PeerAck* ack)
+{
+	DeliveryScope scope(this);
+	if (!scope.Entered()) {
+		return false;
+	}
+
+	uint64_t acked_seq = 0;
+	for (auto& event : batch.events()) {
+		acked_seq = event.seq();
+		if (!AcceptSeq(batch.from_server(), batch.epoch(), event.seq())) {
+			continue;
+		}
+
+		TraceScope trace_scope(event.trace_id());
+		switch (event.body_case()) {
+		case PeerEvent::kAddFriend: {
+			AddFriendRsp rsp;
+			NotifyAddFriend(context, &event.add_friend(), &rsp);
+			break;
+		}
+		case PeerEvent::kAuthFriend: {
+			AuthFriendRsp rsp;
+			NotifyAuthFriend(context, &event.auth_friend(), &rsp);
+			break;
+		}
+		case PeerEvent::kTextMsg: {
+			TextChatMsgRsp rsp;
+			NotifyTextChatMsg(context, &event.text_msg(), &rsp);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	ack->set_acked_seq(acked_seq);
+	return true;
+}
+
+bool ChatServiceImpl::EnterDelivery()
+{
+	std::lock_guard<std::mutex> lock(_delivery_mutex);
+	if (_b_delivery_paused) {
+		return false;
+	}
+	++_delivering;
+	return true;
+}
+
+void ChatServiceImpl::LeaveDelivery()
+{
+	std::lock_guard<std::mutex> lock(_delivery_mutex);
+	if (--_delivering == 0) {
+		_delivery_cond.notify_all();
+	}
+}
+
+void ChatServiceImpl::PauseDelivery()
+{
+	std::unique_lock<std::mutex> lock(_delivery_mutex);
+	_b_delivery_paused = true;
+	_delivery_cond.wait(lock, [this]() {
+		return _delivering == 0;
+	});
+}
+
+void ChatServiceImpl::ResumeDelivery()
+{
+	std::lock_guard<std::mutex> lock(_delivery_mutex);
+	_b_delivery_paused = false;
+}
+
+bool ChatServiceImpl::AcceptSeq(const std::string& from_server, uint64_t epoch, uint64_t seq)
+{
+	std::lock_guard<std::mutex> lock(_seq_mutex);
+	auto& peer_seq = _peer_seqs[from_server];
+	// 对端重启后epoch变化，seq从头开始
+	if (peer_seq.first != epoch) {
+		peer_seq.first = epoch;
+		peer_seq.second = 0;
+	}
+	if (seq <= peer_seq.second) {
+		return false;
+	}
+	peer_seq.second = seq;
+	return true;
 }
 
 Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendReq* request, AddFriendRsp* reply)
 {
-	//ûǷڱ
+	ExecTimer timer(_add_friend_metric);
+	TraceScope trace_scope(ExtractTrace(context));
+	TraceSpan trace_span("grpc.server", "NotifyAddFriend");
+	//查找用户是否在本服务器
 	auto touid = request->touid();
 	auto session = UserMgr::GetInstance()->GetSession(touid);
 
@@ -24,12 +259,12 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
 		reply->set_touid(request->touid());
 		});
 
-	//ûڴֱӷ
+	//用户不在内存中则直接返回
 	if (session == nullptr) {
 		return Status::OK;
 	}
 	
-	//ڴֱӷ֪ͨԷ
+	//在内存中则直接发送通知对方
 	Json::Value  rtvalue;
 	rtvalue["error"] = ErrorCodes::Success;
 	rtvalue["applyuid"] = request->applyuid();
@@ -47,7 +282,10 @@ Status ChatServiceImpl::NotifyAddFriend(ServerContext* context, const AddFriendR
 
 Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context, const AuthFriendReq* request,
 	AuthFriendRsp* reply) {
-	//ûǷڱ
+	ExecTimer timer(_auth_friend_metric);
+	TraceScope trace_scope(ExtractTrace(context));
+	TraceSpan trace_span("grpc.server", "NotifyAuthFriend");
+	//查找用户是否在本服务器
 	auto touid = request->touid();
 	auto fromuid = request->fromuid();
 	auto session = UserMgr::GetInstance()->GetSession(touid);
@@ -58,12 +296,12 @@ Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context, const AuthFrien
 		reply->set_touid(request->touid());
 		});
 
-	//ûڴֱӷ
+	//用户不在内存中则直接返回
 	if (session == nullptr) {
 		return Status::OK;
 	}
 
-	//ڴֱӷ֪ͨԷ
+	//在内存中则直接发送通知对方
 	Json::Value  rtvalue;
 	rtvalue["error"] = ErrorCodes::Success;
 	rtvalue["fromuid"] = request->fromuid();
@@ -89,45 +327,48 @@ Status ChatServiceImpl::NotifyAuthFriend(ServerContext* context, const AuthFrien
 }
 
 Status ChatServiceImpl::NotifyTextChatMsg(::grpc::ServerContext* context, const TextChatMsgReq* request, TextChatMsgRsp* reply) {
-    // ûǷڱ
-    auto touid = request->touid(); // ȡUID
-    auto session = UserMgr::GetInstance()->GetSession(touid); // һỰ
+    ExecTimer timer(_text_chat_metric);
+    TraceScope trace_scope(ExtractTrace(context));
+    TraceSpan trace_span("grpc.server", "NotifyTextChatMsg");
+    // 查找用户是否在本服务器
+    auto touid = request->touid(); // 获取接收者UID
+    auto session = UserMgr::GetInstance()->GetSession(touid); // 查找会话
 
-    // ûظϢĴΪɹ
+    // 设置回复消息的错误码为成功
     reply->set_error(ErrorCodes::Success);
 
-    // ûڴֱӷ
+    // 用户不在内存中则直接返回
     if (session == nullptr) {
-        return Status::OK; // ߵĻỰڣֱӷ
+        return Status::OK; // 如果接收者的会话不存在，直接返回
     }
 
-    // ڴֱӷ֪ͨԷ
-    Json::Value rtvalue; // JSON洢Ӧ
-    rtvalue["error"] = ErrorCodes::Success; // ôΪɹ
-    rtvalue["fromuid"] = request->fromuid(); // ÷UID
-    rtvalue["touid"] = request->touid(); // ýUID
-
-    // ֯Ϊ
-    Json::Value text_array; // һJSON洢ıϢ
-    for (auto& msg : request->textmsgs()) { // еÿϢ
-        Json::Value element; // JSONʾϢ
-        element["content"] = msg.msgcontent(); // Ϣ
-        element["msgid"] = msg.msgid(); // ϢID
-        text_array.append(element); // Ϣӵ
+    // 在内存中则直接发送通知给对方
+    Json::Value rtvalue; // 创建JSON对象来存储响应数据
+    rtvalue["error"] = ErrorCodes::Success; // 设置错误码为成功
+    rtvalue["fromuid"] = request->fromuid(); // 设置发送者UID
+    rtvalue["touid"] = request->touid(); // 设置接收者UID
+
+    // 将聊天数据组织为数组
+    Json::Value text_array; // 创建一个JSON数组来存储文本消息
+    for (auto& msg : request->textmsgs()) { // 遍历请求中的每条消息
+        Json::Value element; // 创建JSON对象来表示单条消息
+        element["content"] = msg.msgcontent(); // 设置消息内容
+        element["msgid"] = msg.msgid(); // 设置消息ID
+        text_array.append(element); // 将单条消息添加到数组中
     }
-    rtvalue["text_array"] = text_array; // ıϢӵӦ
+    rtvalue["text_array"] = text_array; // 将文本消息数组添加到响应对象中
 
-    std::string return_str = rtvalue.toStyledString(); // JSONתΪַ
+    std::string return_str = rtvalue.toStyledString(); // 将JSON对象转换为字符串
 
-    session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ); // ֪ͨ
-    return Status::OK; // سɹ״̬
+    session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ); // 发送通知给接收者
+    return Status::OK; // 返回成功状态
 }
 
 
 
 bool ChatServiceImpl::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
 {
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -146,8 +387,8 @@ bool ChatServiceImpl::GetBaseInfo(std::string base_key, int uid, std::shared_ptr
 			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
 	}
 	else {
-		//redisûѯmysql
-		//ѯݿ
+		//redis中没有则查询mysql
+		//查询数据库
 		std::shared_ptr<UserInfo> user_info = nullptr;
 		user_info = MysqlMgr::GetInstance()->GetUser(uid);
 		if (user_info == nullptr) {
@@ -156,7 +397,7 @@ bool ChatServiceImpl::GetBaseInfo(std::string base_key, int uid, std::shared_ptr
 
 		userinfo = user_info;
 
-		//ݿдredis
+		//将数据库内容写入redis缓存
 		Json::Value redis_root;
 		redis_root["uid"] = uid;
 		redis_root["pwd"] = userinfo->pwd;
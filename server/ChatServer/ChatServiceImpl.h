@@ -2,8 +2,12 @@
 #include <grpcpp/grpcpp.h> // 引入gRPC库
 #include "message.grpc.pb.h" // 引入gRPC生成的消息头文件
 #include "message.pb.h" // 引入Protocol Buffers生成的消息头文件
+#include <map> // 引入map保存每个对端已处理的seq
 #include <mutex> // 引入互斥锁库以实现线程安全
+#include <condition_variable> // 引入条件变量等待在途的投递结束
 #include "data.h" // 引入自定义的数据结构和定义
+#include "MetricsMgr.h" // 引入RPC延迟统计
+#include "AsyncRpcServer.h" // 引入异步gRPC服务
 
 // 使用gRPC相关命名空间
 using grpc::Server;
@@ -22,28 +26,67 @@ using message::ChatService; // 引入聊天服务接口
 using message::TextChatMsgReq; // 引入文本聊天消息请求
 using message::TextChatMsgRsp; // 引入文本聊天消息响应
 using message::TextChatData; // 引入文本聊天数据结构
+using message::PeerEvent; // 引入对端流上的事件
+using message::PeerBatch; // 引入对端流上的一批事件
+using message::PeerAck; // 引入对端流的累计确认
 
-// 聊天服务实现类，继承自gRPC生成的ChatService服务接口
-class ChatServiceImpl final: public ChatService::Service
+// 聊天服务实现类，请求由AsyncRpcServer的完成队列接收，处理函数在它的工作线程上执行
+class ChatServiceImpl final
 {
 public:
     ChatServiceImpl(); // 构造函数
 
+    // 注册到AsyncRpcServer的服务，Start时传入
+    ChatService::AsyncService* GetService() { return &_service; }
+
+    // 服务启动后在每个完成队列上登记各个方法的调用，开始接收请求
+    void Serve(AsyncRpcServer& server);
+
     // 处理添加好友请求的方法
     Status NotifyAddFriend(ServerContext* context, const AddFriendReq* request,
-                           AddFriendRsp* reply) override;
+                           AddFriendRsp* reply);
 
     // 处理好友认证请求的方法
     Status NotifyAuthFriend(ServerContext* context, 
-                            const AuthFriendReq* request, AuthFriendRsp* response) override;
+                            const AuthFriendReq* request, AuthFriendRsp* response);
 
     // 处理文本聊天消息请求的方法
     Status NotifyTextChatMsg(::grpc::ServerContext* context, 
-                             const TextChatMsgReq* request, TextChatMsgRsp* response) override;
+                             const TextChatMsgReq* request, TextChatMsgRsp* response);
+
+    // 处理对端ChatServer长连接流上的一批通知事件，填写累计确认；暂停投递时整批不处理，返回false
+    bool DeliverBatch(ServerContext* context, const PeerBatch& batch, PeerAck* ack);
+
+    // 平滑升级导出会话前调用：之后到达的对端通知全部拒绝，等正在处理的通知发进会话的发送队列后返回
+    void PauseDelivery();
+
+    // 交接失败时恢复处理对端通知
+    void ResumeDelivery();
 
     // 从数据库或其他存储中获取用户基本信息的方法
     bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
 
 private:
-    // 可以添加私有成员变量和辅助方法
+    ChatService::AsyncService _service;
+
+    // 每个RPC的延迟统计，等待时间是请求到达到工作线程开始处理
+    LatencyMetric* _add_friend_metric;
+    LatencyMetric* _auth_friend_metric;
+    LatencyMetric* _text_chat_metric;
+
+    friend class DeliveryScope;
+    // 开始处理一个对端通知，暂停投递时返回false；返回true时处理完调用LeaveDelivery
+    bool EnterDelivery();
+    void LeaveDelivery();
+    std::mutex _delivery_mutex;
+    std::condition_variable _delivery_cond;
+    bool _b_delivery_paused;
+    // 正在处理的对端通知数
+    int _delivering;
+
+    // 检查并记录对端事件的seq，重发的事件返回false
+    bool AcceptSeq(const std::string& from_server, uint64_t epoch, uint64_t seq);
+    std::mutex _seq_mutex;
+    // 每个对端服务的(epoch, 已处理的最大seq)
+    std::map<std::string, std::pair<uint64_t, uint64_t>> _peer_seqs;
 };
@@ -0,0 +1,11 @@
+#pragma once
+
+// CompressBench：按帧压缩的压缩率和CPU开销测试
+// 在控制台输入 compressbench [级别]，配置了抽样并且样本足够时用抽样到的真实帧，否则按协议格式生成登录回包、
+// 聊天消息、搜索回包等样本。一半样本训练字典，另一半按帧大小分档，分别打印不用字典和用字典时的
+// 压缩率、每帧压缩和解压耗时
+class CompressBench
+{
+public:
+	static void Run(int level);
+};
@@ -0,0 +1,222 @@
+#include "CompressMgr.h"
+#include "ConfigMgr.h"
+#include "const.h"
+#include <zdict.h>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <memory>
+#include <iostream>
+
+// 压缩上下文不是线程安全的，每个线程各用一个，字典可以多线程共享
+static ZSTD_CCtx* GetCCtx() {
+	static thread_local std::unique_ptr<ZSTD_CCtx, size_t(*)(ZSTD_CCtx*)> cctx(ZSTD_createCCtx(), ZSTD_freeCCtx);
+	return cctx.get();
+}
+
+static ZSTD_DCtx* GetDCtx() {
+	static thread_local std::unique_ptr<ZSTD_DCtx, size_t(*)(ZSTD_DCtx*)> dctx(ZSTD_createDCtx(), ZSTD_freeDCtx);
+	return dctx.get();
+}
+
+CompressMgr::CompressMgr() :_b_enable(false), _level(COMPRESS_DEFAULT_LEVEL), _min_len(COMPRESS_MIN_LEN),
+	_dict_size(COMPRESS_DICT_SIZE), _sample_max(0), _cdict(nullptr), _ddict(nullptr), _dict_id(0), _sample_seen(0) {
+	auto& cfg = ConfigMgr::Inst();
+	auto enable = cfg["Compress"]["Enable"];
+	auto level = cfg["Compress"]["Level"];
+	auto min_len = cfg["Compress"]["MinLen"];
+	auto dict_size = cfg["Compress"]["DictSize"];
+	auto sample_count = cfg["Compress"]["SampleCount"];
+	_b_enable = !enable.empty() && std::stoi(enable) != 0;
+	_dict_path = cfg["Compress"]["Dict"];
+	if (!level.empty()) {
+		_level = std::stoi(level);
+	}
+	if (!min_len.empty()) {
+		_min_len = std::stoul(min_len);
+	}
+	if (!dict_size.empty()) {
+		_dict_size = std::stoul(dict_size);
+	}
+	if (!sample_count.empty()) {
+		_sample_max = std::stoul(sample_count);
+	}
+
+	if (!_b_enable || _dict_path.empty()) {
+		return;
+	}
+
+	//字典文件不存在时不使用字典，等traindict生成后重启加载
+	std::ifstream ifs(_dict_path, std::ios::binary);
+	if (!ifs) {
+		return;
+	}
+	std::stringstream ss;
+	ss << ifs.rdbuf();
+	if (LoadDict(ss.str())) {
+		std::cout << "compress dict loaded, id is " << _dict_id << ", size is " << ss.str().size() << std::endl;
+	}
+}
+
+CompressMgr::~CompressMgr() {
+	ZSTD_freeCDict(_cdict);
+	ZSTD_freeDDict(_ddict);
+}
+
+bool CompressMgr::IsEnabled() {
+	return _b_enable;
+}
+
+int CompressMgr::GetLevel() {
+	return _level;
+}
+
+unsigned int CompressMgr::GetDictId() {
+	return _dict_id;
+}
+
+bool CompressMgr::LoadDict(const std::string& dict) {
+	_cdict = ZSTD_createCDict(dict.data(), dict.size(), _level);
+	_ddict = ZSTD_createDDict(dict.data(), dict.size());
+	if (_cdict == nullptr || _ddict == nullptr) {
+		std::cout << "create compress dict failed" << std::endl;
+		ZSTD_freeCDict(_cdict);
+		ZSTD_freeDDict(_ddict);
+		_cdict = nullptr;
+		_ddict = nullptr;
+		return false;
+	}
+
+	_dict_id = ZSTD_getDictID_fromDict(dict.data(), dict.size());
+	return true;
+}
+
+bool CompressMgr::Compress(const char* data, std::size_t len, bool b_dict, std::string& out) {
+	if (!_b_enable || len < _min_len) {
+		return false;
+	}
+
+	out.resize(ZSTD_compressBound(len));
+	std::size_t ret = 0;
+	if (b_dict && _cdict != nullptr) {
+		ret = ZSTD_compress_usingCDict(GetCCtx(), &out[0], out.size(), data, len, _cdict);
+	}
+	else {
+		ret = ZSTD_compressCCtx(GetCCtx(), &out[0], out.size(), data, len, _level);
+	}
+
+	if (ZSTD_isError(ret) || ret >= len) {
+		return false;
+	}
+
+	out.resize(ret);
+	return true;
+}
+
+bool CompressMgr::Decompress(const char* data, std::size_t len, std::size_t max_len, std::string& out) {
+	//压缩帧头里带原始长度，先检查长度，防止解压炸弹
+	auto content_size = ZSTD_getFrameContentSize(data, len);
+	if (content_size == ZSTD_CONTENTSIZE_ERROR || content_size == ZSTD_CONTENTSIZE_UNKNOWN
+		|| content_size > max_len) {
+		return false;
+	}
+
+	auto dict_id = ZSTD_getDictID_fromFrame(data, len);
+	if (dict_id != 0 && (dict_id != _dict_id || _ddict == nullptr)) {
+		return false;
+	}
+
+	out.resize(content_size);
+	std::size_t ret = 0;
+	if (dict_id != 0) {
+		ret = ZSTD_decompress_usingDDict(GetDCtx(), &out[0], out.size(), data, len, _ddict);
+	}
+	else {
+		ret = ZSTD_decompressDCtx(GetDCtx(), &out[0], out.size(), data, len);
+	}
+
+	if (ZSTD_isError(ret) || ret != content_size) {
+		return false;
+	}
+	return true;
+}
+
+void CompressMgr::AddSample(const char* data, std::size_t len) {
+	if (_sample_max == 0 || len < _min_len) {
+		return;
+	}
+
+	//蓄水池抽样，样本数固定，每一帧被选中的概率相同
+	std::lock_guard<std::mutex> lock(_sample_mutex);
+	++_sample_seen;
+	if (_samples.size() < _sample_max) {
+		_samples.emplace_back(data, len);
+		return;
+	}
+
+	static thread_local std::mt19937_64 rng(std::random_device{}());
+	auto index = std::uniform_int_distribution<std::size_t>(0, _sample_seen - 1)(rng);
+	if (index < _sample_max) {
+		_samples[index].assign(data, len);
+	}
+}
+
+std::vector<std::string> CompressMgr::GetSamples() {
+	std::lock_guard<std::mutex> lock(_sample_mutex);
+	return _samples;
+}
+
+bool CompressMgr::TrainDict() {
+	if (_dict_path.empty()) {
+		std::cout << "compress dict path is empty" << std::endl;
+		return false;
+	}
+
+	std::vector<std::string> samples;
+	{
+		std::lock_guard<std::mutex> lock(_sample_mutex);
+		samples = _samples;
+	}
+
+	std::string dict;
+	if (!TrainDict(samples, _dict_size, dict)) {
+		std::cout << "train compress dict failed, samples count is " << samples.size() << std::endl;
+		return false;
+	}
+
+	std::ofstream ofs(_dict_path, std::ios::binary | std::ios::trunc);
+	if (!ofs.write(dict.data(), dict.size())) {
+		std::cout << "write compress dict to " << _dict_path << " failed" << std::endl;
+		return false;
+	}
+
+	std::cout << "compress dict saved to " << _dict_path << ", id is "
+		<< ZSTD_getDictID_fromDict(dict.data(), dict.size()) << ", samples count is " << samples.size()
+		<< ", restart server and client to use it" << std::endl;
+	return true;
+}
+
+bool CompressMgr::TrainDict(const std::vector<std::string>& samples, std::size_t dict_size, std::string& dict) {
+	if (samples.empty()) {
+		return false;
+	}
+
+	//ZDICT要求样本连续存放，另外传入每个样本的长度
+	std::string buffer;
+	std::vector<size_t> sizes;
+	sizes.reserve(samples.size());
+	for (auto& sample : samples) {
+		buffer.append(sample);
+		sizes.push_back(sample.size());
+	}
+
+	dict.resize(dict_size);
+	auto ret = ZDICT_trainFromBuffer(&dict[0], dict.size(), buffer.data(), sizes.data(), (unsigned)sizes.size());
+	if (ZDICT_isError(ret)) {
+		std::cout << "train dict error: " << ZDICT_getErrorName(ret) << std::endl;
+		return false;
+	}
+
+	dict.resize(ret);
+	return true;
+}
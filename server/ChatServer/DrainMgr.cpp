@@ -0,0 +1,118 @@
+#include "DrainMgr.h"
+#include "ConfigMgr.h"
+#include "RedisMgr.h"
+#include "UserMgr.h"
+#include "CSession.h"
+#include "StatusGrpcClient.h"
+#include "MembershipMgr.h"
+#include "const.h"
+#include <json/json.h>
+#include <algorithm>
+#include <random>
+#include <chrono>
+
+DrainMgr::DrainMgr() :_b_draining(false), _b_stop(false) {
+	auto& cfg = ConfigMgr::Inst();
+	auto wave_size = cfg["Drain"]["WaveSize"];
+	auto wave_interval = cfg["Drain"]["WaveInterval"];
+	auto jitter = cfg["Drain"]["Jitter"];
+	//没有配置时默认每秒迁移100个用户，客户端在3秒内随机重连
+	_wave_size = wave_size.empty() ? 100 : std::stoi(wave_size);
+	_wave_interval = wave_interval.empty() ? 1000 : std::stoi(wave_interval);
+	_jitter = jitter.empty() ? 3000 : std::stoi(jitter);
+	if (_wave_size <= 0) {
+		_wave_size = 1;
+	}
+}
+
+DrainMgr::~DrainMgr() {
+	Stop();
+}
+
+void DrainMgr::Drain() {
+	if (_b_draining.exchange(true)) {
+		return;
+	}
+
+	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
+	//先通知StatusServer不再分配用户到本服务器，再开始迁移
+	RedisMgr::GetInstance()->HSet(DRAIN_SERVERS, server_name, "1");
+	std::cout << "server " << server_name << " start draining" << std::endl;
+	_thread = std::thread(&DrainMgr::Run, this);
+}
+
+bool DrainMgr::IsDraining() {
+	return _b_draining;
+}
+
+void DrainMgr::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+	}
+	_cond.notify_all();
+
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+void DrainMgr::Run() {
+	//打乱顺序，避免同一批用户集中落到同一台服务器
+	auto uids = UserMgr::GetInstance()->GetUids();
+	std::mt19937 rng(std::random_device{}());
+	std::shuffle(uids.begin(), uids.end(), rng);
+
+	std::size_t migrated = 0;
+	for (std::size_t i = 0; i < uids.size(); i += _wave_size) {
+		auto end = std::min(uids.size(), i + _wave_size);
+		for (auto j = i; j < end; ++j) {
+			if (MigrateUser(uids[j])) {
+				++migrated;
+			}
+		}
+
+		std::cout << "drain wave finished, migrated " << migrated << "/" << uids.size() << std::endl;
+		std::unique_lock<std::mutex> lock(_mutex);
+		if (_cond.wait_for(lock, std::chrono::milliseconds(_wave_interval), [this]() { return _b_stop.load(); })) {
+			return;
+		}
+	}
+
+	std::cout << "drain finished, migrated " << migrated << " users" << std::endl;
+}
+
+bool DrainMgr::MigrateUser(int uid) {
+	auto session = UserMgr::GetInstance()->GetSession(uid);
+	if (session == nullptr) {
+		return false;
+	}
+
+	//StatusServer会跳过正在排空的服务器，并为用户生成新的token
+	auto rsp = StatusGrpcClient::GetInstance()->GetChatServer(uid);
+	if (rsp.error() != ErrorCodes::Success) {
+		std::cout << "get chat server for uid " << uid << " failed, error is " << rsp.error() << std::endl;
+		return false;
+	}
+
+	//所有服务器都在排空时StatusServer只能返回本服务器，不需要迁移；
+	//不同机器上的服务器通常用同一个端口，要和注册时的host一起比较
+	auto& self = MembershipMgr::GetInstance()->Self();
+	if (rsp.host() == self.host() && rsp.port() == self.port()) {
+		return false;
+	}
+
+	//每个客户端在抖动范围内随机延迟重连，把同一批的重连请求打散
+	static std::mt19937 rng(std::random_device{}());
+	std::uniform_int_distribution<int> delay_dist(0, std::max(_jitter, 0));
+
+	Json::Value notify;
+	notify["error"] = ErrorCodes::Success;
+	notify["uid"] = uid;
+	notify["host"] = rsp.host();
+	notify["port"] = rsp.port();
+	notify["token"] = rsp.token();
+	notify["delay"] = delay_dist(rng);
+	session->Send(notify.toStyledString(), ID_NOTIFY_MIGRATE_REQ);
+	return true;
+}
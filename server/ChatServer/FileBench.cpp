@@ -0,0 +1,136 @@
+#include "FileBench.h"
+#include "RedisMgr.h"
+#include "BlobStore.h"
+#include "const.h"
+#include <boost/asio.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/filesystem.hpp>
+#include <json/json.h>
+#include <iostream>
+#include <chrono>
+#include <vector>
+
+using tcp = boost::asio::ip::tcp;
+
+//测试使用的uid，不对应真实用户
+#define BENCH_UID 0
+
+static void WriteFrame(tcp::socket& sock, short msg_id, const Json::Value& root) {
+	std::string body = root.toStyledString();
+	short id = boost::asio::detail::socket_ops::host_to_network_short(msg_id);
+	short len = boost::asio::detail::socket_ops::host_to_network_short((short)body.size());
+	char head[HEAD_TOTAL_LEN];
+	memcpy(head, &id, HEAD_ID_LEN);
+	memcpy(head + HEAD_ID_LEN, &len, HEAD_DATA_LEN);
+	std::vector<boost::asio::const_buffer> bufs{ boost::asio::buffer(head), boost::asio::buffer(body) };
+	boost::asio::write(sock, bufs);
+}
+
+static Json::Value ReadFrame(tcp::socket& sock, short& msg_id) {
+	char head[HEAD_TOTAL_LEN];
+	boost::asio::read(sock, boost::asio::buffer(head));
+	short len = 0;
+	memcpy(&msg_id, head, HEAD_ID_LEN);
+	memcpy(&len, head + HEAD_ID_LEN, HEAD_DATA_LEN);
+	msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+	len = boost::asio::detail::socket_ops::network_to_host_short(len);
+	std::string body(len, '\0');
+	boost::asio::read(sock, boost::asio::buffer(&body[0], len));
+	Json::Reader reader;
+	Json::Value root;
+	reader.parse(body, root);
+	return root;
+}
+
+void FileBench::Run(short port, const std::string& path, long long total_mb, long long chunk_kb) {
+	long long total = total_mb * 1024 * 1024;
+	long long chunk_len = chunk_kb * 1024;
+	if (total <= 0 || total > MAX_FILE_SIZE || chunk_len <= 0 || chunk_len > FILE_CHUNK_MAX_LEN) {
+		std::cout << "filebench: size must be in (0, " << MAX_FILE_SIZE / 1024 / 1024
+			<< "] MB and chunk in (0, " << FILE_CHUNK_MAX_LEN / 1024 << "] KB" << std::endl;
+		return;
+	}
+
+	auto token = boost::uuids::to_string(boost::uuids::random_generator()());
+	auto file_id = "bench_" + boost::uuids::to_string(boost::uuids::random_generator()());
+	std::string token_key = USERTOKENPREFIX + std::to_string(BENCH_UID);
+	RedisMgr::GetInstance()->Set(token_key, token);
+	Defer defer([&token_key, &path, &file_id]() {
+		RedisMgr::GetInstance()->Del(token_key);
+		boost::system::error_code ec;
+		//释放引用后测试文件由blob存储的后台回收删除
+		BlobStore::GetInstance()->Release(file_id);
+		boost::filesystem::remove(boost::filesystem::path(path) / (file_id + ".part"), ec);
+		});
+
+	try {
+		boost::asio::io_context io_context;
+		tcp::socket sock(io_context);
+		sock.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+		std::vector<char> data(chunk_len, 'x');
+
+		short msg_id = 0;
+		Json::Value req;
+		req["uid"] = BENCH_UID;
+		req["token"] = token;
+		req["file_id"] = file_id;
+		req["size"] = (Json::Int64)total;
+		auto start = std::chrono::steady_clock::now();
+		WriteFrame(sock, ID_FILE_UPLOAD_REQ, req);
+		auto rsp = ReadFrame(sock, msg_id);
+		if (rsp["error"].asInt() != ErrorCodes::Success) {
+			std::cout << "filebench: upload req failed, error is " << rsp["error"].asInt() << std::endl;
+			return;
+		}
+
+		//块和回包流水线进行，数据发完后再统一读回包
+		long long offset = rsp["offset"].asInt64();
+		int chunk_count = 0;
+		while (offset < total) {
+			long long len = std::min(chunk_len, total - offset);
+			Json::Value chunk;
+			chunk["offset"] = (Json::Int64)offset;
+			chunk["len"] = (Json::Int64)len;
+			WriteFrame(sock, ID_FILE_CHUNK_REQ, chunk);
+			boost::asio::write(sock, boost::asio::buffer(data.data(), (std::size_t)len));
+			offset += len;
+			++chunk_count;
+		}
+
+		for (int i = 0; i < chunk_count; ++i) {
+			rsp = ReadFrame(sock, msg_id);
+			if (rsp["error"].asInt() != ErrorCodes::Success) {
+				std::cout << "filebench: chunk failed, error is " << rsp["error"].asInt() << std::endl;
+				return;
+			}
+		}
+		auto upload_end = std::chrono::steady_clock::now();
+
+		req.removeMember("size");
+		req["offset"] = 0;
+		WriteFrame(sock, ID_FILE_DOWNLOAD_REQ, req);
+		rsp = ReadFrame(sock, msg_id);
+		if (rsp["error"].asInt() != ErrorCodes::Success) {
+			std::cout << "filebench: download req failed, error is " << rsp["error"].asInt() << std::endl;
+			return;
+		}
+
+		long long left = rsp["size"].asInt64();
+		data.resize(FILE_IO_BUF_LEN);
+		while (left > 0) {
+			auto n = sock.read_some(boost::asio::buffer(data.data(), (std::size_t)std::min<long long>(left, data.size())));
+			left -= n;
+		}
+		auto download_end = std::chrono::steady_clock::now();
+
+		auto upload_sec = std::chrono::duration<double>(upload_end - start).count();
+		auto download_sec = std::chrono::duration<double>(download_end - upload_end).count();
+		std::cout << "filebench: " << total_mb << " MB, chunk " << chunk_kb << " KB" << std::endl;
+		std::cout << "  upload   " << upload_sec * 1000 << " ms, " << total_mb / upload_sec << " MB/s" << std::endl;
+		std::cout << "  download " << download_sec * 1000 << " ms, " << total_mb / download_sec << " MB/s" << std::endl;
+	}
+	catch (std::exception& e) {
+		std::cout << "filebench: exception " << e.what() << std::endl;
+	}
+}
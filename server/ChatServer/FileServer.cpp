@@ -0,0 +1,130 @@
+#include "FileServer.h"
+#include <iostream>
+#include <boost/filesystem.hpp>
+
+FileServer::FileServer(short port, const std::string& path, std::size_t thread_num)
+	: _port(port), _path(path), _next_io(0), _b_stop(false)
+{
+	if (thread_num == 0) {
+		thread_num = 1;
+	}
+
+	boost::system::error_code ec;
+	boost::filesystem::create_directories(_path, ec);
+	if (ec) {
+		std::cout << "create file storage dir " << _path << " failed, error is " << ec.message() << std::endl;
+	}
+
+	for (std::size_t i = 0; i < thread_num; ++i) {
+		_io_contexts.push_back(std::make_unique<boost::asio::io_context>());
+		_works.push_back(std::make_unique<boost::asio::io_context::work>(*_io_contexts.back()));
+	}
+
+	tcp::endpoint endpoint(tcp::v4(), port);
+	_acceptor = std::make_unique<tcp::acceptor>(*_io_contexts[0]);
+	_acceptor->open(endpoint.protocol());
+	_acceptor->set_option(tcp::acceptor::reuse_address(true));
+#ifdef SO_REUSEPORT
+	//平滑升级时新进程在旧进程退出前就要监听同一个端口，旧进程上未完成的传输由客户端断点续传
+	_acceptor->set_option(boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true));
+#endif
+	_acceptor->bind(endpoint);
+	_acceptor->listen();
+	std::cout << "File server start success, listen on port : " << _port << std::endl;
+	StartAccept();
+
+	for (auto& io_context : _io_contexts) {
+		auto io = io_context.get();
+		_threads.emplace_back([io]() {
+			io->run();
+			});
+	}
+}
+
+FileServer::~FileServer() {
+	Stop();
+}
+
+void FileServer::Stop() {
+	if (_b_stop) {
+		return;
+	}
+	_b_stop = true;
+
+	boost::system::error_code ec;
+	_acceptor->close(ec);
+	for (auto& work : _works) {
+		work.reset();
+	}
+	for (auto& io_context : _io_contexts) {
+		io_context->stop();
+	}
+	for (auto& t : _threads) {
+		t.join();
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sessions.clear();
+}
+
+boost::asio::io_context& FileServer::GetIOService() {
+	auto& io_context = *_io_contexts[_next_io++];
+	if (_next_io == _io_contexts.size()) {
+		_next_io = 0;
+	}
+	return io_context;
+}
+
+void FileServer::StartAccept() {
+	auto session = std::make_shared<FileSession>(GetIOService(), this);
+	_acceptor->async_accept(session->GetSocket(),
+		std::bind(&FileServer::HandleAccept, this, session, std::placeholders::_1));
+}
+
+void FileServer::HandleAccept(std::shared_ptr<FileSession> session, const boost::system::error_code& error) {
+	if (error) {
+		//Stop关闭了监听socket
+		if (error == boost::asio::error::operation_aborted) {
+			return;
+		}
+		std::cout << "file session accept failed, error is " << error.message() << std::endl;
+	}
+	else {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_sessions.insert(std::make_pair(session->GetSessionId(), session));
+		}
+		//会话在自己的io线程上启动
+		boost::asio::post(session->GetSocket().get_executor(), [session]() {
+			session->Start();
+			});
+	}
+
+	StartAccept();
+}
+
+void FileServer::ClearSession(const std::string& session_id) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_sessions.erase(session_id);
+}
+
+std::string FileServer::GetFilePath(const std::string& file_id) {
+	return (boost::filesystem::path(_path) / file_id).string();
+}
+
+std::string FileServer::GetPartPath(const std::string& file_id) {
+	return GetFilePath(file_id) + ".part";
+}
+
+bool FileServer::IsValidFileId(const std::string& file_id) {
+	if (file_id.empty() || file_id.size() > MAX_FILE_ID_LEN) {
+		return false;
+	}
+
+	for (char c : file_id) {
+		if (!isalnum((unsigned char)c) && c != '-' && c != '_' && c != '{' && c != '}') {
+			return false;
+		}
+	}
+	return true;
+}
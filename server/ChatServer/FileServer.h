@@ -0,0 +1,44 @@
+#pragma once
+#include <boost/asio.hpp>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <thread>
+#include <string>
+#include "FileSession.h"
+
+using tcp = boost::asio::ip::tcp;
+
+// FileServer：文件传输服务，监听 [FileServer] Port，文件保存在 [FileServer] Path 目录下
+// 使用自己的io_context和线程，大文件传输不会占用聊天连接的io线程和逻辑队列
+// 每个io_context只由一个线程驱动，同一个会话上的回调不会并发执行
+// 多台ChatServer之间互相下载需要共享存储目录(例如挂载同一个网络盘)
+class FileServer
+{
+public:
+	FileServer(short port, const std::string& path, std::size_t thread_num);
+	~FileServer();
+	void Stop();
+	void ClearSession(const std::string& session_id);
+	// 文件上传完成前以.part结尾保存，完成后改名
+	std::string GetFilePath(const std::string& file_id);
+	std::string GetPartPath(const std::string& file_id);
+	// 文件id由客户端生成，只允许字母数字和 -_{}，防止路径穿越
+	static bool IsValidFileId(const std::string& file_id);
+private:
+	void StartAccept();
+	void HandleAccept(std::shared_ptr<FileSession> session, const boost::system::error_code& error);
+	boost::asio::io_context& GetIOService();
+
+	short _port;
+	std::string _path;
+	std::vector<std::unique_ptr<boost::asio::io_context>> _io_contexts;
+	std::vector<std::unique_ptr<boost::asio::io_context::work>> _works;
+	std::vector<std::thread> _threads;
+	std::size_t _next_io;
+	std::unique_ptr<tcp::acceptor> _acceptor;
+	std::map<std::string, std::shared_ptr<FileSession>> _sessions;
+	std::mutex _mutex;
+	bool _b_stop;
+};
@@ -0,0 +1,560 @@
+#include "FileSession.h"
+#include "FileServer.h"
+#include "RedisMgr.h"
+#include "BlobStore.h"
+#include <iostream>
+#include <algorithm>
+#include <boost/filesystem.hpp>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/sendfile.h>
+#endif
+
+FileSession::FileSession(boost::asio::io_context& io_context, FileServer* server)
+	: _socket(io_context), _server(server), _b_close(false), _b_close_after_send(false), _uid(0),
+	_file_size(0), _file_offset(0), _chunk_left(0), _b_send_file(false) {
+	boost::uuids::uuid a_uuid = boost::uuids::random_generator()();
+	_session_id = boost::uuids::to_string(a_uuid);
+#ifdef __linux__
+	_file_fd = -1;
+	_pipe_fds[0] = -1;
+	_pipe_fds[1] = -1;
+	_pipe_bytes = 0;
+#else
+	_file_buf.resize(FILE_IO_BUF_LEN);
+#endif
+}
+
+FileSession::~FileSession() {
+	CloseFile();
+#ifdef __linux__
+	for (auto& fd : _pipe_fds) {
+		if (fd >= 0) {
+			close(fd);
+			fd = -1;
+		}
+	}
+#endif
+}
+
+tcp::socket& FileSession::GetSocket() {
+	return _socket;
+}
+
+std::string& FileSession::GetSessionId() {
+	return _session_id;
+}
+
+void FileSession::Start() {
+#ifdef __linux__
+	//splice必须经过管道，每个会话一个非阻塞管道
+	if (pipe2(_pipe_fds, O_NONBLOCK | O_CLOEXEC) < 0) {
+		Fail("create pipe failed");
+		return;
+	}
+	//splice直接操作socket句柄，socket要设成非阻塞，没有数据时交给asio等待可读
+	_socket.non_blocking(true);
+#endif
+	AsyncReadHead();
+}
+
+void FileSession::Close() {
+	if (_b_close) {
+		return;
+	}
+	_b_close = true;
+	boost::system::error_code ec;
+	_socket.close(ec);
+	CloseFile();
+	_server->ClearSession(_session_id);
+}
+
+void FileSession::Fail(const std::string& reason) {
+	std::cout << "file session " << _session_id << " " << reason << std::endl;
+	Close();
+}
+
+void FileSession::CloseFile() {
+#ifdef __linux__
+	if (_file_fd >= 0) {
+		close(_file_fd);
+		_file_fd = -1;
+	}
+	_pipe_bytes = 0;
+#else
+	if (_file.is_open()) {
+		_file.close();
+	}
+#endif
+}
+
+void FileSession::AsyncReadHead() {
+	auto self = shared_from_this();
+	boost::asio::async_read(_socket, boost::asio::buffer(_head, HEAD_TOTAL_LEN),
+		[self, this](const boost::system::error_code& ec, std::size_t) {
+		if (ec) {
+			if (ec != boost::asio::error::eof) {
+				std::cout << "file session read head failed, error is " << ec.message() << std::endl;
+			}
+			Close();
+			return;
+		}
+
+		short msg_id = 0;
+		memcpy(&msg_id, _head, HEAD_ID_LEN);
+		msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+		short msg_len = 0;
+		memcpy(&msg_len, _head + HEAD_ID_LEN, HEAD_DATA_LEN);
+		msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
+		if (msg_len < 0 || msg_len > MAX_LENGTH) {
+			Fail("invalid data length " + std::to_string(msg_len));
+			return;
+		}
+
+		AsyncReadBody(msg_id, msg_len);
+	});
+}
+
+void FileSession::AsyncReadBody(short msg_id, short msg_len) {
+	auto self = shared_from_this();
+	boost::asio::async_read(_socket, boost::asio::buffer(_body, msg_len),
+		[self, this, msg_id, msg_len](const boost::system::error_code& ec, std::size_t) {
+		if (ec) {
+			std::cout << "file session read body failed, error is " << ec.message() << std::endl;
+			Close();
+			return;
+		}
+
+		HandleMsg(msg_id, std::string(_body, msg_len));
+	});
+}
+
+void FileSession::HandleMsg(short msg_id, const std::string& msg_data) {
+	Json::Reader reader;
+	Json::Value root;
+	if (!reader.parse(msg_data, root)) {
+		Fail("parse json failed");
+		return;
+	}
+
+	switch (msg_id) {
+	case ID_FILE_UPLOAD_REQ:
+		HandleUploadReq(root);
+		AsyncReadHead();
+		break;
+	case ID_FILE_CHUNK_REQ:
+		//块数据收完后才继续读下一条控制消息
+		HandleChunkReq(root);
+		break;
+	case ID_FILE_CHECK_REQ:
+		HandleCheckReq(root);
+		AsyncReadHead();
+		break;
+	case ID_FILE_DOWNLOAD_REQ:
+		//文件数据发完后才继续读下一条控制消息
+		HandleDownloadReq(root);
+		break;
+	default:
+		Fail("unknown msg id " + std::to_string(msg_id));
+		break;
+	}
+}
+
+bool FileSession::CheckToken(const Json::Value& root) {
+	auto uid = root["uid"].asInt();
+	auto token = root["token"].asString();
+	if (_uid != 0 && _uid == uid && _token == token) {
+		return true;
+	}
+
+	std::string token_value = "";
+	bool success = RedisMgr::GetInstance()->Get(USERTOKENPREFIX + std::to_string(uid), token_value);
+	if (!success || token_value != token) {
+		return false;
+	}
+
+	_uid = uid;
+	_token = token;
+	return true;
+}
+
+void FileSession::HandleUploadReq(const Json::Value& root) {
+	Json::Value rtvalue;
+	auto file_id = root["file_id"].asString();
+	auto size = root["size"].asInt64();
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["file_id"] = file_id;
+	Defer defer([this, &rtvalue]() {
+		Send(rtvalue.toStyledString(), ID_FILE_UPLOAD_RSP);
+		});
+
+	if (!CheckToken(root)) {
+		rtvalue["error"] = ErrorCodes::TokenInvalid;
+		return;
+	}
+
+	if (!FileServer::IsValidFileId(file_id) || size <= 0 || size > MAX_FILE_SIZE) {
+		rtvalue["error"] = ErrorCodes::FileInvalid;
+		return;
+	}
+
+	CloseFile();
+	boost::system::error_code ec;
+	//已经传完的文件直接告诉客户端不需要再传，上一次最后一块的回包可能丢了
+	std::string file_path;
+	if (BlobStore::GetInstance()->Resolve(file_id, file_path)
+		&& (long long)boost::filesystem::file_size(file_path, ec) == size) {
+		rtvalue["offset"] = (Json::Int64)size;
+		return;
+	}
+
+	//断点续传：已经收到的部分保存在.part文件中，从它的长度继续
+	auto part_path = _server->GetPartPath(file_id);
+	long long offset = 0;
+	if (boost::filesystem::exists(part_path, ec)) {
+		offset = (long long)boost::filesystem::file_size(part_path, ec);
+		if (ec || offset > size) {
+			offset = 0;
+			boost::filesystem::resize_file(part_path, 0, ec);
+		}
+	}
+
+#ifdef __linux__
+	_file_fd = open(part_path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+	bool b_open = _file_fd >= 0;
+#else
+	//fstream以读写方式打开时要求文件已经存在
+	std::ofstream(part_path, std::ios::binary | std::ios::app).close();
+	_file.open(part_path, std::ios::binary | std::ios::in | std::ios::out);
+	bool b_open = _file.is_open();
+#endif
+	if (!b_open) {
+		std::cout << "open " << part_path << " failed" << std::endl;
+		rtvalue["error"] = ErrorCodes::FileInvalid;
+		return;
+	}
+
+	_file_id = file_id;
+	_file_size = size;
+	_file_offset = offset;
+	rtvalue["offset"] = (Json::Int64)offset;
+}
+
+void FileSession::HandleChunkReq(const Json::Value& root) {
+	auto offset = root["offset"].asInt64();
+	auto len = root["len"].asInt64();
+#ifdef __linux__
+	bool b_uploading = _file_fd >= 0;
+#else
+	bool b_uploading = _file.is_open();
+#endif
+	//块必须从当前断点开始连续发送，数据已经跟在后面无法跳过，出错只能断开让客户端重新查询断点
+	if (!b_uploading || _b_send_file || offset != _file_offset || len <= 0
+		|| len > FILE_CHUNK_MAX_LEN || offset + len > _file_size) {
+		Json::Value rtvalue;
+		rtvalue["error"] = ErrorCodes::FileOffsetErr;
+		rtvalue["file_id"] = _file_id;
+		rtvalue["offset"] = (Json::Int64)_file_offset;
+		_b_close_after_send = true;
+		Send(rtvalue.toStyledString(), ID_FILE_CHUNK_RSP);
+		return;
+	}
+
+	_chunk_left = len;
+	RecvChunkData();
+}
+
+#ifdef __linux__
+
+void FileSession::RecvChunkData() {
+	int sock_fd = _socket.native_handle();
+	while (_chunk_left > 0 || _pipe_bytes > 0) {
+		if (_pipe_bytes == 0) {
+			auto want = std::min<long long>(_chunk_left, FILE_SPLICE_LEN);
+			auto n = splice(sock_fd, nullptr, _pipe_fds[1], nullptr, want, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+			if (n == 0) {
+				Fail("peer closed while uploading " + _file_id);
+				return;
+			}
+
+			if (n < 0) {
+				if (errno == EAGAIN || errno == EWOULDBLOCK) {
+					//socket暂时没有数据，等可读后继续
+					auto self = shared_from_this();
+					_socket.async_wait(tcp::socket::wait_read, [self, this](const boost::system::error_code& ec) {
+						if (ec) {
+							Close();
+							return;
+						}
+						RecvChunkData();
+						});
+					return;
+				}
+				Fail("splice from socket failed, errno is " + std::to_string(errno));
+				return;
+			}
+
+			_pipe_bytes = n;
+			_chunk_left -= n;
+		}
+
+		loff_t off = _file_offset;
+		auto n = splice(_pipe_fds[0], nullptr, _file_fd, &off, _pipe_bytes, SPLICE_F_MOVE);
+		if (n <= 0) {
+			Fail("splice to file failed, errno is " + std::to_string(errno));
+			return;
+		}
+		_pipe_bytes -= n;
+		_file_offset = off;
+	}
+
+	FinishChunk();
+}
+
+void FileSession::SendFileData() {
+	int sock_fd = _socket.native_handle();
+	while (_file_offset < _file_size) {
+		off_t off = _file_offset;
+		auto want = std::min<long long>(_file_size - _file_offset, FILE_SENDFILE_LEN);
+		auto n = sendfile(sock_fd, _file_fd, &off, want);
+		if (n < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				//socket发送缓冲区满了，等可写后继续
+				auto self = shared_from_this();
+				_socket.async_wait(tcp::socket::wait_write, [self, this](const boost::system::error_code& ec) {
+					if (ec) {
+						Close();
+						return;
+					}
+					SendFileData();
+					});
+				return;
+			}
+			Fail("sendfile failed, errno is " + std::to_string(errno));
+			return;
+		}
+
+		if (n == 0) {
+			Fail("file truncated while downloading " + _file_id);
+			return;
+		}
+		_file_offset = off;
+	}
+
+	_b_send_file = false;
+	CloseFile();
+	AsyncReadHead();
+}
+
+#else
+
+//非Linux平台没有splice和sendfile，经过用户态缓冲区读写文件
+void FileSession::RecvChunkData() {
+	auto self = shared_from_this();
+	auto want = std::min<long long>(_chunk_left, (long long)_file_buf.size());
+	_socket.async_read_some(boost::asio::buffer(_file_buf.data(), (std::size_t)want),
+		[self, this](const boost::system::error_code& ec, std::size_t bytes_transfered) {
+		if (ec) {
+			std::cout << "file session recv chunk failed, error is " << ec.message() << std::endl;
+			Close();
+			return;
+		}
+
+		_file.seekp(_file_offset);
+		_file.write(_file_buf.data(), bytes_transfered);
+		if (!_file) {
+			Fail("write file failed " + _file_id);
+			return;
+		}
+
+		_file_offset += bytes_transfered;
+		_chunk_left -= bytes_transfered;
+		if (_chunk_left > 0) {
+			RecvChunkData();
+			return;
+		}
+		FinishChunk();
+	});
+}
+
+void FileSession::SendFileData() {
+	if (_file_offset >= _file_size) {
+		_b_send_file = false;
+		CloseFile();
+		AsyncReadHead();
+		return;
+	}
+
+	auto want = std::min<long long>(_file_size - _file_offset, (long long)_file_buf.size());
+	_file.seekg(_file_offset);
+	_file.read(_file_buf.data(), want);
+	if (_file.gcount() != want) {
+		Fail("file truncated while downloading " + _file_id);
+		return;
+	}
+
+	auto self = shared_from_this();
+	boost::asio::async_write(_socket, boost::asio::buffer(_file_buf.data(), (std::size_t)want),
+		[self, this, want](const boost::system::error_code& ec, std::size_t) {
+		if (ec) {
+			std::cout << "file session send file failed, error is " << ec.message() << std::endl;
+			Close();
+			return;
+		}
+
+		_file_offset += want;
+		SendFileData();
+	});
+}
+
+#endif
+
+void FileSession::FinishChunk() {
+	Json::Value rtvalue;
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["file_id"] = _file_id;
+	rtvalue["offset"] = (Json::Int64)_file_offset;
+	rtvalue["finished"] = _file_offset == _file_size;
+	if (_file_offset == _file_size) {
+		//收完后按内容哈希放入blob存储，之后才能被下载，相同内容只保存一份
+		CloseFile();
+		std::string hash;
+		if (!BlobStore::GetInstance()->Commit(_file_id, _uid, _server->GetPartPath(_file_id), hash)) {
+			rtvalue["error"] = ErrorCodes::FileInvalid;
+		}
+		else {
+			rtvalue["sha256"] = hash;
+			std::cout << "upload " << _file_id << " finished, size is " << _file_size << std::endl;
+		}
+	}
+
+	Send(rtvalue.toStyledString(), ID_FILE_CHUNK_RSP);
+	AsyncReadHead();
+}
+
+void FileSession::HandleCheckReq(const Json::Value& root) {
+	Json::Value rtvalue;
+	auto file_id = root["file_id"].asString();
+	auto hash = root["sha256"].asString();
+	auto size = root["size"].asInt64();
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["file_id"] = file_id;
+	rtvalue["exists"] = false;
+	Defer defer([this, &rtvalue]() {
+		Send(rtvalue.toStyledString(), ID_FILE_CHECK_RSP);
+		});
+
+	if (!CheckToken(root)) {
+		rtvalue["error"] = ErrorCodes::TokenInvalid;
+		return;
+	}
+
+	if (!FileServer::IsValidFileId(file_id) || !BlobStore::IsValidHash(hash) || size <= 0 || size > MAX_FILE_SIZE) {
+		rtvalue["error"] = ErrorCodes::FileInvalid;
+		return;
+	}
+
+	//内容已经存在时直接给file_id加引用，客户端不需要再上传；file_id已经绑定过时返回不存在
+	rtvalue["exists"] = BlobStore::GetInstance()->AddRef(file_id, _uid, hash, size);
+}
+
+void FileSession::HandleDownloadReq(const Json::Value& root) {
+	Json::Value rtvalue;
+	auto file_id = root["file_id"].asString();
+	auto offset = root["offset"].asInt64();
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["file_id"] = file_id;
+
+	if (!CheckToken(root)) {
+		rtvalue["error"] = ErrorCodes::TokenInvalid;
+	}
+	else if (!FileServer::IsValidFileId(file_id)) {
+		rtvalue["error"] = ErrorCodes::FileInvalid;
+	}
+
+	boost::system::error_code ec;
+	//blob存储之前上传的文件还在原来的位置
+	std::string file_path;
+	if (!BlobStore::GetInstance()->Resolve(file_id, file_path)) {
+		file_path = _server->GetFilePath(file_id);
+	}
+	long long size = 0;
+	if (rtvalue["error"].asInt() == ErrorCodes::Success) {
+		size = (long long)boost::filesystem::file_size(file_path, ec);
+		if (ec) {
+			rtvalue["error"] = ErrorCodes::FileNotExist;
+		}
+		else if (offset < 0 || offset > size) {
+			rtvalue["error"] = ErrorCodes::FileOffsetErr;
+		}
+	}
+
+	if (rtvalue["error"].asInt() == ErrorCodes::Success) {
+		CloseFile();
+#ifdef __linux__
+		_file_fd = open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+		bool b_open = _file_fd >= 0;
+#else
+		_file.open(file_path, std::ios::binary | std::ios::in);
+		bool b_open = _file.is_open();
+#endif
+		if (!b_open) {
+			rtvalue["error"] = ErrorCodes::FileNotExist;
+		}
+	}
+
+	if (rtvalue["error"].asInt() != ErrorCodes::Success) {
+		Send(rtvalue.toStyledString(), ID_FILE_DOWNLOAD_RSP);
+		AsyncReadHead();
+		return;
+	}
+
+	_file_id = file_id;
+	_file_size = size;
+	_file_offset = offset;
+	rtvalue["size"] = (Json::Int64)size;
+	rtvalue["offset"] = (Json::Int64)offset;
+	//回包发出去之后在HandleWrite里开始发送文件数据
+	_b_send_file = true;
+	Send(rtvalue.toStyledString(), ID_FILE_DOWNLOAD_RSP);
+}
+
+void FileSession::Send(const std::string& msg, short msg_id) {
+	_send_que.push(std::make_shared<SendNode>(msg.c_str(), (short)msg.length(), msg_id));
+	if (_send_que.size() > 1) {
+		return;
+	}
+
+	auto& msgnode = _send_que.front();
+	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+		std::bind(&FileSession::HandleWrite, shared_from_this(), std::placeholders::_1));
+}
+
+void FileSession::HandleWrite(const boost::system::error_code& error) {
+	if (error) {
+		std::cout << "file session write failed, error is " << error.message() << std::endl;
+		Close();
+		return;
+	}
+
+	_send_que.pop();
+	if (!_send_que.empty()) {
+		auto& msgnode = _send_que.front();
+		boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+			std::bind(&FileSession::HandleWrite, shared_from_this(), std::placeholders::_1));
+		return;
+	}
+
+	if (_b_close_after_send) {
+		Close();
+		return;
+	}
+
+	//控制消息都发完了才能开始写文件数据，避免和回包交错
+	if (_b_send_file) {
+		SendFileData();
+	}
+}
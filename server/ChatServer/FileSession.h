@@ -0,0 +1,88 @@
+#pragma once
+#include <boost/asio.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <queue>
+#include <memory>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <json/json.h>
+#include "const.h"
+#include "MsgNode.h"
+
+using tcp = boost::asio::ip::tcp;
+
+class FileServer;
+
+// FileSession：文件传输连接，和聊天连接使用不同的端口和socket，不经过LogicSystem队列
+// 控制消息沿用聊天协议的格式(2字节id + 2字节长度 + json)，文件数据紧跟在控制消息后面以原始字节传输：
+//   上传：ID_FILE_UPLOAD_REQ 查询断点 -> 多个 ID_FILE_CHUNK_REQ(offset,len) + len字节数据，每块回复一个 ID_FILE_CHUNK_RSP
+//   下载：ID_FILE_DOWNLOAD_REQ(offset) -> ID_FILE_DOWNLOAD_RSP + 从offset到文件末尾的数据
+//   秒传：ID_FILE_CHECK_REQ(sha256,size) -> ID_FILE_CHECK_RSP，内容已经存在时不需要上传
+// 上传完成的文件交给BlobStore按内容去重保存
+// Linux下上传数据用splice从socket经管道直接写入文件，下载用sendfile，数据不经过用户态缓冲区
+class FileSession : public std::enable_shared_from_this<FileSession>
+{
+public:
+	FileSession(boost::asio::io_context& io_context, FileServer* server);
+	~FileSession();
+	tcp::socket& GetSocket();
+	std::string& GetSessionId();
+	void Start();
+	void Close();
+private:
+	void AsyncReadHead();
+	void AsyncReadBody(short msg_id, short msg_len);
+	void HandleMsg(short msg_id, const std::string& msg_data);
+	void HandleUploadReq(const Json::Value& root);
+	void HandleChunkReq(const Json::Value& root);
+	void HandleDownloadReq(const Json::Value& root);
+	void HandleCheckReq(const Json::Value& root);
+	// 校验uid和token，文件连接不走登录流程，每个请求都带上聊天登录时拿到的token
+	bool CheckToken(const Json::Value& root);
+	// 把文件数据从socket写入文件，写完当前块后回复并继续读下一条控制消息
+	void RecvChunkData();
+	void FinishChunk();
+	// 把文件数据写到socket，写完后继续读下一条控制消息
+	void SendFileData();
+	void Send(const std::string& msg, short msg_id);
+	void HandleWrite(const boost::system::error_code& error);
+	void CloseFile();
+	void Fail(const std::string& reason);
+
+	tcp::socket _socket;
+	std::string _session_id;
+	FileServer* _server;
+	bool _b_close;
+	// 出错的回包发完后断开连接
+	bool _b_close_after_send;
+	// 第一次校验通过的uid和token，之后的请求不再查redis
+	int _uid;
+	std::string _token;
+	char _head[HEAD_TOTAL_LEN];
+	char _body[MAX_LENGTH];
+	std::queue<std::shared_ptr<SendNode>> _send_que;
+
+	// 当前上传或下载的文件
+#ifdef __linux__
+	int _file_fd;
+#else
+	std::fstream _file;
+#endif
+	std::string _file_id;
+	long long _file_size;
+	// 上传已经写入的字节数，下载已经发送到的位置
+	long long _file_offset;
+	// 当前块还没收完的字节数
+	long long _chunk_left;
+	// 下载响应发出后开始发送文件数据
+	bool _b_send_file;
+#ifdef __linux__
+	// splice需要经过管道中转
+	int _pipe_fds[2];
+	std::size_t _pipe_bytes;
+#else
+	std::vector<char> _file_buf;
+#endif
+};
@@ -0,0 +1,403 @@
+#include "HandoffMgr.h"
+#include "CServer.h"
+#include "ConfigMgr.h"
+#include "const.h"
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#endif
+
+//新进程发给旧进程的升级请求
+#define HANDOFF_REQ 'U'
+//新进程收到所有socket后的确认
+#define HANDOFF_ACK 'K'
+//旧进程收到确认后的提交，新进程收到之后才能读写这些socket
+#define HANDOFF_COMMIT 'C'
+
+HandoffMgr::HandoffMgr() :_listen_fd(-1), _takeover_fd(-1), _server(nullptr),
+	_b_stop(false), _b_handed_off(false) {
+	_path = ConfigMgr::Inst()["Handoff"]["Path"];
+}
+
+HandoffMgr::~HandoffMgr() {
+	Stop();
+}
+
+bool HandoffMgr::IsHandedOff() {
+	return _b_handed_off;
+}
+
+std::string HandoffMgr::HexEncode(const std::string& data) {
+	static const char* hex_chars = "0123456789abcdef";
+	std::string hex;
+	hex.reserve(data.size() * 2);
+	for (unsigned char c : data) {
+		hex.push_back(hex_chars[c >> 4]);
+		hex.push_back(hex_chars[c & 0x0f]);
+	}
+	return hex;
+}
+
+std::string HandoffMgr::HexDecode(const std::string& hex) {
+	auto to_num = [](char c) -> int {
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return 0;
+	};
+
+	std::string data;
+	data.reserve(hex.size() / 2);
+	for (std::size_t i = 0; i + 1 < hex.size(); i += 2) {
+		data.push_back((char)((to_num(hex[i]) << 4) | to_num(hex[i + 1])));
+	}
+	return data;
+}
+
+#ifdef __linux__
+
+bool HandoffMgr::TakeOver(int& listen_fd, std::vector<int>& session_fds, Json::Value& state, bool& b_old_found) {
+	b_old_found = false;
+	if (_path.empty()) {
+		return false;
+	}
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0) {
+		return false;
+	}
+
+	sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, _path.c_str(), sizeof(addr.sun_path) - 1);
+	//连不上说明没有旧进程在运行，正常启动
+	if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+		close(fd);
+		return false;
+	}
+
+	std::cout << "old server found on " << _path << ", start taking over" << std::endl;
+	b_old_found = true;
+	//旧进程卡住时不能一直等，旧进程冻结会话最多HANDOFF_TIMEOUT_SEC秒
+	SetRecvTimeout(fd, HANDOFF_TIMEOUT_SEC * 2);
+	char req = HANDOFF_REQ;
+	uint32_t net_len = 0;
+	if (!WriteAll(fd, &req, 1) || !ReadAll(fd, (char*)&net_len, sizeof(net_len))) {
+		close(fd);
+		return false;
+	}
+
+	std::string payload(ntohl(net_len), '\0');
+	Json::Reader reader;
+	if (!ReadAll(fd, &payload[0], payload.size()) || !reader.parse(payload, state)) {
+		std::cout << "read handoff state failed" << std::endl;
+		close(fd);
+		return false;
+	}
+
+	//第一个句柄是监听socket，后面依次是每个会话的socket
+	std::vector<int> fds;
+	if (!RecvFds(fd, state["fd_count"].asInt(), fds) || fds.empty()) {
+		std::cout << "recv handoff fds failed" << std::endl;
+		for (auto recv_fd : fds) {
+			close(recv_fd);
+		}
+		close(fd);
+		return false;
+	}
+
+	listen_fd = fds[0];
+	session_fds.assign(fds.begin() + 1, fds.end());
+	_takeover_fd = fd;
+	return true;
+}
+
+bool HandoffMgr::AckTakeOver(int listen_fd, const std::vector<int>& session_fds) {
+	if (_takeover_fd < 0) {
+		return false;
+	}
+
+	//确认之后要等旧进程提交：旧进程等确认超时的话已经恢复了会话，这时不能再碰这些socket
+	char ack = HANDOFF_ACK;
+	char commit = 0;
+	bool b_success = WriteAll(_takeover_fd, &ack, 1)
+		&& ReadAll(_takeover_fd, &commit, 1) && commit == HANDOFF_COMMIT;
+	close(_takeover_fd);
+	_takeover_fd = -1;
+	if (!b_success) {
+		//只关闭本进程里的句柄，旧进程的连接不受影响
+		std::cout << "old server did not commit handoff" << std::endl;
+		close(listen_fd);
+		for (auto fd : session_fds) {
+			close(fd);
+		}
+	}
+	return b_success;
+}
+
+void HandoffMgr::Listen(CServer* server, std::function<void()> on_handoff) {
+	if (_path.empty()) {
+		return;
+	}
+
+	_server = server;
+	_on_handoff = on_handoff;
+	_listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (_listen_fd < 0) {
+		return;
+	}
+
+	sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, _path.c_str(), sizeof(addr.sun_path) - 1);
+	//旧进程交接后路径还留着，新进程重新绑定
+	unlink(_path.c_str());
+	if (bind(_listen_fd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(_listen_fd, 1) < 0) {
+		std::cout << "handoff listen on " << _path << " failed" << std::endl;
+		close(_listen_fd);
+		_listen_fd = -1;
+		return;
+	}
+
+	std::cout << "handoff listen on " << _path << std::endl;
+	_thread = std::thread(&HandoffMgr::Run, this);
+}
+
+void HandoffMgr::Stop() {
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+
+	if (_listen_fd >= 0) {
+		//唤醒阻塞在accept上的线程
+		shutdown(_listen_fd, SHUT_RDWR);
+	}
+
+	if (_thread.joinable() && _thread.get_id() != std::this_thread::get_id()) {
+		_thread.join();
+	}
+
+	if (_listen_fd >= 0) {
+		close(_listen_fd);
+		_listen_fd = -1;
+		//交接成功后路径已经属于新进程，不能删
+		if (!_b_handed_off) {
+			unlink(_path.c_str());
+		}
+	}
+}
+
+void HandoffMgr::Run() {
+	while (!_b_stop) {
+		int conn_fd = accept(_listen_fd, nullptr, nullptr);
+		if (conn_fd < 0) {
+			if (_b_stop) {
+				break;
+			}
+			continue;
+		}
+
+		std::cout << "handoff request received" << std::endl;
+		bool b_success = HandOff(conn_fd);
+		close(conn_fd);
+		if (b_success) {
+			_b_handed_off = true;
+			_on_handoff();
+			break;
+		}
+	}
+}
+
+bool HandoffMgr::HandOff(int conn_fd) {
+	//新进程卡住的话不能让旧进程一直冻结
+	SetRecvTimeout(conn_fd, HANDOFF_TIMEOUT_SEC * 2);
+
+	char req = 0;
+	if (!ReadAll(conn_fd, &req, 1) || req != HANDOFF_REQ) {
+		return false;
+	}
+
+	int listen_fd = -1;
+	std::vector<int> fds;
+	Json::Value state;
+	if (!_server->PrepareHandoff(listen_fd, fds, state)) {
+		return false;
+	}
+
+	fds.insert(fds.begin(), listen_fd);
+	state["fd_count"] = (int)fds.size();
+	Json::FastWriter writer;
+	std::string payload = writer.write(state);
+	uint32_t net_len = htonl((uint32_t)payload.size());
+
+	//收到确认后回复提交，从这里开始socket归新进程；超时或者提交发不出去时新进程收不到提交，会放弃接管
+	char ack = 0;
+	char commit = HANDOFF_COMMIT;
+	bool b_success = WriteAll(conn_fd, (char*)&net_len, sizeof(net_len))
+		&& WriteAll(conn_fd, payload.data(), payload.size())
+		&& SendFds(conn_fd, fds)
+		&& ReadAll(conn_fd, &ack, 1) && ack == HANDOFF_ACK
+		&& WriteAll(conn_fd, &commit, 1);
+	if (!b_success) {
+		std::cout << "handoff failed, resume sessions" << std::endl;
+		_server->AbortHandoff();
+		return false;
+	}
+
+	std::cout << "handoff success, sessions count is " << fds.size() - 1 << std::endl;
+	return true;
+}
+
+bool HandoffMgr::SendFds(int conn_fd, const std::vector<int>& fds) {
+	//单条消息能带的句柄数有限(SCM_MAX_FD)，分批发送，每批附带1字节数据
+	for (std::size_t i = 0; i < fds.size(); i += HANDOFF_FD_BATCH) {
+		std::size_t count = std::min<std::size_t>(HANDOFF_FD_BATCH, fds.size() - i);
+		char data = 'F';
+		iovec iov;
+		iov.iov_base = &data;
+		iov.iov_len = 1;
+
+		std::vector<char> control(CMSG_SPACE(sizeof(int) * count));
+		msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control.data();
+		msg.msg_controllen = control.size();
+
+		cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_RIGHTS;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(int) * count);
+		memcpy(CMSG_DATA(cmsg), fds.data() + i, sizeof(int) * count);
+
+		if (sendmsg(conn_fd, &msg, MSG_NOSIGNAL) != 1) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool HandoffMgr::RecvFds(int conn_fd, int count, std::vector<int>& fds) {
+	while ((int)fds.size() < count) {
+		std::size_t batch = std::min<std::size_t>(HANDOFF_FD_BATCH, count - fds.size());
+		char data = 0;
+		iovec iov;
+		iov.iov_base = &data;
+		iov.iov_len = 1;
+
+		std::vector<char> control(CMSG_SPACE(sizeof(int) * batch));
+		msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control.data();
+		msg.msg_controllen = control.size();
+
+		if (recvmsg(conn_fd, &msg, 0) != 1) {
+			return false;
+		}
+
+		cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+		if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+			return false;
+		}
+
+		std::size_t recv_count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+		for (std::size_t i = 0; i < recv_count; ++i) {
+			int fd = -1;
+			memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+			fds.push_back(fd);
+		}
+	}
+
+	return true;
+}
+
+void HandoffMgr::SetRecvTimeout(int fd, int seconds) {
+	timeval tv;
+	tv.tv_sec = seconds;
+	tv.tv_usec = 0;
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+bool HandoffMgr::WriteAll(int fd, const char* data, std::size_t len) {
+	//对方已经关闭时返回失败，不能因为SIGPIPE退出
+	while (len > 0) {
+		auto n = send(fd, data, len, MSG_NOSIGNAL);
+		if (n <= 0) {
+			return false;
+		}
+		data += n;
+		len -= n;
+	}
+	return true;
+}
+
+bool HandoffMgr::ReadAll(int fd, char* data, std::size_t len) {
+	while (len > 0) {
+		auto n = read(fd, data, len);
+		if (n <= 0) {
+			return false;
+		}
+		data += n;
+		len -= n;
+	}
+	return true;
+}
+
+#else
+
+//非Linux平台不支持句柄传递，始终按普通方式启动和退出
+bool HandoffMgr::TakeOver(int& listen_fd, std::vector<int>& session_fds, Json::Value& state, bool& b_old_found) {
+	b_old_found = false;
+	return false;
+}
+
+bool HandoffMgr::AckTakeOver(int listen_fd, const std::vector<int>& session_fds) {
+	return false;
+}
+
+void HandoffMgr::Listen(CServer* server, std::function<void()> on_handoff) {
+}
+
+void HandoffMgr::Stop() {
+}
+
+void HandoffMgr::Run() {
+}
+
+bool HandoffMgr::HandOff(int conn_fd) {
+	return false;
+}
+
+bool HandoffMgr::SendFds(int conn_fd, const std::vector<int>& fds) {
+	return false;
+}
+
+bool HandoffMgr::RecvFds(int conn_fd, int count, std::vector<int>& fds) {
+	return false;
+}
+
+void HandoffMgr::SetRecvTimeout(int fd, int seconds) {
+}
+
+bool HandoffMgr::WriteAll(int fd, const char* data, std::size_t len) {
+	return false;
+}
+
+bool HandoffMgr::ReadAll(int fd, char* data, std::size_t len) {
+	return false;
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <utility>
+
+// KvStore：键值存储接口，方法和返回值的语义与对应的redis命令一致
+// RedisKvStore基于hiredis连接池，MemKvStore是进程内实现，由RedisMgr根据配置选择
+class KvStore
+{
+public:
+	virtual ~KvStore() {}
+	virtual bool Get(const std::string& key, std::string& value) = 0;
+	virtual bool Set(const std::string& key, const std::string& value) = 0;
+	virtual bool LPush(const std::string& key, const std::string& value) = 0;
+	virtual bool LPop(const std::string& key, std::string& value) = 0;
+	virtual bool RPush(const std::string& key, const std::string& value) = 0;
+	virtual bool RPop(const std::string& key, std::string& value) = 0;
+	virtual bool LRange(const std::string& key, int start, int stop, std::vector<std::string>& values) = 0;
+	virtual bool LTrim(const std::string& key, int start, int stop) = 0;
+	virtual bool Incr(const std::string& key, long long& value) = 0;
+	virtual bool HIncrBy(const std::string& key, const std::string& hkey, long long delta, long long& value) = 0;
+	virtual bool HSet(const std::string& key, const std::string& hkey, const std::string& value) = 0;
+	virtual bool HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen) = 0;
+	virtual std::string HGet(const std::string& key, const std::string& hkey) = 0;
+	virtual bool HDel(const std::string& key, const std::string& field) = 0;
+	virtual bool Del(const std::string& key) = 0;
+	virtual bool ExistsKey(const std::string& key) = 0;
+	// 设置过期时间(秒)，键不存在返回false，seconds<=0时直接删除
+	virtual bool Expire(const std::string& key, int seconds) = 0;
+	// 流：追加一条消息，maxlen>0时把流裁剪到大约maxlen条，id返回消息的id
+	virtual bool XAdd(const std::string& key, const std::string& value, long long maxlen, std::string& id) = 0;
+	// 读取id大于last_id的消息(id, 内容)，最多count条；没有消息时最多阻塞block_ms毫秒，0表示不阻塞。超时返回true，entries为空
+	virtual bool XRead(const std::string& key, const std::string& last_id, int count, int block_ms,
+		std::vector<std::pair<std::string, std::string>>& entries) = 0;
+	virtual void Close() = 0;
+};
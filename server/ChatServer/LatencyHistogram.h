@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+// LatencyHistogram：可以多线程并发记录的高动态范围直方图，单位微秒
+// 分桶方式和LoadGen的HdrHistogram一样，每个值保留significant位有效数字；
+// 每个桶是一个原子计数，Record只做一次下标计算和几次relaxed的原子加法，不加锁。
+// 导出时先Snapshot拷贝一份计数，再在拷贝上算分位数，不影响记录线程
+class LatencyHistogram
+{
+public:
+	struct Snapshot {
+		std::vector<uint64_t> _counts;
+		uint64_t _total;
+		uint64_t _sum;
+		uint64_t _max;
+	};
+
+	LatencyHistogram(int64_t highest, int significant);
+	// 记录一个值，小于0按0记录，超过上限按上限记录
+	void Record(int64_t value);
+	void GetSnapshot(Snapshot& snapshot) const;
+	// 返回percentile(0~100)分位的值，精度内取这个桶的上界
+	int64_t Percentile(const Snapshot& snapshot, double percentile) const;
+	// 小于等于value的样本数，误差在一个桶的宽度以内
+	uint64_t CountAtOrBelow(const Snapshot& snapshot, int64_t value) const;
+private:
+	int BucketIndex(int64_t value) const;
+	int CountsIndex(int64_t value) const;
+	int64_t ValueFromIndex(int index) const;
+	// 和value落在同一个桶内的最大值
+	int64_t HighestEquivalent(int64_t value) const;
+
+	int64_t _highest;
+	int _sub_bucket_half_count_magnitude;
+	int _sub_bucket_half_count;
+	int _sub_bucket_count;
+	int64_t _sub_bucket_mask;
+	int _bucket_count;
+	int _counts_len;
+	std::unique_ptr<std::atomic<uint64_t>[]> _counts;
+	std::atomic<uint64_t> _total;
+	std::atomic<uint64_t> _sum;
+	std::atomic<uint64_t> _max;
+};
@@ -0,0 +1,117 @@
+#include "LogicQueue.h"
+#include "TraceMgr.h"
+#include <chrono>
+
+using namespace std;
+
+LogicNode::LogicNode(shared_ptr<CSession>  session, 
+	shared_ptr<RecvNode> recvnode, uint64_t trace_id):_session(session),_recvnode(recvnode),
+	_enqueue_time(std::chrono::steady_clock::now()), _trace_id(trace_id) {
+	
+}
+
+LogicQueue::LogicQueue() : _b_stop(false), _que_len(0) {
+	_unknown_msg_count = MetricsMgr::GetInstance()->GetCounter("chat_logic_unknown_msg_total");
+	// 导出时只读原子计数，工作线程处理消息时一直持有_mutex，这里加锁会让导出等到回调执行完
+	MetricsMgr::GetInstance()->RegGauge("chat_logic_queue_length", [this]() {
+		return static_cast<double>(_que_len.load(std::memory_order_relaxed));
+	});
+	_worker_thread = std::thread(&LogicQueue::DealMsg, this);
+}
+
+LogicQueue::~LogicQueue() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_stop = true;
+	}
+	_consume.notify_one();
+	_worker_thread.join();
+}
+
+void LogicQueue::PostMsgToQue(shared_ptr<LogicNode> msg) {
+	std::unique_lock<std::mutex> unique_lk(_mutex);
+	_msg_que.push(msg);
+	_que_len.fetch_add(1, std::memory_order_relaxed);
+	// 如果队列从空变为非空，通知消费线程
+	if (_msg_que.size() == 1) {
+		unique_lk.unlock();
+		_consume.notify_one();
+	}
+}
+
+// 平滑升级导出会话状态前调用
+// DealMsg处理完回调后才会pop，所以队列为空时所有回包都已经进入会话的发送队列
+void LogicQueue::WaitIdle() {
+	for (;;) {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_msg_que.empty()) {
+				return;
+			}
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+}
+
+void LogicQueue::DealMsg() {
+	for (;;) {
+		std::unique_lock<std::mutex> unique_lk(_mutex);
+		//判断队列为空则用条件变量阻塞等待，并释放锁
+		while (_msg_que.empty() && !_b_stop) {
+			_consume.wait(unique_lk);
+		}
+
+		//判断是否为关闭状态，把所有逻辑执行完后则退出循环
+		if (_b_stop) {
+			while (!_msg_que.empty()) {
+				DealNode(_msg_que.front());
+				_msg_que.pop();
+				_que_len.fetch_sub(1, std::memory_order_relaxed);
+			}
+			break;
+		}
+
+		//如果没有停服，且说明队列中有数据
+		DealNode(_msg_que.front());
+		_msg_que.pop();
+		_que_len.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
+
+void LogicQueue::DealNode(shared_ptr<LogicNode> msg_node) {
+	auto msg_id = msg_node->_recvnode->_msg_id;
+	cout << "recv_msg id  is " << msg_id << endl;
+	auto call_back_iter = _fun_callbacks.find(msg_id);
+	if (call_back_iter == _fun_callbacks.end()) {
+		_unknown_msg_count->fetch_add(1, std::memory_order_relaxed);
+		std::cout << "msg id [" << msg_id << "] handler not found" << std::endl;
+		return;
+	}
+
+	auto* metric = _msg_metrics[msg_id];
+	auto begin = std::chrono::steady_clock::now();
+	auto wait_us = MetricsMgr::ToMicros(begin - msg_node->_enqueue_time);
+	metric->_wait.Record(wait_us);
+	// 处理函数里的存储调用、gRPC调用和发包都挂在这个trace id下
+	TraceScope trace_scope(msg_node->_trace_id);
+	int64_t begin_us = msg_node->_trace_id != 0 ? TraceMgr::NowMicros() : 0;
+	call_back_iter->second(msg_node->_session, msg_id,
+		std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
+	auto exec_us = MetricsMgr::ToMicros(std::chrono::steady_clock::now() - begin);
+	metric->_exec.Record(exec_us);
+	if (msg_node->_trace_id != 0) {
+		auto trace_mgr = TraceMgr::GetInstance();
+		auto tag = std::to_string(msg_id);
+		trace_mgr->Record(msg_node->_trace_id, "logic.wait", tag, begin_us - wait_us, wait_us);
+		trace_mgr->Record(msg_node->_trace_id, "logic.exec", tag, begin_us, exec_us);
+	}
+}
+
+void LogicQueue::RegisterCallBack(short msg_id, FunCallBack callback) {
+	// 先在锁外取统计对象，GetLatency要加MetricsMgr的锁，不和_mutex嵌套
+	auto* metric = MetricsMgr::GetInstance()->GetLatency("chat_logic_msg", "msg_id", std::to_string(msg_id));
+	// 工作线程查找回调时持有_mutex，注册时也加锁
+	std::lock_guard<std::mutex> lock(_mutex);
+	_fun_callbacks[msg_id] = callback;
+	_msg_metrics[msg_id] = metric;
+}
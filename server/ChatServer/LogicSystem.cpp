@@ -5,515 +5,487 @@
 #include "RedisMgr.h"
 #include "UserMgr.h"
 #include "ChatGrpcClient.h"
+#include "CompressMgr.h"
+#include "TraceMgr.h"
+#include <chrono>
 
 using namespace std;
 
-// 캯
-LogicSystem::LogicSystem() : _b_stop(false) { // ʼֹͣ־Ϊ false
-    RegisterCallBacks(); // עϢĻص
-    // ̣߳ڴϢ
-    _worker_thread = std::thread(&LogicSystem::DealMsg, this); 
+// 构造函数
+LogicSystem::LogicSystem() {
+    RegisterCallBacks(); // 注册消息处理的回调函数
 }
 
-// 
 LogicSystem::~LogicSystem() {
-    _b_stop = true; // ֹͣ־Ϊ trueʾ߳Ӧֹͣ
-    _consume.notify_one(); // ֪ͨµ״̬仯
-    _worker_thread.join(); // ȴ߳
 }
 
-// ϢͶϢ
+// 向消息队列中投递消息
 void LogicSystem::PostMsgToQue(shared_ptr<LogicNode> msg) {
-    std::unique_lock<std::mutex> unique_lk(_mutex); // ȡ
-    _msg_que.push(msg); // ϢϢ
-    // дӿձΪǿգ֪ͨ߳
-    if (_msg_que.size() == 1) {
-        unique_lk.unlock(); // ͷŻ
-        _consume.notify_one(); // ֪ͨ
-    }
+    _queue.PostMsgToQue(msg);
 }
-/*
-DealMsg ϢлȡϢϢ ID ӦĻصдͨͻʵ̰߳ȫϢƣͬʱ֧ŵعرչ̣߳ȷϵͳرʱдϢ
-*/
-void LogicSystem::DealMsg() {
-	for (;;) {
-		std::unique_lock<std::mutex> unique_lk(_mutex);
-		//ж϶Ϊȴͷ
-		while (_msg_que.empty() && !_b_stop) {
-			_consume.wait(unique_lk);
-		}
 
-		//жǷΪر״̬߼ִ˳ѭ
-		if (_b_stop ) {
-			while (!_msg_que.empty()) {
-				auto msg_node = _msg_que.front();
-				cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-				auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-				if (call_back_iter == _fun_callbacks.end()) {
-					_msg_que.pop();
-					continue;
-				}
-				call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-					std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-				_msg_que.pop();
-			}
-			break;
-		}
+// 等待队列中的消息全部处理完，平滑升级导出会话状态前调用
+void LogicSystem::WaitIdle() {
+    _queue.WaitIdle();
+}
 
-		//ûͣ˵
-		auto msg_node = _msg_que.front();
-		cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-		auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-		if (call_back_iter == _fun_callbacks.end()) {
-			_msg_que.pop();
-			std::cout << "msg id [" << msg_node->_recvnode->_msg_id << "] handler not found" << std::endl;
-			continue;
-		}
-		call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id, std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-		_msg_que.pop();
-	}
+void LogicSystem::RegisterCallBack(short msg_id, FunCallBack callback) {
+    _queue.RegisterCallBack(msg_id, callback);
 }
 
 void LogicSystem::RegisterCallBacks() {
-	_fun_callbacks[MSG_CHAT_LOGIN] = std::bind(&LogicSystem::LoginHandler, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(MSG_CHAT_LOGIN, std::bind(&LogicSystem::LoginHandler, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_SEARCH_USER_REQ] = std::bind(&LogicSystem::SearchInfo, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(ID_SEARCH_USER_REQ, std::bind(&LogicSystem::SearchInfo, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_ADD_FRIEND_REQ] = std::bind(&LogicSystem::AddFriendApply, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(ID_ADD_FRIEND_REQ, std::bind(&LogicSystem::AddFriendApply, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_AUTH_FRIEND_REQ] = std::bind(&LogicSystem::AuthFriendApply, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(ID_AUTH_FRIEND_REQ, std::bind(&LogicSystem::AuthFriendApply, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_TEXT_CHAT_MSG_REQ] = std::bind(&LogicSystem::DealChatTextMsg, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
-	
+	RegisterCallBack(ID_TEXT_CHAT_MSG_REQ, std::bind(&LogicSystem::DealChatTextMsg, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 }
 
 void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short &msg_id, const string &msg_data) {
-    //  JSON  JSON ֵ
+    // 创建 JSON 解析器和 JSON 值对象
     Json::Reader reader;
     Json::Value root;
-    // Ϣ
+    // 解析传入的消息数据
     reader.parse(msg_data, root);
 
-    // ȡû ID  Token
-    auto uid = root["uid"].asInt(); //  JSON ȡû ID
-    auto token = root["token"].asString(); //  JSON ȡ Token
+    // 获取用户 ID 和 Token
+    auto uid = root["uid"].asInt(); // 从 JSON 中提取用户 ID
+    auto token = root["token"].asString(); // 从 JSON 中提取 Token
     std::cout << "user login uid is  " << uid << " user token  is " << token << endl;
 
-    Json::Value  rtvalue; // ڴ洢ؽ
-    // ʹ Defer ṹȷͽͻ
+    // 登录成功后在登录回包之后下发离线消息，这个Defer先声明所以后执行
+    bool b_login = false;
+    Defer offline_defer([this, &b_login, uid, session]() {
+        if (b_login) {
+            DeliverOfflineMsgs(uid, session);
+        }
+    });
+
+    Json::Value  rtvalue; // 用于存储返回结果
+    // 使用 Defer 结构体确保最后发送结果给客户端
     Defer defer([this, &rtvalue, session]() {
-        std::string return_str = rtvalue.toStyledString(); //  JSON תΪַ
-        session->Send(return_str, MSG_CHAT_LOGIN_RSP); // ͵¼Ӧ
+        std::string return_str = rtvalue.toStyledString(); // 将 JSON 对象转为字符串
+        session->Send(return_str, MSG_CHAT_LOGIN_RSP); // 发送登录响应
     });
 
-    //  Redis ȡû Token Ƿȷ
-    std::string uid_str = std::to_string(uid); // û ID תΪַ
-    std::string token_key = USERTOKENPREFIX + uid_str; //  Redis  Token ļ
-    std::string token_value = ""; // ڴ洢 Redis ȡ Token
-    bool success = RedisMgr::GetInstance()->Get(token_key, token_value); // ȡ Token
+    // 从 Redis 获取用户的 Token 是否正确
+    std::string uid_str = std::to_string(uid); // 将用户 ID 转为字符串
+    std::string token_key = USERTOKENPREFIX + uid_str; // 构建 Redis 中 Token 的键
+    std::string token_value = ""; // 用于存储从 Redis 获取的 Token
+    bool success = RedisMgr::GetInstance()->Get(token_key, token_value); // 获取 Token
     if (!success) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // ȡʧܣ UID Ч
+        rtvalue["error"] = ErrorCodes::UidInvalid; // 如果获取失败，返回 UID 无效
         return;
     }
 
-    //  Token Ƿ Redis еֵƥ
+    // 检查 Token 是否与 Redis 中的值匹配
     if (token_value != token) {
-        rtvalue["error"] = ErrorCodes::TokenInvalid; // ƥ䣬 Token Ч
+        rtvalue["error"] = ErrorCodes::TokenInvalid; // 如果不匹配，返回 Token 无效
         return;
     }
 
-    rtvalue["error"] = ErrorCodes::Success; // ¼ɹ÷״̬Ϊɹ
+    rtvalue["error"] = ErrorCodes::Success; // 登录成功，设置返回状态为成功
 
-    // ݿȡûϢ
-    std::string base_key = USER_BASE_INFO + uid_str; // ûϢļ
-    auto user_info = std::make_shared<UserInfo>(); // ûϢ
-    bool b_base = GetBaseInfo(base_key, uid, user_info); // ȡûϢ
+    // 从数据库获取用户基本信息
+    std::string base_key = USER_BASE_INFO + uid_str; // 构建用户基本信息的键
+    auto user_info = std::make_shared<UserInfo>(); // 创建用户信息对象
+    bool b_base = GetBaseInfo(base_key, uid, user_info); // 获取用户基本信息
     if (!b_base) {
-        rtvalue["error"] = ErrorCodes::UidInvalid; // ȡʧܣ UID Ч
+        rtvalue["error"] = ErrorCodes::UidInvalid; // 如果获取失败，返回 UID 无效
         return;
     }
 
-    // ûϢӵֵ
-    rtvalue["uid"] = uid; // û ID
-    rtvalue["pwd"] = user_info->pwd; // û
-    rtvalue["name"] = user_info->name; // û
-    rtvalue["email"] = user_info->email; // û
-    rtvalue["nick"] = user_info->nick; // ûǳ
-    rtvalue["desc"] = user_info->desc; // û
-    rtvalue["sex"] = user_info->sex; // ûԱ
-    rtvalue["icon"] = user_info->icon; // ûͷ
-
-  // ݿȡб
-    std::vector<std::shared_ptr<ApplyInfo>> apply_list; // 洢Ϣб
-    auto b_apply = GetFriendApplyInfo(uid, apply_list); // ȡϢ
-    if (b_apply) {
-        for (auto &apply : apply_list) {
-            Json::Value obj; //  JSON 洢Ϣ
-            obj["name"] = apply->_name; // 
-            obj["uid"] = apply->_uid; // û ID
-            obj["icon"] = apply->_icon; // ͷ
-            obj["nick"] = apply->_nick; // ǳ
-            obj["sex"] = apply->_sex; // Ա
-            obj["desc"] = apply->_desc; // 
-            obj["status"] = apply->_status; // ״̬
-            rtvalue["apply_list"].append(obj); // Ϣӵֵ
-        }
+    // 将用户基本信息添加到返回值中
+    rtvalue["uid"] = uid; // 用户 ID
+    rtvalue["pwd"] = user_info->pwd; // 用户密码
+    rtvalue["name"] = user_info->name; // 用户名
+    rtvalue["email"] = user_info->email; // 用户邮箱
+    rtvalue["nick"] = user_info->nick; // 用户昵称
+    rtvalue["desc"] = user_info->desc; // 用户描述
+    rtvalue["sex"] = user_info->sex; // 用户性别
+    rtvalue["icon"] = user_info->icon; // 用户头像
+
+    // 客户端声明支持zstd时协商压缩，登录回包本身就按压缩发送；两端字典id一致才用字典
+    auto compress_mgr = CompressMgr::GetInstance();
+    if (compress_mgr->IsEnabled() && root["compress"].asString() == "zstd") {
+        bool b_dict = compress_mgr->GetDictId() != 0 && root["dict_id"].asUInt() == compress_mgr->GetDictId();
+        session->SetCompress(b_dict);
+        rtvalue["compress"] = "zstd";
+        rtvalue["dict_id"] = b_dict ? compress_mgr->GetDictId() : 0;
     }
 
-    // ȡб
-    std::vector<std::shared_ptr<UserInfo>> friend_list; // 洢Ϣб
-    bool b_friend_list = GetFriendList(uid, friend_list); // ȡб
-    for (auto &friend_ele : friend_list) {
-        Json::Value obj; //  JSON 洢Ϣ
-        obj["name"] = friend_ele->name; // 
-        obj["uid"] = friend_ele->uid; // û ID
-        obj["icon"] = friend_ele->icon; // ͷ
-        obj["nick"] = friend_ele->nick; // ǳ
-        obj["sex"] = friend_ele->sex; // Ա
-        obj["desc"] = friend_ele->desc; // 
-        obj["back"] = friend_ele->back; // ѱϢ
-        rtvalue["friend_list"].append(obj); // Ϣӵֵ
-    }
+    // 资料在上次登录后被修改过时先记入好友的变更日志
+    CheckProfileChange(uid, user_info);
+
+    // 好友申请列表和好友列表，客户端带上本地版本号时只下发增量
+    FillApplySync(uid, root, rtvalue);
+    FillFriendSync(uid, root, rtvalue);
 
-    // ȡǰ
+    // 获取当前服务器名称
     auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
 
-    // µ¼
-    auto rd_res = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server_name); //  Redis ȡ¼
+    // 更新登录数量
+    auto rd_res = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server_name); // 从 Redis 获取登录计数
     int count = 0;
     if (!rd_res.empty()) {
-        count = std::stoi(rd_res); // ¼תΪ
+        count = std::stoi(rd_res); // 将登录计数转换为整数
     }
 
-    count++; // ¼
-    auto count_str = std::to_string(count); // תΪַ
-    RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, count_str); //  Redis еĵ¼
+    count++; // 登录计数增加
+    auto count_str = std::to_string(count); // 转换为字符串
+    RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, count_str); // 更新 Redis 中的登录计数
 
-    // û ID 󶨵ǰỰ
+    // 将用户 ID 绑定到当前会话中
     session->SetUserId(uid);
 	
-    // Ϊûõ¼ IP ͷ
-    std::string ipkey = USERIPPREFIX + uid_str; // û IP  Redis 
-    RedisMgr::GetInstance()->Set(ipkey, server_name); //  Redis û IP
-	//uidsession󶨹,Ժ˲
-    // û ID ͻỰԱ㽫ߵû
+    // 为用户设置登录 IP 和服务器名称
+    std::string ipkey = USERIPPREFIX + uid_str; // 构建用户 IP 的 Redis 键
+    RedisMgr::GetInstance()->Set(ipkey, server_name); // 在 Redis 中设置用户 IP
+	//uid和session绑定管理,方便以后踢人操作
+    // 绑定用户 ID 和会话，以便将来可以踢掉用户
     UserMgr::GetInstance()->SetUserSession(uid, session);
+    b_login = true;
 
-	return; // ɵ¼
+	return; // 完成登录处理
 }
 
 void LogicSystem::SearchInfo(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
 {
-    Json::Reader reader; //  JSON 
-    Json::Value root; //  JSON ֵ
-    reader.parse(msg_data, root); //  JSON ַ
-    auto uid_str = root["uid"].asString(); //  JSON лȡ "uid" ֶεֵ
-    std::cout << "user SearchInfo uid is  " << uid_str << endl; // ӡû ID
+    Json::Reader reader; // 创建 JSON 解析器
+    Json::Value root; // 创建 JSON 值对象
+    reader.parse(msg_data, root); // 解析传入的 JSON 字符串数据
+    auto uid_str = root["uid"].asString(); // 从 JSON 中获取 "uid" 字段的值
+    std::cout << "user SearchInfo uid is  " << uid_str << endl; // 打印搜索的用户 ID
 
-    Json::Value rtvalue; // ڴ洢ؽ JSON ֵ
+    Json::Value rtvalue; // 创建用于存储返回结果的 JSON 值对象
 
-    // ʹ Defer ȷڷʱԶͽ
+    // 使用 Defer 对象来确保在方法结束时自动发送结果
     Defer defer([this, &rtvalue, session]() {
-        std::string return_str = rtvalue.toStyledString(); // תΪַ
-        session->Send(return_str, ID_SEARCH_USER_RSP); // ͽͻ
+        std::string return_str = rtvalue.toStyledString(); // 将结果转换为字符串
+        session->Send(return_str, ID_SEARCH_USER_RSP); // 发送结果给客户端
     });
 
-    //  uid_str ǷǴ
-    bool b_digit = isPureDigit(uid_str); // ж uid_str ǷΪ
-    if (b_digit) { // ֣ͨ UID ѯûϢ
-        GetUserByUid(uid_str, rtvalue); //  UID ȡûϢ䵽 rtvalue 
+    // 检查 uid_str 是否是纯数字
+    bool b_digit = isPureDigit(uid_str); // 判断 uid_str 是否为数字
+    if (b_digit) { // 如果是数字，则通过 UID 查询用户信息
+        GetUserByUid(uid_str, rtvalue); // 根据 UID 获取用户信息并填充到 rtvalue 中
     }
-    else { // ֣ͨûѯûϢ
-        GetUserByName(uid_str, rtvalue); // ûȡûϢ䵽 rtvalue 
+    else { // 如果不是数字，则通过用户名查询用户信息
+        GetUserByName(uid_str, rtvalue); // 根据用户名获取用户信息并填充到 rtvalue 中
     }
-    return; //  Defer Զ
+    return; // 方法结束，结果会在 Defer 中自动发送
 }
 
 void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data)
 {
-    // Json͸ڵ
+    // 创建Json解析器和根节点
     Json::Reader reader;
     Json::Value root;
 
-    // Ϣ
+    // 解析传入的消息数据
     if (!reader.parse(msg_data, root)) {
-        // ʧܣﴦ緵شӦͻ
-        // мܹɹ
+        // 如果解析失败，可以在这里处理错误，例如返回错误响应给客户端
+        // 本例中假设总是能够成功解析
         return;
     }
 
- 	// JSONȡUIDơעԼUID
-    auto uid = root["uid"].asInt();         // ߵUID
-    auto applyname = root["applyname"].asString();  // ʱʹõ
-    auto bakname = root["bakname"].asString();      // ע
-    auto touid = root["touid"].asInt();             // ߵUID
+ 	// 从JSON中提取发送者UID、申请名称、备注名称以及接收者UID
+    auto uid = root["uid"].asInt();         // 发送者的UID
+    auto applyname = root["applyname"].asString();  // 申请时使用的名称
+    auto bakname = root["bakname"].asString();      // 备注名称
+    auto touid = root["touid"].asInt();             // 接收者的UID
 
-    // ӡϢ
+    // 打印调试信息
     std::cout << "user login uid is  " << uid << " applyname  is " << applyname << " bakname is " << bakname << " touid is " << touid << endl;
 
-    // ӦJSON
+    // 构建响应JSON对象
     Json::Value rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;  // ôΪɹ
+    rtvalue["error"] = ErrorCodes::Success;  // 设置错误码为成功
 	
-    // ʹDeferģʽȷںǰͻ˷Ӧ
+    // 使用Defer模式确保在函数结束前向客户端发送响应
     Defer defer([this, &rtvalue, session]() {
-        std::string return_str = rtvalue.toStyledString();  // JSONתɸʽַ
-        session->Send(return_str, ID_ADD_FRIEND_RSP);       // ͻ˷Ӧ
+        std::string return_str = rtvalue.toStyledString();  // 将JSON对象转换成格式化的字符串
+        session->Send(return_str, ID_ADD_FRIEND_RSP);       // 向客户端发送响应
     });
 
-    // ݿ⣬¼
+    // 更新数据库，记录好友申请
     MysqlMgr::GetInstance()->AddFriendApply(uid, touid);
+    // 记录接收者申请列表的变更，供增量同步使用
+    RecordApplyChange(touid, "add", uid, 0);
 
-    // ѯRedisԲҽ߶ӦķIP
+    // 查询Redis以查找接收者对应的服务器IP
     auto to_str = std::to_string(touid);
-    auto to_ip_key = USERIPPREFIX + to_str;  // ϳɼ
-    std::string to_ip_value = "";            // 洢ѯ
-    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);  // ִвѯ
-    if (!b_ip) {  // ûҵӦIPַ
-        // Ӵ߼ô벢
+    auto to_ip_key = USERIPPREFIX + to_str;  // 组合成键
+    std::string to_ip_value = "";            // 存储查询结果
+    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);  // 执行查询
+    if (!b_ip) {  // 如果没有找到对应的IP地址
+        // 可以在这里添加错误处理逻辑，例如设置错误码并返回
         return;
     }
 
-    // ȡǰ
+    // 获取当前服务器配置
     auto& cfg = ConfigMgr::Inst();
-    auto self_name = cfg["SelfServer"]["Name"];  // ǰ
+    auto self_name = cfg["SelfServer"]["Name"];  // 当前服务器名称
 
 
-   // RedisлȡߵûϢ
+   // 从Redis中获取发送者的用户基本信息
     std::string base_key = USER_BASE_INFO + std::to_string(uid);
-    auto apply_info = std::make_shared<UserInfo>();  // UserInfoָ
-    bool b_info = GetBaseInfo(base_key, uid, apply_info);  // ȡûϢ
+    auto apply_info = std::make_shared<UserInfo>();  // 创建UserInfo指针
+    bool b_info = GetBaseInfo(base_key, uid, apply_info);  // 获取用户基本信息
 
-    // Ƿͬһ
+    // 检查接收者是否在同一服务器上
     if (to_ip_value == self_name) {
-        // ͬһֱӻȡỰϢ
+        // 在同一服务器上直接获取会话并发送消息
         auto target_session = UserMgr::GetInstance()->GetSession(touid);
         if (target_session) {
-            // ֪ͨJSON
+            // 构建通知JSON对象
             Json::Value notify;
             notify["error"] = ErrorCodes::Success;
-            notify["applyuid"] = uid;  // ߵUID
-            notify["name"] = applyname;  // ʱʹõ
-            notify["desc"] = "";  // עΪգ
+            notify["applyuid"] = uid;  // 申请者的UID
+            notify["name"] = applyname;  // 申请时使用的名称
+            notify["desc"] = "";  // 备注（这里为空）
 
-            // ȡûϢӦֶ
+            // 如果获取到用户基本信息，则填充相应字段
             if (b_info) {
-                notify["icon"] = apply_info->icon;  // ûͷ
-                notify["sex"] = apply_info->sex;    // ûԱ
-                notify["nick"] = apply_info->nick;  // ûǳ
+                notify["icon"] = apply_info->icon;  // 用户头像
+                notify["sex"] = apply_info->sex;    // 用户性别
+                notify["nick"] = apply_info->nick;  // 用户昵称
             }
 
-            // תַ֪ͨ
+            // 转换成字符串并发送通知
             std::string return_str = notify.toStyledString();
             target_session->Send(return_str, ID_NOTIFY_ADD_FRIEND_REQ);
         }
-        return;  // ֱӷأΪѾڱش
+        return;  // 直接返回，因为已经在本地处理完毕
     }
 
 	
-    // gRPC
+    // 构建gRPC请求对象
     AddFriendReq add_req;
-    add_req.set_applyuid(uid);  // ߵUID
-    add_req.set_touid(touid);   // ýߵUID
-    add_req.set_name(applyname);  // ʱʹõ
-    add_req.set_desc("");        // ñעΪգ
+    add_req.set_applyuid(uid);  // 设置申请者的UID
+    add_req.set_touid(touid);   // 设置接收者的UID
+    add_req.set_name(applyname);  // 设置申请时使用的名称
+    add_req.set_desc("");        // 设置备注（这里为空）
 
-    // ȡûϢӦֶ   
+    // 如果获取到用户基本信息，则填充相应字段   
     if (b_info) {
-        add_req.set_icon(apply_info->icon);  // ûͷ
-        add_req.set_sex(apply_info->sex);    // ûԱ
-        add_req.set_nick(apply_info->nick);  // ûǳ
+        add_req.set_icon(apply_info->icon);  // 用户头像
+        add_req.set_sex(apply_info->sex);    // 用户性别
+        add_req.set_nick(apply_info->nick);  // 用户昵称
     }
 
-    // ͨgRPCͻ˷Ϳ֪ͨ
+    // 通过gRPC客户端发送跨服务器的通知
     ChatGrpcClient::GetInstance()->NotifyAddFriend(to_ip_value, add_req);
 
 }
 
 void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data) {
 	
-    // Json͸ڵ
+    // 创建Json解析器和根节点
     Json::Reader reader;
     Json::Value root;
 
-    // Ϣ
+    // 解析传入的消息数据
     if (!reader.parse(msg_data, root)) {
-        // ʧܣﴦ緵شӦͻ
-        // мܹɹ
+        // 如果解析失败，可以在这里处理错误，例如返回错误响应给客户端
+        // 本例中假设总是能够成功解析
         return;
     }
-    // JSONȡUIDUIDԼע
-    auto uid = root["fromuid"].asInt();         // ߵUID
-    auto touid = root["touid"].asInt();         // ߵUID
-    auto back_name = root["back"].asString();   // ע
+    // 从JSON中提取发送者UID、接收者UID以及备注名称
+    auto uid = root["fromuid"].asInt();         // 发送者的UID
+    auto touid = root["touid"].asInt();         // 接收者的UID
+    auto back_name = root["back"].asString();   // 备注名称
 
-    // ӡϢ
+    // 打印调试信息
     std::cout << "from " << uid << " auth friend to " << touid << std::endl;
 
-    // ӦJSON
+    // 构建响应JSON对象
     Json::Value rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;  // ôΪɹ
+    rtvalue["error"] = ErrorCodes::Success;  // 设置错误码为成功
 
-    // UserInfoָԴ洢ûϢ
+    // 创建UserInfo指针以存储用户信息
     auto user_info = std::make_shared<UserInfo>();
 
-    // RedisлȡߵûϢ
+    // 从Redis中获取接收者的用户基本信息
     std::string base_key = USER_BASE_INFO + std::to_string(touid);
-    bool b_info = GetBaseInfo(base_key, touid, user_info);  // ȡûϢ
+    bool b_info = GetBaseInfo(base_key, touid, user_info);  // 获取用户基本信息
     if (b_info) {
-        // ȡûϢӦֶ
-        rtvalue["name"] = user_info->name;  // û
-        rtvalue["nick"] = user_info->nick;  // ûǳ
-        rtvalue["icon"] = user_info->icon;  // ûͷ
-        rtvalue["sex"] = user_info->sex;    // ûԱ
-        rtvalue["uid"] = touid;             // ûUID
+        // 如果获取到用户基本信息，则填充相应字段
+        rtvalue["name"] = user_info->name;  // 用户名
+        rtvalue["nick"] = user_info->nick;  // 用户昵称
+        rtvalue["icon"] = user_info->icon;  // 用户头像
+        rtvalue["sex"] = user_info->sex;    // 用户性别
+        rtvalue["uid"] = touid;             // 用户UID
     } else {
-        // ûҵûϢô
+        // 如果没有找到用户信息，设置错误码
         rtvalue["error"] = ErrorCodes::UidInvalid;
     }
 
 
-    // ʹDeferģʽȷںǰͻ˷Ӧ
+    // 使用Defer模式确保在函数结束前向客户端发送响应
     Defer defer([this, &rtvalue, session]() {
-        std::string return_str = rtvalue.toStyledString();  // JSONתɸʽַ
-        session->Send(return_str, ID_AUTH_FRIEND_RSP);       // ͻ˷Ӧ
+        std::string return_str = rtvalue.toStyledString();  // 将JSON对象转换成格式化的字符串
+        session->Send(return_str, ID_AUTH_FRIEND_RSP);       // 向客户端发送响应
     });
 
-    // ݿ⣬¼֤ͨ
+    // 更新数据库，记录好友认证通过
     MysqlMgr::GetInstance()->AuthFriendApply(uid, touid);
 
-    // ݿ⣬Ӻѹϵ
+    // 更新数据库，添加好友关系
     MysqlMgr::GetInstance()->AddFriend(uid, touid, back_name);
 
-    // ѯRedisԲҽ߶ӦķIP
+    // 记录双方好友列表及认证方申请列表的变更
+    RecordApplyChange(uid, "update", touid, 1);
+    RecordFriendChange(uid, "add", touid);
+    RecordFriendChange(touid, "add", uid);
+
+    // 查询Redis以查找接收者对应的服务器IP
     auto to_str = std::to_string(touid);
-    auto to_ip_key = USERIPPREFIX + to_str;  // ϳɼ
-    std::string to_ip_value = "";            // 洢ѯ
-    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);  // ִвѯ
-    if (!b_ip) {  // ûҵӦIPַ
-        // Ӵ߼ô벢
+    auto to_ip_key = USERIPPREFIX + to_str;  // 组合成键
+    std::string to_ip_value = "";            // 存储查询结果
+    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);  // 执行查询
+    if (!b_ip) {  // 如果没有找到对应的IP地址
+        // 可以在这里添加错误处理逻辑，例如设置错误码并返回
         return;
     }
 
-    // ȡǰ
+    // 获取当前服务器配置
     auto& cfg = ConfigMgr::Inst();
-    auto self_name = cfg["SelfServer"]["Name"];  // ǰ
+    auto self_name = cfg["SelfServer"]["Name"];  // 当前服务器名称
 
-    // Ƿͬһ
+    // 检查接收者是否在同一服务器上
     if (to_ip_value == self_name) {
-        // ͬһֱӻȡỰϢ
+        // 在同一服务器上直接获取会话并发送消息
         auto target_session = UserMgr::GetInstance()->GetSession(touid);
         if (target_session) {
-            // ֪ͨJSON
+            // 构建通知JSON对象
             Json::Value notify;
             notify["error"] = ErrorCodes::Success;
-            notify["fromuid"] = uid;  // ߵUID
-            notify["touid"] = touid;   // ߵUID
+            notify["fromuid"] = uid;  // 发送者的UID
+            notify["touid"] = touid;   // 接收者的UID
 
-            // RedisлȡߵûϢ
+            // 从Redis中获取发送者的用户基本信息
             std::string base_key = USER_BASE_INFO + std::to_string(uid);
             auto user_info = std::make_shared<UserInfo>();
-            bool b_info = GetBaseInfo(base_key, uid, user_info);  // ȡûϢ
+            bool b_info = GetBaseInfo(base_key, uid, user_info);  // 获取用户基本信息
             if (b_info) {
-                notify["name"] = user_info->name;  // û
-                notify["nick"] = user_info->nick;  // ûǳ
-                notify["icon"] = user_info->icon;  // ûͷ
-                notify["sex"] = user_info->sex;    // ûԱ
+                notify["name"] = user_info->name;  // 用户名
+                notify["nick"] = user_info->nick;  // 用户昵称
+                notify["icon"] = user_info->icon;  // 用户头像
+                notify["sex"] = user_info->sex;    // 用户性别
             } else {
                 notify["error"] = ErrorCodes::UidInvalid;
             }
 
-            // תַ֪ͨ
+            // 转换成字符串并发送通知
             std::string return_str = notify.toStyledString();
             target_session->Send(return_str, ID_NOTIFY_AUTH_FRIEND_REQ);
         }
-        return;  // ֱӷأΪѾڱش
+        return;  // 直接返回，因为已经在本地处理完毕
     }
 
 
-    // gRPC
+    // 构建gRPC请求对象
     AuthFriendReq auth_req;
-    auth_req.set_fromuid(uid);  // ÷ߵUID
-    auth_req.set_touid(touid);  // ýߵUID
+    auth_req.set_fromuid(uid);  // 设置发送者的UID
+    auth_req.set_touid(touid);  // 设置接收者的UID
 
-    // ͨgRPCͻ˷Ϳ֪ͨ
+    // 通过gRPC客户端发送跨服务器的通知
     ChatGrpcClient::GetInstance()->NotifyAuthFriend(to_ip_value, auth_req);
 }
 
 void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data) {
-    // Json͸ڵ
+    // 创建Json解析器和根节点
     Json::Reader reader;
     Json::Value root;
 
-    // Ϣ
+    // 解析传入的消息数据
     if (!reader.parse(msg_data, root)) {
-        // ʧܣﴦ緵شӦͻ
-        // мܹɹ
+        // 如果解析失败，可以在这里处理错误，例如返回错误响应给客户端
+        // 本例中假设总是能够成功解析
         return;
     }
 
-    // JSONȡUIDUIDԼϢ
+    // 从JSON中提取发送者UID、接收者UID以及消息数组
     auto uid = root["fromuid"].asInt();
     auto touid = root["touid"].asInt();
     const Json::Value arrays = root["text_array"];
 	
-    // ӦJSON
+    // 构建通知接收者的JSON对象
     Json::Value rtvalue;
-    rtvalue["error"] = ErrorCodes::Success;  // ôΪɹ
-    rtvalue["text_array"] = arrays;          // ԭʼı鸴ƵӦ
-    rtvalue["fromuid"] = uid;                // ߵUID
-    rtvalue["touid"] = touid;                // ߵUID
-
-
-    // ʹDeferģʽȷںǰͻ˷Ӧ
-    Defer defer([this, &rtvalue, session]() {
-        std::string return_str = rtvalue.toStyledString();  // JSONתɸʽַ
-        session->Send(return_str, ID_TEXT_CHAT_MSG_RSP);    // ͻ˷Ӧ
+    rtvalue["error"] = ErrorCodes::Success;  // 设置错误码为成功
+    rtvalue["text_array"] = arrays;          // 原始文本数组转发给接收者
+    rtvalue["fromuid"] = uid;                // 发送者的UID
+    rtvalue["touid"] = touid;                // 接收者的UID
+
+    // 按会话分配递增的序号，两个方向的消息共用一个序号空间
+    auto conv_key = uid < touid ? std::to_string(uid) + "_" + std::to_string(touid)
+        : std::to_string(touid) + "_" + std::to_string(uid);
+    long long last_seq = 0;
+    RedisMgr::GetInstance()->HIncrBy(MSG_SEQ, conv_key, arrays.size(), last_seq);
+    long long ts = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    // 使用Defer模式确保在函数结束前给发送者回确认
+    // 确认只带msgid、序号和时间戳，不再回显整个消息数组，由会话合并后发送
+    Defer defer([session, arrays, last_seq, ts]() {
+        // 分配序号失败时序号为0，客户端只按msgid确认
+        long long seq = last_seq > 0 ? last_seq - arrays.size() + 1 : 0;
+        for (const auto& txt_obj : arrays) {
+            session->SendAck(txt_obj["msgid"].asString(), seq, ts);
+            if (seq > 0) {
+                ++seq;
+            }
+        }
     });
 
-    // ѯRedisԲҽ߶ӦķIP
+    // 查询Redis以查找接收者对应的服务器IP
     auto to_str = std::to_string(touid);
-    auto to_ip_key = USERIPPREFIX + to_str;  // ϳɼ
-    std::string to_ip_value = "";            // 洢ѯ
-    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);  // ִвѯ
-    if (!b_ip) {  // ûҵӦIPַ
-        // Ӵ߼ô벢
+    auto to_ip_key = USERIPPREFIX + to_str;  // 组合成键
+    std::string to_ip_value = "";            // 存储查询结果
+    bool b_ip = RedisMgr::GetInstance()->Get(to_ip_key, to_ip_value);  // 执行查询
+    if (!b_ip) {  // 如果没有找到对应的IP地址
+        // 可以在这里添加错误处理逻辑，例如设置错误码并返回
         return;
     }
 
-    // ȡǰ
+    // 获取当前服务器配置
     auto& cfg = ConfigMgr::Inst();
-    auto self_name = cfg["SelfServer"]["Name"];  // ǰ
+    auto self_name = cfg["SelfServer"]["Name"];  // 当前服务器名称
 
-    // Ƿͬһ
+    // 检查接收者是否在同一服务器上
     if (to_ip_value == self_name) {
-        // ͬһֱӻȡỰϢ
+        // 在同一服务器上直接获取会话并发送消息
         auto target_session = UserMgr::GetInstance()->GetSession(touid);
         if (target_session) {
-            std::string return_str = rtvalue.toStyledString();  // תַ
-            target_session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);  // ֪ͨ
+            std::string return_str = rtvalue.toStyledString();  // 转换成字符串
+            target_session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);  // 发送通知
         }
-        return;  // ֱӷأΪѾڱش
+        return;  // 直接返回，因为已经在本地处理完毕
     }
 
 
-    // gRPC
+    // 构建gRPC请求对象
     TextChatMsgReq text_msg_req;
-    text_msg_req.set_fromuid(uid);  // ÷UID
-    text_msg_req.set_touid(touid);  // ýUID
-    // ϢݵgRPC
+    text_msg_req.set_fromuid(uid);  // 设置发送者UID
+    text_msg_req.set_touid(touid);  // 设置接收者UID
+    // 复制消息内容到gRPC请求对象
     for (const auto& txt_obj : arrays) {
-        auto content = txt_obj["content"].asString();  // Ϣ
-        auto msgid = txt_obj["msgid"].asString();      // ϢID
+        auto content = txt_obj["content"].asString();  // 消息内容
+        auto msgid = txt_obj["msgid"].asString();      // 消息ID
         std::cout << "content is " << content << std::endl;
         std::cout << "msgid is " << msgid << std::endl;
 
-        // ӵϢgRPC
+        // 添加单条消息到gRPC请求对象
         auto *text_msg = text_msg_req.add_textmsgs();
         text_msg->set_msgid(msgid);
         text_msg->set_msgcontent(content);
@@ -521,13 +493,27 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 
 
 
-	//֪ͨ todo...
-	// ͨgRPCͻ˷Ϳ֪ͨ
+	//发送通知 todo...
+	// 通过gRPC客户端发送跨服务器的通知
 	ChatGrpcClient::GetInstance()->NotifyTextChatMsg(to_ip_value, text_msg_req, rtvalue);
 }
 
 
 
+void LogicSystem::DeliverOfflineMsgs(int uid, std::shared_ptr<CSession> session) {
+	// 只删除已经读出来的部分，读取之后新转存的消息留到下次登录
+	auto key = OFFLINE_MSG_PREFIX + std::to_string(uid);
+	std::vector<std::string> msgs;
+	if (!RedisMgr::GetInstance()->LRange(key, 0, -1, msgs) || msgs.empty()) {
+		return;
+	}
+	for (auto& msg : msgs) {
+		session->Send(msg, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+	}
+	RedisMgr::GetInstance()->LTrim(key, static_cast<int>(msgs.size()), -1);
+	std::cout << "deliver " << msgs.size() << " offline msgs to uid " << uid << std::endl;
+}
+
 bool LogicSystem::isPureDigit(const std::string& str)
 {
 	for (char c : str) {
@@ -544,7 +530,7 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 
 	std::string base_key = USER_BASE_INFO + uid_str;
 
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -574,8 +560,8 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 	}
 
 	auto uid = std::stoi(uid_str);
-	//redisûѯmysql
-	//ѯݿ
+	//redis中没有则查询mysql
+	//查询数据库
 	std::shared_ptr<UserInfo> user_info = nullptr;
 	user_info = MysqlMgr::GetInstance()->GetUser(uid);
 	if (user_info == nullptr) {
@@ -583,7 +569,7 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 		return;
 	}
 
-	//ݿдredis
+	//将数据库内容写入redis缓存
 	Json::Value redis_root;
 	redis_root["uid"] = user_info->uid;
 	redis_root["pwd"] = user_info->pwd;
@@ -596,7 +582,7 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 
 	RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
 
-	//
+	//返回数据
 	rtvalue["uid"] = user_info->uid;
 	rtvalue["pwd"] = user_info->pwd;
 	rtvalue["name"] = user_info->name;
@@ -613,7 +599,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 
 	std::string base_key = NAME_INFO + name;
 
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -640,8 +626,8 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 		return;
 	}
 
-	//redisûѯmysql
-	//ѯݿ
+	//redis中没有则查询mysql
+	//查询数据库
 	std::shared_ptr<UserInfo> user_info = nullptr;
 	user_info = MysqlMgr::GetInstance()->GetUser(name);
 	if (user_info == nullptr) {
@@ -649,7 +635,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 		return;
 	}
 
-	//ݿдredis
+	//将数据库内容写入redis缓存
 	Json::Value redis_root;
 	redis_root["uid"] = user_info->uid;
 	redis_root["pwd"] = user_info->pwd;
@@ -661,7 +647,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 
 	RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
 	
-	//
+	//返回数据
 	rtvalue["uid"] = user_info->uid;
 	rtvalue["pwd"] = user_info->pwd;
 	rtvalue["name"] = user_info->name;
@@ -673,63 +659,315 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 
 bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
 {
-    // ȴ Redis вѯûϢ
-    std::string info_str = ""; // ڴ洢 Redis ȡûϢַ
-    bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str); //  Redis ȡûϢ
-    if (b_base) { // ɹȡûϢ
-        Json::Reader reader; //  JSON 
-        Json::Value root; //  JSON ֵ
-        reader.parse(info_str, root); // ȡ JSON ַ
+    // 优先从 Redis 中查询用户信息
+    std::string info_str = ""; // 用于存储从 Redis 获取的用户信息字符串
+    bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str); // 从 Redis 获取用户信息
+    if (b_base) { // 如果成功获取到用户信息
+        Json::Reader reader; // 创建 JSON 解析器
+        Json::Value root; // 创建 JSON 值对象
+        reader.parse(info_str, root); // 解析获取的 JSON 字符串
         
-        // Ϣ䵽 userinfo 
-        userinfo->uid = root["uid"].asInt(); // û ID
-        userinfo->name = root["name"].asString(); // û
-        userinfo->pwd = root["pwd"].asString(); // û
-        userinfo->email = root["email"].asString(); // û
-        userinfo->nick = root["nick"].asString(); // ûǳ
-        userinfo->desc = root["desc"].asString(); // û
-        userinfo->sex = root["sex"].asInt(); // ûԱ
-        userinfo->icon = root["icon"].asString(); // ûͷ
+        // 将解析后的信息填充到 userinfo 对象中
+        userinfo->uid = root["uid"].asInt(); // 用户 ID
+        userinfo->name = root["name"].asString(); // 用户姓名
+        userinfo->pwd = root["pwd"].asString(); // 用户密码
+        userinfo->email = root["email"].asString(); // 用户邮箱
+        userinfo->nick = root["nick"].asString(); // 用户昵称
+        userinfo->desc = root["desc"].asString(); // 用户描述
+        userinfo->sex = root["sex"].asInt(); // 用户性别
+        userinfo->icon = root["icon"].asString(); // 用户头像
         
-        // ӡû¼Ϣ
+        // 打印用户登录信息
         std::cout << "user login uid is  " << userinfo->uid << " name  is "
                   << userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
     }
     else {
-        //  Redis ûϢѯ MySQL ݿ
-        std::shared_ptr<UserInfo> user_info = nullptr; // ָûϢָ
-        user_info = MysqlMgr::GetInstance()->GetUser(uid); // ݿлȡûϢ
-        if (user_info == nullptr) { // ݿлȡʧ
-            return false; //  falseʾδҵûϢ
+        // 如果 Redis 中没有信息，则查询 MySQL 数据库
+        std::shared_ptr<UserInfo> user_info = nullptr; // 创建指向用户信息的智能指针
+        user_info = MysqlMgr::GetInstance()->GetUser(uid); // 从数据库中获取用户信息
+        if (user_info == nullptr) { // 如果从数据库中获取失败
+            return false; // 返回 false，表示未找到用户信息
         }
 
-        userinfo = user_info; // ݿȡûϢֵ userinfo
-
-        // ݿед Redis 
-        Json::Value redis_root; // ڴ洢 Redis  JSON ֵ
-        redis_root["uid"] = uid; // û ID
-        redis_root["pwd"] = userinfo->pwd; // û
-        redis_root["name"] = userinfo->name; // û
-        redis_root["email"] = userinfo->email; // û
-        redis_root["nick"] = userinfo->nick; // ûǳ
-        redis_root["desc"] = userinfo->desc; // û
-        redis_root["sex"] = userinfo->sex; // ûԱ
-        redis_root["icon"] = userinfo->icon; // ûͷ
-
-        // ûϢд Redis
-        RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString()); //  JSON תΪַ Redis
+        userinfo = user_info; // 将从数据库获取的用户信息赋值给 userinfo
+
+        // 将数据库中的内容写入 Redis 缓存
+        Json::Value redis_root; // 创建用于存储 Redis 的 JSON 值对象
+        redis_root["uid"] = uid; // 用户 ID
+        redis_root["pwd"] = userinfo->pwd; // 用户密码
+        redis_root["name"] = userinfo->name; // 用户姓名
+        redis_root["email"] = userinfo->email; // 用户邮箱
+        redis_root["nick"] = userinfo->nick; // 用户昵称
+        redis_root["desc"] = userinfo->desc; // 用户描述
+        redis_root["sex"] = userinfo->sex; // 用户性别
+        redis_root["icon"] = userinfo->icon; // 用户头像
+
+        // 将用户信息写入 Redis
+        RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString()); // 将 JSON 对象转换为字符串并存入 Redis
     }
 
-    return true; //  trueʾɹȡûϢ
+    return true; // 返回 true，表示成功获取用户基本信息
 }
 
 
 bool LogicSystem::GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>> &list) {
-	//mysqlȡб
+	//从mysql获取好友申请列表
 	return MysqlMgr::GetInstance()->GetApplyList(to_uid, list, 0, 10);
 }
 
 bool LogicSystem::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>>& user_list) {
-	//mysqlȡб
+	//从mysql获取好友列表
 	return MysqlMgr::GetInstance()->GetFriendList(self_id, user_list);
 }
+
+void LogicSystem::FillApplySync(int uid, const Json::Value& root, Json::Value& rtvalue) {
+	auto cur_ver = GetSyncVer(APPLY_VER_PREFIX + std::to_string(uid));
+	rtvalue["apply_ver"] = cur_ver;
+
+	//客户端带了版本号，尝试下发增量
+	if (root.isMember("apply_ver")) {
+		auto client_ver = root["apply_ver"].asInt();
+		if (client_ver == cur_ver) {
+			rtvalue["apply_sync"] = "none";
+			return;
+		}
+
+		std::vector<Json::Value> entries;
+		if (GetSyncLog(APPLY_LOG_PREFIX + std::to_string(uid), client_ver, cur_ver, entries)) {
+			//同一个申请人只保留最后一次变更
+			std::map<int, int> apply_status;
+			for (auto& entry : entries) {
+				apply_status[entry["uid"].asInt()] = entry["status"].asInt();
+			}
+
+			rtvalue["apply_sync"] = "delta";
+			rtvalue["apply_list"] = Json::arrayValue;
+			for (auto& apply : apply_status) {
+				auto user_info = std::make_shared<UserInfo>();
+				if (!GetBaseInfo(USER_BASE_INFO + std::to_string(apply.first), apply.first, user_info)) {
+					continue;
+				}
+				Json::Value obj;
+				obj["name"] = user_info->name;
+				obj["uid"] = apply.first;
+				obj["icon"] = user_info->icon;
+				obj["nick"] = user_info->nick;
+				obj["sex"] = user_info->sex;
+				obj["desc"] = user_info->desc;
+				obj["status"] = apply.second;
+				rtvalue["apply_list"].append(obj);
+			}
+			return;
+		}
+	}
+
+	//版本过旧或者首次登录，下发全量
+	rtvalue["apply_sync"] = "full";
+	std::vector<std::shared_ptr<ApplyInfo>> apply_list;
+	auto b_apply = GetFriendApplyInfo(uid, apply_list);
+	if (b_apply) {
+		for (auto& apply : apply_list) {
+			Json::Value obj;
+			obj["name"] = apply->_name;
+			obj["uid"] = apply->_uid;
+			obj["icon"] = apply->_icon;
+			obj["nick"] = apply->_nick;
+			obj["sex"] = apply->_sex;
+			obj["desc"] = apply->_desc;
+			obj["status"] = apply->_status;
+			rtvalue["apply_list"].append(obj);
+		}
+	}
+}
+
+void LogicSystem::FillFriendSync(int uid, const Json::Value& root, Json::Value& rtvalue) {
+	auto cur_ver = GetSyncVer(FRIEND_VER_PREFIX + std::to_string(uid));
+	rtvalue["friend_ver"] = cur_ver;
+
+	if (root.isMember("friend_ver")) {
+		auto client_ver = root["friend_ver"].asInt();
+		if (client_ver == cur_ver) {
+			rtvalue["friend_sync"] = "none";
+			return;
+		}
+
+		std::vector<Json::Value> entries;
+		if (GetSyncLog(FRIEND_LOG_PREFIX + std::to_string(uid), client_ver, cur_ver, entries)) {
+			//按版本顺序回放，得到新增/变更和删除的好友
+			std::set<int> upsert_set;
+			std::set<int> del_set;
+			for (auto& entry : entries) {
+				auto peer_uid = entry["uid"].asInt();
+				if (entry["op"].asString() == "del") {
+					upsert_set.erase(peer_uid);
+					del_set.insert(peer_uid);
+					continue;
+				}
+				del_set.erase(peer_uid);
+				upsert_set.insert(peer_uid);
+			}
+
+			//备注名存在好友关系上，不在用户资料里，从好友表取；取不到时退回全量同步
+			std::vector<std::shared_ptr<UserInfo>> friend_list;
+			if (upsert_set.empty() || GetFriendList(uid, friend_list)) {
+				std::map<int, std::string> back_map;
+				for (auto& friend_ele : friend_list) {
+					back_map[friend_ele->uid] = friend_ele->back;
+				}
+				rtvalue["friend_sync"] = "delta";
+				rtvalue["friend_list"] = Json::arrayValue;
+				rtvalue["friend_del"] = Json::arrayValue;
+				for (auto peer_uid : upsert_set) {
+					auto back_iter = back_map.find(peer_uid);
+					if (back_iter == back_map.end()) {
+						continue;
+					}
+					auto user_info = std::make_shared<UserInfo>();
+					if (!GetBaseInfo(USER_BASE_INFO + std::to_string(peer_uid), peer_uid, user_info)) {
+						continue;
+					}
+					Json::Value obj;
+					obj["name"] = user_info->name;
+					obj["uid"] = peer_uid;
+					obj["icon"] = user_info->icon;
+					obj["nick"] = user_info->nick;
+					obj["sex"] = user_info->sex;
+					obj["desc"] = user_info->desc;
+					obj["back"] = back_iter->second;
+					rtvalue["friend_list"].append(obj);
+				}
+
+				for (auto peer_uid : del_set) {
+					rtvalue["friend_del"].append(peer_uid);
+				}
+				return;
+			}
+		}
+	}
+
+	rtvalue["friend_sync"] = "full";
+	std::vector<std::shared_ptr<UserInfo>> friend_list;
+	bool b_friend_list = GetFriendList(uid, friend_list);
+	for (auto& friend_ele : friend_list) {
+		Json::Value obj;
+		obj["name"] = friend_ele->name;
+		obj["uid"] = friend_ele->uid;
+		obj["icon"] = friend_ele->icon;
+		obj["nick"] = friend_ele->nick;
+		obj["sex"] = friend_ele->sex;
+		obj["desc"] = friend_ele->desc;
+		obj["back"] = friend_ele->back;
+		rtvalue["friend_list"].append(obj);
+	}
+}
+
+void LogicSystem::RecordApplyChange(int uid, const std::string& op, int peer_uid, int status) {
+	Json::Value entry;
+	entry["op"] = op;
+	entry["uid"] = peer_uid;
+	entry["status"] = status;
+	auto uid_str = std::to_string(uid);
+	RecordSyncChange(APPLY_VER_PREFIX + uid_str, APPLY_LOG_PREFIX + uid_str, entry);
+}
+
+void LogicSystem::RecordFriendChange(int uid, const std::string& op, int peer_uid) {
+	Json::Value entry;
+	entry["op"] = op;
+	entry["uid"] = peer_uid;
+	auto uid_str = std::to_string(uid);
+	RecordSyncChange(FRIEND_VER_PREFIX + uid_str, FRIEND_LOG_PREFIX + uid_str, entry);
+}
+
+void LogicSystem::RecordProfileChange(int uid) {
+	std::vector<std::shared_ptr<UserInfo>> friend_list;
+	if (!GetFriendList(uid, friend_list)) {
+		return;
+	}
+
+	// 好友的增量同步按uid重新读取基本信息，记一条upd即可，不需要带上资料内容
+	for (auto& friend_ele : friend_list) {
+		RecordFriendChange(friend_ele->uid, "upd", uid);
+	}
+}
+
+void LogicSystem::CheckProfileChange(int uid, const std::shared_ptr<UserInfo>& user_info) {
+	Json::Value profile;
+	profile["name"] = user_info->name;
+	profile["nick"] = user_info->nick;
+	profile["icon"] = user_info->icon;
+	profile["desc"] = user_info->desc;
+	profile["sex"] = user_info->sex;
+	Json::FastWriter writer;
+	auto profile_str = writer.write(profile);
+
+	auto profile_key = USER_PROFILE_PREFIX + std::to_string(uid);
+	std::string last_str = "";
+	bool b_last = RedisMgr::GetInstance()->Get(profile_key, last_str);
+	if (b_last && last_str == profile_str) {
+		return;
+	}
+
+	RedisMgr::GetInstance()->Set(profile_key, profile_str);
+	// 第一次登录没有记录，不算修改
+	if (b_last) {
+		std::cout << "user " << uid << " profile changed, record friend sync" << endl;
+		RecordProfileChange(uid);
+	}
+}
+
+void LogicSystem::RecordSyncChange(const std::string& ver_key, const std::string& log_key, Json::Value entry) {
+	long long ver = 0;
+	if (!RedisMgr::GetInstance()->Incr(ver_key, ver)) {
+		return;
+	}
+
+	entry["ver"] = (int)ver;
+	Json::FastWriter writer;
+	RedisMgr::GetInstance()->RPush(log_key, writer.write(entry));
+	//只保留最近的变更，更早的版本直接走全量
+	RedisMgr::GetInstance()->LTrim(log_key, -MAX_SYNC_LOG_LEN, -1);
+}
+
+int LogicSystem::GetSyncVer(const std::string& ver_key) {
+	std::string ver_str = "";
+	if (!RedisMgr::GetInstance()->Get(ver_key, ver_str) || ver_str.empty()) {
+		return 0;
+	}
+
+	return std::stoi(ver_str);
+}
+
+bool LogicSystem::GetSyncLog(const std::string& log_key, int client_ver, int cur_ver, std::vector<Json::Value>& entries) {
+	//客户端版本比服务器还新(比如redis被清空)，只能下发全量
+	if (client_ver <= 0 || client_ver > cur_ver) {
+		return false;
+	}
+
+	std::vector<std::string> values;
+	if (!RedisMgr::GetInstance()->LRange(log_key, 0, -1, values)) {
+		return false;
+	}
+
+	std::map<int, Json::Value> ver_entries;
+	Json::Reader reader;
+	for (auto& value : values) {
+		Json::Value entry;
+		if (!reader.parse(value, entry)) {
+			continue;
+		}
+		auto ver = entry["ver"].asInt();
+		if (ver > client_ver && ver <= cur_ver) {
+			ver_entries[ver] = entry;
+		}
+	}
+
+	//日志必须完整覆盖 (client_ver, cur_ver]，否则说明被裁剪过或者还有写入未完成
+	if ((int)ver_entries.size() != cur_ver - client_ver) {
+		return false;
+	}
+
+	for (auto& ver_entry : ver_entries) {
+		entries.push_back(ver_entry.second);
+	}
+	return true;
+}
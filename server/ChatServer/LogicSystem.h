@@ -5,6 +5,7 @@
 #include "CSession.h"
 #include <queue>
 #include <map>
+#include <set>
 #include <functional>
 #include "const.h"
 #include <json/json.h>
@@ -12,8 +13,7 @@
 #include <json/reader.h>
 #include <unordered_map>
 #include "data.h"
-
-typedef  function<void(shared_ptr<CSession>, const short &msg_id, const string &msg_data)> FunCallBack;
+#include "LogicQueue.h"
 
 class LogicSystem:public Singleton<LogicSystem>
 {
@@ -21,26 +21,39 @@ class LogicSystem:public Singleton<LogicSystem>
 public:
 	~LogicSystem();
 	void PostMsgToQue(shared_ptr < LogicNode> msg);
+	// 等待队列中的消息全部处理完
+	void WaitIdle();
+	// 注册消息处理函数，已注册的id会被覆盖
+	void RegisterCallBack(short msg_id, FunCallBack callback);
+	// 用户资料(name、nick、icon、desc、sex)修改后调用，给每个好友记一条变更，好友下次登录增量同步时拿到新资料
+	void RecordProfileChange(int uid);
 private:
 	LogicSystem();
-	void DealMsg();
 	void RegisterCallBacks();
 	void LoginHandler(shared_ptr<CSession> session, const short &msg_id, const string &msg_data);
 	void SearchInfo(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	void AddFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	void AuthFriendApply(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
 	void DealChatTextMsg(std::shared_ptr<CSession> session, const short& msg_id, const string& msg_data);
+	// 对端不可用时转存的聊天消息，登录成功后下发
+	void DeliverOfflineMsgs(int uid, std::shared_ptr<CSession> session);
 	bool isPureDigit(const std::string& str);
 	void GetUserByUid(std::string uid_str, Json::Value& rtvalue);
 	void GetUserByName(std::string name, Json::Value& rtvalue);
 	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo> &userinfo);
 	bool GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>>& list);
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>> & user_list);
-	std::thread _worker_thread;
-	std::queue<shared_ptr<LogicNode>> _msg_que;
-	std::mutex _mutex;
-	std::condition_variable _consume;
-	bool _b_stop;
-	std::map<short, FunCallBack> _fun_callbacks;
+	//好友列表、申请列表增量同步
+	void FillApplySync(int uid, const Json::Value& root, Json::Value& rtvalue);
+	void FillFriendSync(int uid, const Json::Value& root, Json::Value& rtvalue);
+	void RecordApplyChange(int uid, const std::string& op, int peer_uid, int status);
+	void RecordFriendChange(int uid, const std::string& op, int peer_uid);
+	// 登录时和上次登录的资料比较，资料在别处被修改过时补记好友的变更
+	void CheckProfileChange(int uid, const std::shared_ptr<UserInfo>& user_info);
+	void RecordSyncChange(const std::string& ver_key, const std::string& log_key, Json::Value entry);
+	int GetSyncVer(const std::string& ver_key);
+	bool GetSyncLog(const std::string& log_key, int client_ver, int cur_ver, std::vector<Json::Value>& entries);
+	// 消息队列和分发，处理函数在构造时注册
+	LogicQueue _queue;
 };
 
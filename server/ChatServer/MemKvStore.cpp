@@ -0,0 +1,469 @@
+#include "MemKvStore.h"
+#include <iostream>
+#include <cstdlib>
+#include <cerrno>
+#include <algorithm>
+
+MemKvStore::KvEntry::KvEntry(KvType type) : _type(type), _b_expire(false) {
+	if (type == KV_LIST) {
+		_list.reset(new std::deque<std::string>());
+	}
+	else if (type == KV_HASH) {
+		_hash.reset(new std::unordered_map<std::string, std::string>());
+	}
+	else if (type == KV_STREAM) {
+		_stream.reset(new KvStream());
+	}
+}
+
+// 和redis一样，只接受完整的十进制整数
+static bool ParseInteger(const std::string& str, long long& value) {
+	if (str.empty()) {
+		return false;
+	}
+
+	char* end = nullptr;
+	errno = 0;
+	value = strtoll(str.c_str(), &end, 10);
+	return errno == 0 && end == str.c_str() + str.size();
+}
+
+MemKvStore::MemKvStore(size_t shard_count) : _b_stop(false) {
+	size_t count = 1;
+	while (count < shard_count) {
+		count <<= 1;
+	}
+	for (size_t i = 0; i < count; ++i) {
+		_shards.emplace_back(new KvShard());
+	}
+	_shard_mask = count - 1;
+
+	_sweep_thread = std::thread([this]() {
+		while (!_b_stop) {
+			std::this_thread::sleep_for(std::chrono::seconds(1));
+			SweepExpired();
+		}
+	});
+	std::cout << "mem kv store start with " << count << " shards" << std::endl;
+}
+
+MemKvStore::~MemKvStore() {
+	Close();
+}
+
+void MemKvStore::Close() {
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+	// 唤醒阻塞在XRead上的线程
+	for (auto& shard : _shards) {
+		std::lock_guard<std::mutex> lock(shard->_mutex);
+		shard->_cond.notify_all();
+	}
+	if (_sweep_thread.joinable()) {
+		_sweep_thread.join();
+	}
+}
+
+MemKvStore::KvShard& MemKvStore::GetShard(const std::string& key) {
+	return *_shards[std::hash<std::string>()(key) & _shard_mask];
+}
+
+MemKvStore::KvEntry* MemKvStore::Find(KvShard& shard, const std::string& key) {
+	auto iter = shard._map.find(key);
+	if (iter == shard._map.end()) {
+		return nullptr;
+	}
+
+	if (iter->second._b_expire && iter->second._expire <= KvClock::now()) {
+		shard._map.erase(iter);
+		return nullptr;
+	}
+	return &iter->second;
+}
+
+MemKvStore::KvEntry* MemKvStore::FindOrCreate(KvShard& shard, const std::string& key, KvType type) {
+	auto* entry = Find(shard, key);
+	if (entry == nullptr) {
+		auto result = shard._map.emplace(key, KvEntry(type));
+		return &result.first->second;
+	}
+
+	if (entry->_type != type) {
+		return nullptr;
+	}
+	return entry;
+}
+
+bool MemKvStore::NormalizeRange(long long size, int start, int stop, long long& begin, long long& end) {
+	begin = start < 0 ? size + start : start;
+	end = stop < 0 ? size + stop : stop;
+	if (begin < 0) {
+		begin = 0;
+	}
+	if (end >= size) {
+		end = size - 1;
+	}
+	return begin <= end && begin < size;
+}
+
+bool MemKvStore::Get(const std::string& key, std::string& value) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr || entry->_type != KV_STRING) {
+		return false;
+	}
+
+	value = entry->_str;
+	return true;
+}
+
+bool MemKvStore::Set(const std::string& key, const std::string& value) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	// SET会覆盖任意类型的旧值并清除过期时间
+	KvEntry entry(KV_STRING);
+	entry._str = value;
+	auto iter = shard._map.find(key);
+	if (iter == shard._map.end()) {
+		shard._map.emplace(key, std::move(entry));
+	}
+	else {
+		iter->second = std::move(entry);
+	}
+	return true;
+}
+
+bool MemKvStore::Push(const std::string& key, const std::string& value, bool b_left) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = FindOrCreate(shard, key, KV_LIST);
+	if (entry == nullptr) {
+		return false;
+	}
+
+	if (b_left) {
+		entry->_list->push_front(value);
+	}
+	else {
+		entry->_list->push_back(value);
+	}
+	return true;
+}
+
+bool MemKvStore::Pop(const std::string& key, std::string& value, bool b_left) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr || entry->_type != KV_LIST || entry->_list->empty()) {
+		return false;
+	}
+
+	auto& list = *entry->_list;
+	if (b_left) {
+		value = std::move(list.front());
+		list.pop_front();
+	}
+	else {
+		value = std::move(list.back());
+		list.pop_back();
+	}
+	// 列表空了键也随之删除
+	if (list.empty()) {
+		shard._map.erase(key);
+	}
+	return true;
+}
+
+bool MemKvStore::LPush(const std::string& key, const std::string& value) {
+	return Push(key, value, true);
+}
+
+bool MemKvStore::LPop(const std::string& key, std::string& value) {
+	return Pop(key, value, true);
+}
+
+bool MemKvStore::RPush(const std::string& key, const std::string& value) {
+	return Push(key, value, false);
+}
+
+bool MemKvStore::RPop(const std::string& key, std::string& value) {
+	return Pop(key, value, false);
+}
+
+bool MemKvStore::LRange(const std::string& key, int start, int stop, std::vector<std::string>& values) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr) {
+		return true;
+	}
+	if (entry->_type != KV_LIST) {
+		return false;
+	}
+
+	auto& list = *entry->_list;
+	long long begin = 0;
+	long long end = 0;
+	if (!NormalizeRange(static_cast<long long>(list.size()), start, stop, begin, end)) {
+		return true;
+	}
+	values.insert(values.end(), list.begin() + begin, list.begin() + end + 1);
+	return true;
+}
+
+bool MemKvStore::LTrim(const std::string& key, int start, int stop) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr) {
+		return true;
+	}
+	if (entry->_type != KV_LIST) {
+		return false;
+	}
+
+	auto& list = *entry->_list;
+	long long begin = 0;
+	long long end = 0;
+	if (!NormalizeRange(static_cast<long long>(list.size()), start, stop, begin, end)) {
+		shard._map.erase(key);
+		return true;
+	}
+	list.erase(list.begin() + end + 1, list.end());
+	list.erase(list.begin(), list.begin() + begin);
+	return true;
+}
+
+bool MemKvStore::Incr(const std::string& key, long long& value) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = FindOrCreate(shard, key, KV_STRING);
+	if (entry == nullptr) {
+		return false;
+	}
+
+	long long current = 0;
+	if (!entry->_str.empty() && !ParseInteger(entry->_str, current)) {
+		return false;
+	}
+	value = current + 1;
+	entry->_str = std::to_string(value);
+	return true;
+}
+
+bool MemKvStore::HIncrBy(const std::string& key, const std::string& hkey, long long delta, long long& value) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = FindOrCreate(shard, key, KV_HASH);
+	if (entry == nullptr) {
+		return false;
+	}
+
+	auto& field = (*entry->_hash)[hkey];
+	long long current = 0;
+	if (!field.empty() && !ParseInteger(field, current)) {
+		return false;
+	}
+	value = current + delta;
+	field = std::to_string(value);
+	return true;
+}
+
+bool MemKvStore::HSet(const std::string& key, const std::string& hkey, const std::string& value) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = FindOrCreate(shard, key, KV_HASH);
+	if (entry == nullptr) {
+		return false;
+	}
+
+	(*entry->_hash)[hkey] = value;
+	return true;
+}
+
+bool MemKvStore::HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen) {
+	return HSet(std::string(key), std::string(hkey), std::string(hvalue, hvaluelen));
+}
+
+std::string MemKvStore::HGet(const std::string& key, const std::string& hkey) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr || entry->_type != KV_HASH) {
+		return "";
+	}
+
+	auto iter = entry->_hash->find(hkey);
+	if (iter == entry->_hash->end()) {
+		return "";
+	}
+	return iter->second;
+}
+
+bool MemKvStore::HDel(const std::string& key, const std::string& field) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr || entry->_type != KV_HASH) {
+		return false;
+	}
+
+	bool success = entry->_hash->erase(field) > 0;
+	if (entry->_hash->empty()) {
+		shard._map.erase(key);
+	}
+	return success;
+}
+
+bool MemKvStore::Del(const std::string& key) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	shard._map.erase(key);
+	return true;
+}
+
+bool MemKvStore::ExistsKey(const std::string& key) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	return Find(shard, key) != nullptr;
+}
+
+bool MemKvStore::Expire(const std::string& key, int seconds) {
+	auto& shard = GetShard(key);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto* entry = Find(shard, key);
+	if (entry == nullptr) {
+		return false;
+	}
+
+	if (seconds <= 0) {
+		shard._map.erase(key);
+		return true;
+	}
+	entry->_b_expire = true;
+	entry->_expire = KvClock::now() + std::chrono::seconds(seconds);
+	shard._b_has_expire = true;
+	return true;
+}
+
+// 和redis一样接受"毫秒-序号"或者只有毫秒
+bool MemKvStore::ParseStreamId(const std::string& str, StreamId& id) {
+	auto pos = str.find('-');
+	long long ms = 0, seq = 0;
+	if (!ParseInteger(str.substr(0, pos), ms) || ms < 0) {
+		return false;
+	}
+	if (pos != std::string::npos && (!ParseInteger(str.substr(pos + 1), seq) || seq < 0)) {
+		return false;
+	}
+	id = StreamId(ms, seq);
+	return true;
+}
+
+std::string MemKvStore::FormatStreamId(const StreamId& id) {
+	return std::to_string(id.first) + "-" + std::to_string(id.second);
+}
+
+bool MemKvStore::XAdd(const std::string& key, const std::string& value, long long maxlen, std::string& id) {
+	auto& shard = GetShard(key);
+	{
+		std::lock_guard<std::mutex> lock(shard._mutex);
+		auto* entry = FindOrCreate(shard, key, KV_STREAM);
+		if (entry == nullptr) {
+			return false;
+		}
+
+		// 时钟回拨时沿用上一条的毫秒数，保证id递增
+		auto& stream = *entry->_stream;
+		uint64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+		if (now_ms > stream._last.first) {
+			stream._last = StreamId(now_ms, 0);
+		}
+		else {
+			++stream._last.second;
+		}
+		stream._entries.emplace_back(stream._last, value);
+		while (maxlen > 0 && static_cast<long long>(stream._entries.size()) > maxlen) {
+			stream._entries.pop_front();
+		}
+		id = FormatStreamId(stream._last);
+	}
+	shard._cond.notify_all();
+	return true;
+}
+
+bool MemKvStore::XRead(const std::string& key, const std::string& last_id, int count, int block_ms,
+	std::vector<std::pair<std::string, std::string>>& entries) {
+	// "$"表示只读调用之后追加的消息
+	bool b_tail = last_id == "$";
+	StreamId last(0, 0);
+	if (!b_tail && !ParseStreamId(last_id, last)) {
+		return false;
+	}
+
+	auto& shard = GetShard(key);
+	auto deadline = KvClock::now() + std::chrono::milliseconds(block_ms);
+	std::unique_lock<std::mutex> lock(shard._mutex);
+	while (true) {
+		auto* entry = Find(shard, key);
+		if (entry != nullptr && entry->_type != KV_STREAM) {
+			return false;
+		}
+		if (b_tail) {
+			last = entry == nullptr ? StreamId(0, 0) : entry->_stream->_last;
+			b_tail = false;
+		}
+
+		if (entry != nullptr) {
+			// id递增，二分找到第一条大于last_id的消息
+			auto& list = entry->_stream->_entries;
+			auto iter = std::upper_bound(list.begin(), list.end(), last,
+				[](const StreamId& id, const std::pair<StreamId, std::string>& item) {
+				return id < item.first;
+			});
+			for (; iter != list.end() && (count <= 0 || static_cast<int>(entries.size()) < count); ++iter) {
+				entries.emplace_back(FormatStreamId(iter->first), iter->second);
+			}
+			if (!entries.empty()) {
+				return true;
+			}
+		}
+
+		if (block_ms <= 0 || _b_stop || shard._cond.wait_until(lock, deadline) == std::cv_status::timeout) {
+			return true;
+		}
+	}
+}
+
+void MemKvStore::SweepExpired() {
+	// 每次只锁一个分片，清理期间其他分片照常读写
+	for (auto& shard : _shards) {
+		if (_b_stop) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(shard->_mutex);
+		if (!shard->_b_has_expire) {
+			continue;
+		}
+
+		auto now = KvClock::now();
+		bool b_has_expire = false;
+		for (auto iter = shard->_map.begin(); iter != shard->_map.end();) {
+			if (!iter->second._b_expire) {
+				++iter;
+			}
+			else if (iter->second._expire <= now) {
+				iter = shard->_map.erase(iter);
+			}
+			else {
+				b_has_expire = true;
+				++iter;
+			}
+		}
+		shard->_b_has_expire = b_has_expire;
+	}
+}
@@ -0,0 +1,122 @@
+#include "MembershipMgr.h"
+#include "ConfigMgr.h"
+#include "StatusGrpcClient.h"
+#include "const.h"
+#include <chrono>
+
+// [Membership] 没有配置时的默认心跳间隔，StatusServer的默认租约是它的3倍
+#define MEMBER_DEFAULT_HEARTBEAT_MS  1000
+
+MembershipMgr::MembershipMgr() : _b_online(false), _b_start(false), _b_stop(false) {
+	auto& cfg = ConfigMgr::Inst();
+	// 监听在0.0.0.0时需要配置AdvertiseHost作为客户端和对端连接的地址，没有配置时只能本机访问
+	auto host = cfg["SelfServer"]["AdvertiseHost"];
+	if (host.empty()) {
+		host = cfg["SelfServer"]["Host"];
+		if (host == "0.0.0.0") {
+			host = "127.0.0.1";
+		}
+	}
+	_self.set_name(cfg["SelfServer"]["Name"]);
+	_self.set_host(host);
+	_self.set_port(cfg["SelfServer"]["Port"]);
+	_self.set_rpc_host(host);
+	_self.set_rpc_port(cfg["SelfServer"]["RPCPort"]);
+
+	auto heartbeat_ms = cfg["Membership"]["HeartbeatMs"];
+	_heartbeat_ms = heartbeat_ms.empty() ? MEMBER_DEFAULT_HEARTBEAT_MS : (std::max)(atoi(heartbeat_ms.c_str()), 1);
+	std::atomic_store(&_members, std::shared_ptr<const Membership>(std::make_shared<Membership>()));
+}
+
+MembershipMgr::~MembershipMgr() {
+	Stop(false);
+}
+
+void MembershipMgr::Start() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_b_start) {
+		return;
+	}
+	_b_start = true;
+	_thread = std::thread(&MembershipMgr::Run, this);
+}
+
+void MembershipMgr::Stop(bool leave) {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_b_start || _b_stop) {
+			return;
+		}
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	_thread.join();
+
+	// 主动下线，其他服务器在下一次心跳时关闭到这里的通道，不用等租约过期
+	if (leave) {
+		Heartbeat(true);
+	}
+}
+
+std::shared_ptr<const Membership> MembershipMgr::Snapshot() {
+	return std::atomic_load(&_members);
+}
+
+const message::ChatServerInfo& MembershipMgr::Self() const {
+	return _self;
+}
+
+void MembershipMgr::Subscribe(Listener listener) {
+	std::lock_guard<std::mutex> lock(_listener_mutex);
+	_listeners.push_back(listener);
+	listener(std::atomic_load(&_members));
+}
+
+void MembershipMgr::Run() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_stop) {
+		lock.unlock();
+		Heartbeat(false);
+		lock.lock();
+		_cond.wait_for(lock, std::chrono::milliseconds(_heartbeat_ms), [this]() {
+			return _b_stop;
+		});
+	}
+}
+
+bool MembershipMgr::Heartbeat(bool leave) {
+	HeartbeatReq request;
+	*request.mutable_server() = _self;
+	request.set_version(Snapshot()->_version);
+	request.set_leave(leave);
+	auto reply = StatusGrpcClient::GetInstance()->Heartbeat(request, _heartbeat_ms);
+	// 只在状态切换时打印，StatusServer不可用期间沿用最后一次的成员表
+	if (reply.error() != ErrorCodes::Success) {
+		if (_b_online) {
+			std::cout << "heartbeat to status server failed, keep membership version " << request.version() << std::endl;
+		}
+		_b_online = false;
+		return false;
+	}
+	if (!_b_online) {
+		std::cout << "server " << _self.name() << " registered to status server" << std::endl;
+	}
+	_b_online = true;
+	if (leave || !reply.changed()) {
+		return true;
+	}
+
+	auto members = std::make_shared<Membership>();
+	members->_version = reply.version();
+	for (auto& server : reply.servers()) {
+		members->_servers[server.name()] = server;
+	}
+
+	std::lock_guard<std::mutex> lock(_listener_mutex);
+	std::atomic_store(&_members, std::shared_ptr<const Membership>(members));
+	std::cout << "membership version " << members->_version << ", " << members->_servers.size() << " servers" << std::endl;
+	for (auto& listener : _listeners) {
+		listener(members);
+	}
+	return true;
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include "Singleton.h"
+#include "LatencyHistogram.h"
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// 一个消息类型/路由/RPC的延迟统计，单位微秒
+// _wait是从进入队列到开始处理的时间，_exec是处理函数本身的执行时间
+struct LatencyMetric {
+	LatencyMetric();
+	LatencyHistogram _wait;
+	LatencyHistogram _exec;
+};
+
+// 计时到析构，把执行时间记到metric的_exec上，用在没有排队阶段的RPC处理函数里
+class ExecTimer {
+public:
+	ExecTimer(LatencyMetric* metric);
+	~ExecTimer();
+private:
+	LatencyMetric* _metric;
+	std::chrono::steady_clock::time_point _start;
+};
+
+// 一条SQL语句或者一个redis命令的耗时，单位微秒
+// _pool_wait是等待连接池的时间，_exec是发出请求到服务端返回的时间，_decode是解析结果到调用结束的时间
+struct StorageMetric {
+	StorageMetric(const std::string& name, bool b_record);
+	std::string _name;
+	// 开启 [Metrics] StorageTrace 时才记录直方图和慢日志，否则只在追踪中记录span
+	bool _b_record;
+	LatencyHistogram _pool_wait;
+	LatencyHistogram _exec;
+	LatencyHistogram _decode;
+	std::atomic<uint64_t> _slow_count;
+};
+
+// 分三段记录一次存储调用：构造时开始计时，拿到连接调用Acquired，请求返回调用Executed，析构时结束。
+// 一次调用执行多条语句时每条返回后都调用Executed，以最后一次为准；没有走到的阶段不记录；
+// 没有开启StorageTrace且当前线程不在追踪中时所有函数都直接返回，不读时钟
+class StorageTimer {
+public:
+	StorageTimer(StorageMetric* metric);
+	~StorageTimer();
+	void Acquired();
+	void Executed();
+private:
+	StorageMetric* _metric;
+	bool _b_active;
+	uint64_t _trace_id;
+	int64_t _start_us;
+	std::chrono::steady_clock::time_point _start;
+	std::chrono::steady_clock::time_point _acquired;
+	std::chrono::steady_clock::time_point _executed;
+};
+
+// MetricsMgr：进程内的延迟直方图、计数器和仪表，按Prometheus文本格式导出
+// 统计对象在注册时创建，之后地址不变，调用方注册时取一次指针保存下来，记录时不再查找也不加锁；
+// [Metrics] Port 不为0时在单独的io_context线程上监听HTTP，GET /metrics 返回全部指标
+class MetricsMgr : public Singleton<MetricsMgr>
+{
+	friend class Singleton<MetricsMgr>;
+public:
+	~MetricsMgr();
+	// 同一个family和label_value返回同一个对象，family是指标名前缀，例如chat_logic_msg
+	LatencyMetric* GetLatency(const std::string& family, const std::string& label_name, const std::string& label_value);
+	// 存储调用的耗时统计，family是mysql或者redis，name是语句或者命令
+	StorageMetric* GetStorage(const std::string& family, const std::string& name);
+	// 超过 [Metrics] SlowMs 的存储调用记一次慢操作，每SlowSample次打印一次日志
+	void OnSlowStorage(StorageMetric* metric, int64_t pool_wait_us, int64_t exec_us, int64_t decode_us);
+	// 计数器只增不减，调用方直接对返回的原子变量fetch_add
+	std::atomic<uint64_t>* GetCounter(const std::string& name);
+	// 仪表在导出时调用func取当前值，func里不能再调用MetricsMgr
+	void RegGauge(const std::string& name, std::function<double()> func);
+	void Start();
+	void Stop();
+	std::string Export();
+	static int64_t ToMicros(std::chrono::steady_clock::duration duration);
+private:
+	MetricsMgr();
+	struct LatencyFamily {
+		std::string _label_name;
+		std::map<std::string, std::unique_ptr<LatencyMetric>> _metrics;
+	};
+
+	void StartAccept();
+	// 直方图写到out，分位数写到quantile_out，由调用方拼在直方图之后
+	void ExportHistogram(std::string& out, std::string& quantile_out, const std::string& name, const std::string& label_name,
+		const std::string& label_value, const LatencyHistogram& histogram);
+
+	std::mutex _mutex;
+	std::map<std::string, LatencyFamily> _latency_families;
+	// family -> (语句或命令 -> 统计)
+	std::map<std::string, std::map<std::string, std::unique_ptr<StorageMetric>>> _storage_families;
+	bool _b_storage_trace;
+	int64_t _slow_us;
+	uint64_t _slow_sample;
+	std::atomic<uint64_t>* _slow_storage_count;
+	std::map<std::string, std::unique_ptr<std::atomic<uint64_t>>> _counters;
+	std::map<std::string, std::function<double()>> _gauges;
+
+	boost::asio::io_context _io_context;
+	std::unique_ptr<boost::asio::ip::tcp::acceptor> _acceptor;
+	std::thread _thread;
+	bool _b_start;
+};
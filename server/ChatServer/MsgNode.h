@@ -36,7 +36,7 @@ public:
 
 // 接收消息节点类，继承自 MsgNode，用于表示接收到的消息
 class RecvNode : public MsgNode {
-    friend class LogicSystem;  // 声明 LogicSystem 为友元类，允许其访问私有成员
+    friend class LogicQueue;  // 声明 LogicQueue 为友元类，允许其访问私有成员
 public:
     // 构造函数，初始化接收节点，指定消息长度和消息ID
     RecvNode(short max_len, short msg_id);
@@ -46,6 +46,27 @@ private:
 };
 
 
+// 解析消息头，返回主机字节序的消息ID(已去掉压缩和追踪标志)和消息体长度
+// CSession读取消息头和平滑升级后恢复半包时共用
+inline void ParseMsgHead(const char* head, short& msg_id, short& msg_len) {
+    memcpy(&msg_id, head, HEAD_ID_LEN);
+    msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+    msg_id &= ~(MSG_COMPRESS_FLAG | MSG_TRACE_FLAG);
+    memcpy(&msg_len, head + HEAD_ID_LEN, HEAD_DATA_LEN);
+    msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
+}
+
+// 解析消息体前面的trace id，高32位在前，都是网络字节序
+inline uint64_t ParseTraceId(const char* data) {
+    uint32_t high = 0;
+    uint32_t low = 0;
+    memcpy(&high, data, 4);
+    memcpy(&low, data + 4, 4);
+    high = boost::asio::detail::socket_ops::network_to_host_long(high);
+    low = boost::asio::detail::socket_ops::network_to_host_long(low);
+    return (static_cast<uint64_t>(high) << 32) | low;
+}
+
 // 发送消息节点类，继承自 MsgNode，用于表示要发送的消息
 class SendNode : public MsgNode {
     friend class LogicSystem;  // 声明 LogicSystem 为友元类
@@ -53,6 +74,10 @@ public:
     // 构造函数，初始化发送节点，指定消息内容、消息长度和消息ID
     SendNode(const char* msg, short max_len, short msg_id);
 
+    // 在追踪中入队的消息记录trace id和入队时间，写完后记录发送耗时
+    uint64_t _trace_id;
+    int64_t _enqueue_us;
+
 private:
     short _msg_id;  // 消息ID
 };
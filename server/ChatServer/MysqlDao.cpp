@@ -1,4 +1,5 @@
 #include "MysqlDao.h"
+#include "MetricsMgr.h"
 #include "ConfigMgr.h"
 
 MysqlDao::MysqlDao()
@@ -18,26 +19,31 @@ MysqlDao::~MysqlDao(){
 
 int MysqlDao::RegUser(const std::string& name, const std::string& email, const std::string& pwd)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "RegUser");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
-		// ׼ô洢
+		// 准备调用存储过程
 		std::unique_ptr < sql::PreparedStatement > stmt(con->_con->prepareStatement("CALL reg_user(?,?,?,@result)"));
-		// 
+		// 设置输入参数
 		stmt->setString(1, name);
 		stmt->setString(2, email);
 		stmt->setString(3, pwd);
 
-		// PreparedStatementֱ֧עҪʹûỰȡֵ
+		// 由于PreparedStatement不直接支持注册输出参数，我们需要使用会话变量或其他方法来获取输出参数的值
 
-		  // ִд洢
+		  // 执行存储过程
 		stmt->execute();
-		// 洢˻ỰʽȡִֵSELECTѯȡ
-	   // 磬洢һỰ@result洢ȡ
+		timer.Executed();
+		// 如果存储过程设置了会话变量或有其他方式获取输出参数的值，你可以在这里执行SELECT查询来获取它们
+	   // 例如，如果存储过程设置了一个会话变量@result来存储输出结果，可以这样获取：
 	   std::unique_ptr<sql::Statement> stmtResult(con->_con->createStatement());
 	  std::unique_ptr<sql::ResultSet> res(stmtResult->executeQuery("SELECT @result AS result"));
+	  timer.Executed();
 	  if (res->next()) {
 	       int result = res->getInt("result");
 	      std::cout << "Result: " << result << std::endl;
@@ -57,22 +63,26 @@ int MysqlDao::RegUser(const std::string& name, const std::string& email, const s
 }
 
 bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "CheckEmail");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
 
-		// ׼ѯ
+		// 准备查询语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT email FROM user WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt->setString(1, name);
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			std::cout << "Check Email: " << res->getString("email") << std::endl;
 			if (email != res->getString("email")) {
@@ -94,21 +104,25 @@ bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
 }
 
 bool MysqlDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "UpdatePwd");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
 
-		// ׼ѯ
+		// 准备查询语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("UPDATE user SET pwd = ? WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt->setString(2, name);
 		pstmt->setString(1, newpwd);
 
-		// ִи
+		// 执行更新
 		int updateCount = pstmt->executeUpdate();
+		timer.Executed();
 
 		std::cout << "Updated rows: " << updateCount << std::endl;
 		pool_->returnConnection(std::move(con));
@@ -124,7 +138,10 @@ bool MysqlDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
 }
 
 bool MysqlDao::CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "CheckPwd");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -134,17 +151,18 @@ bool MysqlDao::CheckPwd(const std::string& name, const std::string& pwd, UserInf
 		});
 
 	try {
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT * FROM user WHERE name = ?"));
-		pstmt->setString(1, name); // username滻ΪҪѯû
+		pstmt->setString(1, name); // 将username替换为你要查询的用户名
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 		std::string origin_pwd = "";
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			origin_pwd = res->getString("pwd");
-			// ѯ
+			// 输出查询到的密码
 			std::cout << "Password: " << origin_pwd << std::endl;
 			break;
 		}
@@ -168,7 +186,10 @@ bool MysqlDao::CheckPwd(const std::string& name, const std::string& pwd, UserInf
 
 bool MysqlDao::AddFriendApply(const int& from, const int& to)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "AddFriendApply");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -178,13 +199,14 @@ bool MysqlDao::AddFriendApply(const int& from, const int& to)
 		});
 
 	try {
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("INSERT INTO friend_apply (from_uid, to_uid) values (?,?) "
 			"ON DUPLICATE KEY UPDATE from_uid = from_uid, to_uid = to_uid"));
 		pstmt->setInt(1, from); // from id
 		pstmt->setInt(2, to);
-		// ִи
+		// 执行更新
 		int rowAffected = pstmt->executeUpdate();
+		timer.Executed();
 		if (rowAffected < 0) {
 			return false;
 		}
@@ -202,7 +224,10 @@ bool MysqlDao::AddFriendApply(const int& from, const int& to)
 }
 
 bool MysqlDao::AuthFriendApply(const int& from, const int& to) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "AuthFriendApply");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -212,14 +237,15 @@ bool MysqlDao::AuthFriendApply(const int& from, const int& to) {
 		});
 
 	try {
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("UPDATE friend_apply SET status = 1 "
 			"WHERE from_uid = ? AND to_uid = ?"));
-		//ʱfrom֤ʱto
+		//反过来的申请时from，验证时to
 		pstmt->setInt(1, to); // from id
 		pstmt->setInt(2, from);
-		// ִи
+		// 执行更新
 		int rowAffected = pstmt->executeUpdate();
+		timer.Executed();
 		if (rowAffected < 0) {
 			return false;
 		}
@@ -237,7 +263,10 @@ bool MysqlDao::AuthFriendApply(const int& from, const int& to) {
 }
 
 bool MysqlDao::AddFriend(const int& from, const int& to, std::string back_name) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "AddFriend");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -248,47 +277,49 @@ bool MysqlDao::AddFriend(const int& from, const int& to, std::string back_name)
 
 	try {
 
-		//ʼ
+		//开始事务
 		con->_con->setAutoCommit(false);
 
-		// ׼һSQL, ֤
+		// 准备第一个SQL语句, 插入认证方好友数据
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("INSERT IGNORE INTO friend(self_id, friend_id, back) "
 			"VALUES (?, ?, ?) "
 			));
-		//ʱfrom֤ʱto
+		//反过来的申请时from，验证时to
 		pstmt->setInt(1, from); // from id
 		pstmt->setInt(2, to);
 		pstmt->setString(3, back_name);
-		// ִи
+		// 执行更新
 		int rowAffected = pstmt->executeUpdate();
+		timer.Executed();
 		if (rowAffected < 0) {
 			con->_con->rollback();
 			return false;
 		}
 
-		//׼ڶSQL䣬뷽
+		//准备第二个SQL语句，插入申请方好友数据
 		std::unique_ptr<sql::PreparedStatement> pstmt2(con->_con->prepareStatement("INSERT IGNORE INTO friend(self_id, friend_id, back) "
 			"VALUES (?, ?, ?) "
 		));
-		//ʱfrom֤ʱto
+		//反过来的申请时from，验证时to
 		pstmt2->setInt(1, to); // from id
 		pstmt2->setInt(2, from);
 		pstmt2->setString(3, "");
-		// ִи
+		// 执行更新
 		int rowAffected2 = pstmt2->executeUpdate();
+		timer.Executed();
 		if (rowAffected2 < 0) {
 			con->_con->rollback();
 			return false;
 		}
 
-		// ύ
+		// 提交事务
 		con->_con->commit();
 		std::cout << "addfriend insert friends success" << std::endl;
 
 		return true;
 	}
 	catch (sql::SQLException& e) {
-		// 󣬻ع
+		// 如果发生错误，回滚事务
 		if (con) {
 			con->_con->rollback();
 		}
@@ -304,7 +335,10 @@ bool MysqlDao::AddFriend(const int& from, const int& to, std::string back_name)
 
 std::shared_ptr<UserInfo> MysqlDao::GetUser(int uid)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "GetUserByUid");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return nullptr;
 	}
@@ -314,14 +348,15 @@ std::shared_ptr<UserInfo> MysqlDao::GetUser(int uid)
 		});
 
 	try {
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT * FROM user WHERE uid = ?"));
-		pstmt->setInt(1, uid); // uid滻ΪҪѯuid
+		pstmt->setInt(1, uid); // 将uid替换为你要查询的uid
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 		std::shared_ptr<UserInfo> user_ptr = nullptr;
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			user_ptr.reset(new UserInfo);
 			user_ptr->pwd = res->getString("pwd");
@@ -346,7 +381,10 @@ std::shared_ptr<UserInfo> MysqlDao::GetUser(int uid)
 
 std::shared_ptr<UserInfo> MysqlDao::GetUser(std::string name)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "GetUserByName");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return nullptr;
 	}
@@ -356,14 +394,15 @@ std::shared_ptr<UserInfo> MysqlDao::GetUser(std::string name)
 		});
 
 	try {
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT * FROM user WHERE name = ?"));
-		pstmt->setString(1, name); // uid滻ΪҪѯuid
+		pstmt->setString(1, name); // 将uid替换为你要查询的uid
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 		std::shared_ptr<UserInfo> user_ptr = nullptr;
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			user_ptr.reset(new UserInfo);
 			user_ptr->pwd = res->getString("pwd");
@@ -387,7 +426,10 @@ std::shared_ptr<UserInfo> MysqlDao::GetUser(std::string name)
 
 
 bool MysqlDao::GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int begin, int limit) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "GetApplyList");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -398,17 +440,18 @@ bool MysqlDao::GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>&
 
 
 		try {
-		// ׼SQL, ʼidб
+		// 准备SQL语句, 根据起始id和限制条数返回列表
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("select apply.from_uid, apply.status, user.name, "
 				"user.nick, user.sex from friend_apply as apply join user on apply.from_uid = user.uid where apply.to_uid = ? "
 			"and apply.id > ? order by apply.id ASC LIMIT ? "));
 
-		pstmt->setInt(1, touid); // uid滻ΪҪѯuid
-		pstmt->setInt(2, begin); // ʼid
-		pstmt->setInt(3, limit); //ƫ
-		// ִвѯ
+		pstmt->setInt(1, touid); // 将uid替换为你要查询的uid
+		pstmt->setInt(2, begin); // 起始id
+		pstmt->setInt(3, limit); //偏移量
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-		// 
+		timer.Executed();
+		// 遍历结果集
 		while (res->next()) {	
 			auto name = res->getString("name");
 			auto uid = res->getInt("from_uid");
@@ -429,8 +472,11 @@ bool MysqlDao::GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>&
 }
 
 bool MysqlDao::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info_list) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "GetFriendList");
+	StorageTimer timer(metric);
 
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -441,18 +487,19 @@ bool MysqlDao::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>
 
 
 	try {
-		// ׼SQL, ʼidб
+		// 准备SQL语句, 根据起始id和限制条数返回列表
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("select * from friend where self_id = ? "));
 
-		pstmt->setInt(1, self_id); // uid滻ΪҪѯuid
+		pstmt->setInt(1, self_id); // 将uid替换为你要查询的uid
 	
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
-		// 
+		timer.Executed();
+		// 遍历结果集
 		while (res->next()) {		
 			auto friend_id = res->getInt("friend_id");
 			auto back = res->getString("back");
-			//һβѯfriend_idӦϢ
+			//再一次查询friend_id对应的信息
 			auto user_info = GetUser(friend_id);
 			if (user_info == nullptr) {
 				continue;
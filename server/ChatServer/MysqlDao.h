@@ -8,6 +8,7 @@
 #include <jdbc/cppconn/statement.h>
 #include <jdbc/cppconn/exception.h>
 #include "data.h"
+#include "UserDao.h"
 #include <memory>
 #include <queue>
 #include <mutex>
@@ -27,9 +28,9 @@ public:
 				sql::mysql::MySQL_Driver* driver = sql::mysql::get_mysql_driver_instance();
 				auto*  con = driver->connect(url_, user_, pass_);
 				con->setSchema(schema_);
-				// ȡǰʱ
+				// 获取当前时间戳
 				auto currentTime = std::chrono::system_clock::now().time_since_epoch();
-				// ʱתΪ
+				// 将时间戳转换为秒
 				long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(currentTime).count();
 				pool_.push(std::make_unique<SqlConnection>(con, timestamp));
 			}
@@ -44,7 +45,7 @@ public:
 			_check_thread.detach();
 		}
 		catch (sql::SQLException& e) {
-			// 쳣
+			// 处理异常
 			std::cout << "mysql pool init failed, error is " << e.what()<< std::endl;
 		}
 	}
@@ -52,9 +53,9 @@ public:
 	void checkConnection() {
 		std::lock_guard<std::mutex> guard(mutex_);
 		int poolsize = pool_.size();
-		// ȡǰʱ
+		// 获取当前时间戳
 		auto currentTime = std::chrono::system_clock::now().time_since_epoch();
-		// ʱתΪ
+		// 将时间戳转换为秒
 		long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(currentTime).count();
 		for (int i = 0; i < poolsize; i++) {
 			auto con = std::move(pool_.front());
@@ -75,7 +76,7 @@ public:
 			}
 			catch (sql::SQLException& e) {
 				std::cout << "Error keeping connection alive: " << e.what() << std::endl;
-				// ´Ӳ滻ɵ
+				// 重新创建连接并替换旧的连接
 				sql::mysql::MySQL_Driver* driver = sql::mysql::get_mysql_driver_instance();
 				auto* newcon = driver->connect(url_, user_, pass_);
 				newcon->setSchema(schema_);
@@ -136,22 +137,22 @@ private:
 
 
 
-class MysqlDao
+class MysqlDao : public UserDao
 {
 public:
 	MysqlDao();
 	~MysqlDao();
-	int RegUser(const std::string& name, const std::string& email, const std::string& pwd);
-	bool CheckEmail(const std::string& name, const std::string & email);
-	bool UpdatePwd(const std::string& name, const std::string& newpwd);
-	bool CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo);
-	bool AddFriendApply(const int& from, const int& to);
-	bool AuthFriendApply(const int& from, const int& to);
-	bool AddFriend(const int& from, const int& to, std::string back_name);
-	std::shared_ptr<UserInfo> GetUser(int uid);
-	std::shared_ptr<UserInfo> GetUser(std::string name);
-	bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int offset, int limit );
-	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info);
+	int RegUser(const std::string& name, const std::string& email, const std::string& pwd) override;
+	bool CheckEmail(const std::string& name, const std::string & email) override;
+	bool UpdatePwd(const std::string& name, const std::string& newpwd) override;
+	bool CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) override;
+	bool AddFriendApply(const int& from, const int& to) override;
+	bool AuthFriendApply(const int& from, const int& to) override;
+	bool AddFriend(const int& from, const int& to, std::string back_name) override;
+	std::shared_ptr<UserInfo> GetUser(int uid) override;
+	std::shared_ptr<UserInfo> GetUser(std::string name) override;
+	bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int offset, int limit ) override;
+	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info) override;
 private:
 	std::unique_ptr<MySqlPool> pool_;
 };
@@ -1,4 +1,7 @@
 #include "MysqlMgr.h"
+#include "MysqlDao.h"
+#include "MemUserDao.h"
+#include "ConfigMgr.h"
 
 
 MysqlMgr::~MysqlMgr() {
@@ -7,54 +10,62 @@ MysqlMgr::~MysqlMgr() {
 
 int MysqlMgr::RegUser(const std::string& name, const std::string& email, const std::string& pwd)
 {
-	return _dao.RegUser(name, email, pwd);
+	return _dao->RegUser(name, email, pwd);
 }
 
 bool MysqlMgr::CheckEmail(const std::string& name, const std::string& email) {
-	return _dao.CheckEmail(name, email);
+	return _dao->CheckEmail(name, email);
 }
 
 bool MysqlMgr::UpdatePwd(const std::string& name, const std::string& pwd) {
-	return _dao.UpdatePwd(name, pwd);
+	return _dao->UpdatePwd(name, pwd);
 }
 
 MysqlMgr::MysqlMgr() {
+	auto& cfg = ConfigMgr::Inst();
+	if (cfg["Storage"]["DaoBackend"] == "memory") {
+		auto shards = cfg["Storage"]["Shards"];
+		_dao.reset(new MemUserDao(shards.empty() ? MEM_STORE_SHARDS : atoi(shards.c_str())));
+		return;
+	}
+
+	_dao.reset(new MysqlDao());
 }
 
 bool MysqlMgr::CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) {
-	return _dao.CheckPwd(name, pwd, userInfo);
+	return _dao->CheckPwd(name, pwd, userInfo);
 }
 
 bool MysqlMgr::AddFriendApply(const int& from, const int& to)
 {
-	return _dao.AddFriendApply(from, to);
+	return _dao->AddFriendApply(from, to);
 }
 
 bool MysqlMgr::AuthFriendApply(const int& from, const int& to) {
-	return _dao.AuthFriendApply(from, to);
+	return _dao->AuthFriendApply(from, to);
 }
 
 bool MysqlMgr::AddFriend(const int& from, const int& to, std::string back_name) {
-	return _dao.AddFriend(from, to, back_name);
+	return _dao->AddFriend(from, to, back_name);
 }
 
 std::shared_ptr<UserInfo> MysqlMgr::GetUser(int uid)
 {
-	return _dao.GetUser(uid);
+	return _dao->GetUser(uid);
 }
 
 std::shared_ptr<UserInfo> MysqlMgr::GetUser(std::string name)
 {
-	return _dao.GetUser(name);
+	return _dao->GetUser(name);
 }
 
 bool MysqlMgr::GetApplyList(int touid, 
 	std::vector<std::shared_ptr<ApplyInfo>>& applyList, int begin, int limit) {
 
-	return _dao.GetApplyList(touid, applyList, begin, limit);
+	return _dao->GetApplyList(touid, applyList, begin, limit);
 }
 
 bool MysqlMgr::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info) {
-	return _dao.GetFriendList(self_id, user_info);
+	return _dao->GetFriendList(self_id, user_info);
 }
 
@@ -0,0 +1,340 @@
+#include "PeerChannel.h"
+#include "MetricsMgr.h"
+#include "TraceMgr.h"
+#include <random>
+#include <unordered_map>
+
+uint64_t PeerSeq::Epoch() {
+	static const uint64_t epoch = []() {
+		std::random_device rd;
+		return (static_cast<uint64_t>(rd()) << 32) | rd();
+	}();
+	return epoch;
+}
+
+std::shared_ptr<std::atomic<uint64_t>> PeerSeq::Counter(const std::string& name) {
+	static std::mutex mutex;
+	static std::unordered_map<std::string, std::shared_ptr<std::atomic<uint64_t>>> counters;
+	std::lock_guard<std::mutex> lock(mutex);
+	auto& counter = counters[name];
+	if (!counter) {
+		counter = std::make_shared<std::atomic<uint64_t>>(0);
+	}
+	return counter;
+}
+
+PeerChannel::PeerChannel(const std::string& self_name, const std::string& name, const std::string& host,
+	const std::string& port, const PeerChannelConfig& config, Fallback fallback)
+	: _self_name(self_name), _name(name), _config(config), _fallback(fallback),
+	_breaker(name, config._breaker_failures, config._breaker_open_ms),
+	_epoch(PeerSeq::Epoch()), _next_seq(PeerSeq::Counter(name)),
+	_pending_bytes(0), _b_broken(false), _b_read_closed(false), _b_stop(false), _b_write_exit(false),
+	_call_deadline(std::chrono::steady_clock::time_point::max()) {
+	auto channel = grpc::CreateChannel(host + ":" + port, grpc::InsecureChannelCredentials());
+	_stub = message::ChatService::NewStub(channel);
+
+	auto metrics = MetricsMgr::GetInstance();
+	_batch_count = metrics->GetCounter("chat_peer_batch_total");
+	_event_count = metrics->GetCounter("chat_peer_event_total");
+	_resend_count = metrics->GetCounter("chat_peer_resend_total");
+	_unknown_count = metrics->GetCounter("chat_peer_unknown_total");
+
+	_write_thread = std::thread([this]() {
+		WriteLoop();
+	});
+	_watch_thread = std::thread([this]() {
+		WatchLoop();
+	});
+}
+
+PeerChannel::~PeerChannel() {
+	Stop();
+}
+
+void PeerChannel::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_b_stop) {
+			return;
+		}
+		_b_stop = true;
+	}
+	_cond.notify_all();
+	if (_write_thread.joinable()) {
+		_write_thread.join();
+	}
+	if (_watch_thread.joinable()) {
+		_watch_thread.join();
+	}
+}
+
+void PeerChannel::Post(PeerEventItem item) {
+	item._bytes = item._event.ByteSizeLong();
+	item._event.set_trace_id(TraceMgr::Current());
+	if (item._event.trace_id() != 0) {
+		item._start_us = TraceMgr::NowMicros();
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (_b_stop || _pending.size() + _unacked.size() >= _config._max_pending) {
+		bool b_stop = _b_stop;
+		lock.unlock();
+		if (!b_stop) {
+			std::cout << "peer [" << _name << "] too many pending events" << std::endl;
+		}
+		_fallback(item);
+		return;
+	}
+
+	item._event.set_seq(++*_next_seq);
+	item._enqueue_time = std::chrono::steady_clock::now();
+	_pending_bytes += item._bytes;
+	_pending.push_back(std::move(item));
+	// 第一个事件让发送线程开始计时，攒够一批时立即发送，其余情况不需要唤醒
+	if (_pending.size() == 1 || _pending.size() >= static_cast<size_t>(_config._batch_size)
+		|| _pending_bytes >= _config._batch_bytes) {
+		_cond.notify_all();
+	}
+}
+
+void PeerChannel::WriteLoop() {
+	auto flush_time = std::chrono::microseconds(_config._flush_us);
+	auto ack_timeout = std::chrono::milliseconds(_config._ack_timeout_ms);
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_stop) {
+		auto now = std::chrono::steady_clock::now();
+		// 最早的未确认事件超时说明对端卡住了，取消这个流后按断开处理
+		if (_stream && !_b_broken && !_unacked.empty() && now - _unacked.front()._send_time >= ack_timeout) {
+			std::cout << "peer [" << _name << "] ack timeout, seq " << _unacked.front()._event.seq() << std::endl;
+			_b_broken = true;
+		}
+		if (_b_broken) {
+			CloseStream(lock);
+			continue;
+		}
+
+		bool b_full = _pending.size() >= static_cast<size_t>(_config._batch_size)
+			|| _pending_bytes >= _config._batch_bytes;
+		if (!_pending.empty() && (b_full || now >= _pending.front()._enqueue_time + flush_time)) {
+			if (!_stream && !OpenStream(lock)) {
+				FallbackAll(lock);
+				continue;
+			}
+			WriteBatch(lock);
+			continue;
+		}
+
+		// 下一次要处理的是最早事件的发送时间和最早未确认事件的超时时间，都没有时等Post唤醒
+		auto wake_time = std::chrono::steady_clock::time_point::max();
+		if (!_pending.empty()) {
+			wake_time = _pending.front()._enqueue_time + flush_time;
+		}
+		if (_stream && !_unacked.empty()) {
+			wake_time = (std::min)(wake_time, _unacked.front()._send_time + ack_timeout);
+		}
+		if (wake_time == std::chrono::steady_clock::time_point::max()) {
+			_cond.wait(lock);
+		}
+		else {
+			_cond.wait_until(lock, wake_time);
+		}
+	}
+
+	// 退出前把待发送的事件发完，WritesDone后对端处理完所有批次会结束这个流
+	if (_stream) {
+		while (!_pending.empty() && !_b_broken) {
+			WriteBatch(lock);
+		}
+		if (!_b_broken) {
+			auto* stream = _stream.get();
+			_call_deadline = std::chrono::steady_clock::now() + ack_timeout;
+			_cond.notify_all();
+			lock.unlock();
+			stream->WritesDone();
+			lock.lock();
+			_call_deadline = std::chrono::steady_clock::time_point::max();
+			_cond.wait_for(lock, ack_timeout, [this]() {
+				return _unacked.empty() || _b_broken;
+			});
+		}
+		CloseStream(lock);
+	}
+	FallbackAll(lock);
+	_b_write_exit = true;
+	_cond.notify_all();
+}
+
+void PeerChannel::WatchLoop() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (!_b_write_exit) {
+		auto deadline = _call_deadline;
+		if (deadline == std::chrono::steady_clock::time_point::max()) {
+			_cond.wait(lock);
+			continue;
+		}
+		if (std::chrono::steady_clock::now() < deadline) {
+			_cond.wait_until(lock, deadline);
+			continue;
+		}
+		// 发送线程还卡在同一个调用里，取消流让它返回，之后按断开处理
+		std::cout << "peer [" << _name << "] write timeout, cancel stream" << std::endl;
+		_b_broken = true;
+		_call_deadline = std::chrono::steady_clock::time_point::max();
+		_context->TryCancel();
+	}
+}
+
+void PeerChannel::ReadLoop(Stream* stream) {
+	message::PeerAck ack;
+	while (stream->Read(&ack)) {
+		_breaker.OnSuccess();
+		std::lock_guard<std::mutex> lock(_mutex);
+		while (!_unacked.empty() && _unacked.front()._event.seq() <= ack.acked_seq()) {
+			auto& item = _unacked.front();
+			if (item._event.trace_id() != 0) {
+				TraceMgr::GetInstance()->Record(item._event.trace_id(), "grpc.client", "DeliverStream",
+					item._start_us, TraceMgr::NowMicros() - item._start_us);
+			}
+			_unacked.pop_front();
+		}
+		if (_unacked.empty()) {
+			_cond.notify_all();
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_b_read_closed = true;
+	_b_broken = true;
+	_cond.notify_all();
+}
+
+bool PeerChannel::OpenStream(std::unique_lock<std::mutex>& lock) {
+	if (!_breaker.Allow()) {
+		return false;
+	}
+
+	// 建流时会等初始metadata发出，不能持有锁；对端连不上时同样由看门狗取消
+	_context.reset(new grpc::ClientContext());
+	_b_broken = false;
+	_b_read_closed = false;
+	auto* context = _context.get();
+	_call_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_config._ack_timeout_ms);
+	_cond.notify_all();
+	lock.unlock();
+	auto stream = _stub->DeliverStream(context);
+	lock.lock();
+	_call_deadline = std::chrono::steady_clock::time_point::max();
+
+	_stream = std::move(stream);
+	auto* raw_stream = _stream.get();
+	_read_thread = std::thread([this, raw_stream]() {
+		ReadLoop(raw_stream);
+	});
+	std::cout << "peer stream to [" << _name << "] opened" << std::endl;
+	return true;
+}
+
+void PeerChannel::CloseStream(std::unique_lock<std::mutex>& lock) {
+	// 读线程在Read失败后才退出，写失败或者确认超时时先取消再等它，之后才能Finish拿到对端的状态
+	bool b_read_closed = _b_read_closed;
+	lock.unlock();
+	if (!b_read_closed) {
+		_context->TryCancel();
+	}
+	_read_thread.join();
+	auto status = _stream->Finish();
+	lock.lock();
+
+	if (!_b_stop) {
+		_breaker.OnFailure();
+		std::cout << "peer stream to [" << _name << "] broken, " << status.error_message()
+			<< ", " << _unacked.size() << " events to resend" << std::endl;
+	}
+	_stream.reset();
+	_context.reset();
+	_b_broken = false;
+
+	// 对端正在交接会话时以ABORTED拒绝，最后一个确认之后的事件都没有处理过，可以放心回退到离线或broker
+	if (status.error_code() == grpc::StatusCode::ABORTED) {
+		for (auto& item : _unacked) {
+			item._b_written = false;
+		}
+	}
+
+	// 未确认的事件放回待发送队列最前面，重新建流后按原来的seq重发
+	_resend_count->fetch_add(_unacked.size(), std::memory_order_relaxed);
+	while (!_unacked.empty()) {
+		_pending_bytes += _unacked.back()._bytes;
+		_pending.push_front(std::move(_unacked.back()));
+		_unacked.pop_back();
+	}
+}
+
+void PeerChannel::WriteBatch(std::unique_lock<std::mutex>& lock) {
+	message::PeerBatch batch;
+	batch.set_from_server(_self_name);
+	batch.set_epoch(_epoch);
+	size_t bytes = 0;
+	auto now = std::chrono::steady_clock::now();
+	while (!_pending.empty() && batch.events_size() < _config._batch_size && bytes < _config._batch_bytes) {
+		auto& item = _pending.front();
+		*batch.add_events() = item._event;
+		bytes += item._bytes;
+		_pending_bytes -= item._bytes;
+		item._send_time = now;
+		item._b_written = true;
+		_unacked.push_back(std::move(item));
+		_pending.pop_front();
+	}
+
+	// Write会因为流控阻塞，期间Post继续往待发送队列里放；对端一直不读时看门狗到AckTimeoutMs取消流
+	auto* stream = _stream.get();
+	_call_deadline = now + std::chrono::milliseconds(_config._ack_timeout_ms);
+	_cond.notify_all();
+	lock.unlock();
+	bool b_write = stream->Write(batch);
+	lock.lock();
+	_call_deadline = std::chrono::steady_clock::time_point::max();
+	if (!b_write) {
+		_b_broken = true;
+		return;
+	}
+	_batch_count->fetch_add(1, std::memory_order_relaxed);
+	_event_count->fetch_add(batch.events_size(), std::memory_order_relaxed);
+}
+
+void PeerChannel::FallbackAll(std::unique_lock<std::mutex>& lock) {
+	std::deque<PeerEventItem> items;
+	items.swap(_unacked);
+	for (auto& item : _pending) {
+		items.push_back(std::move(item));
+	}
+	_pending.clear();
+	_pending_bytes = 0;
+	// 写出过但没有确认的事件对端可能已经处理，降级会让接收方收到两次，只有从没写出的事件降级
+	size_t written = 0;
+	for (auto iter = items.begin(); iter != items.end();) {
+		if (iter->_b_written) {
+			++written;
+			iter = items.erase(iter);
+		}
+		else {
+			++iter;
+		}
+	}
+	if (written > 0) {
+		_unknown_count->fetch_add(written, std::memory_order_relaxed);
+		std::cout << "peer [" << _name << "] " << written << " written events not acked, not fallback" << std::endl;
+	}
+	if (items.empty()) {
+		return;
+	}
+
+	lock.unlock();
+	for (auto& item : items) {
+		// 降级处理里的存储调用挂在发起通知的trace下
+		TraceScope trace_scope(item._event.trace_id());
+		_fallback(item);
+	}
+	lock.lock();
+}
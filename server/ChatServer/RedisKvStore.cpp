@@ -0,0 +1,689 @@
+#include "RedisKvStore.h"
+#include "MetricsMgr.h"
+#include "const.h"
+#include "ConfigMgr.h"
+RedisKvStore::RedisKvStore(size_t pool_size) {
+	auto& gCfgMgr = ConfigMgr::Inst();
+	auto host = gCfgMgr["Redis"]["Host"];
+	auto port = gCfgMgr["Redis"]["Port"];
+	auto pwd = gCfgMgr["Redis"]["Passwd"];
+	_con_pool.reset(new RedisConPool(pool_size, host.c_str(), atoi(port.c_str()), pwd.c_str()));
+}
+
+RedisKvStore::~RedisKvStore() {
+	
+}
+
+
+
+bool RedisKvStore::Get(const std::string& key, std::string& value)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "GET");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	 auto reply = (redisReply*)redisCommand(connect, "GET %s", key.c_str());
+	 timer.Executed();
+	 if (reply == NULL) {
+		 std::cout << "[ GET  " << key << " ] failed" << std::endl;
+		// freeReplyObject(reply);
+		 _con_pool->returnConnection(connect);
+		  return false;
+	}
+
+	 if (reply->type != REDIS_REPLY_STRING) {
+		 std::cout << "[ GET  " << key << " ] failed" << std::endl;
+		 freeReplyObject(reply);
+		 _con_pool->returnConnection(connect);
+		 return false;
+	}
+
+	 value = reply->str;
+	 freeReplyObject(reply);
+
+	 std::cout << "Succeed to execute command [ GET " << key << "  ]" << std::endl;
+	 _con_pool->returnConnection(connect);
+	 return true;
+}
+
+bool RedisKvStore::Set(const std::string &key, const std::string &value){
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "SET");
+	StorageTimer timer(metric);
+	//执行redis命令行
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "SET %s %s", key.c_str(), value.c_str());
+	timer.Executed();
+
+	//如果返回NULL则说明执行失败
+	if (NULL == reply)
+	{
+		std::cout << "Execut command [ SET " << key << "  "<< value << " ] failure ! " << std::endl;
+		//freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	//如果执行失败则释放连接
+	if (!(reply->type == REDIS_REPLY_STATUS && (strcmp(reply->str, "OK") == 0 || strcmp(reply->str, "ok") == 0)))
+	{
+		std::cout << "Execut command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	//执行成功 释放redisCommand执行后返回的redisReply所占用的内存
+	freeReplyObject(reply);
+	std::cout << "Execut command [ SET " << key << "  " << value << " ] success ! " << std::endl;
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisKvStore::LPush(const std::string &key, const std::string &value)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "LPUSH");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "LPUSH %s %s", key.c_str(), value.c_str());
+	timer.Executed();
+	if (NULL == reply)
+	{
+		std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
+		std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] success ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisKvStore::LPop(const std::string &key, std::string& value){
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "LPOP");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "LPOP %s ", key.c_str());
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Execut command [ LPOP " << key<<  " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type == REDIS_REPLY_NIL) {
+		std::cout << "Execut command [ LPOP " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	value = reply->str;
+	std::cout << "Execut command [ LPOP " << key <<  " ] success ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisKvStore::RPush(const std::string& key, const std::string& value) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "RPUSH");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "RPUSH %s %s", key.c_str(), value.c_str());
+	timer.Executed();
+	if (NULL == reply)
+	{
+		std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
+		std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] success ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+bool RedisKvStore::RPop(const std::string& key, std::string& value) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "RPOP");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "RPOP %s ", key.c_str());
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Execut command [ RPOP " << key << " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type == REDIS_REPLY_NIL) {
+		std::cout << "Execut command [ RPOP " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+	value = reply->str;
+	std::cout << "Execut command [ RPOP " << key << " ] success ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisKvStore::LRange(const std::string& key, int start, int stop, std::vector<std::string>& values) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "LRANGE");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	auto reply = (redisReply*)redisCommand(connect, "LRANGE %s %d %d", key.c_str(), start, stop);
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ LRANGE " << key << " " << start << " " << stop << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_ARRAY) {
+		std::cout << "Execut command [ LRANGE " << key << " " << start << " " << stop << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		return false;
+	}
+
+	for (size_t i = 0; i < reply->elements; i++) {
+		auto* element = reply->element[i];
+		if (element->type == REDIS_REPLY_STRING) {
+			values.emplace_back(element->str, element->len);
+		}
+	}
+
+	freeReplyObject(reply);
+	return true;
+}
+
+bool RedisKvStore::LTrim(const std::string& key, int start, int stop) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "LTRIM");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	auto reply = (redisReply*)redisCommand(connect, "LTRIM %s %d %d", key.c_str(), start, stop);
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ LTRIM " << key << " " << start << " " << stop << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	bool success = reply->type == REDIS_REPLY_STATUS;
+	freeReplyObject(reply);
+	return success;
+}
+
+//原子自增，多个ChatServer同时修改同一用户的版本号时也不会丢失更新
+bool RedisKvStore::Incr(const std::string& key, long long& value) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "INCR");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	auto reply = (redisReply*)redisCommand(connect, "INCR %s", key.c_str());
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ INCR " << key << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER) {
+		std::cout << "Execut command [ INCR " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		return false;
+	}
+
+	value = reply->integer;
+	freeReplyObject(reply);
+	return true;
+}
+
+bool RedisKvStore::HIncrBy(const std::string& key, const std::string& hkey, long long delta, long long& value) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "HINCRBY");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	auto reply = (redisReply*)redisCommand(connect, "HINCRBY %s %s %lld", key.c_str(), hkey.c_str(), delta);
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ HINCRBY " << key << " " << hkey << " " << delta << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER) {
+		std::cout << "Execut command [ HINCRBY " << key << " " << hkey << " " << delta << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		return false;
+	}
+
+	value = reply->integer;
+	freeReplyObject(reply);
+	return true;
+}
+
+bool RedisKvStore::HSet(const std::string &key, const std::string &hkey, const std::string &value) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "HSET");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "HSET %s %s %s", key.c_str(), hkey.c_str(), value.c_str());
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Execut command [ HSet " << key << "  " << hkey <<"  " << value << " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER) {
+		std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisKvStore::HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "HSET");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	 const char* argv[4];
+	 size_t argvlen[4];
+	 argv[0] = "HSET";
+	argvlen[0] = 4;
+	argv[1] = key;
+	argvlen[1] = strlen(key);
+	argv[2] = hkey;
+	argvlen[2] = strlen(hkey);
+	argv[3] = hvalue;
+	argvlen[3] = hvaluelen;
+
+	auto reply = (redisReply*)redisCommandArgv(connect, 4, argv, argvlen);
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER) {
+		std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+	std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] success ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+std::string RedisKvStore::HGet(const std::string &key, const std::string &hkey)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "HGET");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return "";
+	}
+	const char* argv[3];
+	size_t argvlen[3];
+	argv[0] = "HGET";
+	argvlen[0] = 4;
+	argv[1] = key.c_str();
+	argvlen[1] = key.length();
+	argv[2] = hkey.c_str();
+	argvlen[2] = hkey.length();
+	
+	auto reply = (redisReply*)redisCommandArgv(connect, 3, argv, argvlen);
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Execut command [ HGet " << key << " "<< hkey <<"  ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return "";
+	}
+
+	if ( reply->type == REDIS_REPLY_NIL) {
+		freeReplyObject(reply);
+		std::cout << "Execut command [ HGet " << key << " " << hkey << "  ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return "";
+	}
+
+	std::string value = reply->str;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	std::cout << "Execut command [ HGet " << key << " " << hkey << " ] success ! " << std::endl;
+	return value;
+}
+
+bool RedisKvStore::HDel(const std::string& key, const std::string& field)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "HDEL");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	redisReply* reply = (redisReply*)redisCommand(connect, "HDEL %s %s", key.c_str(), field.c_str());
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cerr << "HDEL command failed" << std::endl;
+		return false;
+	}
+
+	bool success = false;
+	if (reply->type == REDIS_REPLY_INTEGER) {
+		success = reply->integer > 0;
+	}
+
+	freeReplyObject(reply);
+	return success;
+}
+
+bool RedisKvStore::Del(const std::string &key)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "DEL");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+	auto reply = (redisReply*)redisCommand(connect, "DEL %s", key.c_str());
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Execut command [ Del " << key <<  " ] failure ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if ( reply->type != REDIS_REPLY_INTEGER) {
+		std::cout << "Execut command [ Del " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	std::cout << "Execut command [ Del " << key << " ] success ! " << std::endl;
+	 freeReplyObject(reply);
+	 _con_pool->returnConnection(connect);
+	 return true;
+}
+
+bool RedisKvStore::ExistsKey(const std::string &key)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "EXISTS");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	auto reply = (redisReply*)redisCommand(connect, "exists %s", key.c_str());
+	timer.Executed();
+	if (reply == nullptr ) {
+		std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_INTEGER || reply->integer == 0) {
+		std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
+		_con_pool->returnConnection(connect);
+		freeReplyObject(reply);
+		return false;
+	}
+	std::cout << " Found [ Key " << key << " ] exists ! " << std::endl;
+	freeReplyObject(reply);
+	_con_pool->returnConnection(connect);
+	return true;
+}
+
+bool RedisKvStore::Expire(const std::string& key, int seconds)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "EXPIRE");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	auto reply = (redisReply*)redisCommand(connect, "EXPIRE %s %d", key.c_str(), seconds);
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ EXPIRE " << key << " " << seconds << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	bool success = reply->type == REDIS_REPLY_INTEGER && reply->integer > 0;
+	freeReplyObject(reply);
+	return success;
+}
+
+// 流里的每条消息只有一个字段data，内容是二进制安全的
+bool RedisKvStore::XAdd(const std::string& key, const std::string& value, long long maxlen, std::string& id)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "XADD");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	// MAXLEN ~ 按整个宏节点裁剪，比精确裁剪开销小
+	auto maxlen_str = std::to_string(maxlen);
+	std::vector<const char*> argv;
+	std::vector<size_t> argvlen;
+	auto add_arg = [&argv, &argvlen](const char* arg, size_t len) {
+		argv.push_back(arg);
+		argvlen.push_back(len);
+	};
+	add_arg("XADD", 4);
+	add_arg(key.c_str(), key.size());
+	if (maxlen > 0) {
+		add_arg("MAXLEN", 6);
+		add_arg("~", 1);
+		add_arg(maxlen_str.c_str(), maxlen_str.size());
+	}
+	add_arg("*", 1);
+	add_arg("data", 4);
+	add_arg(value.data(), value.size());
+
+	auto reply = (redisReply*)redisCommandArgv(connect, static_cast<int>(argv.size()), argv.data(), argvlen.data());
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ XADD " << key << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	if (reply->type != REDIS_REPLY_STRING) {
+		std::cout << "Execut command [ XADD " << key << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		return false;
+	}
+	id.assign(reply->str, reply->len);
+	freeReplyObject(reply);
+	return true;
+}
+
+bool RedisKvStore::XRead(const std::string& key, const std::string& last_id, int count, int block_ms,
+	std::vector<std::pair<std::string, std::string>>& entries)
+{
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("redis", "XREAD");
+	StorageTimer timer(metric);
+	auto connect = _con_pool->getConnection();
+	timer.Acquired();
+	if (connect == nullptr) {
+		return false;
+	}
+
+	Defer defer([&connect, this]() {
+		_con_pool->returnConnection(connect);
+		});
+
+	auto count_str = std::to_string(count);
+	auto block_str = std::to_string(block_ms);
+	std::vector<const char*> argv;
+	std::vector<size_t> argvlen;
+	auto add_arg = [&argv, &argvlen](const std::string& arg) {
+		argv.push_back(arg.c_str());
+		argvlen.push_back(arg.size());
+	};
+	static const std::string xread = "XREAD", count_arg = "COUNT", block_arg = "BLOCK", streams_arg = "STREAMS";
+	add_arg(xread);
+	if (count > 0) {
+		add_arg(count_arg);
+		add_arg(count_str);
+	}
+	if (block_ms > 0) {
+		add_arg(block_arg);
+		add_arg(block_str);
+	}
+	add_arg(streams_arg);
+	add_arg(key);
+	add_arg(last_id);
+
+	auto reply = (redisReply*)redisCommandArgv(connect, static_cast<int>(argv.size()), argv.data(), argvlen.data());
+	timer.Executed();
+	if (reply == nullptr) {
+		std::cout << "Execut command [ XREAD " << key << " " << last_id << " ] failure ! " << std::endl;
+		return false;
+	}
+
+	// 超时没有消息时返回nil
+	if (reply->type == REDIS_REPLY_NIL) {
+		freeReplyObject(reply);
+		return true;
+	}
+	if (reply->type != REDIS_REPLY_ARRAY) {
+		std::cout << "Execut command [ XREAD " << key << " " << last_id << " ] failure ! " << std::endl;
+		freeReplyObject(reply);
+		return false;
+	}
+
+	// [[key, [[id, [field, value]], ...]]]
+	for (size_t i = 0; i < reply->elements; i++) {
+		auto* stream = reply->element[i];
+		if (stream->type != REDIS_REPLY_ARRAY || stream->elements < 2 || stream->element[1]->type != REDIS_REPLY_ARRAY) {
+			continue;
+		}
+		auto* messages = stream->element[1];
+		for (size_t j = 0; j < messages->elements; j++) {
+			auto* message = messages->element[j];
+			if (message->type != REDIS_REPLY_ARRAY || message->elements < 2) {
+				continue;
+			}
+			auto* id = message->element[0];
+			auto* fields = message->element[1];
+			if (fields->type != REDIS_REPLY_ARRAY || fields->elements < 2) {
+				continue;
+			}
+			entries.emplace_back(std::string(id->str, id->len),
+				std::string(fields->element[1]->str, fields->element[1]->len));
+		}
+	}
+	freeReplyObject(reply);
+	return true;
+}
@@ -1,360 +1,107 @@
 #include "RedisMgr.h"
 #include "const.h"
 #include "ConfigMgr.h"
-RedisMgr::RedisMgr() {
+#include "RedisKvStore.h"
+#include "MemKvStore.h"
+
+RedisMgr::RedisMgr() : _b_memory(false) {
 	auto& gCfgMgr = ConfigMgr::Inst();
-	auto host = gCfgMgr["Redis"]["Host"];
-	auto port = gCfgMgr["Redis"]["Port"];
-	auto pwd = gCfgMgr["Redis"]["Passwd"];
-	_con_pool.reset(new RedisConPool(5, host.c_str(), atoi(port.c_str()), pwd.c_str()));
+	auto backend = gCfgMgr["Storage"]["KvBackend"];
+	if (backend == "memory") {
+		auto shards = gCfgMgr["Storage"]["Shards"];
+		_store.reset(new MemKvStore(shards.empty() ? MEM_STORE_SHARDS : atoi(shards.c_str())));
+		_b_memory = true;
+		return;
+	}
+
+	_store.reset(new RedisKvStore());
 }
 
 RedisMgr::~RedisMgr() {
 	
 }
 
-
-
-bool RedisMgr::Get(const std::string& key, std::string& value)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	 auto reply = (redisReply*)redisCommand(connect, "GET %s", key.c_str());
-	 if (reply == NULL) {
-		 std::cout << "[ GET  " << key << " ] failed" << std::endl;
-		// freeReplyObject(reply);
-		 _con_pool->returnConnection(connect);
-		  return false;
-	}
-
-	 if (reply->type != REDIS_REPLY_STRING) {
-		 std::cout << "[ GET  " << key << " ] failed" << std::endl;
-		 freeReplyObject(reply);
-		 _con_pool->returnConnection(connect);
-		 return false;
-	}
-
-	 value = reply->str;
-	 freeReplyObject(reply);
-
-	 std::cout << "Succeed to execute command [ GET " << key << "  ]" << std::endl;
-	 _con_pool->returnConnection(connect);
-	 return true;
+bool RedisMgr::Get(const std::string& key, std::string& value) {
+	return _store->Get(key, value);
 }
 
-bool RedisMgr::Set(const std::string &key, const std::string &value){
-	//ִredis
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "SET %s %s", key.c_str(), value.c_str());
-
-	//NULL˵ִʧ
-	if (NULL == reply)
-	{
-		std::cout << "Execut command [ SET " << key << "  "<< value << " ] failure ! " << std::endl;
-		//freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	//ִʧͷ
-	if (!(reply->type == REDIS_REPLY_STATUS && (strcmp(reply->str, "OK") == 0 || strcmp(reply->str, "ok") == 0)))
-	{
-		std::cout << "Execut command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	//ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-	freeReplyObject(reply);
-	std::cout << "Execut command [ SET " << key << "  " << value << " ] success ! " << std::endl;
-	_con_pool->returnConnection(connect);
-	return true;
+bool RedisMgr::Set(const std::string& key, const std::string& value) {
+	return _store->Set(key, value);
 }
 
-bool RedisMgr::LPush(const std::string &key, const std::string &value)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "LPUSH %s %s", key.c_str(), value.c_str());
-	if (NULL == reply)
-	{
-		std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
-		std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	std::cout << "Execut command [ LPUSH " << key << "  " << value << " ] success ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+bool RedisMgr::LPush(const std::string& key, const std::string& value) {
+	return _store->LPush(key, value);
 }
 
-bool RedisMgr::LPop(const std::string &key, std::string& value){
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "LPOP %s ", key.c_str());
-	if (reply == nullptr ) {
-		std::cout << "Execut command [ LPOP " << key<<  " ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	if (reply->type == REDIS_REPLY_NIL) {
-		std::cout << "Execut command [ LPOP " << key << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	value = reply->str;
-	std::cout << "Execut command [ LPOP " << key <<  " ] success ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+bool RedisMgr::LPop(const std::string& key, std::string& value) {
+	return _store->LPop(key, value);
 }
 
 bool RedisMgr::RPush(const std::string& key, const std::string& value) {
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "RPUSH %s %s", key.c_str(), value.c_str());
-	if (NULL == reply)
-	{
-		std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
-		std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	std::cout << "Execut command [ RPUSH " << key << "  " << value << " ] success ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+	return _store->RPush(key, value);
 }
-bool RedisMgr::RPop(const std::string& key, std::string& value) {
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "RPOP %s ", key.c_str());
-	if (reply == nullptr ) {
-		std::cout << "Execut command [ RPOP " << key << " ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return false;
-	}
 
-	if (reply->type == REDIS_REPLY_NIL) {
-		std::cout << "Execut command [ RPOP " << key << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-	value = reply->str;
-	std::cout << "Execut command [ RPOP " << key << " ] success ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+bool RedisMgr::RPop(const std::string& key, std::string& value) {
+	return _store->RPop(key, value);
 }
 
-bool RedisMgr::HSet(const std::string &key, const std::string &hkey, const std::string &value) {
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "HSET %s %s %s", key.c_str(), hkey.c_str(), value.c_str());
-	if (reply == nullptr ) {
-		std::cout << "Execut command [ HSet " << key << "  " << hkey <<"  " << value << " ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	if (reply->type != REDIS_REPLY_INTEGER) {
-		std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+bool RedisMgr::LRange(const std::string& key, int start, int stop, std::vector<std::string>& values) {
+	return _store->LRange(key, start, stop, values);
 }
 
-bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	 const char* argv[4];
-	 size_t argvlen[4];
-	 argv[0] = "HSET";
-	argvlen[0] = 4;
-	argv[1] = key;
-	argvlen[1] = strlen(key);
-	argv[2] = hkey;
-	argvlen[2] = strlen(hkey);
-	argv[3] = hvalue;
-	argvlen[3] = hvaluelen;
-
-	auto reply = (redisReply*)redisCommandArgv(connect, 4, argv, argvlen);
-	if (reply == nullptr ) {
-		std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-
-	if (reply->type != REDIS_REPLY_INTEGER) {
-		std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
-	std::cout << "Execut command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] success ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+bool RedisMgr::LTrim(const std::string& key, int start, int stop) {
+	return _store->LTrim(key, start, stop);
 }
 
-std::string RedisMgr::HGet(const std::string &key, const std::string &hkey)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return "";
-	}
-	const char* argv[3];
-	size_t argvlen[3];
-	argv[0] = "HGET";
-	argvlen[0] = 4;
-	argv[1] = key.c_str();
-	argvlen[1] = key.length();
-	argv[2] = hkey.c_str();
-	argvlen[2] = hkey.length();
-	
-	auto reply = (redisReply*)redisCommandArgv(connect, 3, argv, argvlen);
-	if (reply == nullptr ) {
-		std::cout << "Execut command [ HGet " << key << " "<< hkey <<"  ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return "";
-	}
-
-	if ( reply->type == REDIS_REPLY_NIL) {
-		freeReplyObject(reply);
-		std::cout << "Execut command [ HGet " << key << " " << hkey << "  ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return "";
-	}
-
-	std::string value = reply->str;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	std::cout << "Execut command [ HGet " << key << " " << hkey << " ] success ! " << std::endl;
-	return value;
+//原子自增，多个ChatServer同时修改同一用户的版本号时也不会丢失更新
+bool RedisMgr::Incr(const std::string& key, long long& value) {
+	return _store->Incr(key, value);
 }
 
-bool RedisMgr::HDel(const std::string& key, const std::string& field)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
+bool RedisMgr::HIncrBy(const std::string& key, const std::string& hkey, long long delta, long long& value) {
+	return _store->HIncrBy(key, hkey, delta, value);
+}
 
-	Defer defer([&connect, this]() {
-		_con_pool->returnConnection(connect);
-		});
+bool RedisMgr::HSet(const std::string& key, const std::string& hkey, const std::string& value) {
+	return _store->HSet(key, hkey, value);
+}
 
-	redisReply* reply = (redisReply*)redisCommand(connect, "HDEL %s %s", key.c_str(), field.c_str());
-	if (reply == nullptr) {
-		std::cerr << "HDEL command failed" << std::endl;
-		return false;
-	}
+bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen) {
+	return _store->HSet(key, hkey, hvalue, hvaluelen);
+}
 
-	bool success = false;
-	if (reply->type == REDIS_REPLY_INTEGER) {
-		success = reply->integer > 0;
-	}
+std::string RedisMgr::HGet(const std::string& key, const std::string& hkey) {
+	return _store->HGet(key, hkey);
+}
 
-	freeReplyObject(reply);
-	return success;
+bool RedisMgr::HDel(const std::string& key, const std::string& field) {
+	return _store->HDel(key, field);
 }
 
-bool RedisMgr::Del(const std::string &key)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
-	auto reply = (redisReply*)redisCommand(connect, "DEL %s", key.c_str());
-	if (reply == nullptr ) {
-		std::cout << "Execut command [ Del " << key <<  " ] failure ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return false;
-	}
+bool RedisMgr::Del(const std::string& key) {
+	return _store->Del(key);
+}
 
-	if ( reply->type != REDIS_REPLY_INTEGER) {
-		std::cout << "Execut command [ Del " << key << " ] failure ! " << std::endl;
-		freeReplyObject(reply);
-		_con_pool->returnConnection(connect);
-		return false;
-	}
+bool RedisMgr::ExistsKey(const std::string& key) {
+	return _store->ExistsKey(key);
+}
 
-	std::cout << "Execut command [ Del " << key << " ] success ! " << std::endl;
-	 freeReplyObject(reply);
-	 _con_pool->returnConnection(connect);
-	 return true;
+bool RedisMgr::Expire(const std::string& key, int seconds) {
+	return _store->Expire(key, seconds);
 }
 
-bool RedisMgr::ExistsKey(const std::string &key)
-{
-	auto connect = _con_pool->getConnection();
-	if (connect == nullptr) {
-		return false;
-	}
+bool RedisMgr::XAdd(const std::string& key, const std::string& value, long long maxlen, std::string& id) {
+	return _store->XAdd(key, value, maxlen, id);
+}
 
-	auto reply = (redisReply*)redisCommand(connect, "exists %s", key.c_str());
-	if (reply == nullptr ) {
-		std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		return false;
-	}
+bool RedisMgr::XRead(const std::string& key, const std::string& last_id, int count, int block_ms,
+	std::vector<std::pair<std::string, std::string>>& entries) {
+	return _store->XRead(key, last_id, count, block_ms, entries);
+}
 
-	if (reply->type != REDIS_REPLY_INTEGER || reply->integer == 0) {
-		std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
-		_con_pool->returnConnection(connect);
-		freeReplyObject(reply);
-		return false;
+std::shared_ptr<KvStore> RedisMgr::OpenStore(size_t pool_size) {
+	if (_b_memory) {
+		return _store;
 	}
-	std::cout << " Found [ Key " << key << " ] exists ! " << std::endl;
-	freeReplyObject(reply);
-	_con_pool->returnConnection(connect);
-	return true;
+	return std::make_shared<RedisKvStore>(pool_size);
 }
-
-
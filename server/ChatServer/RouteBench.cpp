@@ -0,0 +1,268 @@
+#include "RouteBench.h"
+#include "BrokerChannel.h"
+#include "PeerInbox.h"
+#include "PeerChannel.h"
+#include "LatencyHistogram.h"
+#include "RedisMgr.h"
+#include "const.h"
+#include "message.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//等所有事件送达的最长时间，超过后没送达的计入丢失
+#define ROUTE_BENCH_WAIT_MS 30000
+//单个事件延迟的上限(微秒)
+#define ROUTE_BENCH_MAX_LATENCY_US 60000000
+
+namespace {
+	int64_t NowMicros() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// 所有节点共用的统计
+	struct BenchStat {
+		BenchStat() : _histogram(ROUTE_BENCH_MAX_LATENCY_US, 3), _received(0), _lost(0) {}
+
+		// 事件的msgid是发送时间，收到时记录延迟
+		void OnBatch(const message::PeerBatch& batch) {
+			auto now_us = NowMicros();
+			for (auto& event : batch.events()) {
+				if (event.text_msg().textmsgs_size() > 0) {
+					_histogram.Record(now_us - atoll(event.text_msg().textmsgs(0).msgid().c_str()));
+				}
+			}
+			_received.fetch_add(batch.events_size(), std::memory_order_relaxed);
+		}
+
+		LatencyHistogram _histogram;
+		std::atomic<uint64_t> _received;
+		std::atomic<uint64_t> _lost;
+	};
+
+	// mesh模式下节点的ChatService，只实现DeliverStream：统计后回复累计确认
+	class MeshNodeService : public message::ChatService::Service {
+	public:
+		explicit MeshNodeService(BenchStat* stat) : _stat(stat) {}
+
+		grpc::Status DeliverStream(grpc::ServerContext* context,
+			grpc::ServerReaderWriter<message::PeerAck, message::PeerBatch>* stream) override {
+			message::PeerBatch batch;
+			while (stream->Read(&batch)) {
+				_stat->OnBatch(batch);
+				message::PeerAck ack;
+				if (batch.events_size() > 0) {
+					ack.set_acked_seq(batch.events(batch.events_size() - 1).seq());
+				}
+				if (!stream->Write(ack)) {
+					break;
+				}
+			}
+			return grpc::Status::OK;
+		}
+	private:
+		BenchStat* _stat;
+	};
+
+	struct BenchResult {
+		size_t _links;
+		uint64_t _events;
+		uint64_t _received;
+		uint64_t _lost;
+		double _rate;
+		int64_t _p50;
+		int64_t _p99;
+	};
+
+	// 每个节点一个线程，把事件轮流发给其他节点，senders[i][j]是节点i发给节点j的通道
+	void SendAll(std::vector<std::vector<std::shared_ptr<PeerSender>>>& senders, int events_per_node) {
+		int nodes = static_cast<int>(senders.size());
+		std::vector<std::thread> threads;
+		for (int i = 0; i < nodes; ++i) {
+			threads.emplace_back([&senders, i, nodes, events_per_node]() {
+				for (int k = 0; k < events_per_node; ++k) {
+					int target = (i + 1 + k % (nodes - 1)) % nodes;
+					PeerEventItem item;
+					auto* req = item._event.mutable_text_msg();
+					req->set_fromuid(i);
+					req->set_touid(target);
+					auto* msg = req->add_textmsgs();
+					msg->set_msgid(std::to_string(NowMicros()));
+					msg->set_msgcontent("routebench");
+					senders[i][target]->Post(std::move(item));
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+	}
+
+	// 发完后等所有事件送达或者降级，返回从开始发送到最后一个事件送达的速率
+	void WaitAll(BenchStat& stat, uint64_t total, std::chrono::steady_clock::time_point begin, BenchResult& result) {
+		auto deadline = begin + std::chrono::milliseconds(ROUTE_BENCH_WAIT_MS);
+		while (stat._received.load() + stat._lost.load() < total && std::chrono::steady_clock::now() < deadline) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+		result._events = total;
+		result._received = stat._received.load();
+		result._lost = total - (std::min)(result._received, total);
+		result._rate = seconds > 0 ? result._received / seconds : 0;
+		LatencyHistogram::Snapshot snapshot;
+		stat._histogram.GetSnapshot(snapshot);
+		result._p50 = stat._histogram.Percentile(snapshot, 50);
+		result._p99 = stat._histogram.Percentile(snapshot, 99);
+	}
+
+	PeerChannelConfig BenchConfig(int events_per_node) {
+		// 积压上限放开，只有连接或者存储出错时才降级
+		PeerChannelConfig config;
+		config._batch_size = 256;
+		config._batch_bytes = 65536;
+		config._flush_us = 200;
+		config._ack_timeout_ms = 5000;
+		config._max_pending = static_cast<size_t>(events_per_node) + 1;
+		config._breaker_failures = 5;
+		config._breaker_open_ms = 5000;
+		return config;
+	}
+
+	bool RunMesh(int nodes, int events_per_node, BenchResult& result) {
+		BenchStat stat;
+		MeshNodeService service(&stat);
+		std::vector<std::unique_ptr<grpc::Server>> servers;
+		std::vector<int> ports;
+		for (int i = 0; i < nodes; ++i) {
+			int port = 0;
+			grpc::ServerBuilder builder;
+			builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+			builder.RegisterService(&service);
+			auto server = builder.BuildAndStart();
+			if (!server || port == 0) {
+				std::cout << "routebench: start mesh node " << i << " failed" << std::endl;
+				for (auto& started : servers) {
+					started->Shutdown();
+				}
+				return false;
+			}
+			servers.push_back(std::move(server));
+			ports.push_back(port);
+		}
+
+		auto config = BenchConfig(events_per_node);
+		auto fallback = [&stat](PeerEventItem&) {
+			stat._lost.fetch_add(1, std::memory_order_relaxed);
+		};
+		std::vector<std::vector<std::shared_ptr<PeerSender>>> senders(nodes);
+		for (int i = 0; i < nodes; ++i) {
+			senders[i].resize(nodes);
+			for (int j = 0; j < nodes; ++j) {
+				if (i != j) {
+					senders[i][j] = std::make_shared<PeerChannel>("mesh" + std::to_string(i), "mesh" + std::to_string(j),
+						"127.0.0.1", std::to_string(ports[j]), config, fallback);
+				}
+			}
+		}
+
+		auto begin = std::chrono::steady_clock::now();
+		SendAll(senders, events_per_node);
+		WaitAll(stat, static_cast<uint64_t>(nodes) * events_per_node, begin, result);
+		result._links = static_cast<size_t>(nodes) * (nodes - 1);
+
+		for (auto& row : senders) {
+			for (auto& sender : row) {
+				if (sender) {
+					sender->Stop();
+				}
+			}
+		}
+		for (auto& server : servers) {
+			server->Shutdown(std::chrono::system_clock::now() + std::chrono::milliseconds(1000));
+		}
+		return true;
+	}
+
+	bool RunBroker(int nodes, int events_per_node, BenchResult& result) {
+		BenchStat stat;
+		auto redis = RedisMgr::GetInstance();
+		// 每次运行用不同的节点名，不会读到上一次留下的收件箱
+		auto prefix = "routebench" + std::to_string(NowMicros()) + "_";
+		std::vector<std::unique_ptr<PeerInbox>> inboxes;
+		std::vector<std::shared_ptr<KvStore>> stores;
+		for (int i = 0; i < nodes; ++i) {
+			auto inbox_store = redis->OpenStore(1);
+			inboxes.emplace_back(new PeerInbox(prefix + std::to_string(i), inbox_store,
+				[&stat](const message::PeerBatch& batch) {
+				stat.OnBatch(batch);
+			}));
+			inboxes.back()->Start();
+			stores.push_back(redis->OpenStore(2));
+		}
+
+		auto config = BenchConfig(events_per_node);
+		auto fallback = [&stat](PeerEventItem&) {
+			stat._lost.fetch_add(1, std::memory_order_relaxed);
+		};
+		std::vector<std::vector<std::shared_ptr<PeerSender>>> senders(nodes);
+		for (int i = 0; i < nodes; ++i) {
+			senders[i].resize(nodes);
+			for (int j = 0; j < nodes; ++j) {
+				if (i != j) {
+					senders[i][j] = std::make_shared<BrokerChannel>(prefix + std::to_string(i), prefix + std::to_string(j),
+						stores[i], config, fallback);
+				}
+			}
+		}
+
+		auto begin = std::chrono::steady_clock::now();
+		SendAll(senders, events_per_node);
+		WaitAll(stat, static_cast<uint64_t>(nodes) * events_per_node, begin, result);
+		result._links = static_cast<size_t>(nodes) * 2;
+
+		for (auto& row : senders) {
+			for (auto& sender : row) {
+				if (sender) {
+					sender->Stop();
+				}
+			}
+		}
+		for (auto& inbox : inboxes) {
+			inbox->Stop();
+		}
+		for (int i = 0; i < nodes; ++i) {
+			redis->Del(PEER_INBOX_PREFIX + prefix + std::to_string(i));
+			redis->HDel(PEER_INBOX_OFFSET, prefix + std::to_string(i));
+		}
+		return true;
+	}
+}
+
+void RouteBench::Run(int events_per_node, const std::string& mode) {
+	const int node_counts[] = { 2, 8, 32 };
+	events_per_node = (std::max)(events_per_node, 1);
+	std::cout << "routebench " << mode << ", " << events_per_node << " events per node" << std::endl;
+	std::cout << std::setw(8) << "mode" << std::setw(7) << "nodes" << std::setw(7) << "links" << std::setw(10) << "events"
+		<< std::setw(12) << "events/s" << std::setw(10) << "p50(us)" << std::setw(10) << "p99(us)" << std::setw(8) << "lost" << std::endl;
+	for (int nodes : node_counts) {
+		for (int b_broker = 0; b_broker < 2; ++b_broker) {
+			if ((mode == "mesh" && b_broker) || (mode == "broker" && !b_broker)) {
+				continue;
+			}
+			BenchResult result;
+			bool b_ok = b_broker ? RunBroker(nodes, events_per_node, result) : RunMesh(nodes, events_per_node, result);
+			if (!b_ok) {
+				continue;
+			}
+			std::cout << std::setw(8) << (b_broker ? "broker" : "mesh") << std::setw(7) << nodes << std::setw(7) << result._links
+				<< std::setw(10) << result._events << std::setw(12) << static_cast<int64_t>(result._rate)
+				<< std::setw(10) << result._p50 << std::setw(10) << result._p99 << std::setw(8) << result._lost << std::endl;
+		}
+	}
+}
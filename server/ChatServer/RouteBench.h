@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+
+// RouteBench：对比两种跨服务器路由方式的吞吐量和延迟
+// 在控制台输入 routebench [每个节点的事件数] [mesh|broker|all]，在本进程内分别模拟2、8、32个ChatServer节点：
+// mesh每个节点是一个本机gRPC服务，节点之间两两建立PeerChannel，共N*(N-1)条连接；
+// broker每个节点只有一个追加用的存储和一个PeerInbox，事件经过 [Storage] KvBackend 配置的存储(redis流或者进程内存储)转发，共2N个连接。
+// 每个节点把事件轮流发给其他所有节点，打印连接数、完成速率、从Post到对端处理的p50/p99和降级(丢失)的事件数
+class RouteBench
+{
+public:
+	static void Run(int events_per_node, const std::string& mode);
+};
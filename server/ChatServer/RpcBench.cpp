@@ -0,0 +1,168 @@
+#include "RpcBench.h"
+#include "ConfigMgr.h"
+#include "LatencyHistogram.h"
+#include "message.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+//第一档的速率(次/秒)
+#define RPC_BENCH_START_RATE 1000
+//最高速率，到了之后不再加压
+#define RPC_BENCH_MAX_RATE 1000000
+//每一档的持续时间
+#define RPC_BENCH_STEP_MS 3000
+//单次调用的超时，超时计入失败
+#define RPC_BENCH_DEADLINE_MS 5000
+
+namespace {
+	struct BenchCall {
+		virtual ~BenchCall() {}
+		grpc::ClientContext _context;
+		grpc::Status _status;
+		std::chrono::steady_clock::time_point _start;
+	};
+
+	template <typename Rsp>
+	struct TypedBenchCall : public BenchCall {
+		Rsp _rsp;
+		std::unique_ptr<grpc::ClientAsyncResponseReader<Rsp>> _reader;
+	};
+
+	// 发出一次调用，结果由完成队列的轮询线程统计
+	typedef std::function<void(grpc::CompletionQueue*)> Issue;
+
+	struct StepResult {
+		uint64_t _sent;
+		uint64_t _failed;
+		double _achieved;
+		int64_t _p50;
+		int64_t _p99;
+	};
+
+	template <typename Rsp, typename Prepare>
+	void StartCall(grpc::CompletionQueue* cq, Prepare prepare) {
+		auto* call = new TypedBenchCall<Rsp>();
+		call->_start = std::chrono::steady_clock::now();
+		call->_context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(RPC_BENCH_DEADLINE_MS));
+		call->_reader = prepare(&call->_context, cq);
+		call->_reader->StartCall();
+		call->_reader->Finish(&call->_rsp, &call->_status, call);
+	}
+
+	StepResult RunStep(const Issue& issue, int rate) {
+		grpc::CompletionQueue cq;
+		LatencyHistogram histogram(static_cast<int64_t>(RPC_BENCH_DEADLINE_MS) * 2000, 3);
+		std::atomic<uint64_t> failed(0);
+		std::chrono::steady_clock::time_point last_done;
+		std::thread poll_thread([&cq, &histogram, &failed, &last_done]() {
+			void* tag = nullptr;
+			bool ok = false;
+			while (cq.Next(&tag, &ok)) {
+				std::unique_ptr<BenchCall> call(static_cast<BenchCall*>(tag));
+				last_done = std::chrono::steady_clock::now();
+				if (!ok || !call->_status.ok()) {
+					failed.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+				histogram.Record(std::chrono::duration_cast<std::chrono::microseconds>(last_done - call->_start).count());
+			}
+		});
+
+		// 按经过的时间算出应该发出的调用数，补齐后睡一小段，不受sleep精度影响
+		uint64_t sent = 0;
+		auto begin = std::chrono::steady_clock::now();
+		auto end = begin + std::chrono::milliseconds(RPC_BENCH_STEP_MS);
+		for (auto now = begin; now < end; now = std::chrono::steady_clock::now()) {
+			auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(now - begin).count();
+			uint64_t due = static_cast<uint64_t>(elapsed_us) * rate / 1000000;
+			for (; sent < due; ++sent) {
+				issue(&cq);
+			}
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		// 所有调用都带超时，Shutdown之后Next会把剩下的结果取完再返回false
+		cq.Shutdown();
+		poll_thread.join();
+
+		StepResult result;
+		result._sent = sent;
+		result._failed = failed.load();
+		double seconds = std::chrono::duration<double>(last_done - begin).count();
+		result._achieved = seconds > 0 ? (sent - result._failed) / seconds : 0;
+		LatencyHistogram::Snapshot snapshot;
+		histogram.GetSnapshot(snapshot);
+		result._p50 = histogram.Percentile(snapshot, 50);
+		result._p99 = histogram.Percentile(snapshot, 99);
+		return result;
+	}
+}
+
+void RpcBench::Run(int p99_ms, const std::string& target) {
+	auto& cfg = ConfigMgr::Inst();
+	std::string address;
+	Issue issue;
+	if (target == "status") {
+		address = cfg["StatusServer"]["Host"] + ":" + cfg["StatusServer"]["Port"];
+		auto stub = std::shared_ptr<message::StatusService::Stub>(
+			message::StatusService::NewStub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials())));
+		issue = [stub](grpc::CompletionQueue* cq) {
+			message::LoginReq req;
+			req.set_uid(-1);
+			req.set_token("rpcbench");
+			StartCall<message::LoginRsp>(cq, [&stub, &req](grpc::ClientContext* context, grpc::CompletionQueue* cq) {
+				return stub->PrepareAsyncLogin(context, req, cq);
+			});
+		};
+	}
+	else {
+		// 监听在0.0.0.0时通过本机地址连接
+		auto host = cfg["SelfServer"]["Host"];
+		if (host == "0.0.0.0") {
+			host = "127.0.0.1";
+		}
+		address = host + ":" + cfg["SelfServer"]["RPCPort"];
+		auto stub = std::shared_ptr<message::ChatService::Stub>(
+			message::ChatService::NewStub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials())));
+		issue = [stub](grpc::CompletionQueue* cq) {
+			message::TextChatMsgReq req;
+			req.set_fromuid(0);
+			req.set_touid(-1);
+			auto* msg = req.add_textmsgs();
+			msg->set_msgid("rpcbench");
+			msg->set_msgcontent("rpcbench");
+			StartCall<message::TextChatMsgRsp>(cq, [&stub, &req](grpc::ClientContext* context, grpc::CompletionQueue* cq) {
+				return stub->PrepareAsyncNotifyTextChatMsg(context, req, cq);
+			});
+		};
+	}
+
+	std::cout << "rpcbench " << target << " " << address << ", target p99 " << p99_ms << " ms" << std::endl;
+	std::cout << std::setw(10) << "rate" << std::setw(12) << "achieved" << std::setw(10) << "p50(us)"
+		<< std::setw(10) << "p99(us)" << std::setw(10) << "failed" << std::endl;
+	int best_rate = 0;
+	double best_achieved = 0;
+	for (int rate = RPC_BENCH_START_RATE; rate <= RPC_BENCH_MAX_RATE; rate = rate * 3 / 2) {
+		auto result = RunStep(issue, rate);
+		std::cout << std::setw(10) << rate << std::setw(12) << static_cast<int64_t>(result._achieved)
+			<< std::setw(10) << result._p50 << std::setw(10) << result._p99 << std::setw(10) << result._failed << std::endl;
+		if (result._p99 > static_cast<int64_t>(p99_ms) * 1000 || result._failed * 100 > result._sent) {
+			break;
+		}
+		best_rate = rate;
+		best_achieved = result._achieved;
+	}
+
+	if (best_rate == 0) {
+		std::cout << "rpcbench: p99 above " << p99_ms << " ms even at " << RPC_BENCH_START_RATE << " rpc/s" << std::endl;
+		return;
+	}
+	std::cout << "rpcbench: " << static_cast<int64_t>(best_achieved) << " rpc/s at p99 <= " << p99_ms
+		<< " ms (offered " << best_rate << " rpc/s)" << std::endl;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+
+// RpcBench：固定p99下的gRPC吞吐量测试
+// 在控制台输入 rpcbench [p99毫秒] [chat|status]，chat压本机ChatService的NotifyTextChatMsg(接收方不在线，只查找会话)，
+// status压StatusServer的Login(不存在的uid，只有一次redis查询)。
+// 开环发送：按目标速率匀速发出异步调用，不等回包，服务端排队的时间也计入延迟；每档持续几秒，
+// 速率逐档乘1.5，p99超过目标或者失败超过1%时停止，打印每档的p50/p99和完成速率，最后给出满足p99的最高速率
+class RpcBench
+{
+public:
+	static void Run(int p99_ms, const std::string& target);
+};
@@ -0,0 +1,248 @@
+#include "Sha256.h"
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SHA256_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define SHA256_TARGET
+#else
+#include <cpuid.h>
+#define SHA256_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+#endif
+#endif
+
+//哈希文件时每次读取的长度
+#define SHA256_FILE_BUF_LEN (1024 * 1024)
+
+static const uint32_t K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t Rotr(uint32_t x, int n) {
+	return (x >> n) | (x << (32 - n));
+}
+
+//软件实现，每次处理一个64字节的块
+static void TransformSoft(uint32_t state[8], const uint8_t* data, std::size_t blocks) {
+	uint32_t w[64];
+	for (std::size_t b = 0; b < blocks; ++b, data += 64) {
+		for (int i = 0; i < 16; ++i) {
+			w[i] = ((uint32_t)data[i * 4] << 24) | ((uint32_t)data[i * 4 + 1] << 16)
+				| ((uint32_t)data[i * 4 + 2] << 8) | (uint32_t)data[i * 4 + 3];
+		}
+		for (int i = 16; i < 64; ++i) {
+			uint32_t s0 = Rotr(w[i - 15], 7) ^ Rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+			uint32_t s1 = Rotr(w[i - 2], 17) ^ Rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+			w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+		}
+
+		uint32_t a = state[0], b1 = state[1], c = state[2], d = state[3];
+		uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+		for (int i = 0; i < 64; ++i) {
+			uint32_t S1 = Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25);
+			uint32_t ch = (e & f) ^ (~e & g);
+			uint32_t t1 = h + S1 + ch + K[i] + w[i];
+			uint32_t S0 = Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22);
+			uint32_t maj = (a & b1) ^ (a & c) ^ (b1 & c);
+			uint32_t t2 = S0 + maj;
+			h = g; g = f; f = e; e = d + t1;
+			d = c; c = b1; b1 = a; a = t1 + t2;
+		}
+		state[0] += a; state[1] += b1; state[2] += c; state[3] += d;
+		state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+	}
+}
+
+#ifdef SHA256_X86
+
+//SHA-NI实现，每条sha256rnds2指令完成两轮，消息扩展由sha256msg1/sha256msg2完成
+SHA256_TARGET
+static void TransformHard(uint32_t state[8], const uint8_t* data, std::size_t blocks) {
+	const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+	//状态字从ABCDEFGH重排成指令需要的ABEF和CDGH
+	__m128i tmp = _mm_loadu_si128((const __m128i*)&state[0]);
+	__m128i state1 = _mm_loadu_si128((const __m128i*)&state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);
+	state1 = _mm_shuffle_epi32(state1, 0x1B);
+	__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+	for (std::size_t b = 0; b < blocks; ++b, data += 64) {
+		__m128i abef_save = state0;
+		__m128i cdgh_save = state1;
+		__m128i w[4];
+		for (int i = 0; i < 16; ++i) {
+			__m128i m;
+			if (i < 4) {
+				m = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + i * 16)), MASK);
+			}
+			else {
+				//W[t] = W[t-16] + s0(W[t-15]) + W[t-7] + s1(W[t-2])，每次算4个
+				m = _mm_sha256msg1_epu32(w[(i - 4) & 3], w[(i - 3) & 3]);
+				m = _mm_add_epi32(m, _mm_alignr_epi8(w[(i - 1) & 3], w[(i - 2) & 3], 4));
+				m = _mm_sha256msg2_epu32(m, w[(i - 1) & 3]);
+			}
+			w[i & 3] = m;
+
+			__m128i msg = _mm_add_epi32(m, _mm_loadu_si128((const __m128i*)&K[i * 4]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+		}
+		state0 = _mm_add_epi32(state0, abef_save);
+		state1 = _mm_add_epi32(state1, cdgh_save);
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B);
+	state1 = _mm_shuffle_epi32(state1, 0xB1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+	_mm_storeu_si128((__m128i*)&state[0], state0);
+	_mm_storeu_si128((__m128i*)&state[4], state1);
+}
+
+static bool DetectHardware() {
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return false;
+	}
+	__cpuid(info, 1);
+	bool sse41 = (info[2] & (1 << 19)) != 0;
+	bool ssse3 = (info[2] & (1 << 9)) != 0;
+	__cpuidex(info, 7, 0);
+	bool sha = (info[1] & (1 << 29)) != 0;
+#else
+	unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return false;
+	}
+	bool sse41 = (ecx & (1 << 19)) != 0;
+	bool ssse3 = (ecx & (1 << 9)) != 0;
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+		return false;
+	}
+	bool sha = (ebx & (1 << 29)) != 0;
+#endif
+	return sse41 && ssse3 && sha;
+}
+
+#else
+
+static bool DetectHardware() {
+	return false;
+}
+
+#endif
+
+bool Sha256::HasHardwareSupport() {
+	static const bool b_support = DetectHardware();
+	return b_support;
+}
+
+Sha256::Sha256() : _buf_len(0), _total_len(0) {
+	static const uint32_t init[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+	};
+	memcpy(_state, init, sizeof(_state));
+}
+
+void Sha256::Transform(const uint8_t* data, std::size_t blocks) {
+#ifdef SHA256_X86
+	if (HasHardwareSupport()) {
+		TransformHard(_state, data, blocks);
+		return;
+	}
+#endif
+	TransformSoft(_state, data, blocks);
+}
+
+void Sha256::Update(const void* data, std::size_t len) {
+	auto p = (const uint8_t*)data;
+	_total_len += len;
+	if (_buf_len > 0) {
+		std::size_t n = std::min(len, sizeof(_buf) - _buf_len);
+		memcpy(_buf + _buf_len, p, n);
+		_buf_len += n;
+		p += n;
+		len -= n;
+		if (_buf_len < sizeof(_buf)) {
+			return;
+		}
+		Transform(_buf, 1);
+		_buf_len = 0;
+	}
+
+	//整块直接处理，不经过缓冲区
+	if (len >= 64) {
+		Transform(p, len / 64);
+		p += len / 64 * 64;
+		len %= 64;
+	}
+
+	memcpy(_buf, p, len);
+	_buf_len = len;
+}
+
+std::string Sha256::HexDigest() {
+	uint64_t bit_len = _total_len * 8;
+	uint8_t pad[72] = { 0x80 };
+	std::size_t pad_len = (_buf_len < 56) ? (56 - _buf_len) : (120 - _buf_len);
+	Update(pad, pad_len);
+	uint8_t len_be[8];
+	for (int i = 0; i < 8; ++i) {
+		len_be[i] = (uint8_t)(bit_len >> (56 - i * 8));
+	}
+	Update(len_be, 8);
+
+	static const char* hex_chars = "0123456789abcdef";
+	std::string hex;
+	hex.reserve(64);
+	for (auto word : _state) {
+		for (int i = 3; i >= 0; --i) {
+			uint8_t c = (uint8_t)(word >> (i * 8));
+			hex.push_back(hex_chars[c >> 4]);
+			hex.push_back(hex_chars[c & 0x0f]);
+		}
+	}
+	return hex;
+}
+
+bool Sha256::HashFile(const std::string& path, std::string& hex, long long& size) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+
+	Sha256 sha;
+	std::vector<char> buf(SHA256_FILE_BUF_LEN);
+	size = 0;
+	while (file) {
+		file.read(buf.data(), buf.size());
+		auto n = file.gcount();
+		if (n <= 0) {
+			break;
+		}
+		sha.Update(buf.data(), (std::size_t)n);
+		size += n;
+	}
+
+	if (file.bad()) {
+		return false;
+	}
+	hex = sha.HexDigest();
+	return true;
+}
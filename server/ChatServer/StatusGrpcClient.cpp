@@ -42,6 +42,29 @@ LoginRsp StatusGrpcClient::Login(int uid, std::string token)
 	}
 }
 
+HeartbeatRsp StatusGrpcClient::Heartbeat(const HeartbeatReq& request, int timeout_ms)
+{
+	ClientContext context;
+	context.set_deadline(std::chrono::system_clock::now() + std::chrono::milliseconds(timeout_ms));
+	HeartbeatRsp reply;
+	auto stub = pool_->getConnection();
+	if (stub == nullptr) {
+		reply.set_error(ErrorCodes::RPCFailed);
+		return reply;
+	}
+	Status status = stub->Heartbeat(&context, request, &reply);
+	Defer defer([&stub, this]() {
+		pool_->returnConnection(std::move(stub));
+		});
+	if (status.ok()) {
+		return reply;
+	}
+	else {
+		reply.set_error(ErrorCodes::RPCFailed);
+		return reply;
+	}
+}
+
 
 StatusGrpcClient::StatusGrpcClient()
 {
@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 class CSession;
 class UserMgr: public Singleton<UserMgr>
@@ -13,6 +14,8 @@ public:
 	std::shared_ptr<CSession> GetSession(int uid);
 	void SetUserSession(int uid, std::shared_ptr<CSession> session);
 	void RmvUserSession(int uid);
+	//获取本服务器所有在线用户
+	std::vector<int> GetUids();
 private:
 	UserMgr();
 	std::mutex _session_mtx;
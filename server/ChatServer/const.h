@@ -4,27 +4,30 @@
 
 enum ErrorCodes {
 	Success = 0,
-	Error_Json = 1001,  //Json
-	RPCFailed = 1002,  //RPC
-	VarifyExpired = 1003, //֤
-	VarifyCodeErr = 1004, //֤
-	UserExist = 1005,       //ûѾ
-	PasswdErr = 1006,    //
-	EmailNotMatch = 1007,  //䲻ƥ
-	PasswdUpFailed = 1008,  //ʧ
-	PasswdInvalid = 1009,   //ʧ
-	TokenInvalid = 1010,   //TokenʧЧ
-	UidInvalid = 1011,  //uidЧ
+	Error_Json = 1001,  //Json解析错误
+	RPCFailed = 1002,  //RPC请求错误
+	VarifyExpired = 1003, //验证码过期
+	VarifyCodeErr = 1004, //验证码错误
+	UserExist = 1005,       //用户已经存在
+	PasswdErr = 1006,    //密码错误
+	EmailNotMatch = 1007,  //邮箱不匹配
+	PasswdUpFailed = 1008,  //更新密码失败
+	PasswdInvalid = 1009,   //密码更新失败
+	TokenInvalid = 1010,   //Token失效
+	UidInvalid = 1011,  //uid无效
+	FileInvalid = 1012,  //文件id或大小非法
+	FileNotExist = 1013,  //文件不存在
+	FileOffsetErr = 1014,  //文件偏移不匹配
 };
 
 
-// Defer
+// Defer类
 class Defer {
 public:
-	// һlambdaʽߺָ
+	// 接受一个lambda表达式或者函数指针
 	Defer(std::function<void()> func) : func_(func) {}
 
-	// ִдĺ
+	// 析构函数中执行传入的函数
 	~Defer() {
 		func_();
 	}
@@ -34,30 +37,68 @@ private:
 };
 
 #define MAX_LENGTH  1024*2
-//ͷܳ
+//头部总长度
 #define HEAD_TOTAL_LEN 4
-//ͷid
+//头部id长度
 #define HEAD_ID_LEN 2
-//ͷݳ
+//头部数据长度
 #define HEAD_DATA_LEN 2
+//消息id最高位表示消息体经过zstd压缩
+#define MSG_COMPRESS_FLAG 0x8000
+//消息id次高位表示消息体前面带TRACE_ID_LEN字节的trace id(网络字节序)，trace id不参与压缩
+#define MSG_TRACE_FLAG 0x4000
+#define TRACE_ID_LEN 8
+//默认压缩级别
+#define COMPRESS_DEFAULT_LEVEL 3
+//小于这个长度的帧不压缩
+#define COMPRESS_MIN_LEN 256
+//训练字典的默认大小
+#define COMPRESS_DICT_SIZE (16 * 1024)
 #define MAX_RECVQUE  10000
 #define MAX_SENDQUE 1000
+//一帧消息确认中最多合并的条数
+#define MAX_ACK_BATCH 200
+//平滑升级时等待会话冻结的超时时间(秒)
+#define HANDOFF_TIMEOUT_SEC 5
+//每条unix域消息携带的socket句柄数
+#define HANDOFF_FD_BATCH 200
+//文件id最大长度
+#define MAX_FILE_ID_LEN 64
+//上传文件大小上限，和客户端限制一致
+#define MAX_FILE_SIZE (100LL * 1024 * 1024)
+//上传时每块最大长度
+#define FILE_CHUNK_MAX_LEN (4 * 1024 * 1024)
+//每次splice的长度，不超过管道默认容量
+#define FILE_SPLICE_LEN (64 * 1024)
+//每次sendfile的长度
+#define FILE_SENDFILE_LEN (1024 * 1024)
+//不支持零拷贝时文件读写缓冲区大小
+#define FILE_IO_BUF_LEN (256 * 1024)
 
 
 enum MSG_IDS {
-	MSG_CHAT_LOGIN = 1005, //û½
-	MSG_CHAT_LOGIN_RSP = 1006, //û½ذ
-	ID_SEARCH_USER_REQ = 1007, //û
-	ID_SEARCH_USER_RSP = 1008, //ûذ
-	ID_ADD_FRIEND_REQ = 1009, //Ӻ
-	ID_ADD_FRIEND_RSP  = 1010, //Ӻѻظ
-	ID_NOTIFY_ADD_FRIEND_REQ = 1011,  //֪ͨûӺ
-	ID_AUTH_FRIEND_REQ = 1013,  //֤
-	ID_AUTH_FRIEND_RSP = 1014,  //֤ѻظ
-	ID_NOTIFY_AUTH_FRIEND_REQ = 1015, //֪ͨû֤
-	ID_TEXT_CHAT_MSG_REQ = 1017, //ıϢ
-	ID_TEXT_CHAT_MSG_RSP = 1018, //ıϢظ
-	ID_NOTIFY_TEXT_CHAT_MSG_REQ = 1019, //֪ͨûıϢ
+	MSG_CHAT_LOGIN = 1005, //用户登陆
+	MSG_CHAT_LOGIN_RSP = 1006, //用户登陆回包
+	ID_SEARCH_USER_REQ = 1007, //用户搜索请求
+	ID_SEARCH_USER_RSP = 1008, //搜索用户回包
+	ID_ADD_FRIEND_REQ = 1009, //申请添加好友请求
+	ID_ADD_FRIEND_RSP  = 1010, //申请添加好友回复
+	ID_NOTIFY_ADD_FRIEND_REQ = 1011,  //通知用户添加好友申请
+	ID_AUTH_FRIEND_REQ = 1013,  //认证好友请求
+	ID_AUTH_FRIEND_RSP = 1014,  //认证好友回复
+	ID_NOTIFY_AUTH_FRIEND_REQ = 1015, //通知用户认证好友申请
+	ID_TEXT_CHAT_MSG_REQ = 1017, //文本聊天信息请求
+	ID_TEXT_CHAT_MSG_RSP = 1018, //文本聊天信息回复
+	ID_NOTIFY_TEXT_CHAT_MSG_REQ = 1019, //通知用户文本聊天信息
+	ID_NOTIFY_MIGRATE_REQ = 1021, //通知用户迁移到其他服务器
+	ID_FILE_UPLOAD_REQ = 1101, //上传文件请求，查询断点
+	ID_FILE_UPLOAD_RSP = 1102, //上传文件回包，返回已经收到的长度
+	ID_FILE_CHUNK_REQ = 1103, //上传文件块，后面紧跟块数据
+	ID_FILE_CHUNK_RSP = 1104, //上传文件块回包
+	ID_FILE_DOWNLOAD_REQ = 1105, //下载文件请求
+	ID_FILE_DOWNLOAD_RSP = 1106, //下载文件回包，后面紧跟文件数据
+	ID_FILE_CHECK_REQ = 1107, //按内容哈希查询文件是否已经存在(秒传)
+	ID_FILE_CHECK_RSP = 1108, //查询文件回包
 };
 
 #define USERIPPREFIX  "uip_"
@@ -66,5 +107,38 @@ enum MSG_IDS {
 #define USER_BASE_INFO "ubaseinfo_"
 #define LOGIN_COUNT  "logincount"
 #define NAME_INFO  "nameinfo_"
+//好友列表、申请列表版本号及变更日志
+#define FRIEND_VER_PREFIX  "friendver_"
+#define FRIEND_LOG_PREFIX  "friendlog_"
+#define APPLY_VER_PREFIX  "applyver_"
+#define APPLY_LOG_PREFIX  "applylog_"
+//变更日志最多保留的条数，客户端版本落后更多则下发全量
+#define MAX_SYNC_LOG_LEN  200
+//用户上次登录时的资料(name、nick、icon、desc、sex)，和本次不同时记入好友的同步日志
+#define USER_PROFILE_PREFIX  "uprofile_"
+//正在排空的服务器，StatusServer不再往这些服务器分配用户
+#define DRAIN_SERVERS  "drainservers"
+//blob引用计数，field为内容哈希
+#define BLOB_REF  "blobref"
+//file_id到内容哈希的映射
+#define FILE_BLOB  "fileblob"
+//file_id的上传者uid，file_id绑定后不能被别人重新绑定
+#define FILE_OWNER  "fileowner"
+//file_id按绑定时间排列的记录，内容为"绑定时间|file_id"，到期释放引用
+#define FILE_LINK_LOG  "filelinklog"
+//去重统计，logical为所有引用的总大小，physical为实际存储的大小
+#define BLOB_STAT  "blobstat"
+//每个会话的消息序号，field为两个uid按从小到大拼接
+#define MSG_SEQ  "msgseq"
+//对端ChatServer不可用时转存的聊天消息，接收方登录时下发
+#define OFFLINE_MSG_PREFIX  "offlinemsg_"
+//每个用户最多保留的离线消息条数
+#define MAX_OFFLINE_MSG  1000
+//broker路由下每个ChatServer的收件箱(流)，后面拼接服务器名
+#define PEER_INBOX_PREFIX  "peerinbox_"
+//每个ChatServer已经处理到的收件箱消息id，field为服务器名，重启后从这里继续读
+#define PEER_INBOX_OFFSET  "peerinboxoffset"
+//进程内存储默认的分片数
+#define MEM_STORE_SHARDS  64
 
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3013000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3013000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,9 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
@@ -43,68 +41,78 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_message_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[17]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_message_2eproto;
 namespace message {
 class AddFriendReq;
-class AddFriendReqDefaultTypeInternal;
+struct AddFriendReqDefaultTypeInternal;
 extern AddFriendReqDefaultTypeInternal _AddFriendReq_default_instance_;
 class AddFriendRsp;
-class AddFriendRspDefaultTypeInternal;
+struct AddFriendRspDefaultTypeInternal;
 extern AddFriendRspDefaultTypeInternal _AddFriendRsp_default_instance_;
 class AuthFriendReq;
-class AuthFriendReqDefaultTypeInternal;
+struct AuthFriendReqDefaultTypeInternal;
 extern AuthFriendReqDefaultTypeInternal _AuthFriendReq_default_instance_;
 class AuthFriendRsp;
-class AuthFriendRspDefaultTypeInternal;
+struct AuthFriendRspDefaultTypeInternal;
 extern AuthFriendRspDefaultTypeInternal _AuthFriendRsp_default_instance_;
+class ChatServerInfo;
+struct ChatServerInfoDefaultTypeInternal;
+extern ChatServerInfoDefaultTypeInternal _ChatServerInfo_default_instance_;
 class GetChatServerReq;
-class GetChatServerReqDefaultTypeInternal;
+struct GetChatServerReqDefaultTypeInternal;
 extern GetChatServerReqDefaultTypeInternal _GetChatServerReq_default_instance_;
 class GetChatServerRsp;
-class GetChatServerRspDefaultTypeInternal;
+struct GetChatServerRspDefaultTypeInternal;
 extern GetChatServerRspDefaultTypeInternal _GetChatServerRsp_default_instance_;
 class GetVarifyReq;
-class GetVarifyReqDefaultTypeInternal;
+struct GetVarifyReqDefaultTypeInternal;
 extern GetVarifyReqDefaultTypeInternal _GetVarifyReq_default_instance_;
 class GetVarifyRsp;
-class GetVarifyRspDefaultTypeInternal;
+struct GetVarifyRspDefaultTypeInternal;
 extern GetVarifyRspDefaultTypeInternal _GetVarifyRsp_default_instance_;
+class HeartbeatReq;
+struct HeartbeatReqDefaultTypeInternal;
+extern HeartbeatReqDefaultTypeInternal _HeartbeatReq_default_instance_;
+class HeartbeatRsp;
+struct HeartbeatRspDefaultTypeInternal;
+extern HeartbeatRspDefaultTypeInternal _HeartbeatRsp_default_instance_;
 class LoginReq;
-class LoginReqDefaultTypeInternal;
+struct LoginReqDefaultTypeInternal;
 extern LoginReqDefaultTypeInternal _LoginReq_default_instance_;
 class LoginRsp;
-class LoginRspDefaultTypeInternal;
+struct LoginRspDefaultTypeInternal;
 extern LoginRspDefaultTypeInternal _LoginRsp_default_instance_;
+class PeerAck;
+struct PeerAckDefaultTypeInternal;
+extern PeerAckDefaultTypeInternal _PeerAck_default_instance_;
+class PeerBatch;
+struct PeerBatchDefaultTypeInternal;
+extern PeerBatchDefaultTypeInternal _PeerBatch_default_instance_;
+class PeerEvent;
+struct PeerEventDefaultTypeInternal;
+extern PeerEventDefaultTypeInternal _PeerEvent_default_instance_;
 class RplyFriendReq;
-class RplyFriendReqDefaultTypeInternal;
+struct RplyFriendReqDefaultTypeInternal;
 extern RplyFriendReqDefaultTypeInternal _RplyFriendReq_default_instance_;
 class RplyFriendRsp;
-class RplyFriendRspDefaultTypeInternal;
+struct RplyFriendRspDefaultTypeInternal;
 extern RplyFriendRspDefaultTypeInternal _RplyFriendRsp_default_instance_;
 class SendChatMsgReq;
-class SendChatMsgReqDefaultTypeInternal;
+struct SendChatMsgReqDefaultTypeInternal;
 extern SendChatMsgReqDefaultTypeInternal _SendChatMsgReq_default_instance_;
 class SendChatMsgRsp;
-class SendChatMsgRspDefaultTypeInternal;
+struct SendChatMsgRspDefaultTypeInternal;
 extern SendChatMsgRspDefaultTypeInternal _SendChatMsgRsp_default_instance_;
 class TextChatData;
-class TextChatDataDefaultTypeInternal;
+struct TextChatDataDefaultTypeInternal;
 extern TextChatDataDefaultTypeInternal _TextChatData_default_instance_;
 class TextChatMsgReq;
-class TextChatMsgReqDefaultTypeInternal;
+struct TextChatMsgReqDefaultTypeInternal;
 extern TextChatMsgReqDefaultTypeInternal _TextChatMsgReq_default_instance_;
 class TextChatMsgRsp;
-class TextChatMsgRspDefaultTypeInternal;
+struct TextChatMsgRspDefaultTypeInternal;
 extern TextChatMsgRspDefaultTypeInternal _TextChatMsgRsp_default_instance_;
 }  // namespace message
 PROTOBUF_NAMESPACE_OPEN
@@ -112,12 +120,18 @@ template<> ::message::AddFriendReq* Arena::CreateMaybeMessage<::message::AddFrie
 template<> ::message::AddFriendRsp* Arena::CreateMaybeMessage<::message::AddFriendRsp>(Arena*);
 template<> ::message::AuthFriendReq* Arena::CreateMaybeMessage<::message::AuthFriendReq>(Arena*);
 template<> ::message::AuthFriendRsp* Arena::CreateMaybeMessage<::message::AuthFriendRsp>(Arena*);
+template<> ::message::ChatServerInfo* Arena::CreateMaybeMessage<::message::ChatServerInfo>(Arena*);
 template<> ::message::GetChatServerReq* Arena::CreateMaybeMessage<::message::GetChatServerReq>(Arena*);
 template<> ::message::GetChatServerRsp* Arena::CreateMaybeMessage<::message::GetChatServerRsp>(Arena*);
 template<> ::message::GetVarifyReq* Arena::CreateMaybeMessage<::message::GetVarifyReq>(Arena*);
 template<> ::message::GetVarifyRsp* Arena::CreateMaybeMessage<::message::GetVarifyRsp>(Arena*);
+template<> ::message::HeartbeatReq* Arena::CreateMaybeMessage<::message::HeartbeatReq>(Arena*);
+template<> ::message::HeartbeatRsp* Arena::CreateMaybeMessage<::message::HeartbeatRsp>(Arena*);
 template<> ::message::LoginReq* Arena::CreateMaybeMessage<::message::LoginReq>(Arena*);
 template<> ::message::LoginRsp* Arena::CreateMaybeMessage<::message::LoginRsp>(Arena*);
+template<> ::message::PeerAck* Arena::CreateMaybeMessage<::message::PeerAck>(Arena*);
+template<> ::message::PeerBatch* Arena::CreateMaybeMessage<::message::PeerBatch>(Arena*);
+template<> ::message::PeerEvent* Arena::CreateMaybeMessage<::message::PeerEvent>(Arena*);
 template<> ::message::RplyFriendReq* Arena::CreateMaybeMessage<::message::RplyFriendReq>(Arena*);
 template<> ::message::RplyFriendRsp* Arena::CreateMaybeMessage<::message::RplyFriendRsp>(Arena*);
 template<> ::message::SendChatMsgReq* Arena::CreateMaybeMessage<::message::SendChatMsgReq>(Arena*);
@@ -130,11 +144,12 @@ namespace message {
 
 // ===================================================================
 
-class GetVarifyReq PROTOBUF_FINAL :
+class GetVarifyReq final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetVarifyReq) */ {
  public:
   inline GetVarifyReq() : GetVarifyReq(nullptr) {}
-  virtual ~GetVarifyReq();
+  ~GetVarifyReq() override;
+  explicit PROTOBUF_CONSTEXPR GetVarifyReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetVarifyReq(const GetVarifyReq& from);
   GetVarifyReq(GetVarifyReq&& from) noexcept
@@ -147,8 +162,13 @@ class GetVarifyReq PROTOBUF_FINAL :
     return *this;
   }
   inline GetVarifyReq& operator=(GetVarifyReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -159,14 +179,14 @@ class GetVarifyReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetVarifyReq& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetVarifyReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetVarifyReq* internal_default_instance() {
     return reinterpret_cast<const GetVarifyReq*>(
                &_GetVarifyReq_default_instance_);
@@ -179,7 +199,12 @@ class GetVarifyReq PROTOBUF_FINAL :
   }
   inline void Swap(GetVarifyReq* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -187,56 +212,53 @@ class GetVarifyReq PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetVarifyReq* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetVarifyReq* New() const final {
-    return CreateMaybeMessage<GetVarifyReq>(nullptr);
-  }
-
-  GetVarifyReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetVarifyReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetVarifyReq>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetVarifyReq& from);
-  void MergeFrom(const GetVarifyReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetVarifyReq& from) {
+    GetVarifyReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetVarifyReq* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "message.GetVarifyReq";
   }
   protected:
-  explicit GetVarifyReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetVarifyReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -248,16 +270,14 @@ class GetVarifyReq PROTOBUF_FINAL :
   // string email = 1;
   void clear_email();
   const std::string& email() const;
-  void set_email(const std::string& value);
-  void set_email(std::string&& value);
-  void set_email(const char* value);
-  void set_email(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_email(ArgT0&& arg0, ArgT... args);
   std::string* mutable_email();
-  std::string* release_email();
+  PROTOBUF_NODISCARD std::string* release_email();
   void set_allocated_email(std::string* email);
   private:
   const std::string& _internal_email() const;
-  void _internal_set_email(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(const std::string& value);
   std::string* _internal_mutable_email();
   public:
 
@@ -268,17 +288,21 @@ class GetVarifyReq PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetVarifyRsp PROTOBUF_FINAL :
+class GetVarifyRsp final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetVarifyRsp) */ {
  public:
   inline GetVarifyRsp() : GetVarifyRsp(nullptr) {}
-  virtual ~GetVarifyRsp();
+  ~GetVarifyRsp() override;
+  explicit PROTOBUF_CONSTEXPR GetVarifyRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetVarifyRsp(const GetVarifyRsp& from);
   GetVarifyRsp(GetVarifyRsp&& from) noexcept
@@ -291,8 +315,13 @@ class GetVarifyRsp PROTOBUF_FINAL :
     return *this;
   }
   inline GetVarifyRsp& operator=(GetVarifyRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -303,14 +332,14 @@ class GetVarifyRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetVarifyRsp& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetVarifyRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetVarifyRsp* internal_default_instance() {
     return reinterpret_cast<const GetVarifyRsp*>(
                &_GetVarifyRsp_default_instance_);
@@ -323,7 +352,12 @@ class GetVarifyRsp PROTOBUF_FINAL :
   }
   inline void Swap(GetVarifyRsp* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -331,56 +365,53 @@ class GetVarifyRsp PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetVarifyRsp* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetVarifyRsp* New() const final {
-    return CreateMaybeMessage<GetVarifyRsp>(nullptr);
-  }
-
-  GetVarifyRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetVarifyRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetVarifyRsp>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetVarifyRsp& from);
-  void MergeFrom(const GetVarifyRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetVarifyRsp& from) {
+    GetVarifyRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetVarifyRsp* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "message.GetVarifyRsp";
   }
   protected:
-  explicit GetVarifyRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetVarifyRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -394,42 +425,38 @@ class GetVarifyRsp PROTOBUF_FINAL :
   // string email = 2;
   void clear_email();
   const std::string& email() const;
-  void set_email(const std::string& value);
-  void set_email(std::string&& value);
-  void set_email(const char* value);
-  void set_email(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_email(ArgT0&& arg0, ArgT... args);
   std::string* mutable_email();
-  std::string* release_email();
+  PROTOBUF_NODISCARD std::string* release_email();
   void set_allocated_email(std::string* email);
   private:
   const std::string& _internal_email() const;
-  void _internal_set_email(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_email(const std::string& value);
   std::string* _internal_mutable_email();
   public:
 
   // string code = 3;
   void clear_code();
   const std::string& code() const;
-  void set_code(const std::string& value);
-  void set_code(std::string&& value);
-  void set_code(const char* value);
-  void set_code(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_code(ArgT0&& arg0, ArgT... args);
   std::string* mutable_code();
-  std::string* release_code();
+  PROTOBUF_NODISCARD std::string* release_code();
   void set_allocated_code(std::string* code);
   private:
   const std::string& _internal_code() const;
-  void _internal_set_code(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_code(const std::string& value);
   std::string* _internal_mutable_code();
   public:
 
   // int32 error = 1;
   void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t error() const;
+  void set_error(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:message.GetVarifyRsp)
@@ -439,19 +466,23 @@ class GetVarifyRsp PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr code_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetChatServerReq PROTOBUF_FINAL :
+class GetChatServerReq final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetChatServerReq) */ {
  public:
   inline GetChatServerReq() : GetChatServerReq(nullptr) {}
-  virtual ~GetChatServerReq();
+  ~GetChatServerReq() override;
+  explicit PROTOBUF_CONSTEXPR GetChatServerReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetChatServerReq(const GetChatServerReq& from);
   GetChatServerReq(GetChatServerReq&& from) noexcept
@@ -464,8 +495,13 @@ class GetChatServerReq PROTOBUF_FINAL :
     return *this;
   }
   inline GetChatServerReq& operator=(GetChatServerReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -476,14 +512,14 @@ class GetChatServerReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetChatServerReq& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetChatServerReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetChatServerReq* internal_default_instance() {
     return reinterpret_cast<const GetChatServerReq*>(
                &_GetChatServerReq_default_instance_);
@@ -496,7 +532,12 @@ class GetChatServerReq PROTOBUF_FINAL :
   }
   inline void Swap(GetChatServerReq* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -504,56 +545,53 @@ class GetChatServerReq PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetChatServerReq* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetChatServerReq* New() const final {
-    return CreateMaybeMessage<GetChatServerReq>(nullptr);
-  }
-
-  GetChatServerReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetChatServerReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetChatServerReq>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetChatServerReq& from);
-  void MergeFrom(const GetChatServerReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetChatServerReq& from) {
+    GetChatServerReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetChatServerReq* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "message.GetChatServerReq";
   }
   protected:
-  explicit GetChatServerReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetChatServerReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -564,11 +602,11 @@ class GetChatServerReq PROTOBUF_FINAL :
   };
   // int32 uid = 1;
   void clear_uid();
-  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
-  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t uid() const;
+  void set_uid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
-  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_uid() const;
+  void _internal_set_uid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:message.GetChatServerReq)
@@ -578,17 +616,21 @@ class GetChatServerReq PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t uid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GetChatServerRsp PROTOBUF_FINAL :
+class GetChatServerRsp final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetChatServerRsp) */ {
  public:
   inline GetChatServerRsp() : GetChatServerRsp(nullptr) {}
-  virtual ~GetChatServerRsp();
+  ~GetChatServerRsp() override;
+  explicit PROTOBUF_CONSTEXPR GetChatServerRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GetChatServerRsp(const GetChatServerRsp& from);
   GetChatServerRsp(GetChatServerRsp&& from) noexcept
@@ -601,8 +643,13 @@ class GetChatServerRsp PROTOBUF_FINAL :
     return *this;
   }
   inline GetChatServerRsp& operator=(GetChatServerRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -613,14 +660,14 @@ class GetChatServerRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetChatServerRsp& default_instance() {
+    return *internal_default_instance();
   }
-  static const GetChatServerRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GetChatServerRsp* internal_default_instance() {
     return reinterpret_cast<const GetChatServerRsp*>(
                &_GetChatServerRsp_default_instance_);
@@ -633,7 +680,12 @@ class GetChatServerRsp PROTOBUF_FINAL :
   }
   inline void Swap(GetChatServerRsp* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -641,56 +693,53 @@ class GetChatServerRsp PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(GetChatServerRsp* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GetChatServerRsp* New() const final {
-    return CreateMaybeMessage<GetChatServerRsp>(nullptr);
-  }
-
-  GetChatServerRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GetChatServerRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GetChatServerRsp>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GetChatServerRsp& from);
-  void MergeFrom(const GetChatServerRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetChatServerRsp& from) {
+    GetChatServerRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GetChatServerRsp* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "message.GetChatServerRsp";
   }
   protected:
-  explicit GetChatServerRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit GetChatServerRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -705,58 +754,52 @@ class GetChatServerRsp PROTOBUF_FINAL :
   // string host = 2;
   void clear_host();
   const std::string& host() const;
-  void set_host(const std::string& value);
-  void set_host(std::string&& value);
-  void set_host(const char* value);
-  void set_host(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host(ArgT0&& arg0, ArgT... args);
   std::string* mutable_host();
-  std::string* release_host();
+  PROTOBUF_NODISCARD std::string* release_host();
   void set_allocated_host(std::string* host);
   private:
   const std::string& _internal_host() const;
-  void _internal_set_host(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(const std::string& value);
   std::string* _internal_mutable_host();
   public:
 
   // string port = 3;
   void clear_port();
   const std::string& port() const;
-  void set_port(const std::string& value);
-  void set_port(std::string&& value);
-  void set_port(const char* value);
-  void set_port(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_port(ArgT0&& arg0, ArgT... args);
   std::string* mutable_port();
-  std::string* release_port();
+  PROTOBUF_NODISCARD std::string* release_port();
   void set_allocated_port(std::string* port);
   private:
   const std::string& _internal_port() const;
-  void _internal_set_port(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_port(const std::string& value);
   std::string* _internal_mutable_port();
   public:
 
   // string token = 4;
   void clear_token();
   const std::string& token() const;
-  void set_token(const std::string& value);
-  void set_token(std::string&& value);
-  void set_token(const char* value);
-  void set_token(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_token(ArgT0&& arg0, ArgT... args);
   std::string* mutable_token();
-  std::string* release_token();
+  PROTOBUF_NODISCARD std::string* release_token();
   void set_allocated_token(std::string* token);
   private:
   const std::string& _internal_token() const;
-  void _internal_set_token(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(const std::string& value);
   std::string* _internal_mutable_token();
   public:
 
   // int32 error = 1;
   void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t error() const;
+  void set_error(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:message.GetChatServerRsp)
@@ -766,20 +809,24 @@ class GetChatServerRsp PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr port_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr port_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+    int32_t error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginReq PROTOBUF_FINAL :
+class LoginReq final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.LoginReq) */ {
  public:
   inline LoginReq() : LoginReq(nullptr) {}
-  virtual ~LoginReq();
+  ~LoginReq() override;
+  explicit PROTOBUF_CONSTEXPR LoginReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginReq(const LoginReq& from);
   LoginReq(LoginReq&& from) noexcept
@@ -792,8 +839,13 @@ class LoginReq PROTOBUF_FINAL :
     return *this;
   }
   inline LoginReq& operator=(LoginReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -804,14 +856,14 @@ class LoginReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginReq& default_instance() {
+    return *internal_default_instance();
   }
-  static const LoginReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LoginReq* internal_default_instance() {
     return reinterpret_cast<const LoginReq*>(
                &_LoginReq_default_instance_);
@@ -824,7 +876,12 @@ class LoginReq PROTOBUF_FINAL :
   }
   inline void Swap(LoginReq* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -832,56 +889,53 @@ class LoginReq PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LoginReq* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LoginReq* New() const final {
-    return CreateMaybeMessage<LoginReq>(nullptr);
-  }
-
-  LoginReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LoginReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginReq>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginReq& from);
-  void MergeFrom(const LoginReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginReq& from) {
+    LoginReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginReq* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "message.LoginReq";
   }
   protected:
-  explicit LoginReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LoginReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -894,26 +948,24 @@ class LoginReq PROTOBUF_FINAL :
   // string token = 2;
   void clear_token();
   const std::string& token() const;
-  void set_token(const std::string& value);
-  void set_token(std::string&& value);
-  void set_token(const char* value);
-  void set_token(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_token(ArgT0&& arg0, ArgT... args);
   std::string* mutable_token();
-  std::string* release_token();
+  PROTOBUF_NODISCARD std::string* release_token();
   void set_allocated_token(std::string* token);
   private:
   const std::string& _internal_token() const;
-  void _internal_set_token(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(const std::string& value);
   std::string* _internal_mutable_token();
   public:
 
   // int32 uid = 1;
   void clear_uid();
-  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
-  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t uid() const;
+  void set_uid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
-  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_uid() const;
+  void _internal_set_uid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:message.LoginReq)
@@ -923,18 +975,22 @@ class LoginReq PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
-  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+    int32_t uid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginRsp PROTOBUF_FINAL :
+class LoginRsp final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.LoginRsp) */ {
  public:
   inline LoginRsp() : LoginRsp(nullptr) {}
-  virtual ~LoginRsp();
+  ~LoginRsp() override;
+  explicit PROTOBUF_CONSTEXPR LoginRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginRsp(const LoginRsp& from);
   LoginRsp(LoginRsp&& from) noexcept
@@ -947,8 +1003,13 @@ class LoginRsp PROTOBUF_FINAL :
     return *this;
   }
   inline LoginRsp& operator=(LoginRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -959,14 +1020,14 @@ class LoginRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRsp& default_instance() {
+    return *internal_default_instance();
   }
-  static const LoginRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LoginRsp* internal_default_instance() {
     return reinterpret_cast<const LoginRsp*>(
                &_LoginRsp_default_instance_);
@@ -979,7 +1040,12 @@ class LoginRsp PROTOBUF_FINAL :
   }
   inline void Swap(LoginRsp* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -987,56 +1053,53 @@ class LoginRsp PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LoginRsp* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LoginRsp* New() const final {
-    return CreateMaybeMessage<LoginRsp>(nullptr);
-  }
-
-  LoginRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LoginRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginRsp>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginRsp& from);
-  void MergeFrom(const LoginRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginRsp& from) {
+    LoginRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginRsp* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "message.LoginRsp";
   }
   protected:
-  explicit LoginRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LoginRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1050,35 +1113,33 @@ class LoginRsp PROTOBUF_FINAL :
   // string token = 3;
   void clear_token();
   const std::string& token() const;
-  void set_token(const std::string& value);
-  void set_token(std::string&& value);
-  void set_token(const char* value);
-  void set_token(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_token(ArgT0&& arg0, ArgT... args);
   std::string* mutable_token();
-  std::string* release_token();
+  PROTOBUF_NODISCARD std::string* release_token();
   void set_allocated_token(std::string* token);
   private:
   const std::string& _internal_token() const;
-  void _internal_set_token(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(const std::string& value);
   std::string* _internal_mutable_token();
   public:
 
   // int32 error = 1;
   void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t error() const;
+  void set_error(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
   public:
 
   // int32 uid = 2;
   void clear_uid();
-  ::PROTOBUF_NAMESPACE_ID::int32 uid() const;
-  void set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t uid() const;
+  void set_uid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uid() const;
-  void _internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_uid() const;
+  void _internal_set_uid(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:message.LoginRsp)
@@ -1088,33 +1149,42 @@ class LoginRsp PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  ::PROTOBUF_NAMESPACE_ID::int32 uid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+    int32_t error_;
+    int32_t uid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AddFriendReq PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AddFriendReq) */ {
+class ChatServerInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.ChatServerInfo) */ {
  public:
-  inline AddFriendReq() : AddFriendReq(nullptr) {}
-  virtual ~AddFriendReq();
+  inline ChatServerInfo() : ChatServerInfo(nullptr) {}
+  ~ChatServerInfo() override;
+  explicit PROTOBUF_CONSTEXPR ChatServerInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AddFriendReq(const AddFriendReq& from);
-  AddFriendReq(AddFriendReq&& from) noexcept
-    : AddFriendReq() {
+  ChatServerInfo(const ChatServerInfo& from);
+  ChatServerInfo(ChatServerInfo&& from) noexcept
+    : ChatServerInfo() {
     *this = ::std::move(from);
   }
 
-  inline AddFriendReq& operator=(const AddFriendReq& from) {
+  inline ChatServerInfo& operator=(const ChatServerInfo& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AddFriendReq& operator=(AddFriendReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ChatServerInfo& operator=(ChatServerInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1125,227 +1195,213 @@ class AddFriendReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AddFriendReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AddFriendReq* internal_default_instance() {
-    return reinterpret_cast<const AddFriendReq*>(
-               &_AddFriendReq_default_instance_);
+  static const ChatServerInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChatServerInfo* internal_default_instance() {
+    return reinterpret_cast<const ChatServerInfo*>(
+               &_ChatServerInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(AddFriendReq& a, AddFriendReq& b) {
+  friend void swap(ChatServerInfo& a, ChatServerInfo& b) {
     a.Swap(&b);
   }
-  inline void Swap(AddFriendReq* other) {
+  inline void Swap(ChatServerInfo* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AddFriendReq* other) {
+  void UnsafeArenaSwap(ChatServerInfo* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AddFriendReq* New() const final {
-    return CreateMaybeMessage<AddFriendReq>(nullptr);
+  ChatServerInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChatServerInfo>(arena);
   }
-
-  AddFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AddFriendReq>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChatServerInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChatServerInfo& from) {
+    ChatServerInfo::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AddFriendReq& from);
-  void MergeFrom(const AddFriendReq& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AddFriendReq* other);
+  void InternalSwap(ChatServerInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.AddFriendReq";
+    return "message.ChatServerInfo";
   }
   protected:
-  explicit AddFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ChatServerInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNameFieldNumber = 2,
-    kDescFieldNumber = 3,
-    kIconFieldNumber = 4,
-    kNickFieldNumber = 5,
-    kApplyuidFieldNumber = 1,
-    kSexFieldNumber = 6,
-    kTouidFieldNumber = 7,
+    kNameFieldNumber = 1,
+    kHostFieldNumber = 2,
+    kPortFieldNumber = 3,
+    kRpcHostFieldNumber = 4,
+    kRpcPortFieldNumber = 5,
   };
-  // string name = 2;
+  // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
-  // string desc = 3;
-  void clear_desc();
-  const std::string& desc() const;
-  void set_desc(const std::string& value);
-  void set_desc(std::string&& value);
-  void set_desc(const char* value);
-  void set_desc(const char* value, size_t size);
-  std::string* mutable_desc();
-  std::string* release_desc();
-  void set_allocated_desc(std::string* desc);
-  private:
-  const std::string& _internal_desc() const;
-  void _internal_set_desc(const std::string& value);
-  std::string* _internal_mutable_desc();
-  public:
-
-  // string icon = 4;
-  void clear_icon();
-  const std::string& icon() const;
-  void set_icon(const std::string& value);
-  void set_icon(std::string&& value);
-  void set_icon(const char* value);
-  void set_icon(const char* value, size_t size);
-  std::string* mutable_icon();
-  std::string* release_icon();
-  void set_allocated_icon(std::string* icon);
-  private:
-  const std::string& _internal_icon() const;
-  void _internal_set_icon(const std::string& value);
-  std::string* _internal_mutable_icon();
-  public:
-
-  // string nick = 5;
-  void clear_nick();
-  const std::string& nick() const;
-  void set_nick(const std::string& value);
-  void set_nick(std::string&& value);
-  void set_nick(const char* value);
-  void set_nick(const char* value, size_t size);
-  std::string* mutable_nick();
-  std::string* release_nick();
-  void set_allocated_nick(std::string* nick);
+  // string host = 2;
+  void clear_host();
+  const std::string& host() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_host(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_host();
+  PROTOBUF_NODISCARD std::string* release_host();
+  void set_allocated_host(std::string* host);
   private:
-  const std::string& _internal_nick() const;
-  void _internal_set_nick(const std::string& value);
-  std::string* _internal_mutable_nick();
+  const std::string& _internal_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_host(const std::string& value);
+  std::string* _internal_mutable_host();
   public:
 
-  // int32 applyuid = 1;
-  void clear_applyuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 applyuid() const;
-  void set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // string port = 3;
+  void clear_port();
+  const std::string& port() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_port(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_port();
+  PROTOBUF_NODISCARD std::string* release_port();
+  void set_allocated_port(std::string* port);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_applyuid() const;
-  void _internal_set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const std::string& _internal_port() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_port(const std::string& value);
+  std::string* _internal_mutable_port();
   public:
 
-  // int32 sex = 6;
-  void clear_sex();
-  ::PROTOBUF_NAMESPACE_ID::int32 sex() const;
-  void set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // string rpc_host = 4;
+  void clear_rpc_host();
+  const std::string& rpc_host() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rpc_host(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rpc_host();
+  PROTOBUF_NODISCARD std::string* release_rpc_host();
+  void set_allocated_rpc_host(std::string* rpc_host);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sex() const;
-  void _internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const std::string& _internal_rpc_host() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rpc_host(const std::string& value);
+  std::string* _internal_mutable_rpc_host();
   public:
 
-  // int32 touid = 7;
-  void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // string rpc_port = 5;
+  void clear_rpc_port();
+  const std::string& rpc_port() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rpc_port(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rpc_port();
+  PROTOBUF_NODISCARD std::string* release_rpc_port();
+  void set_allocated_rpc_port(std::string* rpc_port);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const std::string& _internal_rpc_port() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rpc_port(const std::string& value);
+  std::string* _internal_mutable_rpc_port();
   public:
 
-  // @@protoc_insertion_point(class_scope:message.AddFriendReq)
+  // @@protoc_insertion_point(class_scope:message.ChatServerInfo)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desc_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
-  ::PROTOBUF_NAMESPACE_ID::int32 applyuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 sex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr port_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rpc_host_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rpc_port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AddFriendRsp PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AddFriendRsp) */ {
+class HeartbeatReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.HeartbeatReq) */ {
  public:
-  inline AddFriendRsp() : AddFriendRsp(nullptr) {}
-  virtual ~AddFriendRsp();
+  inline HeartbeatReq() : HeartbeatReq(nullptr) {}
+  ~HeartbeatReq() override;
+  explicit PROTOBUF_CONSTEXPR HeartbeatReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AddFriendRsp(const AddFriendRsp& from);
-  AddFriendRsp(AddFriendRsp&& from) noexcept
-    : AddFriendRsp() {
+  HeartbeatReq(const HeartbeatReq& from);
+  HeartbeatReq(HeartbeatReq&& from) noexcept
+    : HeartbeatReq() {
     *this = ::std::move(from);
   }
 
-  inline AddFriendRsp& operator=(const AddFriendRsp& from) {
+  inline HeartbeatReq& operator=(const HeartbeatReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AddFriendRsp& operator=(AddFriendRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline HeartbeatReq& operator=(HeartbeatReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1356,155 +1412,175 @@ class AddFriendRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AddFriendRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AddFriendRsp* internal_default_instance() {
-    return reinterpret_cast<const AddFriendRsp*>(
-               &_AddFriendRsp_default_instance_);
+  static const HeartbeatReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HeartbeatReq* internal_default_instance() {
+    return reinterpret_cast<const HeartbeatReq*>(
+               &_HeartbeatReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(AddFriendRsp& a, AddFriendRsp& b) {
+  friend void swap(HeartbeatReq& a, HeartbeatReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(AddFriendRsp* other) {
+  inline void Swap(HeartbeatReq* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AddFriendRsp* other) {
+  void UnsafeArenaSwap(HeartbeatReq* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AddFriendRsp* New() const final {
-    return CreateMaybeMessage<AddFriendRsp>(nullptr);
+  HeartbeatReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HeartbeatReq>(arena);
   }
-
-  AddFriendRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AddFriendRsp>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HeartbeatReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HeartbeatReq& from) {
+    HeartbeatReq::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AddFriendRsp& from);
-  void MergeFrom(const AddFriendRsp& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AddFriendRsp* other);
+  void InternalSwap(HeartbeatReq* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.AddFriendRsp";
+    return "message.HeartbeatReq";
   }
   protected:
-  explicit AddFriendRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit HeartbeatReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
-    kApplyuidFieldNumber = 2,
-    kTouidFieldNumber = 3,
+    kServerFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kLeaveFieldNumber = 3,
   };
-  // int32 error = 1;
-  void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // .message.ChatServerInfo server = 1;
+  bool has_server() const;
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_has_server() const;
   public:
-
-  // int32 applyuid = 2;
-  void clear_applyuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 applyuid() const;
-  void set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  void clear_server();
+  const ::message::ChatServerInfo& server() const;
+  PROTOBUF_NODISCARD ::message::ChatServerInfo* release_server();
+  ::message::ChatServerInfo* mutable_server();
+  void set_allocated_server(::message::ChatServerInfo* server);
+  private:
+  const ::message::ChatServerInfo& _internal_server() const;
+  ::message::ChatServerInfo* _internal_mutable_server();
+  public:
+  void unsafe_arena_set_allocated_server(
+      ::message::ChatServerInfo* server);
+  ::message::ChatServerInfo* unsafe_arena_release_server();
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_applyuid() const;
-  void _internal_set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
   public:
 
-  // int32 touid = 3;
-  void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // bool leave = 3;
+  void clear_leave();
+  bool leave() const;
+  void set_leave(bool value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  bool _internal_leave() const;
+  void _internal_set_leave(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.AddFriendRsp)
+  // @@protoc_insertion_point(class_scope:message.HeartbeatReq)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  ::PROTOBUF_NAMESPACE_ID::int32 applyuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::message::ChatServerInfo* server_;
+    uint64_t version_;
+    bool leave_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RplyFriendReq PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.RplyFriendReq) */ {
+class HeartbeatRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.HeartbeatRsp) */ {
  public:
-  inline RplyFriendReq() : RplyFriendReq(nullptr) {}
-  virtual ~RplyFriendReq();
+  inline HeartbeatRsp() : HeartbeatRsp(nullptr) {}
+  ~HeartbeatRsp() override;
+  explicit PROTOBUF_CONSTEXPR HeartbeatRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RplyFriendReq(const RplyFriendReq& from);
-  RplyFriendReq(RplyFriendReq&& from) noexcept
-    : RplyFriendReq() {
+  HeartbeatRsp(const HeartbeatRsp& from);
+  HeartbeatRsp(HeartbeatRsp&& from) noexcept
+    : HeartbeatRsp() {
     *this = ::std::move(from);
   }
 
-  inline RplyFriendReq& operator=(const RplyFriendReq& from) {
+  inline HeartbeatRsp& operator=(const HeartbeatRsp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RplyFriendReq& operator=(RplyFriendReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline HeartbeatRsp& operator=(HeartbeatRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1515,155 +1591,1275 @@ class RplyFriendReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RplyFriendReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RplyFriendReq* internal_default_instance() {
-    return reinterpret_cast<const RplyFriendReq*>(
-               &_RplyFriendReq_default_instance_);
+  static const HeartbeatRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HeartbeatRsp* internal_default_instance() {
+    return reinterpret_cast<const HeartbeatRsp*>(
+               &_HeartbeatRsp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(RplyFriendReq& a, RplyFriendReq& b) {
+  friend void swap(HeartbeatRsp& a, HeartbeatRsp& b) {
     a.Swap(&b);
   }
-  inline void Swap(RplyFriendReq* other) {
+  inline void Swap(HeartbeatRsp* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RplyFriendReq* other) {
+  void UnsafeArenaSwap(HeartbeatRsp* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RplyFriendReq* New() const final {
-    return CreateMaybeMessage<RplyFriendReq>(nullptr);
+  HeartbeatRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HeartbeatRsp>(arena);
   }
-
-  RplyFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RplyFriendReq>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HeartbeatRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HeartbeatRsp& from) {
+    HeartbeatRsp::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RplyFriendReq& from);
-  void MergeFrom(const RplyFriendReq& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RplyFriendReq* other);
+  void InternalSwap(HeartbeatRsp* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.RplyFriendReq";
+    return "message.HeartbeatRsp";
   }
   protected:
-  explicit RplyFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit HeartbeatRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServersFieldNumber = 4,
+    kVersionFieldNumber = 2,
+    kErrorFieldNumber = 1,
+    kChangedFieldNumber = 3,
+  };
+  // repeated .message.ChatServerInfo servers = 4;
+  int servers_size() const;
+  private:
+  int _internal_servers_size() const;
+  public:
+  void clear_servers();
+  ::message::ChatServerInfo* mutable_servers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::ChatServerInfo >*
+      mutable_servers();
+  private:
+  const ::message::ChatServerInfo& _internal_servers(int index) const;
+  ::message::ChatServerInfo* _internal_add_servers();
+  public:
+  const ::message::ChatServerInfo& servers(int index) const;
+  ::message::ChatServerInfo* add_servers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::ChatServerInfo >&
+      servers() const;
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // bool changed = 3;
+  void clear_changed();
+  bool changed() const;
+  void set_changed(bool value);
+  private:
+  bool _internal_changed() const;
+  void _internal_set_changed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.HeartbeatRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::ChatServerInfo > servers_;
+    uint64_t version_;
+    int32_t error_;
+    bool changed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AddFriendReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AddFriendReq) */ {
+ public:
+  inline AddFriendReq() : AddFriendReq(nullptr) {}
+  ~AddFriendReq() override;
+  explicit PROTOBUF_CONSTEXPR AddFriendReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AddFriendReq(const AddFriendReq& from);
+  AddFriendReq(AddFriendReq&& from) noexcept
+    : AddFriendReq() {
+    *this = ::std::move(from);
+  }
+
+  inline AddFriendReq& operator=(const AddFriendReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AddFriendReq& operator=(AddFriendReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AddFriendReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AddFriendReq* internal_default_instance() {
+    return reinterpret_cast<const AddFriendReq*>(
+               &_AddFriendReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(AddFriendReq& a, AddFriendReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AddFriendReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AddFriendReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AddFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AddFriendReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AddFriendReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AddFriendReq& from) {
+    AddFriendReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AddFriendReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.AddFriendReq";
+  }
+  protected:
+  explicit AddFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 2,
+    kDescFieldNumber = 3,
+    kIconFieldNumber = 4,
+    kNickFieldNumber = 5,
+    kApplyuidFieldNumber = 1,
+    kSexFieldNumber = 6,
+    kTouidFieldNumber = 7,
+  };
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string desc = 3;
+  void clear_desc();
+  const std::string& desc() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_desc(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_desc();
+  PROTOBUF_NODISCARD std::string* release_desc();
+  void set_allocated_desc(std::string* desc);
+  private:
+  const std::string& _internal_desc() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_desc(const std::string& value);
+  std::string* _internal_mutable_desc();
+  public:
+
+  // string icon = 4;
+  void clear_icon();
+  const std::string& icon() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_icon(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_icon();
+  PROTOBUF_NODISCARD std::string* release_icon();
+  void set_allocated_icon(std::string* icon);
+  private:
+  const std::string& _internal_icon() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_icon(const std::string& value);
+  std::string* _internal_mutable_icon();
+  public:
+
+  // string nick = 5;
+  void clear_nick();
+  const std::string& nick() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nick(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nick();
+  PROTOBUF_NODISCARD std::string* release_nick();
+  void set_allocated_nick(std::string* nick);
+  private:
+  const std::string& _internal_nick() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nick(const std::string& value);
+  std::string* _internal_mutable_nick();
+  public:
+
+  // int32 applyuid = 1;
+  void clear_applyuid();
+  int32_t applyuid() const;
+  void set_applyuid(int32_t value);
+  private:
+  int32_t _internal_applyuid() const;
+  void _internal_set_applyuid(int32_t value);
+  public:
+
+  // int32 sex = 6;
+  void clear_sex();
+  int32_t sex() const;
+  void set_sex(int32_t value);
+  private:
+  int32_t _internal_sex() const;
+  void _internal_set_sex(int32_t value);
+  public:
+
+  // int32 touid = 7;
+  void clear_touid();
+  int32_t touid() const;
+  void set_touid(int32_t value);
+  private:
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.AddFriendReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desc_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr icon_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nick_;
+    int32_t applyuid_;
+    int32_t sex_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AddFriendRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AddFriendRsp) */ {
+ public:
+  inline AddFriendRsp() : AddFriendRsp(nullptr) {}
+  ~AddFriendRsp() override;
+  explicit PROTOBUF_CONSTEXPR AddFriendRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AddFriendRsp(const AddFriendRsp& from);
+  AddFriendRsp(AddFriendRsp&& from) noexcept
+    : AddFriendRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline AddFriendRsp& operator=(const AddFriendRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AddFriendRsp& operator=(AddFriendRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AddFriendRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AddFriendRsp* internal_default_instance() {
+    return reinterpret_cast<const AddFriendRsp*>(
+               &_AddFriendRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(AddFriendRsp& a, AddFriendRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AddFriendRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AddFriendRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AddFriendRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AddFriendRsp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AddFriendRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AddFriendRsp& from) {
+    AddFriendRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AddFriendRsp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.AddFriendRsp";
+  }
+  protected:
+  explicit AddFriendRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kApplyuidFieldNumber = 2,
+    kTouidFieldNumber = 3,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 applyuid = 2;
+  void clear_applyuid();
+  int32_t applyuid() const;
+  void set_applyuid(int32_t value);
+  private:
+  int32_t _internal_applyuid() const;
+  void _internal_set_applyuid(int32_t value);
+  public:
+
+  // int32 touid = 3;
+  void clear_touid();
+  int32_t touid() const;
+  void set_touid(int32_t value);
+  private:
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.AddFriendRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t applyuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RplyFriendReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.RplyFriendReq) */ {
+ public:
+  inline RplyFriendReq() : RplyFriendReq(nullptr) {}
+  ~RplyFriendReq() override;
+  explicit PROTOBUF_CONSTEXPR RplyFriendReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RplyFriendReq(const RplyFriendReq& from);
+  RplyFriendReq(RplyFriendReq&& from) noexcept
+    : RplyFriendReq() {
+    *this = ::std::move(from);
+  }
+
+  inline RplyFriendReq& operator=(const RplyFriendReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RplyFriendReq& operator=(RplyFriendReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RplyFriendReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RplyFriendReq* internal_default_instance() {
+    return reinterpret_cast<const RplyFriendReq*>(
+               &_RplyFriendReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(RplyFriendReq& a, RplyFriendReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RplyFriendReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RplyFriendReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RplyFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RplyFriendReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RplyFriendReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RplyFriendReq& from) {
+    RplyFriendReq::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RplyFriendReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.RplyFriendReq";
+  }
+  protected:
+  explicit RplyFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRplyuidFieldNumber = 1,
+    kAgreeFieldNumber = 2,
+    kTouidFieldNumber = 3,
+  };
+  // int32 rplyuid = 1;
+  void clear_rplyuid();
+  int32_t rplyuid() const;
+  void set_rplyuid(int32_t value);
+  private:
+  int32_t _internal_rplyuid() const;
+  void _internal_set_rplyuid(int32_t value);
+  public:
+
+  // bool agree = 2;
+  void clear_agree();
+  bool agree() const;
+  void set_agree(bool value);
+  private:
+  bool _internal_agree() const;
+  void _internal_set_agree(bool value);
+  public:
+
+  // int32 touid = 3;
+  void clear_touid();
+  int32_t touid() const;
+  void set_touid(int32_t value);
+  private:
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.RplyFriendReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t rplyuid_;
+    bool agree_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RplyFriendRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.RplyFriendRsp) */ {
+ public:
+  inline RplyFriendRsp() : RplyFriendRsp(nullptr) {}
+  ~RplyFriendRsp() override;
+  explicit PROTOBUF_CONSTEXPR RplyFriendRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RplyFriendRsp(const RplyFriendRsp& from);
+  RplyFriendRsp(RplyFriendRsp&& from) noexcept
+    : RplyFriendRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline RplyFriendRsp& operator=(const RplyFriendRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RplyFriendRsp& operator=(RplyFriendRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RplyFriendRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RplyFriendRsp* internal_default_instance() {
+    return reinterpret_cast<const RplyFriendRsp*>(
+               &_RplyFriendRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(RplyFriendRsp& a, RplyFriendRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RplyFriendRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RplyFriendRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RplyFriendRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RplyFriendRsp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RplyFriendRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RplyFriendRsp& from) {
+    RplyFriendRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RplyFriendRsp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.RplyFriendRsp";
+  }
+  protected:
+  explicit RplyFriendRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kRplyuidFieldNumber = 2,
+    kTouidFieldNumber = 3,
+  };
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
+  private:
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
+  public:
+
+  // int32 rplyuid = 2;
+  void clear_rplyuid();
+  int32_t rplyuid() const;
+  void set_rplyuid(int32_t value);
+  private:
+  int32_t _internal_rplyuid() const;
+  void _internal_set_rplyuid(int32_t value);
+  public:
+
+  // int32 touid = 3;
+  void clear_touid();
+  int32_t touid() const;
+  void set_touid(int32_t value);
+  private:
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.RplyFriendRsp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t rplyuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendChatMsgReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.SendChatMsgReq) */ {
+ public:
+  inline SendChatMsgReq() : SendChatMsgReq(nullptr) {}
+  ~SendChatMsgReq() override;
+  explicit PROTOBUF_CONSTEXPR SendChatMsgReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendChatMsgReq(const SendChatMsgReq& from);
+  SendChatMsgReq(SendChatMsgReq&& from) noexcept
+    : SendChatMsgReq() {
+    *this = ::std::move(from);
+  }
+
+  inline SendChatMsgReq& operator=(const SendChatMsgReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendChatMsgReq& operator=(SendChatMsgReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendChatMsgReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendChatMsgReq* internal_default_instance() {
+    return reinterpret_cast<const SendChatMsgReq*>(
+               &_SendChatMsgReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SendChatMsgReq& a, SendChatMsgReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendChatMsgReq* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendChatMsgReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendChatMsgReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendChatMsgReq>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendChatMsgReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendChatMsgReq& from) {
+    SendChatMsgReq::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendChatMsgReq* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.SendChatMsgReq";
+  }
+  protected:
+  explicit SendChatMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kRplyuidFieldNumber = 1,
-    kAgreeFieldNumber = 2,
+    kMessageFieldNumber = 3,
+    kFromuidFieldNumber = 1,
+    kTouidFieldNumber = 2,
+  };
+  // string message = 3;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // int32 fromuid = 1;
+  void clear_fromuid();
+  int32_t fromuid() const;
+  void set_fromuid(int32_t value);
+  private:
+  int32_t _internal_fromuid() const;
+  void _internal_set_fromuid(int32_t value);
+  public:
+
+  // int32 touid = 2;
+  void clear_touid();
+  int32_t touid() const;
+  void set_touid(int32_t value);
+  private:
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.SendChatMsgReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int32_t fromuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendChatMsgRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.SendChatMsgRsp) */ {
+ public:
+  inline SendChatMsgRsp() : SendChatMsgRsp(nullptr) {}
+  ~SendChatMsgRsp() override;
+  explicit PROTOBUF_CONSTEXPR SendChatMsgRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendChatMsgRsp(const SendChatMsgRsp& from);
+  SendChatMsgRsp(SendChatMsgRsp&& from) noexcept
+    : SendChatMsgRsp() {
+    *this = ::std::move(from);
+  }
+
+  inline SendChatMsgRsp& operator=(const SendChatMsgRsp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendChatMsgRsp& operator=(SendChatMsgRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendChatMsgRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendChatMsgRsp* internal_default_instance() {
+    return reinterpret_cast<const SendChatMsgRsp*>(
+               &_SendChatMsgRsp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(SendChatMsgRsp& a, SendChatMsgRsp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendChatMsgRsp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendChatMsgRsp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendChatMsgRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendChatMsgRsp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendChatMsgRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendChatMsgRsp& from) {
+    SendChatMsgRsp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendChatMsgRsp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.SendChatMsgRsp";
+  }
+  protected:
+  explicit SendChatMsgRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+    kFromuidFieldNumber = 2,
     kTouidFieldNumber = 3,
   };
-  // int32 rplyuid = 1;
-  void clear_rplyuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 rplyuid() const;
-  void set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rplyuid() const;
-  void _internal_set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
   public:
 
-  // bool agree = 2;
-  void clear_agree();
-  bool agree() const;
-  void set_agree(bool value);
+  // int32 fromuid = 2;
+  void clear_fromuid();
+  int32_t fromuid() const;
+  void set_fromuid(int32_t value);
   private:
-  bool _internal_agree() const;
-  void _internal_set_agree(bool value);
+  int32_t _internal_fromuid() const;
+  void _internal_set_fromuid(int32_t value);
   public:
 
   // int32 touid = 3;
   void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t touid() const;
+  void set_touid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.RplyFriendReq)
+  // @@protoc_insertion_point(class_scope:message.SendChatMsgRsp)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 rplyuid_;
-  bool agree_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t fromuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RplyFriendRsp PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.RplyFriendRsp) */ {
+class AuthFriendReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AuthFriendReq) */ {
  public:
-  inline RplyFriendRsp() : RplyFriendRsp(nullptr) {}
-  virtual ~RplyFriendRsp();
+  inline AuthFriendReq() : AuthFriendReq(nullptr) {}
+  ~AuthFriendReq() override;
+  explicit PROTOBUF_CONSTEXPR AuthFriendReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RplyFriendRsp(const RplyFriendRsp& from);
-  RplyFriendRsp(RplyFriendRsp&& from) noexcept
-    : RplyFriendRsp() {
+  AuthFriendReq(const AuthFriendReq& from);
+  AuthFriendReq(AuthFriendReq&& from) noexcept
+    : AuthFriendReq() {
     *this = ::std::move(from);
   }
 
-  inline RplyFriendRsp& operator=(const RplyFriendRsp& from) {
+  inline AuthFriendReq& operator=(const AuthFriendReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RplyFriendRsp& operator=(RplyFriendRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline AuthFriendReq& operator=(AuthFriendReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1674,155 +2870,155 @@ class RplyFriendRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RplyFriendRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RplyFriendRsp* internal_default_instance() {
-    return reinterpret_cast<const RplyFriendRsp*>(
-               &_RplyFriendRsp_default_instance_);
+  static const AuthFriendReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthFriendReq* internal_default_instance() {
+    return reinterpret_cast<const AuthFriendReq*>(
+               &_AuthFriendReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    15;
 
-  friend void swap(RplyFriendRsp& a, RplyFriendRsp& b) {
+  friend void swap(AuthFriendReq& a, AuthFriendReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(RplyFriendRsp* other) {
+  inline void Swap(AuthFriendReq* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RplyFriendRsp* other) {
+  void UnsafeArenaSwap(AuthFriendReq* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RplyFriendRsp* New() const final {
-    return CreateMaybeMessage<RplyFriendRsp>(nullptr);
+  AuthFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthFriendReq>(arena);
   }
-
-  RplyFriendRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RplyFriendRsp>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AuthFriendReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AuthFriendReq& from) {
+    AuthFriendReq::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RplyFriendRsp& from);
-  void MergeFrom(const RplyFriendRsp& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RplyFriendRsp* other);
+  void InternalSwap(AuthFriendReq* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.RplyFriendRsp";
+    return "message.AuthFriendReq";
   }
   protected:
-  explicit RplyFriendRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AuthFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
-    kRplyuidFieldNumber = 2,
-    kTouidFieldNumber = 3,
+    kFromuidFieldNumber = 1,
+    kTouidFieldNumber = 2,
   };
-  // int32 error = 1;
-  void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 rplyuid = 2;
-  void clear_rplyuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 rplyuid() const;
-  void set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 fromuid = 1;
+  void clear_fromuid();
+  int32_t fromuid() const;
+  void set_fromuid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_rplyuid() const;
-  void _internal_set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_fromuid() const;
+  void _internal_set_fromuid(int32_t value);
   public:
 
-  // int32 touid = 3;
+  // int32 touid = 2;
   void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t touid() const;
+  void set_touid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.RplyFriendRsp)
+  // @@protoc_insertion_point(class_scope:message.AuthFriendReq)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  ::PROTOBUF_NAMESPACE_ID::int32 rplyuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t fromuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SendChatMsgReq PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.SendChatMsgReq) */ {
+class AuthFriendRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AuthFriendRsp) */ {
  public:
-  inline SendChatMsgReq() : SendChatMsgReq(nullptr) {}
-  virtual ~SendChatMsgReq();
+  inline AuthFriendRsp() : AuthFriendRsp(nullptr) {}
+  ~AuthFriendRsp() override;
+  explicit PROTOBUF_CONSTEXPR AuthFriendRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SendChatMsgReq(const SendChatMsgReq& from);
-  SendChatMsgReq(SendChatMsgReq&& from) noexcept
-    : SendChatMsgReq() {
+  AuthFriendRsp(const AuthFriendRsp& from);
+  AuthFriendRsp(AuthFriendRsp&& from) noexcept
+    : AuthFriendRsp() {
     *this = ::std::move(from);
   }
 
-  inline SendChatMsgReq& operator=(const SendChatMsgReq& from) {
+  inline AuthFriendRsp& operator=(const AuthFriendRsp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SendChatMsgReq& operator=(SendChatMsgReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline AuthFriendRsp& operator=(AuthFriendRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1833,162 +3029,166 @@ class SendChatMsgReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const SendChatMsgReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const SendChatMsgReq* internal_default_instance() {
-    return reinterpret_cast<const SendChatMsgReq*>(
-               &_SendChatMsgReq_default_instance_);
+  static const AuthFriendRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AuthFriendRsp* internal_default_instance() {
+    return reinterpret_cast<const AuthFriendRsp*>(
+               &_AuthFriendRsp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    16;
 
-  friend void swap(SendChatMsgReq& a, SendChatMsgReq& b) {
+  friend void swap(AuthFriendRsp& a, AuthFriendRsp& b) {
     a.Swap(&b);
   }
-  inline void Swap(SendChatMsgReq* other) {
+  inline void Swap(AuthFriendRsp* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SendChatMsgReq* other) {
+  void UnsafeArenaSwap(AuthFriendRsp* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SendChatMsgReq* New() const final {
-    return CreateMaybeMessage<SendChatMsgReq>(nullptr);
+  AuthFriendRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthFriendRsp>(arena);
   }
-
-  SendChatMsgReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<SendChatMsgReq>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AuthFriendRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AuthFriendRsp& from) {
+    AuthFriendRsp::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const SendChatMsgReq& from);
-  void MergeFrom(const SendChatMsgReq& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SendChatMsgReq* other);
+  void InternalSwap(AuthFriendRsp* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.SendChatMsgReq";
+    return "message.AuthFriendRsp";
   }
   protected:
-  explicit SendChatMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AuthFriendRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 3,
-    kFromuidFieldNumber = 1,
-    kTouidFieldNumber = 2,
+    kErrorFieldNumber = 1,
+    kFromuidFieldNumber = 2,
+    kTouidFieldNumber = 3,
   };
-  // string message = 3;
-  void clear_message();
-  const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
-  std::string* mutable_message();
-  std::string* release_message();
-  void set_allocated_message(std::string* message);
+  // int32 error = 1;
+  void clear_error();
+  int32_t error() const;
+  void set_error(int32_t value);
   private:
-  const std::string& _internal_message() const;
-  void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
   public:
 
-  // int32 fromuid = 1;
+  // int32 fromuid = 2;
   void clear_fromuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
-  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t fromuid() const;
+  void set_fromuid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
-  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_fromuid() const;
+  void _internal_set_fromuid(int32_t value);
   public:
 
-  // int32 touid = 2;
+  // int32 touid = 3;
   void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t touid() const;
+  void set_touid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.SendChatMsgReq)
+  // @@protoc_insertion_point(class_scope:message.AuthFriendRsp)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int32_t error_;
+    int32_t fromuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SendChatMsgRsp PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.SendChatMsgRsp) */ {
+class TextChatMsgReq final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.TextChatMsgReq) */ {
  public:
-  inline SendChatMsgRsp() : SendChatMsgRsp(nullptr) {}
-  virtual ~SendChatMsgRsp();
+  inline TextChatMsgReq() : TextChatMsgReq(nullptr) {}
+  ~TextChatMsgReq() override;
+  explicit PROTOBUF_CONSTEXPR TextChatMsgReq(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SendChatMsgRsp(const SendChatMsgRsp& from);
-  SendChatMsgRsp(SendChatMsgRsp&& from) noexcept
-    : SendChatMsgRsp() {
+  TextChatMsgReq(const TextChatMsgReq& from);
+  TextChatMsgReq(TextChatMsgReq&& from) noexcept
+    : TextChatMsgReq() {
     *this = ::std::move(from);
   }
 
-  inline SendChatMsgRsp& operator=(const SendChatMsgRsp& from) {
+  inline TextChatMsgReq& operator=(const TextChatMsgReq& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SendChatMsgRsp& operator=(SendChatMsgRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline TextChatMsgReq& operator=(TextChatMsgReq&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1999,155 +3199,175 @@ class SendChatMsgRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const SendChatMsgRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const SendChatMsgRsp* internal_default_instance() {
-    return reinterpret_cast<const SendChatMsgRsp*>(
-               &_SendChatMsgRsp_default_instance_);
+  static const TextChatMsgReq& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TextChatMsgReq* internal_default_instance() {
+    return reinterpret_cast<const TextChatMsgReq*>(
+               &_TextChatMsgReq_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    17;
 
-  friend void swap(SendChatMsgRsp& a, SendChatMsgRsp& b) {
+  friend void swap(TextChatMsgReq& a, TextChatMsgReq& b) {
     a.Swap(&b);
   }
-  inline void Swap(SendChatMsgRsp* other) {
+  inline void Swap(TextChatMsgReq* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SendChatMsgRsp* other) {
+  void UnsafeArenaSwap(TextChatMsgReq* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SendChatMsgRsp* New() const final {
-    return CreateMaybeMessage<SendChatMsgRsp>(nullptr);
+  TextChatMsgReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TextChatMsgReq>(arena);
   }
-
-  SendChatMsgRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<SendChatMsgRsp>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TextChatMsgReq& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TextChatMsgReq& from) {
+    TextChatMsgReq::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const SendChatMsgRsp& from);
-  void MergeFrom(const SendChatMsgRsp& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SendChatMsgRsp* other);
+  void InternalSwap(TextChatMsgReq* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.SendChatMsgRsp";
+    return "message.TextChatMsgReq";
   }
   protected:
-  explicit SendChatMsgRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit TextChatMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
-    kFromuidFieldNumber = 2,
-    kTouidFieldNumber = 3,
+    kTextmsgsFieldNumber = 3,
+    kFromuidFieldNumber = 1,
+    kTouidFieldNumber = 2,
   };
-  // int32 error = 1;
-  void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated .message.TextChatData textmsgs = 3;
+  int textmsgs_size() const;
+  private:
+  int _internal_textmsgs_size() const;
+  public:
+  void clear_textmsgs();
+  ::message::TextChatData* mutable_textmsgs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >*
+      mutable_textmsgs();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::message::TextChatData& _internal_textmsgs(int index) const;
+  ::message::TextChatData* _internal_add_textmsgs();
   public:
+  const ::message::TextChatData& textmsgs(int index) const;
+  ::message::TextChatData* add_textmsgs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
+      textmsgs() const;
 
-  // int32 fromuid = 2;
+  // int32 fromuid = 1;
   void clear_fromuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
-  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t fromuid() const;
+  void set_fromuid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
-  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_fromuid() const;
+  void _internal_set_fromuid(int32_t value);
   public:
 
-  // int32 touid = 3;
+  // int32 touid = 2;
   void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t touid() const;
+  void set_touid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.SendChatMsgRsp)
+  // @@protoc_insertion_point(class_scope:message.TextChatMsgReq)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData > textmsgs_;
+    int32_t fromuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AuthFriendReq PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AuthFriendReq) */ {
+class TextChatData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.TextChatData) */ {
  public:
-  inline AuthFriendReq() : AuthFriendReq(nullptr) {}
-  virtual ~AuthFriendReq();
+  inline TextChatData() : TextChatData(nullptr) {}
+  ~TextChatData() override;
+  explicit PROTOBUF_CONSTEXPR TextChatData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AuthFriendReq(const AuthFriendReq& from);
-  AuthFriendReq(AuthFriendReq&& from) noexcept
-    : AuthFriendReq() {
+  TextChatData(const TextChatData& from);
+  TextChatData(TextChatData&& from) noexcept
+    : TextChatData() {
     *this = ::std::move(from);
   }
 
-  inline AuthFriendReq& operator=(const AuthFriendReq& from) {
+  inline TextChatData& operator=(const TextChatData& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AuthFriendReq& operator=(AuthFriendReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline TextChatData& operator=(TextChatData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2158,144 +3378,165 @@ class AuthFriendReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AuthFriendReq& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AuthFriendReq* internal_default_instance() {
-    return reinterpret_cast<const AuthFriendReq*>(
-               &_AuthFriendReq_default_instance_);
+  static const TextChatData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TextChatData* internal_default_instance() {
+    return reinterpret_cast<const TextChatData*>(
+               &_TextChatData_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    18;
 
-  friend void swap(AuthFriendReq& a, AuthFriendReq& b) {
+  friend void swap(TextChatData& a, TextChatData& b) {
     a.Swap(&b);
   }
-  inline void Swap(AuthFriendReq* other) {
+  inline void Swap(TextChatData* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AuthFriendReq* other) {
+  void UnsafeArenaSwap(TextChatData* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AuthFriendReq* New() const final {
-    return CreateMaybeMessage<AuthFriendReq>(nullptr);
+  TextChatData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TextChatData>(arena);
   }
-
-  AuthFriendReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AuthFriendReq>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TextChatData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TextChatData& from) {
+    TextChatData::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AuthFriendReq& from);
-  void MergeFrom(const AuthFriendReq& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AuthFriendReq* other);
+  void InternalSwap(TextChatData* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.AuthFriendReq";
+    return "message.TextChatData";
   }
   protected:
-  explicit AuthFriendReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit TextChatData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFromuidFieldNumber = 1,
-    kTouidFieldNumber = 2,
+    kMsgidFieldNumber = 1,
+    kMsgcontentFieldNumber = 2,
   };
-  // int32 fromuid = 1;
-  void clear_fromuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
-  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // string msgid = 1;
+  void clear_msgid();
+  const std::string& msgid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msgid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msgid();
+  PROTOBUF_NODISCARD std::string* release_msgid();
+  void set_allocated_msgid(std::string* msgid);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
-  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const std::string& _internal_msgid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msgid(const std::string& value);
+  std::string* _internal_mutable_msgid();
   public:
 
-  // int32 touid = 2;
-  void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // string msgcontent = 2;
+  void clear_msgcontent();
+  const std::string& msgcontent() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_msgcontent(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_msgcontent();
+  PROTOBUF_NODISCARD std::string* release_msgcontent();
+  void set_allocated_msgcontent(std::string* msgcontent);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const std::string& _internal_msgcontent() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_msgcontent(const std::string& value);
+  std::string* _internal_mutable_msgcontent();
   public:
 
-  // @@protoc_insertion_point(class_scope:message.AuthFriendReq)
+  // @@protoc_insertion_point(class_scope:message.TextChatData)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msgid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msgcontent_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AuthFriendRsp PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.AuthFriendRsp) */ {
+class TextChatMsgRsp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.TextChatMsgRsp) */ {
  public:
-  inline AuthFriendRsp() : AuthFriendRsp(nullptr) {}
-  virtual ~AuthFriendRsp();
+  inline TextChatMsgRsp() : TextChatMsgRsp(nullptr) {}
+  ~TextChatMsgRsp() override;
+  explicit PROTOBUF_CONSTEXPR TextChatMsgRsp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AuthFriendRsp(const AuthFriendRsp& from);
-  AuthFriendRsp(AuthFriendRsp&& from) noexcept
-    : AuthFriendRsp() {
+  TextChatMsgRsp(const TextChatMsgRsp& from);
+  TextChatMsgRsp(TextChatMsgRsp&& from) noexcept
+    : TextChatMsgRsp() {
     *this = ::std::move(from);
   }
 
-  inline AuthFriendRsp& operator=(const AuthFriendRsp& from) {
+  inline TextChatMsgRsp& operator=(const TextChatMsgRsp& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AuthFriendRsp& operator=(AuthFriendRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline TextChatMsgRsp& operator=(TextChatMsgRsp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2306,155 +3547,186 @@ class AuthFriendRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AuthFriendRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AuthFriendRsp* internal_default_instance() {
-    return reinterpret_cast<const AuthFriendRsp*>(
-               &_AuthFriendRsp_default_instance_);
+  static const TextChatMsgRsp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TextChatMsgRsp* internal_default_instance() {
+    return reinterpret_cast<const TextChatMsgRsp*>(
+               &_TextChatMsgRsp_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    19;
 
-  friend void swap(AuthFriendRsp& a, AuthFriendRsp& b) {
+  friend void swap(TextChatMsgRsp& a, TextChatMsgRsp& b) {
     a.Swap(&b);
   }
-  inline void Swap(AuthFriendRsp* other) {
+  inline void Swap(TextChatMsgRsp* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AuthFriendRsp* other) {
+  void UnsafeArenaSwap(TextChatMsgRsp* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AuthFriendRsp* New() const final {
-    return CreateMaybeMessage<AuthFriendRsp>(nullptr);
+  TextChatMsgRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TextChatMsgRsp>(arena);
   }
-
-  AuthFriendRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AuthFriendRsp>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TextChatMsgRsp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TextChatMsgRsp& from) {
+    TextChatMsgRsp::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AuthFriendRsp& from);
-  void MergeFrom(const AuthFriendRsp& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AuthFriendRsp* other);
+  void InternalSwap(TextChatMsgRsp* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.AuthFriendRsp";
+    return "message.TextChatMsgRsp";
   }
   protected:
-  explicit AuthFriendRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit TextChatMsgRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kTextmsgsFieldNumber = 4,
     kErrorFieldNumber = 1,
     kFromuidFieldNumber = 2,
     kTouidFieldNumber = 3,
   };
+  // repeated .message.TextChatData textmsgs = 4;
+  int textmsgs_size() const;
+  private:
+  int _internal_textmsgs_size() const;
+  public:
+  void clear_textmsgs();
+  ::message::TextChatData* mutable_textmsgs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >*
+      mutable_textmsgs();
+  private:
+  const ::message::TextChatData& _internal_textmsgs(int index) const;
+  ::message::TextChatData* _internal_add_textmsgs();
+  public:
+  const ::message::TextChatData& textmsgs(int index) const;
+  ::message::TextChatData* add_textmsgs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
+      textmsgs() const;
+
   // int32 error = 1;
   void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t error() const;
+  void set_error(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_error() const;
+  void _internal_set_error(int32_t value);
   public:
 
   // int32 fromuid = 2;
   void clear_fromuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
-  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t fromuid() const;
+  void set_fromuid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
-  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_fromuid() const;
+  void _internal_set_fromuid(int32_t value);
   public:
 
   // int32 touid = 3;
   void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t touid() const;
+  void set_touid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_touid() const;
+  void _internal_set_touid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.AuthFriendRsp)
+  // @@protoc_insertion_point(class_scope:message.TextChatMsgRsp)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData > textmsgs_;
+    int32_t error_;
+    int32_t fromuid_;
+    int32_t touid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TextChatMsgReq PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.TextChatMsgReq) */ {
+class PeerEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.PeerEvent) */ {
  public:
-  inline TextChatMsgReq() : TextChatMsgReq(nullptr) {}
-  virtual ~TextChatMsgReq();
+  inline PeerEvent() : PeerEvent(nullptr) {}
+  ~PeerEvent() override;
+  explicit PROTOBUF_CONSTEXPR PeerEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TextChatMsgReq(const TextChatMsgReq& from);
-  TextChatMsgReq(TextChatMsgReq&& from) noexcept
-    : TextChatMsgReq() {
+  PeerEvent(const PeerEvent& from);
+  PeerEvent(PeerEvent&& from) noexcept
+    : PeerEvent() {
     *this = ::std::move(from);
   }
 
-  inline TextChatMsgReq& operator=(const TextChatMsgReq& from) {
+  inline PeerEvent& operator=(const PeerEvent& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TextChatMsgReq& operator=(TextChatMsgReq&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline PeerEvent& operator=(PeerEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2465,164 +3737,236 @@ class TextChatMsgReq PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TextChatMsgReq& default_instance();
+  static const PeerEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  enum BodyCase {
+    kAddFriend = 3,
+    kAuthFriend = 4,
+    kTextMsg = 5,
+    BODY_NOT_SET = 0,
+  };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TextChatMsgReq* internal_default_instance() {
-    return reinterpret_cast<const TextChatMsgReq*>(
-               &_TextChatMsgReq_default_instance_);
+  static inline const PeerEvent* internal_default_instance() {
+    return reinterpret_cast<const PeerEvent*>(
+               &_PeerEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    20;
 
-  friend void swap(TextChatMsgReq& a, TextChatMsgReq& b) {
+  friend void swap(PeerEvent& a, PeerEvent& b) {
     a.Swap(&b);
   }
-  inline void Swap(TextChatMsgReq* other) {
+  inline void Swap(PeerEvent* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TextChatMsgReq* other) {
+  void UnsafeArenaSwap(PeerEvent* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TextChatMsgReq* New() const final {
-    return CreateMaybeMessage<TextChatMsgReq>(nullptr);
+  PeerEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerEvent>(arena);
   }
-
-  TextChatMsgReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TextChatMsgReq>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerEvent& from) {
+    PeerEvent::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TextChatMsgReq& from);
-  void MergeFrom(const TextChatMsgReq& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TextChatMsgReq* other);
+  void InternalSwap(PeerEvent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.TextChatMsgReq";
+    return "message.PeerEvent";
   }
   protected:
-  explicit TextChatMsgReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PeerEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTextmsgsFieldNumber = 3,
-    kFromuidFieldNumber = 1,
-    kTouidFieldNumber = 2,
+    kSeqFieldNumber = 1,
+    kTraceIdFieldNumber = 2,
+    kAddFriendFieldNumber = 3,
+    kAuthFriendFieldNumber = 4,
+    kTextMsgFieldNumber = 5,
   };
-  // repeated .message.TextChatData textmsgs = 3;
-  int textmsgs_size() const;
+  // uint64 seq = 1;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
   private:
-  int _internal_textmsgs_size() const;
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
   public:
-  void clear_textmsgs();
-  ::message::TextChatData* mutable_textmsgs(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >*
-      mutable_textmsgs();
+
+  // uint64 trace_id = 2;
+  void clear_trace_id();
+  uint64_t trace_id() const;
+  void set_trace_id(uint64_t value);
   private:
-  const ::message::TextChatData& _internal_textmsgs(int index) const;
-  ::message::TextChatData* _internal_add_textmsgs();
+  uint64_t _internal_trace_id() const;
+  void _internal_set_trace_id(uint64_t value);
   public:
-  const ::message::TextChatData& textmsgs(int index) const;
-  ::message::TextChatData* add_textmsgs();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
-      textmsgs() const;
 
-  // int32 fromuid = 1;
-  void clear_fromuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
-  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // .message.AddFriendReq add_friend = 3;
+  bool has_add_friend() const;
+  private:
+  bool _internal_has_add_friend() const;
+  public:
+  void clear_add_friend();
+  const ::message::AddFriendReq& add_friend() const;
+  PROTOBUF_NODISCARD ::message::AddFriendReq* release_add_friend();
+  ::message::AddFriendReq* mutable_add_friend();
+  void set_allocated_add_friend(::message::AddFriendReq* add_friend);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
-  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::message::AddFriendReq& _internal_add_friend() const;
+  ::message::AddFriendReq* _internal_mutable_add_friend();
   public:
+  void unsafe_arena_set_allocated_add_friend(
+      ::message::AddFriendReq* add_friend);
+  ::message::AddFriendReq* unsafe_arena_release_add_friend();
 
-  // int32 touid = 2;
-  void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // .message.AuthFriendReq auth_friend = 4;
+  bool has_auth_friend() const;
+  private:
+  bool _internal_has_auth_friend() const;
+  public:
+  void clear_auth_friend();
+  const ::message::AuthFriendReq& auth_friend() const;
+  PROTOBUF_NODISCARD ::message::AuthFriendReq* release_auth_friend();
+  ::message::AuthFriendReq* mutable_auth_friend();
+  void set_allocated_auth_friend(::message::AuthFriendReq* auth_friend);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::message::AuthFriendReq& _internal_auth_friend() const;
+  ::message::AuthFriendReq* _internal_mutable_auth_friend();
   public:
+  void unsafe_arena_set_allocated_auth_friend(
+      ::message::AuthFriendReq* auth_friend);
+  ::message::AuthFriendReq* unsafe_arena_release_auth_friend();
 
-  // @@protoc_insertion_point(class_scope:message.TextChatMsgReq)
+  // .message.TextChatMsgReq text_msg = 5;
+  bool has_text_msg() const;
+  private:
+  bool _internal_has_text_msg() const;
+  public:
+  void clear_text_msg();
+  const ::message::TextChatMsgReq& text_msg() const;
+  PROTOBUF_NODISCARD ::message::TextChatMsgReq* release_text_msg();
+  ::message::TextChatMsgReq* mutable_text_msg();
+  void set_allocated_text_msg(::message::TextChatMsgReq* text_msg);
+  private:
+  const ::message::TextChatMsgReq& _internal_text_msg() const;
+  ::message::TextChatMsgReq* _internal_mutable_text_msg();
+  public:
+  void unsafe_arena_set_allocated_text_msg(
+      ::message::TextChatMsgReq* text_msg);
+  ::message::TextChatMsgReq* unsafe_arena_release_text_msg();
+
+  void clear_body();
+  BodyCase body_case() const;
+  // @@protoc_insertion_point(class_scope:message.PeerEvent)
  private:
   class _Internal;
+  void set_has_add_friend();
+  void set_has_auth_friend();
+  void set_has_text_msg();
+
+  inline bool has_body() const;
+  inline void clear_has_body();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData > textmsgs_;
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t seq_;
+    uint64_t trace_id_;
+    union BodyUnion {
+      constexpr BodyUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::message::AddFriendReq* add_friend_;
+      ::message::AuthFriendReq* auth_friend_;
+      ::message::TextChatMsgReq* text_msg_;
+    } body_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TextChatData PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.TextChatData) */ {
+class PeerBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.PeerBatch) */ {
  public:
-  inline TextChatData() : TextChatData(nullptr) {}
-  virtual ~TextChatData();
+  inline PeerBatch() : PeerBatch(nullptr) {}
+  ~PeerBatch() override;
+  explicit PROTOBUF_CONSTEXPR PeerBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TextChatData(const TextChatData& from);
-  TextChatData(TextChatData&& from) noexcept
-    : TextChatData() {
+  PeerBatch(const PeerBatch& from);
+  PeerBatch(PeerBatch&& from) noexcept
+    : PeerBatch() {
     *this = ::std::move(from);
   }
 
-  inline TextChatData& operator=(const TextChatData& from) {
+  inline PeerBatch& operator=(const PeerBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TextChatData& operator=(TextChatData&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline PeerBatch& operator=(PeerBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2633,158 +3977,180 @@ class TextChatData PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TextChatData& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TextChatData* internal_default_instance() {
-    return reinterpret_cast<const TextChatData*>(
-               &_TextChatData_default_instance_);
+  static const PeerBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerBatch* internal_default_instance() {
+    return reinterpret_cast<const PeerBatch*>(
+               &_PeerBatch_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    21;
 
-  friend void swap(TextChatData& a, TextChatData& b) {
+  friend void swap(PeerBatch& a, PeerBatch& b) {
     a.Swap(&b);
   }
-  inline void Swap(TextChatData* other) {
+  inline void Swap(PeerBatch* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TextChatData* other) {
+  void UnsafeArenaSwap(PeerBatch* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TextChatData* New() const final {
-    return CreateMaybeMessage<TextChatData>(nullptr);
+  PeerBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerBatch>(arena);
   }
-
-  TextChatData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TextChatData>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerBatch& from) {
+    PeerBatch::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TextChatData& from);
-  void MergeFrom(const TextChatData& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TextChatData* other);
+  void InternalSwap(PeerBatch* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.TextChatData";
+    return "message.PeerBatch";
   }
   protected:
-  explicit TextChatData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PeerBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMsgidFieldNumber = 1,
-    kMsgcontentFieldNumber = 2,
+    kEventsFieldNumber = 3,
+    kFromServerFieldNumber = 1,
+    kEpochFieldNumber = 2,
   };
-  // string msgid = 1;
-  void clear_msgid();
-  const std::string& msgid() const;
-  void set_msgid(const std::string& value);
-  void set_msgid(std::string&& value);
-  void set_msgid(const char* value);
-  void set_msgid(const char* value, size_t size);
-  std::string* mutable_msgid();
-  std::string* release_msgid();
-  void set_allocated_msgid(std::string* msgid);
+  // repeated .message.PeerEvent events = 3;
+  int events_size() const;
   private:
-  const std::string& _internal_msgid() const;
-  void _internal_set_msgid(const std::string& value);
-  std::string* _internal_mutable_msgid();
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::message::PeerEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::PeerEvent >*
+      mutable_events();
+  private:
+  const ::message::PeerEvent& _internal_events(int index) const;
+  ::message::PeerEvent* _internal_add_events();
+  public:
+  const ::message::PeerEvent& events(int index) const;
+  ::message::PeerEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::PeerEvent >&
+      events() const;
+
+  // string from_server = 1;
+  void clear_from_server();
+  const std::string& from_server() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from_server(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from_server();
+  PROTOBUF_NODISCARD std::string* release_from_server();
+  void set_allocated_from_server(std::string* from_server);
+  private:
+  const std::string& _internal_from_server() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from_server(const std::string& value);
+  std::string* _internal_mutable_from_server();
   public:
 
-  // string msgcontent = 2;
-  void clear_msgcontent();
-  const std::string& msgcontent() const;
-  void set_msgcontent(const std::string& value);
-  void set_msgcontent(std::string&& value);
-  void set_msgcontent(const char* value);
-  void set_msgcontent(const char* value, size_t size);
-  std::string* mutable_msgcontent();
-  std::string* release_msgcontent();
-  void set_allocated_msgcontent(std::string* msgcontent);
+  // uint64 epoch = 2;
+  void clear_epoch();
+  uint64_t epoch() const;
+  void set_epoch(uint64_t value);
   private:
-  const std::string& _internal_msgcontent() const;
-  void _internal_set_msgcontent(const std::string& value);
-  std::string* _internal_mutable_msgcontent();
+  uint64_t _internal_epoch() const;
+  void _internal_set_epoch(uint64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.TextChatData)
+  // @@protoc_insertion_point(class_scope:message.PeerBatch)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msgid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr msgcontent_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::PeerEvent > events_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_server_;
+    uint64_t epoch_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TextChatMsgRsp PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.TextChatMsgRsp) */ {
+class PeerAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.PeerAck) */ {
  public:
-  inline TextChatMsgRsp() : TextChatMsgRsp(nullptr) {}
-  virtual ~TextChatMsgRsp();
+  inline PeerAck() : PeerAck(nullptr) {}
+  ~PeerAck() override;
+  explicit PROTOBUF_CONSTEXPR PeerAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TextChatMsgRsp(const TextChatMsgRsp& from);
-  TextChatMsgRsp(TextChatMsgRsp&& from) noexcept
-    : TextChatMsgRsp() {
+  PeerAck(const PeerAck& from);
+  PeerAck(PeerAck&& from) noexcept
+    : PeerAck() {
     *this = ::std::move(from);
   }
 
-  inline TextChatMsgRsp& operator=(const TextChatMsgRsp& from) {
+  inline PeerAck& operator=(const PeerAck& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TextChatMsgRsp& operator=(TextChatMsgRsp&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline PeerAck& operator=(PeerAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2795,152 +4161,115 @@ class TextChatMsgRsp PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const TextChatMsgRsp& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TextChatMsgRsp* internal_default_instance() {
-    return reinterpret_cast<const TextChatMsgRsp*>(
-               &_TextChatMsgRsp_default_instance_);
+  static const PeerAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerAck* internal_default_instance() {
+    return reinterpret_cast<const PeerAck*>(
+               &_PeerAck_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    22;
 
-  friend void swap(TextChatMsgRsp& a, TextChatMsgRsp& b) {
+  friend void swap(PeerAck& a, PeerAck& b) {
     a.Swap(&b);
   }
-  inline void Swap(TextChatMsgRsp* other) {
+  inline void Swap(PeerAck* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TextChatMsgRsp* other) {
+  void UnsafeArenaSwap(PeerAck* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TextChatMsgRsp* New() const final {
-    return CreateMaybeMessage<TextChatMsgRsp>(nullptr);
+  PeerAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerAck>(arena);
   }
-
-  TextChatMsgRsp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TextChatMsgRsp>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerAck& from) {
+    PeerAck::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TextChatMsgRsp& from);
-  void MergeFrom(const TextChatMsgRsp& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TextChatMsgRsp* other);
+  void InternalSwap(PeerAck* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "message.TextChatMsgRsp";
+    return "message.PeerAck";
   }
   protected:
-  explicit TextChatMsgRsp(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PeerAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
-    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kTextmsgsFieldNumber = 4,
-    kErrorFieldNumber = 1,
-    kFromuidFieldNumber = 2,
-    kTouidFieldNumber = 3,
-  };
-  // repeated .message.TextChatData textmsgs = 4;
-  int textmsgs_size() const;
-  private:
-  int _internal_textmsgs_size() const;
-  public:
-  void clear_textmsgs();
-  ::message::TextChatData* mutable_textmsgs(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >*
-      mutable_textmsgs();
-  private:
-  const ::message::TextChatData& _internal_textmsgs(int index) const;
-  ::message::TextChatData* _internal_add_textmsgs();
-  public:
-  const ::message::TextChatData& textmsgs(int index) const;
-  ::message::TextChatData* add_textmsgs();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
-      textmsgs() const;
-
-  // int32 error = 1;
-  void clear_error();
-  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
-  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
-  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 fromuid = 2;
-  void clear_fromuid();
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid() const;
-  void set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fromuid() const;
-  void _internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 touid = 3;
-  void clear_touid();
-  ::PROTOBUF_NAMESPACE_ID::int32 touid() const;
-  void set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  enum : int {
+    kAckedSeqFieldNumber = 1,
+  };
+  // uint64 acked_seq = 1;
+  void clear_acked_seq();
+  uint64_t acked_seq() const;
+  void set_acked_seq(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_touid() const;
-  void _internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  uint64_t _internal_acked_seq() const;
+  void _internal_set_acked_seq(uint64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:message.TextChatMsgRsp)
+  // @@protoc_insertion_point(class_scope:message.PeerAck)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData > textmsgs_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_;
-  ::PROTOBUF_NAMESPACE_ID::int32 fromuid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 touid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t acked_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // ===================================================================
@@ -2956,54 +4285,38 @@ class TextChatMsgRsp PROTOBUF_FINAL :
 
 // string email = 1;
 inline void GetVarifyReq::clear_email() {
-  email_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.email_.ClearToEmpty();
 }
 inline const std::string& GetVarifyReq::email() const {
   // @@protoc_insertion_point(field_get:message.GetVarifyReq.email)
   return _internal_email();
 }
-inline void GetVarifyReq::set_email(const std::string& value) {
-  _internal_set_email(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetVarifyReq::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.GetVarifyReq.email)
 }
 inline std::string* GetVarifyReq::mutable_email() {
+  std::string* _s = _internal_mutable_email();
   // @@protoc_insertion_point(field_mutable:message.GetVarifyReq.email)
-  return _internal_mutable_email();
+  return _s;
 }
 inline const std::string& GetVarifyReq::_internal_email() const {
-  return email_.Get();
+  return _impl_.email_.Get();
 }
 inline void GetVarifyReq::_internal_set_email(const std::string& value) {
   
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetVarifyReq::set_email(std::string&& value) {
-  
-  email_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.GetVarifyReq.email)
-}
-inline void GetVarifyReq::set_email(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.GetVarifyReq.email)
-}
-inline void GetVarifyReq::set_email(const char* value,
-    size_t size) {
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.GetVarifyReq.email)
+  _impl_.email_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetVarifyReq::_internal_mutable_email() {
   
-  return email_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.email_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetVarifyReq::release_email() {
   // @@protoc_insertion_point(field_release:message.GetVarifyReq.email)
-  return email_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.email_.Release();
 }
 inline void GetVarifyReq::set_allocated_email(std::string* email) {
   if (email != nullptr) {
@@ -3011,8 +4324,12 @@ inline void GetVarifyReq::set_allocated_email(std::string* email) {
   } else {
     
   }
-  email_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), email,
-      GetArena());
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.GetVarifyReq.email)
 }
 
@@ -3022,74 +4339,58 @@ inline void GetVarifyReq::set_allocated_email(std::string* email) {
 
 // int32 error = 1;
 inline void GetVarifyRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetVarifyRsp::_internal_error() const {
-  return error_;
+inline int32_t GetVarifyRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetVarifyRsp::error() const {
+inline int32_t GetVarifyRsp::error() const {
   // @@protoc_insertion_point(field_get:message.GetVarifyRsp.error)
   return _internal_error();
 }
-inline void GetVarifyRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetVarifyRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void GetVarifyRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetVarifyRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.GetVarifyRsp.error)
 }
 
 // string email = 2;
 inline void GetVarifyRsp::clear_email() {
-  email_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.email_.ClearToEmpty();
 }
 inline const std::string& GetVarifyRsp::email() const {
   // @@protoc_insertion_point(field_get:message.GetVarifyRsp.email)
   return _internal_email();
 }
-inline void GetVarifyRsp::set_email(const std::string& value) {
-  _internal_set_email(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetVarifyRsp::set_email(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.email_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.GetVarifyRsp.email)
 }
 inline std::string* GetVarifyRsp::mutable_email() {
+  std::string* _s = _internal_mutable_email();
   // @@protoc_insertion_point(field_mutable:message.GetVarifyRsp.email)
-  return _internal_mutable_email();
+  return _s;
 }
 inline const std::string& GetVarifyRsp::_internal_email() const {
-  return email_.Get();
+  return _impl_.email_.Get();
 }
 inline void GetVarifyRsp::_internal_set_email(const std::string& value) {
   
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetVarifyRsp::set_email(std::string&& value) {
-  
-  email_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.GetVarifyRsp.email)
-}
-inline void GetVarifyRsp::set_email(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.GetVarifyRsp.email)
-}
-inline void GetVarifyRsp::set_email(const char* value,
-    size_t size) {
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.GetVarifyRsp.email)
+  _impl_.email_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetVarifyRsp::_internal_mutable_email() {
   
-  return email_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.email_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetVarifyRsp::release_email() {
   // @@protoc_insertion_point(field_release:message.GetVarifyRsp.email)
-  return email_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.email_.Release();
 }
 inline void GetVarifyRsp::set_allocated_email(std::string* email) {
   if (email != nullptr) {
@@ -3097,61 +4398,49 @@ inline void GetVarifyRsp::set_allocated_email(std::string* email) {
   } else {
     
   }
-  email_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), email,
-      GetArena());
+  _impl_.email_.SetAllocated(email, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.email_.IsDefault()) {
+    _impl_.email_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.GetVarifyRsp.email)
 }
 
 // string code = 3;
 inline void GetVarifyRsp::clear_code() {
-  code_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.code_.ClearToEmpty();
 }
 inline const std::string& GetVarifyRsp::code() const {
   // @@protoc_insertion_point(field_get:message.GetVarifyRsp.code)
   return _internal_code();
 }
-inline void GetVarifyRsp::set_code(const std::string& value) {
-  _internal_set_code(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetVarifyRsp::set_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.GetVarifyRsp.code)
 }
 inline std::string* GetVarifyRsp::mutable_code() {
+  std::string* _s = _internal_mutable_code();
   // @@protoc_insertion_point(field_mutable:message.GetVarifyRsp.code)
-  return _internal_mutable_code();
+  return _s;
 }
 inline const std::string& GetVarifyRsp::_internal_code() const {
-  return code_.Get();
+  return _impl_.code_.Get();
 }
 inline void GetVarifyRsp::_internal_set_code(const std::string& value) {
   
-  code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetVarifyRsp::set_code(std::string&& value) {
-  
-  code_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.GetVarifyRsp.code)
-}
-inline void GetVarifyRsp::set_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.GetVarifyRsp.code)
-}
-inline void GetVarifyRsp::set_code(const char* value,
-    size_t size) {
-  
-  code_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.GetVarifyRsp.code)
+  _impl_.code_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetVarifyRsp::_internal_mutable_code() {
   
-  return code_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.code_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetVarifyRsp::release_code() {
   // @@protoc_insertion_point(field_release:message.GetVarifyRsp.code)
-  return code_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.code_.Release();
 }
 inline void GetVarifyRsp::set_allocated_code(std::string* code) {
   if (code != nullptr) {
@@ -3159,8 +4448,12 @@ inline void GetVarifyRsp::set_allocated_code(std::string* code) {
   } else {
     
   }
-  code_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), code,
-      GetArena());
+  _impl_.code_.SetAllocated(code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.code_.IsDefault()) {
+    _impl_.code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.GetVarifyRsp.code)
 }
 
@@ -3170,20 +4463,20 @@ inline void GetVarifyRsp::set_allocated_code(std::string* code) {
 
 // int32 uid = 1;
 inline void GetChatServerReq::clear_uid() {
-  uid_ = 0;
+  _impl_.uid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServerReq::_internal_uid() const {
-  return uid_;
+inline int32_t GetChatServerReq::_internal_uid() const {
+  return _impl_.uid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServerReq::uid() const {
+inline int32_t GetChatServerReq::uid() const {
   // @@protoc_insertion_point(field_get:message.GetChatServerReq.uid)
   return _internal_uid();
 }
-inline void GetChatServerReq::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetChatServerReq::_internal_set_uid(int32_t value) {
   
-  uid_ = value;
+  _impl_.uid_ = value;
 }
-inline void GetChatServerReq::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetChatServerReq::set_uid(int32_t value) {
   _internal_set_uid(value);
   // @@protoc_insertion_point(field_set:message.GetChatServerReq.uid)
 }
@@ -3194,74 +4487,58 @@ inline void GetChatServerReq::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 error = 1;
 inline void GetChatServerRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServerRsp::_internal_error() const {
-  return error_;
+inline int32_t GetChatServerRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServerRsp::error() const {
+inline int32_t GetChatServerRsp::error() const {
   // @@protoc_insertion_point(field_get:message.GetChatServerRsp.error)
   return _internal_error();
 }
-inline void GetChatServerRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetChatServerRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void GetChatServerRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void GetChatServerRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.GetChatServerRsp.error)
 }
 
 // string host = 2;
 inline void GetChatServerRsp::clear_host() {
-  host_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.host_.ClearToEmpty();
 }
 inline const std::string& GetChatServerRsp::host() const {
   // @@protoc_insertion_point(field_get:message.GetChatServerRsp.host)
   return _internal_host();
 }
-inline void GetChatServerRsp::set_host(const std::string& value) {
-  _internal_set_host(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetChatServerRsp::set_host(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.host_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.GetChatServerRsp.host)
 }
 inline std::string* GetChatServerRsp::mutable_host() {
+  std::string* _s = _internal_mutable_host();
   // @@protoc_insertion_point(field_mutable:message.GetChatServerRsp.host)
-  return _internal_mutable_host();
+  return _s;
 }
 inline const std::string& GetChatServerRsp::_internal_host() const {
-  return host_.Get();
+  return _impl_.host_.Get();
 }
 inline void GetChatServerRsp::_internal_set_host(const std::string& value) {
   
-  host_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetChatServerRsp::set_host(std::string&& value) {
-  
-  host_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.GetChatServerRsp.host)
-}
-inline void GetChatServerRsp::set_host(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  host_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.GetChatServerRsp.host)
-}
-inline void GetChatServerRsp::set_host(const char* value,
-    size_t size) {
-  
-  host_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.GetChatServerRsp.host)
+  _impl_.host_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetChatServerRsp::_internal_mutable_host() {
   
-  return host_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.host_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetChatServerRsp::release_host() {
   // @@protoc_insertion_point(field_release:message.GetChatServerRsp.host)
-  return host_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.host_.Release();
 }
 inline void GetChatServerRsp::set_allocated_host(std::string* host) {
   if (host != nullptr) {
@@ -3269,61 +4546,49 @@ inline void GetChatServerRsp::set_allocated_host(std::string* host) {
   } else {
     
   }
-  host_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), host,
-      GetArena());
+  _impl_.host_.SetAllocated(host, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.GetChatServerRsp.host)
 }
 
 // string port = 3;
 inline void GetChatServerRsp::clear_port() {
-  port_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.port_.ClearToEmpty();
 }
 inline const std::string& GetChatServerRsp::port() const {
   // @@protoc_insertion_point(field_get:message.GetChatServerRsp.port)
   return _internal_port();
 }
-inline void GetChatServerRsp::set_port(const std::string& value) {
-  _internal_set_port(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetChatServerRsp::set_port(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.port_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.GetChatServerRsp.port)
 }
 inline std::string* GetChatServerRsp::mutable_port() {
+  std::string* _s = _internal_mutable_port();
   // @@protoc_insertion_point(field_mutable:message.GetChatServerRsp.port)
-  return _internal_mutable_port();
+  return _s;
 }
 inline const std::string& GetChatServerRsp::_internal_port() const {
-  return port_.Get();
+  return _impl_.port_.Get();
 }
 inline void GetChatServerRsp::_internal_set_port(const std::string& value) {
   
-  port_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetChatServerRsp::set_port(std::string&& value) {
-  
-  port_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.GetChatServerRsp.port)
-}
-inline void GetChatServerRsp::set_port(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  port_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.GetChatServerRsp.port)
-}
-inline void GetChatServerRsp::set_port(const char* value,
-    size_t size) {
-  
-  port_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.GetChatServerRsp.port)
+  _impl_.port_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetChatServerRsp::_internal_mutable_port() {
   
-  return port_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.port_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetChatServerRsp::release_port() {
   // @@protoc_insertion_point(field_release:message.GetChatServerRsp.port)
-  return port_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.port_.Release();
 }
 inline void GetChatServerRsp::set_allocated_port(std::string* port) {
   if (port != nullptr) {
@@ -3331,61 +4596,49 @@ inline void GetChatServerRsp::set_allocated_port(std::string* port) {
   } else {
     
   }
-  port_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), port,
-      GetArena());
+  _impl_.port_.SetAllocated(port, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.port_.IsDefault()) {
+    _impl_.port_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.GetChatServerRsp.port)
 }
 
 // string token = 4;
 inline void GetChatServerRsp::clear_token() {
-  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.token_.ClearToEmpty();
 }
 inline const std::string& GetChatServerRsp::token() const {
   // @@protoc_insertion_point(field_get:message.GetChatServerRsp.token)
   return _internal_token();
 }
-inline void GetChatServerRsp::set_token(const std::string& value) {
-  _internal_set_token(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetChatServerRsp::set_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.GetChatServerRsp.token)
 }
 inline std::string* GetChatServerRsp::mutable_token() {
+  std::string* _s = _internal_mutable_token();
   // @@protoc_insertion_point(field_mutable:message.GetChatServerRsp.token)
-  return _internal_mutable_token();
+  return _s;
 }
 inline const std::string& GetChatServerRsp::_internal_token() const {
-  return token_.Get();
+  return _impl_.token_.Get();
 }
 inline void GetChatServerRsp::_internal_set_token(const std::string& value) {
   
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void GetChatServerRsp::set_token(std::string&& value) {
-  
-  token_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.GetChatServerRsp.token)
-}
-inline void GetChatServerRsp::set_token(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.GetChatServerRsp.token)
-}
-inline void GetChatServerRsp::set_token(const char* value,
-    size_t size) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.GetChatServerRsp.token)
+  _impl_.token_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GetChatServerRsp::_internal_mutable_token() {
   
-  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.token_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GetChatServerRsp::release_token() {
   // @@protoc_insertion_point(field_release:message.GetChatServerRsp.token)
-  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.token_.Release();
 }
 inline void GetChatServerRsp::set_allocated_token(std::string* token) {
   if (token != nullptr) {
@@ -3393,8 +4646,12 @@ inline void GetChatServerRsp::set_allocated_token(std::string* token) {
   } else {
     
   }
-  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
-      GetArena());
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.GetChatServerRsp.token)
 }
 
@@ -3404,190 +4661,658 @@ inline void GetChatServerRsp::set_allocated_token(std::string* token) {
 
 // int32 uid = 1;
 inline void LoginReq::clear_uid() {
-  uid_ = 0;
+  _impl_.uid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LoginReq::_internal_uid() const {
-  return uid_;
+inline int32_t LoginReq::_internal_uid() const {
+  return _impl_.uid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LoginReq::uid() const {
+inline int32_t LoginReq::uid() const {
   // @@protoc_insertion_point(field_get:message.LoginReq.uid)
   return _internal_uid();
 }
-inline void LoginReq::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LoginReq::_internal_set_uid(int32_t value) {
   
-  uid_ = value;
+  _impl_.uid_ = value;
 }
-inline void LoginReq::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LoginReq::set_uid(int32_t value) {
   _internal_set_uid(value);
   // @@protoc_insertion_point(field_set:message.LoginReq.uid)
 }
 
 // string token = 2;
 inline void LoginReq::clear_token() {
-  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.token_.ClearToEmpty();
 }
 inline const std::string& LoginReq::token() const {
   // @@protoc_insertion_point(field_get:message.LoginReq.token)
   return _internal_token();
 }
-inline void LoginReq::set_token(const std::string& value) {
-  _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:message.LoginReq.token)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginReq::set_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.LoginReq.token)
+}
+inline std::string* LoginReq::mutable_token() {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:message.LoginReq.token)
+  return _s;
+}
+inline const std::string& LoginReq::_internal_token() const {
+  return _impl_.token_.Get();
+}
+inline void LoginReq::_internal_set_token(const std::string& value) {
+  
+  _impl_.token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginReq::_internal_mutable_token() {
+  
+  return _impl_.token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginReq::release_token() {
+  // @@protoc_insertion_point(field_release:message.LoginReq.token)
+  return _impl_.token_.Release();
+}
+inline void LoginReq::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.LoginReq.token)
+}
+
+// -------------------------------------------------------------------
+
+// LoginRsp
+
+// int32 error = 1;
+inline void LoginRsp::clear_error() {
+  _impl_.error_ = 0;
+}
+inline int32_t LoginRsp::_internal_error() const {
+  return _impl_.error_;
+}
+inline int32_t LoginRsp::error() const {
+  // @@protoc_insertion_point(field_get:message.LoginRsp.error)
+  return _internal_error();
+}
+inline void LoginRsp::_internal_set_error(int32_t value) {
+  
+  _impl_.error_ = value;
+}
+inline void LoginRsp::set_error(int32_t value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.LoginRsp.error)
+}
+
+// int32 uid = 2;
+inline void LoginRsp::clear_uid() {
+  _impl_.uid_ = 0;
+}
+inline int32_t LoginRsp::_internal_uid() const {
+  return _impl_.uid_;
+}
+inline int32_t LoginRsp::uid() const {
+  // @@protoc_insertion_point(field_get:message.LoginRsp.uid)
+  return _internal_uid();
+}
+inline void LoginRsp::_internal_set_uid(int32_t value) {
+  
+  _impl_.uid_ = value;
+}
+inline void LoginRsp::set_uid(int32_t value) {
+  _internal_set_uid(value);
+  // @@protoc_insertion_point(field_set:message.LoginRsp.uid)
+}
+
+// string token = 3;
+inline void LoginRsp::clear_token() {
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& LoginRsp::token() const {
+  // @@protoc_insertion_point(field_get:message.LoginRsp.token)
+  return _internal_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRsp::set_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.LoginRsp.token)
+}
+inline std::string* LoginRsp::mutable_token() {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:message.LoginRsp.token)
+  return _s;
+}
+inline const std::string& LoginRsp::_internal_token() const {
+  return _impl_.token_.Get();
+}
+inline void LoginRsp::_internal_set_token(const std::string& value) {
+  
+  _impl_.token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginRsp::_internal_mutable_token() {
+  
+  return _impl_.token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginRsp::release_token() {
+  // @@protoc_insertion_point(field_release:message.LoginRsp.token)
+  return _impl_.token_.Release();
+}
+inline void LoginRsp::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.LoginRsp.token)
+}
+
+// -------------------------------------------------------------------
+
+// ChatServerInfo
+
+// string name = 1;
+inline void ChatServerInfo::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& ChatServerInfo::name() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerInfo.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatServerInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.ChatServerInfo.name)
+}
+inline std::string* ChatServerInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:message.ChatServerInfo.name)
+  return _s;
+}
+inline const std::string& ChatServerInfo::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ChatServerInfo::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::release_name() {
+  // @@protoc_insertion_point(field_release:message.ChatServerInfo.name)
+  return _impl_.name_.Release();
+}
+inline void ChatServerInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerInfo.name)
+}
+
+// string host = 2;
+inline void ChatServerInfo::clear_host() {
+  _impl_.host_.ClearToEmpty();
+}
+inline const std::string& ChatServerInfo::host() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerInfo.host)
+  return _internal_host();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatServerInfo::set_host(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.host_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.ChatServerInfo.host)
+}
+inline std::string* ChatServerInfo::mutable_host() {
+  std::string* _s = _internal_mutable_host();
+  // @@protoc_insertion_point(field_mutable:message.ChatServerInfo.host)
+  return _s;
+}
+inline const std::string& ChatServerInfo::_internal_host() const {
+  return _impl_.host_.Get();
+}
+inline void ChatServerInfo::_internal_set_host(const std::string& value) {
+  
+  _impl_.host_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::_internal_mutable_host() {
+  
+  return _impl_.host_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::release_host() {
+  // @@protoc_insertion_point(field_release:message.ChatServerInfo.host)
+  return _impl_.host_.Release();
+}
+inline void ChatServerInfo::set_allocated_host(std::string* host) {
+  if (host != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.host_.SetAllocated(host, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.host_.IsDefault()) {
+    _impl_.host_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerInfo.host)
+}
+
+// string port = 3;
+inline void ChatServerInfo::clear_port() {
+  _impl_.port_.ClearToEmpty();
+}
+inline const std::string& ChatServerInfo::port() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerInfo.port)
+  return _internal_port();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatServerInfo::set_port(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.port_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.ChatServerInfo.port)
+}
+inline std::string* ChatServerInfo::mutable_port() {
+  std::string* _s = _internal_mutable_port();
+  // @@protoc_insertion_point(field_mutable:message.ChatServerInfo.port)
+  return _s;
+}
+inline const std::string& ChatServerInfo::_internal_port() const {
+  return _impl_.port_.Get();
+}
+inline void ChatServerInfo::_internal_set_port(const std::string& value) {
+  
+  _impl_.port_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::_internal_mutable_port() {
+  
+  return _impl_.port_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::release_port() {
+  // @@protoc_insertion_point(field_release:message.ChatServerInfo.port)
+  return _impl_.port_.Release();
+}
+inline void ChatServerInfo::set_allocated_port(std::string* port) {
+  if (port != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.port_.SetAllocated(port, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.port_.IsDefault()) {
+    _impl_.port_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerInfo.port)
+}
+
+// string rpc_host = 4;
+inline void ChatServerInfo::clear_rpc_host() {
+  _impl_.rpc_host_.ClearToEmpty();
+}
+inline const std::string& ChatServerInfo::rpc_host() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerInfo.rpc_host)
+  return _internal_rpc_host();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatServerInfo::set_rpc_host(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rpc_host_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.ChatServerInfo.rpc_host)
+}
+inline std::string* ChatServerInfo::mutable_rpc_host() {
+  std::string* _s = _internal_mutable_rpc_host();
+  // @@protoc_insertion_point(field_mutable:message.ChatServerInfo.rpc_host)
+  return _s;
+}
+inline const std::string& ChatServerInfo::_internal_rpc_host() const {
+  return _impl_.rpc_host_.Get();
+}
+inline void ChatServerInfo::_internal_set_rpc_host(const std::string& value) {
+  
+  _impl_.rpc_host_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::_internal_mutable_rpc_host() {
+  
+  return _impl_.rpc_host_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::release_rpc_host() {
+  // @@protoc_insertion_point(field_release:message.ChatServerInfo.rpc_host)
+  return _impl_.rpc_host_.Release();
+}
+inline void ChatServerInfo::set_allocated_rpc_host(std::string* rpc_host) {
+  if (rpc_host != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rpc_host_.SetAllocated(rpc_host, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rpc_host_.IsDefault()) {
+    _impl_.rpc_host_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerInfo.rpc_host)
+}
+
+// string rpc_port = 5;
+inline void ChatServerInfo::clear_rpc_port() {
+  _impl_.rpc_port_.ClearToEmpty();
+}
+inline const std::string& ChatServerInfo::rpc_port() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerInfo.rpc_port)
+  return _internal_rpc_port();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChatServerInfo::set_rpc_port(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rpc_port_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.ChatServerInfo.rpc_port)
+}
+inline std::string* ChatServerInfo::mutable_rpc_port() {
+  std::string* _s = _internal_mutable_rpc_port();
+  // @@protoc_insertion_point(field_mutable:message.ChatServerInfo.rpc_port)
+  return _s;
+}
+inline const std::string& ChatServerInfo::_internal_rpc_port() const {
+  return _impl_.rpc_port_.Get();
+}
+inline void ChatServerInfo::_internal_set_rpc_port(const std::string& value) {
+  
+  _impl_.rpc_port_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::_internal_mutable_rpc_port() {
+  
+  return _impl_.rpc_port_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChatServerInfo::release_rpc_port() {
+  // @@protoc_insertion_point(field_release:message.ChatServerInfo.rpc_port)
+  return _impl_.rpc_port_.Release();
+}
+inline void ChatServerInfo::set_allocated_rpc_port(std::string* rpc_port) {
+  if (rpc_port != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rpc_port_.SetAllocated(rpc_port, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rpc_port_.IsDefault()) {
+    _impl_.rpc_port_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerInfo.rpc_port)
+}
+
+// -------------------------------------------------------------------
+
+// HeartbeatReq
+
+// .message.ChatServerInfo server = 1;
+inline bool HeartbeatReq::_internal_has_server() const {
+  return this != internal_default_instance() && _impl_.server_ != nullptr;
+}
+inline bool HeartbeatReq::has_server() const {
+  return _internal_has_server();
+}
+inline void HeartbeatReq::clear_server() {
+  if (GetArenaForAllocation() == nullptr && _impl_.server_ != nullptr) {
+    delete _impl_.server_;
+  }
+  _impl_.server_ = nullptr;
+}
+inline const ::message::ChatServerInfo& HeartbeatReq::_internal_server() const {
+  const ::message::ChatServerInfo* p = _impl_.server_;
+  return p != nullptr ? *p : reinterpret_cast<const ::message::ChatServerInfo&>(
+      ::message::_ChatServerInfo_default_instance_);
+}
+inline const ::message::ChatServerInfo& HeartbeatReq::server() const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatReq.server)
+  return _internal_server();
+}
+inline void HeartbeatReq::unsafe_arena_set_allocated_server(
+    ::message::ChatServerInfo* server) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.server_);
+  }
+  _impl_.server_ = server;
+  if (server) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.HeartbeatReq.server)
+}
+inline ::message::ChatServerInfo* HeartbeatReq::release_server() {
+  
+  ::message::ChatServerInfo* temp = _impl_.server_;
+  _impl_.server_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::message::ChatServerInfo* HeartbeatReq::unsafe_arena_release_server() {
+  // @@protoc_insertion_point(field_release:message.HeartbeatReq.server)
+  
+  ::message::ChatServerInfo* temp = _impl_.server_;
+  _impl_.server_ = nullptr;
+  return temp;
+}
+inline ::message::ChatServerInfo* HeartbeatReq::_internal_mutable_server() {
+  
+  if (_impl_.server_ == nullptr) {
+    auto* p = CreateMaybeMessage<::message::ChatServerInfo>(GetArenaForAllocation());
+    _impl_.server_ = p;
+  }
+  return _impl_.server_;
+}
+inline ::message::ChatServerInfo* HeartbeatReq::mutable_server() {
+  ::message::ChatServerInfo* _msg = _internal_mutable_server();
+  // @@protoc_insertion_point(field_mutable:message.HeartbeatReq.server)
+  return _msg;
+}
+inline void HeartbeatReq::set_allocated_server(::message::ChatServerInfo* server) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.server_;
+  }
+  if (server) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(server);
+    if (message_arena != submessage_arena) {
+      server = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, server, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.server_ = server;
+  // @@protoc_insertion_point(field_set_allocated:message.HeartbeatReq.server)
+}
+
+// uint64 version = 2;
+inline void HeartbeatReq::clear_version() {
+  _impl_.version_ = uint64_t{0u};
 }
-inline std::string* LoginReq::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:message.LoginReq.token)
-  return _internal_mutable_token();
+inline uint64_t HeartbeatReq::_internal_version() const {
+  return _impl_.version_;
 }
-inline const std::string& LoginReq::_internal_token() const {
-  return token_.Get();
+inline uint64_t HeartbeatReq::version() const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatReq.version)
+  return _internal_version();
 }
-inline void LoginReq::_internal_set_token(const std::string& value) {
+inline void HeartbeatReq::_internal_set_version(uint64_t value) {
   
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  _impl_.version_ = value;
 }
-inline void LoginReq::set_token(std::string&& value) {
-  
-  token_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.LoginReq.token)
+inline void HeartbeatReq::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:message.HeartbeatReq.version)
 }
-inline void LoginReq::set_token(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.LoginReq.token)
+
+// bool leave = 3;
+inline void HeartbeatReq::clear_leave() {
+  _impl_.leave_ = false;
 }
-inline void LoginReq::set_token(const char* value,
-    size_t size) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.LoginReq.token)
+inline bool HeartbeatReq::_internal_leave() const {
+  return _impl_.leave_;
 }
-inline std::string* LoginReq::_internal_mutable_token() {
-  
-  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline bool HeartbeatReq::leave() const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatReq.leave)
+  return _internal_leave();
 }
-inline std::string* LoginReq::release_token() {
-  // @@protoc_insertion_point(field_release:message.LoginReq.token)
-  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void HeartbeatReq::_internal_set_leave(bool value) {
+  
+  _impl_.leave_ = value;
 }
-inline void LoginReq::set_allocated_token(std::string* token) {
-  if (token != nullptr) {
-    
-  } else {
-    
-  }
-  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:message.LoginReq.token)
+inline void HeartbeatReq::set_leave(bool value) {
+  _internal_set_leave(value);
+  // @@protoc_insertion_point(field_set:message.HeartbeatReq.leave)
 }
 
 // -------------------------------------------------------------------
 
-// LoginRsp
+// HeartbeatRsp
 
 // int32 error = 1;
-inline void LoginRsp::clear_error() {
-  error_ = 0;
+inline void HeartbeatRsp::clear_error() {
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LoginRsp::_internal_error() const {
-  return error_;
+inline int32_t HeartbeatRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LoginRsp::error() const {
-  // @@protoc_insertion_point(field_get:message.LoginRsp.error)
+inline int32_t HeartbeatRsp::error() const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatRsp.error)
   return _internal_error();
 }
-inline void LoginRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void HeartbeatRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void LoginRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void HeartbeatRsp::set_error(int32_t value) {
   _internal_set_error(value);
-  // @@protoc_insertion_point(field_set:message.LoginRsp.error)
+  // @@protoc_insertion_point(field_set:message.HeartbeatRsp.error)
 }
 
-// int32 uid = 2;
-inline void LoginRsp::clear_uid() {
-  uid_ = 0;
+// uint64 version = 2;
+inline void HeartbeatRsp::clear_version() {
+  _impl_.version_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LoginRsp::_internal_uid() const {
-  return uid_;
+inline uint64_t HeartbeatRsp::_internal_version() const {
+  return _impl_.version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LoginRsp::uid() const {
-  // @@protoc_insertion_point(field_get:message.LoginRsp.uid)
-  return _internal_uid();
+inline uint64_t HeartbeatRsp::version() const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatRsp.version)
+  return _internal_version();
 }
-inline void LoginRsp::_internal_set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void HeartbeatRsp::_internal_set_version(uint64_t value) {
   
-  uid_ = value;
+  _impl_.version_ = value;
 }
-inline void LoginRsp::set_uid(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_uid(value);
-  // @@protoc_insertion_point(field_set:message.LoginRsp.uid)
+inline void HeartbeatRsp::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:message.HeartbeatRsp.version)
 }
 
-// string token = 3;
-inline void LoginRsp::clear_token() {
-  token_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// bool changed = 3;
+inline void HeartbeatRsp::clear_changed() {
+  _impl_.changed_ = false;
 }
-inline const std::string& LoginRsp::token() const {
-  // @@protoc_insertion_point(field_get:message.LoginRsp.token)
-  return _internal_token();
+inline bool HeartbeatRsp::_internal_changed() const {
+  return _impl_.changed_;
 }
-inline void LoginRsp::set_token(const std::string& value) {
-  _internal_set_token(value);
-  // @@protoc_insertion_point(field_set:message.LoginRsp.token)
+inline bool HeartbeatRsp::changed() const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatRsp.changed)
+  return _internal_changed();
 }
-inline std::string* LoginRsp::mutable_token() {
-  // @@protoc_insertion_point(field_mutable:message.LoginRsp.token)
-  return _internal_mutable_token();
+inline void HeartbeatRsp::_internal_set_changed(bool value) {
+  
+  _impl_.changed_ = value;
 }
-inline const std::string& LoginRsp::_internal_token() const {
-  return token_.Get();
+inline void HeartbeatRsp::set_changed(bool value) {
+  _internal_set_changed(value);
+  // @@protoc_insertion_point(field_set:message.HeartbeatRsp.changed)
 }
-inline void LoginRsp::_internal_set_token(const std::string& value) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// repeated .message.ChatServerInfo servers = 4;
+inline int HeartbeatRsp::_internal_servers_size() const {
+  return _impl_.servers_.size();
 }
-inline void LoginRsp::set_token(std::string&& value) {
-  
-  token_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.LoginRsp.token)
+inline int HeartbeatRsp::servers_size() const {
+  return _internal_servers_size();
 }
-inline void LoginRsp::set_token(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.LoginRsp.token)
+inline void HeartbeatRsp::clear_servers() {
+  _impl_.servers_.Clear();
 }
-inline void LoginRsp::set_token(const char* value,
-    size_t size) {
-  
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.LoginRsp.token)
+inline ::message::ChatServerInfo* HeartbeatRsp::mutable_servers(int index) {
+  // @@protoc_insertion_point(field_mutable:message.HeartbeatRsp.servers)
+  return _impl_.servers_.Mutable(index);
 }
-inline std::string* LoginRsp::_internal_mutable_token() {
-  
-  return token_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::ChatServerInfo >*
+HeartbeatRsp::mutable_servers() {
+  // @@protoc_insertion_point(field_mutable_list:message.HeartbeatRsp.servers)
+  return &_impl_.servers_;
 }
-inline std::string* LoginRsp::release_token() {
-  // @@protoc_insertion_point(field_release:message.LoginRsp.token)
-  return token_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::message::ChatServerInfo& HeartbeatRsp::_internal_servers(int index) const {
+  return _impl_.servers_.Get(index);
 }
-inline void LoginRsp::set_allocated_token(std::string* token) {
-  if (token != nullptr) {
-    
-  } else {
-    
-  }
-  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:message.LoginRsp.token)
+inline const ::message::ChatServerInfo& HeartbeatRsp::servers(int index) const {
+  // @@protoc_insertion_point(field_get:message.HeartbeatRsp.servers)
+  return _internal_servers(index);
+}
+inline ::message::ChatServerInfo* HeartbeatRsp::_internal_add_servers() {
+  return _impl_.servers_.Add();
+}
+inline ::message::ChatServerInfo* HeartbeatRsp::add_servers() {
+  ::message::ChatServerInfo* _add = _internal_add_servers();
+  // @@protoc_insertion_point(field_add:message.HeartbeatRsp.servers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::ChatServerInfo >&
+HeartbeatRsp::servers() const {
+  // @@protoc_insertion_point(field_list:message.HeartbeatRsp.servers)
+  return _impl_.servers_;
 }
 
 // -------------------------------------------------------------------
@@ -3596,74 +5321,58 @@ inline void LoginRsp::set_allocated_token(std::string* token) {
 
 // int32 applyuid = 1;
 inline void AddFriendReq::clear_applyuid() {
-  applyuid_ = 0;
+  _impl_.applyuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendReq::_internal_applyuid() const {
-  return applyuid_;
+inline int32_t AddFriendReq::_internal_applyuid() const {
+  return _impl_.applyuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendReq::applyuid() const {
+inline int32_t AddFriendReq::applyuid() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.applyuid)
   return _internal_applyuid();
 }
-inline void AddFriendReq::_internal_set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendReq::_internal_set_applyuid(int32_t value) {
   
-  applyuid_ = value;
+  _impl_.applyuid_ = value;
 }
-inline void AddFriendReq::set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendReq::set_applyuid(int32_t value) {
   _internal_set_applyuid(value);
   // @@protoc_insertion_point(field_set:message.AddFriendReq.applyuid)
 }
 
 // string name = 2;
 inline void AddFriendReq::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& AddFriendReq::name() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.name)
   return _internal_name();
 }
-inline void AddFriendReq::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddFriendReq::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.AddFriendReq.name)
 }
 inline std::string* AddFriendReq::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:message.AddFriendReq.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& AddFriendReq::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void AddFriendReq::_internal_set_name(const std::string& value) {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void AddFriendReq::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.AddFriendReq.name)
-}
-inline void AddFriendReq::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.AddFriendReq.name)
-}
-inline void AddFriendReq::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.AddFriendReq.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::_internal_mutable_name() {
   
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::release_name() {
   // @@protoc_insertion_point(field_release:message.AddFriendReq.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void AddFriendReq::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -3671,61 +5380,49 @@ inline void AddFriendReq::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.AddFriendReq.name)
 }
 
 // string desc = 3;
 inline void AddFriendReq::clear_desc() {
-  desc_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.desc_.ClearToEmpty();
 }
 inline const std::string& AddFriendReq::desc() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.desc)
   return _internal_desc();
 }
-inline void AddFriendReq::set_desc(const std::string& value) {
-  _internal_set_desc(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddFriendReq::set_desc(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.desc_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.AddFriendReq.desc)
 }
 inline std::string* AddFriendReq::mutable_desc() {
+  std::string* _s = _internal_mutable_desc();
   // @@protoc_insertion_point(field_mutable:message.AddFriendReq.desc)
-  return _internal_mutable_desc();
+  return _s;
 }
 inline const std::string& AddFriendReq::_internal_desc() const {
-  return desc_.Get();
+  return _impl_.desc_.Get();
 }
 inline void AddFriendReq::_internal_set_desc(const std::string& value) {
   
-  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void AddFriendReq::set_desc(std::string&& value) {
-  
-  desc_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.AddFriendReq.desc)
-}
-inline void AddFriendReq::set_desc(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.AddFriendReq.desc)
-}
-inline void AddFriendReq::set_desc(const char* value,
-    size_t size) {
-  
-  desc_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.AddFriendReq.desc)
+  _impl_.desc_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::_internal_mutable_desc() {
   
-  return desc_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.desc_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::release_desc() {
   // @@protoc_insertion_point(field_release:message.AddFriendReq.desc)
-  return desc_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.desc_.Release();
 }
 inline void AddFriendReq::set_allocated_desc(std::string* desc) {
   if (desc != nullptr) {
@@ -3733,61 +5430,49 @@ inline void AddFriendReq::set_allocated_desc(std::string* desc) {
   } else {
     
   }
-  desc_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), desc,
-      GetArena());
+  _impl_.desc_.SetAllocated(desc, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.desc_.IsDefault()) {
+    _impl_.desc_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.AddFriendReq.desc)
 }
 
 // string icon = 4;
 inline void AddFriendReq::clear_icon() {
-  icon_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.icon_.ClearToEmpty();
 }
 inline const std::string& AddFriendReq::icon() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.icon)
   return _internal_icon();
 }
-inline void AddFriendReq::set_icon(const std::string& value) {
-  _internal_set_icon(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddFriendReq::set_icon(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.icon_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.AddFriendReq.icon)
 }
 inline std::string* AddFriendReq::mutable_icon() {
+  std::string* _s = _internal_mutable_icon();
   // @@protoc_insertion_point(field_mutable:message.AddFriendReq.icon)
-  return _internal_mutable_icon();
+  return _s;
 }
 inline const std::string& AddFriendReq::_internal_icon() const {
-  return icon_.Get();
+  return _impl_.icon_.Get();
 }
 inline void AddFriendReq::_internal_set_icon(const std::string& value) {
   
-  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void AddFriendReq::set_icon(std::string&& value) {
-  
-  icon_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.AddFriendReq.icon)
-}
-inline void AddFriendReq::set_icon(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.AddFriendReq.icon)
-}
-inline void AddFriendReq::set_icon(const char* value,
-    size_t size) {
-  
-  icon_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.AddFriendReq.icon)
+  _impl_.icon_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::_internal_mutable_icon() {
   
-  return icon_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.icon_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::release_icon() {
   // @@protoc_insertion_point(field_release:message.AddFriendReq.icon)
-  return icon_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.icon_.Release();
 }
 inline void AddFriendReq::set_allocated_icon(std::string* icon) {
   if (icon != nullptr) {
@@ -3795,61 +5480,49 @@ inline void AddFriendReq::set_allocated_icon(std::string* icon) {
   } else {
     
   }
-  icon_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), icon,
-      GetArena());
+  _impl_.icon_.SetAllocated(icon, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.icon_.IsDefault()) {
+    _impl_.icon_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.AddFriendReq.icon)
 }
 
 // string nick = 5;
 inline void AddFriendReq::clear_nick() {
-  nick_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.nick_.ClearToEmpty();
 }
 inline const std::string& AddFriendReq::nick() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.nick)
   return _internal_nick();
 }
-inline void AddFriendReq::set_nick(const std::string& value) {
-  _internal_set_nick(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddFriendReq::set_nick(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.nick_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.AddFriendReq.nick)
 }
 inline std::string* AddFriendReq::mutable_nick() {
+  std::string* _s = _internal_mutable_nick();
   // @@protoc_insertion_point(field_mutable:message.AddFriendReq.nick)
-  return _internal_mutable_nick();
+  return _s;
 }
 inline const std::string& AddFriendReq::_internal_nick() const {
-  return nick_.Get();
+  return _impl_.nick_.Get();
 }
 inline void AddFriendReq::_internal_set_nick(const std::string& value) {
   
-  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void AddFriendReq::set_nick(std::string&& value) {
-  
-  nick_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.AddFriendReq.nick)
-}
-inline void AddFriendReq::set_nick(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.AddFriendReq.nick)
-}
-inline void AddFriendReq::set_nick(const char* value,
-    size_t size) {
-  
-  nick_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.AddFriendReq.nick)
+  _impl_.nick_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::_internal_mutable_nick() {
   
-  return nick_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.nick_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AddFriendReq::release_nick() {
   // @@protoc_insertion_point(field_release:message.AddFriendReq.nick)
-  return nick_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.nick_.Release();
 }
 inline void AddFriendReq::set_allocated_nick(std::string* nick) {
   if (nick != nullptr) {
@@ -3857,47 +5530,51 @@ inline void AddFriendReq::set_allocated_nick(std::string* nick) {
   } else {
     
   }
-  nick_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nick,
-      GetArena());
+  _impl_.nick_.SetAllocated(nick, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nick_.IsDefault()) {
+    _impl_.nick_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.AddFriendReq.nick)
 }
 
 // int32 sex = 6;
 inline void AddFriendReq::clear_sex() {
-  sex_ = 0;
+  _impl_.sex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendReq::_internal_sex() const {
-  return sex_;
+inline int32_t AddFriendReq::_internal_sex() const {
+  return _impl_.sex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendReq::sex() const {
+inline int32_t AddFriendReq::sex() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.sex)
   return _internal_sex();
 }
-inline void AddFriendReq::_internal_set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendReq::_internal_set_sex(int32_t value) {
   
-  sex_ = value;
+  _impl_.sex_ = value;
 }
-inline void AddFriendReq::set_sex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendReq::set_sex(int32_t value) {
   _internal_set_sex(value);
   // @@protoc_insertion_point(field_set:message.AddFriendReq.sex)
 }
 
 // int32 touid = 7;
 inline void AddFriendReq::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendReq::_internal_touid() const {
-  return touid_;
+inline int32_t AddFriendReq::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendReq::touid() const {
+inline int32_t AddFriendReq::touid() const {
   // @@protoc_insertion_point(field_get:message.AddFriendReq.touid)
   return _internal_touid();
 }
-inline void AddFriendReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendReq::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void AddFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendReq::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.AddFriendReq.touid)
 }
@@ -3908,60 +5585,60 @@ inline void AddFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 error = 1;
 inline void AddFriendRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendRsp::_internal_error() const {
-  return error_;
+inline int32_t AddFriendRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendRsp::error() const {
+inline int32_t AddFriendRsp::error() const {
   // @@protoc_insertion_point(field_get:message.AddFriendRsp.error)
   return _internal_error();
 }
-inline void AddFriendRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void AddFriendRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.AddFriendRsp.error)
 }
 
 // int32 applyuid = 2;
 inline void AddFriendRsp::clear_applyuid() {
-  applyuid_ = 0;
+  _impl_.applyuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendRsp::_internal_applyuid() const {
-  return applyuid_;
+inline int32_t AddFriendRsp::_internal_applyuid() const {
+  return _impl_.applyuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendRsp::applyuid() const {
+inline int32_t AddFriendRsp::applyuid() const {
   // @@protoc_insertion_point(field_get:message.AddFriendRsp.applyuid)
   return _internal_applyuid();
 }
-inline void AddFriendRsp::_internal_set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendRsp::_internal_set_applyuid(int32_t value) {
   
-  applyuid_ = value;
+  _impl_.applyuid_ = value;
 }
-inline void AddFriendRsp::set_applyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendRsp::set_applyuid(int32_t value) {
   _internal_set_applyuid(value);
   // @@protoc_insertion_point(field_set:message.AddFriendRsp.applyuid)
 }
 
 // int32 touid = 3;
 inline void AddFriendRsp::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendRsp::_internal_touid() const {
-  return touid_;
+inline int32_t AddFriendRsp::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AddFriendRsp::touid() const {
+inline int32_t AddFriendRsp::touid() const {
   // @@protoc_insertion_point(field_get:message.AddFriendRsp.touid)
   return _internal_touid();
 }
-inline void AddFriendRsp::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendRsp::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void AddFriendRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AddFriendRsp::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.AddFriendRsp.touid)
 }
@@ -3972,30 +5649,30 @@ inline void AddFriendRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 rplyuid = 1;
 inline void RplyFriendReq::clear_rplyuid() {
-  rplyuid_ = 0;
+  _impl_.rplyuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendReq::_internal_rplyuid() const {
-  return rplyuid_;
+inline int32_t RplyFriendReq::_internal_rplyuid() const {
+  return _impl_.rplyuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendReq::rplyuid() const {
+inline int32_t RplyFriendReq::rplyuid() const {
   // @@protoc_insertion_point(field_get:message.RplyFriendReq.rplyuid)
   return _internal_rplyuid();
 }
-inline void RplyFriendReq::_internal_set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendReq::_internal_set_rplyuid(int32_t value) {
   
-  rplyuid_ = value;
+  _impl_.rplyuid_ = value;
 }
-inline void RplyFriendReq::set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendReq::set_rplyuid(int32_t value) {
   _internal_set_rplyuid(value);
   // @@protoc_insertion_point(field_set:message.RplyFriendReq.rplyuid)
 }
 
 // bool agree = 2;
 inline void RplyFriendReq::clear_agree() {
-  agree_ = false;
+  _impl_.agree_ = false;
 }
 inline bool RplyFriendReq::_internal_agree() const {
-  return agree_;
+  return _impl_.agree_;
 }
 inline bool RplyFriendReq::agree() const {
   // @@protoc_insertion_point(field_get:message.RplyFriendReq.agree)
@@ -4003,7 +5680,7 @@ inline bool RplyFriendReq::agree() const {
 }
 inline void RplyFriendReq::_internal_set_agree(bool value) {
   
-  agree_ = value;
+  _impl_.agree_ = value;
 }
 inline void RplyFriendReq::set_agree(bool value) {
   _internal_set_agree(value);
@@ -4012,20 +5689,20 @@ inline void RplyFriendReq::set_agree(bool value) {
 
 // int32 touid = 3;
 inline void RplyFriendReq::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendReq::_internal_touid() const {
-  return touid_;
+inline int32_t RplyFriendReq::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendReq::touid() const {
+inline int32_t RplyFriendReq::touid() const {
   // @@protoc_insertion_point(field_get:message.RplyFriendReq.touid)
   return _internal_touid();
 }
-inline void RplyFriendReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendReq::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void RplyFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendReq::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.RplyFriendReq.touid)
 }
@@ -4036,60 +5713,60 @@ inline void RplyFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 error = 1;
 inline void RplyFriendRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendRsp::_internal_error() const {
-  return error_;
+inline int32_t RplyFriendRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendRsp::error() const {
+inline int32_t RplyFriendRsp::error() const {
   // @@protoc_insertion_point(field_get:message.RplyFriendRsp.error)
   return _internal_error();
 }
-inline void RplyFriendRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void RplyFriendRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.RplyFriendRsp.error)
 }
 
 // int32 rplyuid = 2;
 inline void RplyFriendRsp::clear_rplyuid() {
-  rplyuid_ = 0;
+  _impl_.rplyuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendRsp::_internal_rplyuid() const {
-  return rplyuid_;
+inline int32_t RplyFriendRsp::_internal_rplyuid() const {
+  return _impl_.rplyuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendRsp::rplyuid() const {
+inline int32_t RplyFriendRsp::rplyuid() const {
   // @@protoc_insertion_point(field_get:message.RplyFriendRsp.rplyuid)
   return _internal_rplyuid();
 }
-inline void RplyFriendRsp::_internal_set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendRsp::_internal_set_rplyuid(int32_t value) {
   
-  rplyuid_ = value;
+  _impl_.rplyuid_ = value;
 }
-inline void RplyFriendRsp::set_rplyuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendRsp::set_rplyuid(int32_t value) {
   _internal_set_rplyuid(value);
   // @@protoc_insertion_point(field_set:message.RplyFriendRsp.rplyuid)
 }
 
 // int32 touid = 3;
 inline void RplyFriendRsp::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendRsp::_internal_touid() const {
-  return touid_;
+inline int32_t RplyFriendRsp::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RplyFriendRsp::touid() const {
+inline int32_t RplyFriendRsp::touid() const {
   // @@protoc_insertion_point(field_get:message.RplyFriendRsp.touid)
   return _internal_touid();
 }
-inline void RplyFriendRsp::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendRsp::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void RplyFriendRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RplyFriendRsp::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.RplyFriendRsp.touid)
 }
@@ -4100,94 +5777,78 @@ inline void RplyFriendRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 fromuid = 1;
 inline void SendChatMsgReq::clear_fromuid() {
-  fromuid_ = 0;
+  _impl_.fromuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgReq::_internal_fromuid() const {
-  return fromuid_;
+inline int32_t SendChatMsgReq::_internal_fromuid() const {
+  return _impl_.fromuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgReq::fromuid() const {
+inline int32_t SendChatMsgReq::fromuid() const {
   // @@protoc_insertion_point(field_get:message.SendChatMsgReq.fromuid)
   return _internal_fromuid();
 }
-inline void SendChatMsgReq::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgReq::_internal_set_fromuid(int32_t value) {
   
-  fromuid_ = value;
+  _impl_.fromuid_ = value;
 }
-inline void SendChatMsgReq::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgReq::set_fromuid(int32_t value) {
   _internal_set_fromuid(value);
   // @@protoc_insertion_point(field_set:message.SendChatMsgReq.fromuid)
 }
 
 // int32 touid = 2;
 inline void SendChatMsgReq::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgReq::_internal_touid() const {
-  return touid_;
+inline int32_t SendChatMsgReq::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgReq::touid() const {
+inline int32_t SendChatMsgReq::touid() const {
   // @@protoc_insertion_point(field_get:message.SendChatMsgReq.touid)
   return _internal_touid();
 }
-inline void SendChatMsgReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgReq::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void SendChatMsgReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgReq::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.SendChatMsgReq.touid)
 }
 
 // string message = 3;
 inline void SendChatMsgReq::clear_message() {
-  message_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.message_.ClearToEmpty();
 }
 inline const std::string& SendChatMsgReq::message() const {
   // @@protoc_insertion_point(field_get:message.SendChatMsgReq.message)
   return _internal_message();
 }
-inline void SendChatMsgReq::set_message(const std::string& value) {
-  _internal_set_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendChatMsgReq::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.SendChatMsgReq.message)
 }
 inline std::string* SendChatMsgReq::mutable_message() {
+  std::string* _s = _internal_mutable_message();
   // @@protoc_insertion_point(field_mutable:message.SendChatMsgReq.message)
-  return _internal_mutable_message();
+  return _s;
 }
 inline const std::string& SendChatMsgReq::_internal_message() const {
-  return message_.Get();
+  return _impl_.message_.Get();
 }
 inline void SendChatMsgReq::_internal_set_message(const std::string& value) {
   
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void SendChatMsgReq::set_message(std::string&& value) {
-  
-  message_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.SendChatMsgReq.message)
-}
-inline void SendChatMsgReq::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.SendChatMsgReq.message)
-}
-inline void SendChatMsgReq::set_message(const char* value,
-    size_t size) {
-  
-  message_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.SendChatMsgReq.message)
+  _impl_.message_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SendChatMsgReq::_internal_mutable_message() {
   
-  return message_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.message_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SendChatMsgReq::release_message() {
   // @@protoc_insertion_point(field_release:message.SendChatMsgReq.message)
-  return message_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.message_.Release();
 }
 inline void SendChatMsgReq::set_allocated_message(std::string* message) {
   if (message != nullptr) {
@@ -4195,8 +5856,12 @@ inline void SendChatMsgReq::set_allocated_message(std::string* message) {
   } else {
     
   }
-  message_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message,
-      GetArena());
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.SendChatMsgReq.message)
 }
 
@@ -4206,60 +5871,60 @@ inline void SendChatMsgReq::set_allocated_message(std::string* message) {
 
 // int32 error = 1;
 inline void SendChatMsgRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgRsp::_internal_error() const {
-  return error_;
+inline int32_t SendChatMsgRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgRsp::error() const {
+inline int32_t SendChatMsgRsp::error() const {
   // @@protoc_insertion_point(field_get:message.SendChatMsgRsp.error)
   return _internal_error();
 }
-inline void SendChatMsgRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void SendChatMsgRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.SendChatMsgRsp.error)
 }
 
 // int32 fromuid = 2;
 inline void SendChatMsgRsp::clear_fromuid() {
-  fromuid_ = 0;
+  _impl_.fromuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgRsp::_internal_fromuid() const {
-  return fromuid_;
+inline int32_t SendChatMsgRsp::_internal_fromuid() const {
+  return _impl_.fromuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgRsp::fromuid() const {
+inline int32_t SendChatMsgRsp::fromuid() const {
   // @@protoc_insertion_point(field_get:message.SendChatMsgRsp.fromuid)
   return _internal_fromuid();
 }
-inline void SendChatMsgRsp::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgRsp::_internal_set_fromuid(int32_t value) {
   
-  fromuid_ = value;
+  _impl_.fromuid_ = value;
 }
-inline void SendChatMsgRsp::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgRsp::set_fromuid(int32_t value) {
   _internal_set_fromuid(value);
   // @@protoc_insertion_point(field_set:message.SendChatMsgRsp.fromuid)
 }
 
 // int32 touid = 3;
 inline void SendChatMsgRsp::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgRsp::_internal_touid() const {
-  return touid_;
+inline int32_t SendChatMsgRsp::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 SendChatMsgRsp::touid() const {
+inline int32_t SendChatMsgRsp::touid() const {
   // @@protoc_insertion_point(field_get:message.SendChatMsgRsp.touid)
   return _internal_touid();
 }
-inline void SendChatMsgRsp::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgRsp::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void SendChatMsgRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void SendChatMsgRsp::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.SendChatMsgRsp.touid)
 }
@@ -4270,40 +5935,40 @@ inline void SendChatMsgRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 fromuid = 1;
 inline void AuthFriendReq::clear_fromuid() {
-  fromuid_ = 0;
+  _impl_.fromuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendReq::_internal_fromuid() const {
-  return fromuid_;
+inline int32_t AuthFriendReq::_internal_fromuid() const {
+  return _impl_.fromuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendReq::fromuid() const {
+inline int32_t AuthFriendReq::fromuid() const {
   // @@protoc_insertion_point(field_get:message.AuthFriendReq.fromuid)
   return _internal_fromuid();
 }
-inline void AuthFriendReq::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendReq::_internal_set_fromuid(int32_t value) {
   
-  fromuid_ = value;
+  _impl_.fromuid_ = value;
 }
-inline void AuthFriendReq::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendReq::set_fromuid(int32_t value) {
   _internal_set_fromuid(value);
   // @@protoc_insertion_point(field_set:message.AuthFriendReq.fromuid)
 }
 
 // int32 touid = 2;
 inline void AuthFriendReq::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendReq::_internal_touid() const {
-  return touid_;
+inline int32_t AuthFriendReq::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendReq::touid() const {
+inline int32_t AuthFriendReq::touid() const {
   // @@protoc_insertion_point(field_get:message.AuthFriendReq.touid)
   return _internal_touid();
 }
-inline void AuthFriendReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendReq::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void AuthFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendReq::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.AuthFriendReq.touid)
 }
@@ -4314,60 +5979,60 @@ inline void AuthFriendReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 error = 1;
 inline void AuthFriendRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendRsp::_internal_error() const {
-  return error_;
+inline int32_t AuthFriendRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendRsp::error() const {
+inline int32_t AuthFriendRsp::error() const {
   // @@protoc_insertion_point(field_get:message.AuthFriendRsp.error)
   return _internal_error();
 }
-inline void AuthFriendRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void AuthFriendRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.AuthFriendRsp.error)
 }
 
 // int32 fromuid = 2;
 inline void AuthFriendRsp::clear_fromuid() {
-  fromuid_ = 0;
+  _impl_.fromuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendRsp::_internal_fromuid() const {
-  return fromuid_;
+inline int32_t AuthFriendRsp::_internal_fromuid() const {
+  return _impl_.fromuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendRsp::fromuid() const {
+inline int32_t AuthFriendRsp::fromuid() const {
   // @@protoc_insertion_point(field_get:message.AuthFriendRsp.fromuid)
   return _internal_fromuid();
 }
-inline void AuthFriendRsp::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendRsp::_internal_set_fromuid(int32_t value) {
   
-  fromuid_ = value;
+  _impl_.fromuid_ = value;
 }
-inline void AuthFriendRsp::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendRsp::set_fromuid(int32_t value) {
   _internal_set_fromuid(value);
   // @@protoc_insertion_point(field_set:message.AuthFriendRsp.fromuid)
 }
 
 // int32 touid = 3;
 inline void AuthFriendRsp::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendRsp::_internal_touid() const {
-  return touid_;
+inline int32_t AuthFriendRsp::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AuthFriendRsp::touid() const {
+inline int32_t AuthFriendRsp::touid() const {
   // @@protoc_insertion_point(field_get:message.AuthFriendRsp.touid)
   return _internal_touid();
 }
-inline void AuthFriendRsp::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendRsp::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void AuthFriendRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AuthFriendRsp::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.AuthFriendRsp.touid)
 }
@@ -4378,81 +6043,82 @@ inline void AuthFriendRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
 
 // int32 fromuid = 1;
 inline void TextChatMsgReq::clear_fromuid() {
-  fromuid_ = 0;
+  _impl_.fromuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgReq::_internal_fromuid() const {
-  return fromuid_;
+inline int32_t TextChatMsgReq::_internal_fromuid() const {
+  return _impl_.fromuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgReq::fromuid() const {
+inline int32_t TextChatMsgReq::fromuid() const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgReq.fromuid)
   return _internal_fromuid();
 }
-inline void TextChatMsgReq::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgReq::_internal_set_fromuid(int32_t value) {
   
-  fromuid_ = value;
+  _impl_.fromuid_ = value;
 }
-inline void TextChatMsgReq::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgReq::set_fromuid(int32_t value) {
   _internal_set_fromuid(value);
   // @@protoc_insertion_point(field_set:message.TextChatMsgReq.fromuid)
 }
 
 // int32 touid = 2;
 inline void TextChatMsgReq::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgReq::_internal_touid() const {
-  return touid_;
+inline int32_t TextChatMsgReq::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgReq::touid() const {
+inline int32_t TextChatMsgReq::touid() const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgReq.touid)
   return _internal_touid();
 }
-inline void TextChatMsgReq::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgReq::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void TextChatMsgReq::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgReq::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.TextChatMsgReq.touid)
 }
 
 // repeated .message.TextChatData textmsgs = 3;
 inline int TextChatMsgReq::_internal_textmsgs_size() const {
-  return textmsgs_.size();
+  return _impl_.textmsgs_.size();
 }
 inline int TextChatMsgReq::textmsgs_size() const {
   return _internal_textmsgs_size();
 }
 inline void TextChatMsgReq::clear_textmsgs() {
-  textmsgs_.Clear();
+  _impl_.textmsgs_.Clear();
 }
 inline ::message::TextChatData* TextChatMsgReq::mutable_textmsgs(int index) {
   // @@protoc_insertion_point(field_mutable:message.TextChatMsgReq.textmsgs)
-  return textmsgs_.Mutable(index);
+  return _impl_.textmsgs_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >*
 TextChatMsgReq::mutable_textmsgs() {
   // @@protoc_insertion_point(field_mutable_list:message.TextChatMsgReq.textmsgs)
-  return &textmsgs_;
+  return &_impl_.textmsgs_;
 }
 inline const ::message::TextChatData& TextChatMsgReq::_internal_textmsgs(int index) const {
-  return textmsgs_.Get(index);
+  return _impl_.textmsgs_.Get(index);
 }
 inline const ::message::TextChatData& TextChatMsgReq::textmsgs(int index) const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgReq.textmsgs)
   return _internal_textmsgs(index);
 }
 inline ::message::TextChatData* TextChatMsgReq::_internal_add_textmsgs() {
-  return textmsgs_.Add();
+  return _impl_.textmsgs_.Add();
 }
 inline ::message::TextChatData* TextChatMsgReq::add_textmsgs() {
+  ::message::TextChatData* _add = _internal_add_textmsgs();
   // @@protoc_insertion_point(field_add:message.TextChatMsgReq.textmsgs)
-  return _internal_add_textmsgs();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
 TextChatMsgReq::textmsgs() const {
   // @@protoc_insertion_point(field_list:message.TextChatMsgReq.textmsgs)
-  return textmsgs_;
+  return _impl_.textmsgs_;
 }
 
 // -------------------------------------------------------------------
@@ -4461,54 +6127,38 @@ TextChatMsgReq::textmsgs() const {
 
 // string msgid = 1;
 inline void TextChatData::clear_msgid() {
-  msgid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.msgid_.ClearToEmpty();
 }
 inline const std::string& TextChatData::msgid() const {
   // @@protoc_insertion_point(field_get:message.TextChatData.msgid)
   return _internal_msgid();
 }
-inline void TextChatData::set_msgid(const std::string& value) {
-  _internal_set_msgid(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TextChatData::set_msgid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msgid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.TextChatData.msgid)
 }
 inline std::string* TextChatData::mutable_msgid() {
+  std::string* _s = _internal_mutable_msgid();
   // @@protoc_insertion_point(field_mutable:message.TextChatData.msgid)
-  return _internal_mutable_msgid();
+  return _s;
 }
 inline const std::string& TextChatData::_internal_msgid() const {
-  return msgid_.Get();
+  return _impl_.msgid_.Get();
 }
 inline void TextChatData::_internal_set_msgid(const std::string& value) {
   
-  msgid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void TextChatData::set_msgid(std::string&& value) {
-  
-  msgid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.TextChatData.msgid)
-}
-inline void TextChatData::set_msgid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  msgid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.TextChatData.msgid)
-}
-inline void TextChatData::set_msgid(const char* value,
-    size_t size) {
-  
-  msgid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.TextChatData.msgid)
+  _impl_.msgid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TextChatData::_internal_mutable_msgid() {
   
-  return msgid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.msgid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TextChatData::release_msgid() {
   // @@protoc_insertion_point(field_release:message.TextChatData.msgid)
-  return msgid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.msgid_.Release();
 }
 inline void TextChatData::set_allocated_msgid(std::string* msgid) {
   if (msgid != nullptr) {
@@ -4516,61 +6166,49 @@ inline void TextChatData::set_allocated_msgid(std::string* msgid) {
   } else {
     
   }
-  msgid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), msgid,
-      GetArena());
+  _impl_.msgid_.SetAllocated(msgid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msgid_.IsDefault()) {
+    _impl_.msgid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.TextChatData.msgid)
 }
 
 // string msgcontent = 2;
 inline void TextChatData::clear_msgcontent() {
-  msgcontent_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.msgcontent_.ClearToEmpty();
 }
 inline const std::string& TextChatData::msgcontent() const {
   // @@protoc_insertion_point(field_get:message.TextChatData.msgcontent)
   return _internal_msgcontent();
 }
-inline void TextChatData::set_msgcontent(const std::string& value) {
-  _internal_set_msgcontent(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TextChatData::set_msgcontent(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.msgcontent_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:message.TextChatData.msgcontent)
 }
 inline std::string* TextChatData::mutable_msgcontent() {
+  std::string* _s = _internal_mutable_msgcontent();
   // @@protoc_insertion_point(field_mutable:message.TextChatData.msgcontent)
-  return _internal_mutable_msgcontent();
+  return _s;
 }
 inline const std::string& TextChatData::_internal_msgcontent() const {
-  return msgcontent_.Get();
+  return _impl_.msgcontent_.Get();
 }
 inline void TextChatData::_internal_set_msgcontent(const std::string& value) {
   
-  msgcontent_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void TextChatData::set_msgcontent(std::string&& value) {
-  
-  msgcontent_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:message.TextChatData.msgcontent)
-}
-inline void TextChatData::set_msgcontent(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  msgcontent_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:message.TextChatData.msgcontent)
-}
-inline void TextChatData::set_msgcontent(const char* value,
-    size_t size) {
-  
-  msgcontent_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:message.TextChatData.msgcontent)
+  _impl_.msgcontent_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TextChatData::_internal_mutable_msgcontent() {
   
-  return msgcontent_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.msgcontent_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TextChatData::release_msgcontent() {
   // @@protoc_insertion_point(field_release:message.TextChatData.msgcontent)
-  return msgcontent_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.msgcontent_.Release();
 }
 inline void TextChatData::set_allocated_msgcontent(std::string* msgcontent) {
   if (msgcontent != nullptr) {
@@ -4578,8 +6216,12 @@ inline void TextChatData::set_allocated_msgcontent(std::string* msgcontent) {
   } else {
     
   }
-  msgcontent_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), msgcontent,
-      GetArena());
+  _impl_.msgcontent_.SetAllocated(msgcontent, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.msgcontent_.IsDefault()) {
+    _impl_.msgcontent_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:message.TextChatData.msgcontent)
 }
 
@@ -4589,101 +6231,515 @@ inline void TextChatData::set_allocated_msgcontent(std::string* msgcontent) {
 
 // int32 error = 1;
 inline void TextChatMsgRsp::clear_error() {
-  error_ = 0;
+  _impl_.error_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgRsp::_internal_error() const {
-  return error_;
+inline int32_t TextChatMsgRsp::_internal_error() const {
+  return _impl_.error_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgRsp::error() const {
+inline int32_t TextChatMsgRsp::error() const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.error)
   return _internal_error();
 }
-inline void TextChatMsgRsp::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgRsp::_internal_set_error(int32_t value) {
   
-  error_ = value;
+  _impl_.error_ = value;
 }
-inline void TextChatMsgRsp::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgRsp::set_error(int32_t value) {
   _internal_set_error(value);
   // @@protoc_insertion_point(field_set:message.TextChatMsgRsp.error)
 }
 
 // int32 fromuid = 2;
 inline void TextChatMsgRsp::clear_fromuid() {
-  fromuid_ = 0;
+  _impl_.fromuid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgRsp::_internal_fromuid() const {
-  return fromuid_;
+inline int32_t TextChatMsgRsp::_internal_fromuid() const {
+  return _impl_.fromuid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgRsp::fromuid() const {
+inline int32_t TextChatMsgRsp::fromuid() const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.fromuid)
   return _internal_fromuid();
 }
-inline void TextChatMsgRsp::_internal_set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgRsp::_internal_set_fromuid(int32_t value) {
   
-  fromuid_ = value;
+  _impl_.fromuid_ = value;
 }
-inline void TextChatMsgRsp::set_fromuid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgRsp::set_fromuid(int32_t value) {
   _internal_set_fromuid(value);
   // @@protoc_insertion_point(field_set:message.TextChatMsgRsp.fromuid)
 }
 
 // int32 touid = 3;
 inline void TextChatMsgRsp::clear_touid() {
-  touid_ = 0;
+  _impl_.touid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgRsp::_internal_touid() const {
-  return touid_;
+inline int32_t TextChatMsgRsp::_internal_touid() const {
+  return _impl_.touid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TextChatMsgRsp::touid() const {
+inline int32_t TextChatMsgRsp::touid() const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.touid)
   return _internal_touid();
 }
-inline void TextChatMsgRsp::_internal_set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgRsp::_internal_set_touid(int32_t value) {
   
-  touid_ = value;
+  _impl_.touid_ = value;
 }
-inline void TextChatMsgRsp::set_touid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TextChatMsgRsp::set_touid(int32_t value) {
   _internal_set_touid(value);
   // @@protoc_insertion_point(field_set:message.TextChatMsgRsp.touid)
 }
 
 // repeated .message.TextChatData textmsgs = 4;
 inline int TextChatMsgRsp::_internal_textmsgs_size() const {
-  return textmsgs_.size();
+  return _impl_.textmsgs_.size();
 }
 inline int TextChatMsgRsp::textmsgs_size() const {
   return _internal_textmsgs_size();
 }
 inline void TextChatMsgRsp::clear_textmsgs() {
-  textmsgs_.Clear();
+  _impl_.textmsgs_.Clear();
 }
 inline ::message::TextChatData* TextChatMsgRsp::mutable_textmsgs(int index) {
   // @@protoc_insertion_point(field_mutable:message.TextChatMsgRsp.textmsgs)
-  return textmsgs_.Mutable(index);
+  return _impl_.textmsgs_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >*
 TextChatMsgRsp::mutable_textmsgs() {
   // @@protoc_insertion_point(field_mutable_list:message.TextChatMsgRsp.textmsgs)
-  return &textmsgs_;
+  return &_impl_.textmsgs_;
 }
 inline const ::message::TextChatData& TextChatMsgRsp::_internal_textmsgs(int index) const {
-  return textmsgs_.Get(index);
+  return _impl_.textmsgs_.Get(index);
 }
 inline const ::message::TextChatData& TextChatMsgRsp::textmsgs(int index) const {
   // @@protoc_insertion_point(field_get:message.TextChatMsgRsp.textmsgs)
   return _internal_textmsgs(index);
 }
 inline ::message::TextChatData* TextChatMsgRsp::_internal_add_textmsgs() {
-  return textmsgs_.Add();
+  return _impl_.textmsgs_.Add();
 }
 inline ::message::TextChatData* TextChatMsgRsp::add_textmsgs() {
+  ::message::TextChatData* _add = _internal_add_textmsgs();
   // @@protoc_insertion_point(field_add:message.TextChatMsgRsp.textmsgs)
-  return _internal_add_textmsgs();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::TextChatData >&
 TextChatMsgRsp::textmsgs() const {
   // @@protoc_insertion_point(field_list:message.TextChatMsgRsp.textmsgs)
-  return textmsgs_;
+  return _impl_.textmsgs_;
+}
+
+// -------------------------------------------------------------------
+
+// PeerEvent
+
+// uint64 seq = 1;
+inline void PeerEvent::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t PeerEvent::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t PeerEvent::seq() const {
+  // @@protoc_insertion_point(field_get:message.PeerEvent.seq)
+  return _internal_seq();
+}
+inline void PeerEvent::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void PeerEvent::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:message.PeerEvent.seq)
+}
+
+// uint64 trace_id = 2;
+inline void PeerEvent::clear_trace_id() {
+  _impl_.trace_id_ = uint64_t{0u};
+}
+inline uint64_t PeerEvent::_internal_trace_id() const {
+  return _impl_.trace_id_;
+}
+inline uint64_t PeerEvent::trace_id() const {
+  // @@protoc_insertion_point(field_get:message.PeerEvent.trace_id)
+  return _internal_trace_id();
+}
+inline void PeerEvent::_internal_set_trace_id(uint64_t value) {
+  
+  _impl_.trace_id_ = value;
+}
+inline void PeerEvent::set_trace_id(uint64_t value) {
+  _internal_set_trace_id(value);
+  // @@protoc_insertion_point(field_set:message.PeerEvent.trace_id)
+}
+
+// .message.AddFriendReq add_friend = 3;
+inline bool PeerEvent::_internal_has_add_friend() const {
+  return body_case() == kAddFriend;
+}
+inline bool PeerEvent::has_add_friend() const {
+  return _internal_has_add_friend();
+}
+inline void PeerEvent::set_has_add_friend() {
+  _impl_._oneof_case_[0] = kAddFriend;
+}
+inline void PeerEvent::clear_add_friend() {
+  if (_internal_has_add_friend()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.body_.add_friend_;
+    }
+    clear_has_body();
+  }
+}
+inline ::message::AddFriendReq* PeerEvent::release_add_friend() {
+  // @@protoc_insertion_point(field_release:message.PeerEvent.add_friend)
+  if (_internal_has_add_friend()) {
+    clear_has_body();
+    ::message::AddFriendReq* temp = _impl_.body_.add_friend_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.body_.add_friend_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::message::AddFriendReq& PeerEvent::_internal_add_friend() const {
+  return _internal_has_add_friend()
+      ? *_impl_.body_.add_friend_
+      : reinterpret_cast< ::message::AddFriendReq&>(::message::_AddFriendReq_default_instance_);
+}
+inline const ::message::AddFriendReq& PeerEvent::add_friend() const {
+  // @@protoc_insertion_point(field_get:message.PeerEvent.add_friend)
+  return _internal_add_friend();
+}
+inline ::message::AddFriendReq* PeerEvent::unsafe_arena_release_add_friend() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:message.PeerEvent.add_friend)
+  if (_internal_has_add_friend()) {
+    clear_has_body();
+    ::message::AddFriendReq* temp = _impl_.body_.add_friend_;
+    _impl_.body_.add_friend_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PeerEvent::unsafe_arena_set_allocated_add_friend(::message::AddFriendReq* add_friend) {
+  clear_body();
+  if (add_friend) {
+    set_has_add_friend();
+    _impl_.body_.add_friend_ = add_friend;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.PeerEvent.add_friend)
+}
+inline ::message::AddFriendReq* PeerEvent::_internal_mutable_add_friend() {
+  if (!_internal_has_add_friend()) {
+    clear_body();
+    set_has_add_friend();
+    _impl_.body_.add_friend_ = CreateMaybeMessage< ::message::AddFriendReq >(GetArenaForAllocation());
+  }
+  return _impl_.body_.add_friend_;
+}
+inline ::message::AddFriendReq* PeerEvent::mutable_add_friend() {
+  ::message::AddFriendReq* _msg = _internal_mutable_add_friend();
+  // @@protoc_insertion_point(field_mutable:message.PeerEvent.add_friend)
+  return _msg;
+}
+
+// .message.AuthFriendReq auth_friend = 4;
+inline bool PeerEvent::_internal_has_auth_friend() const {
+  return body_case() == kAuthFriend;
+}
+inline bool PeerEvent::has_auth_friend() const {
+  return _internal_has_auth_friend();
+}
+inline void PeerEvent::set_has_auth_friend() {
+  _impl_._oneof_case_[0] = kAuthFriend;
+}
+inline void PeerEvent::clear_auth_friend() {
+  if (_internal_has_auth_friend()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.body_.auth_friend_;
+    }
+    clear_has_body();
+  }
+}
+inline ::message::AuthFriendReq* PeerEvent::release_auth_friend() {
+  // @@protoc_insertion_point(field_release:message.PeerEvent.auth_friend)
+  if (_internal_has_auth_friend()) {
+    clear_has_body();
+    ::message::AuthFriendReq* temp = _impl_.body_.auth_friend_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.body_.auth_friend_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::message::AuthFriendReq& PeerEvent::_internal_auth_friend() const {
+  return _internal_has_auth_friend()
+      ? *_impl_.body_.auth_friend_
+      : reinterpret_cast< ::message::AuthFriendReq&>(::message::_AuthFriendReq_default_instance_);
+}
+inline const ::message::AuthFriendReq& PeerEvent::auth_friend() const {
+  // @@protoc_insertion_point(field_get:message.PeerEvent.auth_friend)
+  return _internal_auth_friend();
+}
+inline ::message::AuthFriendReq* PeerEvent::unsafe_arena_release_auth_friend() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:message.PeerEvent.auth_friend)
+  if (_internal_has_auth_friend()) {
+    clear_has_body();
+    ::message::AuthFriendReq* temp = _impl_.body_.auth_friend_;
+    _impl_.body_.auth_friend_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PeerEvent::unsafe_arena_set_allocated_auth_friend(::message::AuthFriendReq* auth_friend) {
+  clear_body();
+  if (auth_friend) {
+    set_has_auth_friend();
+    _impl_.body_.auth_friend_ = auth_friend;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.PeerEvent.auth_friend)
+}
+inline ::message::AuthFriendReq* PeerEvent::_internal_mutable_auth_friend() {
+  if (!_internal_has_auth_friend()) {
+    clear_body();
+    set_has_auth_friend();
+    _impl_.body_.auth_friend_ = CreateMaybeMessage< ::message::AuthFriendReq >(GetArenaForAllocation());
+  }
+  return _impl_.body_.auth_friend_;
+}
+inline ::message::AuthFriendReq* PeerEvent::mutable_auth_friend() {
+  ::message::AuthFriendReq* _msg = _internal_mutable_auth_friend();
+  // @@protoc_insertion_point(field_mutable:message.PeerEvent.auth_friend)
+  return _msg;
+}
+
+// .message.TextChatMsgReq text_msg = 5;
+inline bool PeerEvent::_internal_has_text_msg() const {
+  return body_case() == kTextMsg;
+}
+inline bool PeerEvent::has_text_msg() const {
+  return _internal_has_text_msg();
+}
+inline void PeerEvent::set_has_text_msg() {
+  _impl_._oneof_case_[0] = kTextMsg;
+}
+inline void PeerEvent::clear_text_msg() {
+  if (_internal_has_text_msg()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.body_.text_msg_;
+    }
+    clear_has_body();
+  }
+}
+inline ::message::TextChatMsgReq* PeerEvent::release_text_msg() {
+  // @@protoc_insertion_point(field_release:message.PeerEvent.text_msg)
+  if (_internal_has_text_msg()) {
+    clear_has_body();
+    ::message::TextChatMsgReq* temp = _impl_.body_.text_msg_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.body_.text_msg_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::message::TextChatMsgReq& PeerEvent::_internal_text_msg() const {
+  return _internal_has_text_msg()
+      ? *_impl_.body_.text_msg_
+      : reinterpret_cast< ::message::TextChatMsgReq&>(::message::_TextChatMsgReq_default_instance_);
+}
+inline const ::message::TextChatMsgReq& PeerEvent::text_msg() const {
+  // @@protoc_insertion_point(field_get:message.PeerEvent.text_msg)
+  return _internal_text_msg();
+}
+inline ::message::TextChatMsgReq* PeerEvent::unsafe_arena_release_text_msg() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:message.PeerEvent.text_msg)
+  if (_internal_has_text_msg()) {
+    clear_has_body();
+    ::message::TextChatMsgReq* temp = _impl_.body_.text_msg_;
+    _impl_.body_.text_msg_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PeerEvent::unsafe_arena_set_allocated_text_msg(::message::TextChatMsgReq* text_msg) {
+  clear_body();
+  if (text_msg) {
+    set_has_text_msg();
+    _impl_.body_.text_msg_ = text_msg;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:message.PeerEvent.text_msg)
+}
+inline ::message::TextChatMsgReq* PeerEvent::_internal_mutable_text_msg() {
+  if (!_internal_has_text_msg()) {
+    clear_body();
+    set_has_text_msg();
+    _impl_.body_.text_msg_ = CreateMaybeMessage< ::message::TextChatMsgReq >(GetArenaForAllocation());
+  }
+  return _impl_.body_.text_msg_;
+}
+inline ::message::TextChatMsgReq* PeerEvent::mutable_text_msg() {
+  ::message::TextChatMsgReq* _msg = _internal_mutable_text_msg();
+  // @@protoc_insertion_point(field_mutable:message.PeerEvent.text_msg)
+  return _msg;
+}
+
+inline bool PeerEvent::has_body() const {
+  return body_case() != BODY_NOT_SET;
+}
+inline void PeerEvent::clear_has_body() {
+  _impl_._oneof_case_[0] = BODY_NOT_SET;
+}
+inline PeerEvent::BodyCase PeerEvent::body_case() const {
+  return PeerEvent::BodyCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// PeerBatch
+
+// string from_server = 1;
+inline void PeerBatch::clear_from_server() {
+  _impl_.from_server_.ClearToEmpty();
+}
+inline const std::string& PeerBatch::from_server() const {
+  // @@protoc_insertion_point(field_get:message.PeerBatch.from_server)
+  return _internal_from_server();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerBatch::set_from_server(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.from_server_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:message.PeerBatch.from_server)
+}
+inline std::string* PeerBatch::mutable_from_server() {
+  std::string* _s = _internal_mutable_from_server();
+  // @@protoc_insertion_point(field_mutable:message.PeerBatch.from_server)
+  return _s;
+}
+inline const std::string& PeerBatch::_internal_from_server() const {
+  return _impl_.from_server_.Get();
+}
+inline void PeerBatch::_internal_set_from_server(const std::string& value) {
+  
+  _impl_.from_server_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerBatch::_internal_mutable_from_server() {
+  
+  return _impl_.from_server_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerBatch::release_from_server() {
+  // @@protoc_insertion_point(field_release:message.PeerBatch.from_server)
+  return _impl_.from_server_.Release();
+}
+inline void PeerBatch::set_allocated_from_server(std::string* from_server) {
+  if (from_server != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.from_server_.SetAllocated(from_server, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_server_.IsDefault()) {
+    _impl_.from_server_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:message.PeerBatch.from_server)
+}
+
+// uint64 epoch = 2;
+inline void PeerBatch::clear_epoch() {
+  _impl_.epoch_ = uint64_t{0u};
+}
+inline uint64_t PeerBatch::_internal_epoch() const {
+  return _impl_.epoch_;
+}
+inline uint64_t PeerBatch::epoch() const {
+  // @@protoc_insertion_point(field_get:message.PeerBatch.epoch)
+  return _internal_epoch();
+}
+inline void PeerBatch::_internal_set_epoch(uint64_t value) {
+  
+  _impl_.epoch_ = value;
+}
+inline void PeerBatch::set_epoch(uint64_t value) {
+  _internal_set_epoch(value);
+  // @@protoc_insertion_point(field_set:message.PeerBatch.epoch)
+}
+
+// repeated .message.PeerEvent events = 3;
+inline int PeerBatch::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int PeerBatch::events_size() const {
+  return _internal_events_size();
+}
+inline void PeerBatch::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::message::PeerEvent* PeerBatch::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:message.PeerBatch.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::PeerEvent >*
+PeerBatch::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:message.PeerBatch.events)
+  return &_impl_.events_;
+}
+inline const ::message::PeerEvent& PeerBatch::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::message::PeerEvent& PeerBatch::events(int index) const {
+  // @@protoc_insertion_point(field_get:message.PeerBatch.events)
+  return _internal_events(index);
+}
+inline ::message::PeerEvent* PeerBatch::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::message::PeerEvent* PeerBatch::add_events() {
+  ::message::PeerEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:message.PeerBatch.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::PeerEvent >&
+PeerBatch::events() const {
+  // @@protoc_insertion_point(field_list:message.PeerBatch.events)
+  return _impl_.events_;
+}
+
+// -------------------------------------------------------------------
+
+// PeerAck
+
+// uint64 acked_seq = 1;
+inline void PeerAck::clear_acked_seq() {
+  _impl_.acked_seq_ = uint64_t{0u};
+}
+inline uint64_t PeerAck::_internal_acked_seq() const {
+  return _impl_.acked_seq_;
+}
+inline uint64_t PeerAck::acked_seq() const {
+  // @@protoc_insertion_point(field_get:message.PeerAck.acked_seq)
+  return _internal_acked_seq();
+}
+inline void PeerAck::_internal_set_acked_seq(uint64_t value) {
+  
+  _impl_.acked_seq_ = value;
+}
+inline void PeerAck::set_acked_seq(uint64_t value) {
+  _internal_set_acked_seq(value);
+  // @@protoc_insertion_point(field_set:message.PeerAck.acked_seq)
 }
 
 #ifdef __GNUC__
@@ -4721,6 +6777,18 @@ TextChatMsgRsp::textmsgs() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
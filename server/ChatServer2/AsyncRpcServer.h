@@ -0,0 +1,136 @@
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "MetricsMgr.h"
+
+// 完成队列上的一个调用，每完成一个操作轮询线程调用一次Proceed推进状态
+class RpcCall {
+public:
+	virtual ~RpcCall() {}
+	virtual void Proceed(bool ok) = 0;
+};
+
+class AsyncRpcServer;
+
+// 一个unary方法：登记等待请求的函数、处理函数和延迟统计，同一方法的所有调用共享
+template <typename Req, typename Rsp>
+struct UnaryMethod {
+	std::function<void(grpc::ServerContext*, Req*, grpc::ServerAsyncResponseWriter<Rsp>*,
+		grpc::ServerCompletionQueue*, void*)> _request;
+	std::function<grpc::Status(grpc::ServerContext*, const Req*, Rsp*)> _handler;
+	LatencyMetric* _metric;
+};
+
+// 一次unary调用：等请求 -> 请求到达后立刻登记下一个调用，处理函数投递到工作线程 -> Finish后释放
+template <typename Req, typename Rsp>
+class UnaryCall : public RpcCall {
+public:
+	UnaryCall(AsyncRpcServer* server, grpc::ServerCompletionQueue* cq, std::shared_ptr<UnaryMethod<Req, Rsp>> method)
+		: _server(server), _cq(cq), _method(method), _responder(&_context), _b_finish(false) {
+		_method->_request(&_context, &_req, &_responder, _cq, this);
+	}
+
+	void Proceed(bool ok) override;
+
+private:
+	AsyncRpcServer* _server;
+	grpc::ServerCompletionQueue* _cq;
+	std::shared_ptr<UnaryMethod<Req, Rsp>> _method;
+	grpc::ServerContext _context;
+	Req _req;
+	Rsp _rsp;
+	grpc::ServerAsyncResponseWriter<Rsp> _responder;
+	bool _b_finish;
+};
+
+// AsyncRpcServer：异步gRPC服务，配置在 [Grpc] 中
+// CqCount个完成队列，每个队列CqThreads个轮询线程，轮询线程只推进调用的状态；
+// 处理函数投递到Workers个工作线程上执行，处理函数里的redis、mysql调用不会占住完成队列。
+// 先Start注册服务并启动，再由服务实现AddUnary或者自己创建调用开始接收请求
+class AsyncRpcServer
+{
+public:
+	AsyncRpcServer();
+	~AsyncRpcServer();
+	bool Start(const std::string& address, grpc::Service* service);
+	// 停止接收新请求，在途调用最多等ShutdownMs，之后停止工作线程和完成队列，可以重复调用
+	void Shutdown();
+	// 阻塞到Shutdown完成
+	void Wait();
+	void Post(std::function<void()> task);
+	size_t CqCount() const;
+	grpc::ServerCompletionQueue* GetCq(size_t index);
+
+	// request是生成代码里AsyncService的RequestXXX，每个完成队列上预先登记几个调用
+	template <typename Base, typename Service, typename Req, typename Rsp, typename Handler>
+	void AddUnary(Service* service,
+		void (Base::*request)(grpc::ServerContext*, Req*, grpc::ServerAsyncResponseWriter<Rsp>*,
+			grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*),
+		Handler handler, LatencyMetric* metric);
+private:
+	void PollCompletion(grpc::ServerCompletionQueue* cq);
+
+	int _cq_count;
+	int _cq_threads;
+	int _worker_count;
+	int _shutdown_ms;
+	std::unique_ptr<grpc::Server> _server;
+	std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> _cqs;
+	std::vector<std::thread> _poll_threads;
+	boost::asio::io_context _executor;
+	std::unique_ptr<boost::asio::io_context::work> _work;
+	std::vector<std::thread> _workers;
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	bool _b_start;
+	bool _b_stop;
+	bool _b_done;
+};
+
+// 每个完成队列上同时等待请求的调用数，请求到达时会立即补上一个
+#define ASYNC_RPC_PENDING_CALLS  8
+
+template <typename Req, typename Rsp>
+void UnaryCall<Req, Rsp>::Proceed(bool ok) {
+	// 登记失败说明服务在关闭
+	if (_b_finish || !ok) {
+		delete this;
+		return;
+	}
+
+	new UnaryCall<Req, Rsp>(_server, _cq, _method);
+	auto arrive_time = std::chrono::steady_clock::now();
+	_server->Post([this, arrive_time]() {
+		if (_method->_metric != nullptr) {
+			_method->_metric->_wait.Record(MetricsMgr::ToMicros(std::chrono::steady_clock::now() - arrive_time));
+		}
+		auto status = _method->_handler(&_context, &_req, &_rsp);
+		_b_finish = true;
+		_responder.Finish(_rsp, status, this);
+	});
+}
+
+template <typename Base, typename Service, typename Req, typename Rsp, typename Handler>
+void AsyncRpcServer::AddUnary(Service* service,
+	void (Base::*request)(grpc::ServerContext*, Req*, grpc::ServerAsyncResponseWriter<Rsp>*,
+		grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*),
+	Handler handler, LatencyMetric* metric) {
+	auto method = std::make_shared<UnaryMethod<Req, Rsp>>();
+	method->_request = [service, request](grpc::ServerContext* context, Req* req,
+		grpc::ServerAsyncResponseWriter<Rsp>* responder, grpc::ServerCompletionQueue* cq, void* tag) {
+		(service->*request)(context, req, responder, cq, cq, tag);
+	};
+	method->_handler = handler;
+	method->_metric = metric;
+	for (auto& cq : _cqs) {
+		for (int i = 0; i < ASYNC_RPC_PENDING_CALLS; ++i) {
+			new UnaryCall<Req, Rsp>(this, cq.get(), method);
+		}
+	}
+}
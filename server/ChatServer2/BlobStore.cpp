@@ -0,0 +1,276 @@
+#include "BlobStore.h"
+#include "Sha256.h"
+#include "RedisMgr.h"
+#include "ConfigMgr.h"
+#include "const.h"
+#include <iostream>
+#include <chrono>
+#include <ctime>
+#include <boost/filesystem.hpp>
+
+BlobStore::BlobStore() : _b_stop(false) {
+	auto& cfg = ConfigMgr::Inst();
+	_root = cfg["FileServer"]["Path"];
+	_blob_root = (boost::filesystem::path(_root) / "blobs").string();
+	_gc_interval = atoi(cfg["FileServer"]["GcInterval"].c_str());
+	_gc_grace = atoi(cfg["FileServer"]["GcGrace"].c_str());
+	_part_expire = atoi(cfg["FileServer"]["PartExpire"].c_str());
+	_file_expire = atoi(cfg["FileServer"]["FileExpire"].c_str());
+	if (_gc_interval <= 0) {
+		_gc_interval = 3600;
+	}
+
+	boost::system::error_code ec;
+	boost::filesystem::create_directories(_blob_root, ec);
+	std::cout << "blob store on " << _blob_root << ", sha256 hardware support is "
+		<< Sha256::HasHardwareSupport() << std::endl;
+}
+
+BlobStore::~BlobStore() {
+	Stop();
+}
+
+bool BlobStore::IsValidHash(const std::string& hash) {
+	if (hash.size() != 64) {
+		return false;
+	}
+	for (char c : hash) {
+		if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+std::string BlobStore::BlobPath(const std::string& hash) {
+	//按哈希前两个字节分两级目录，避免单个目录下文件过多
+	return (boost::filesystem::path(_blob_root) / hash.substr(0, 2) / hash.substr(2, 2) / hash).string();
+}
+
+bool BlobStore::Link(const std::string& file_id, int uid, const std::string& hash, long long size) {
+	auto old_hash = RedisMgr::GetInstance()->HGet(FILE_BLOB, file_id);
+	//file_id绑定后不再改变，同一个用户重复提交同样的内容只算一次引用
+	if (!old_hash.empty()) {
+		return old_hash == hash && RedisMgr::GetInstance()->HGet(FILE_OWNER, file_id) == std::to_string(uid);
+	}
+
+	long long value = 0;
+	RedisMgr::GetInstance()->HSet(FILE_OWNER, file_id, std::to_string(uid));
+	RedisMgr::GetInstance()->HSet(FILE_BLOB, file_id, hash);
+	RedisMgr::GetInstance()->HIncrBy(BLOB_REF, hash, 1, value);
+	RedisMgr::GetInstance()->HIncrBy(BLOB_STAT, "logical", size, value);
+	//按绑定时间顺序记录，到期后由后台释放
+	RedisMgr::GetInstance()->RPush(FILE_LINK_LOG, std::to_string(std::time(nullptr)) + "|" + file_id);
+	return true;
+}
+
+bool BlobStore::AddRef(const std::string& file_id, int uid, const std::string& hash, long long size) {
+	if (!IsValidHash(hash)) {
+		return false;
+	}
+
+	//检查blob、更新修改时间和加引用都在锁内，回收线程删除前会在锁内重新检查引用和修改时间
+	std::lock_guard<std::mutex> lock(_mutex);
+	boost::system::error_code ec;
+	auto path = BlobPath(hash);
+	auto blob_size = (long long)boost::filesystem::file_size(path, ec);
+	if (ec || blob_size != size) {
+		return false;
+	}
+
+	//更新修改时间，避免刚加上引用的blob被正在进行的回收删掉
+	boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+	return Link(file_id, uid, hash, size);
+}
+
+bool BlobStore::Commit(const std::string& file_id, int uid, const std::string& part_path, std::string& hash) {
+	//在文件传输的io线程上计算，100M文件用SHA-NI大约几十毫秒
+	long long size = 0;
+	if (!Sha256::HashFile(part_path, hash, size)) {
+		std::cout << "hash " << part_path << " failed" << std::endl;
+		return false;
+	}
+
+	boost::system::error_code ec;
+	auto path = BlobPath(hash);
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (boost::filesystem::exists(path, ec)) {
+		//内容已经存在，丢弃刚收到的这份
+		boost::filesystem::remove(part_path, ec);
+		boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+	}
+	else {
+		boost::filesystem::create_directories(boost::filesystem::path(path).parent_path(), ec);
+		boost::filesystem::rename(part_path, path, ec);
+		if (ec) {
+			std::cout << "move " << part_path << " to blob store failed, error is " << ec.message() << std::endl;
+			return false;
+		}
+		long long value = 0;
+		RedisMgr::GetInstance()->HIncrBy(BLOB_STAT, "physical", size, value);
+	}
+
+	if (!Link(file_id, uid, hash, size)) {
+		//内容已经进了存储，没有引用时由后台回收
+		std::cout << "file " << file_id << " is bound by another upload" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool BlobStore::Resolve(const std::string& file_id, std::string& path) {
+	auto hash = RedisMgr::GetInstance()->HGet(FILE_BLOB, file_id);
+	if (!IsValidHash(hash)) {
+		return false;
+	}
+
+	path = BlobPath(hash);
+	boost::system::error_code ec;
+	return boost::filesystem::exists(path, ec);
+}
+
+void BlobStore::Release(const std::string& file_id) {
+	auto hash = RedisMgr::GetInstance()->HGet(FILE_BLOB, file_id);
+	if (!IsValidHash(hash)) {
+		return;
+	}
+
+	boost::system::error_code ec;
+	auto size = (long long)boost::filesystem::file_size(BlobPath(hash), ec);
+	long long value = 0;
+	RedisMgr::GetInstance()->HDel(FILE_BLOB, file_id);
+	RedisMgr::GetInstance()->HDel(FILE_OWNER, file_id);
+	RedisMgr::GetInstance()->HIncrBy(BLOB_REF, hash, -1, value);
+	if (!ec) {
+		RedisMgr::GetInstance()->HIncrBy(BLOB_STAT, "logical", -size, value);
+	}
+}
+
+double BlobStore::DedupRatio(long long& logical_bytes, long long& physical_bytes) {
+	logical_bytes = atoll(RedisMgr::GetInstance()->HGet(BLOB_STAT, "logical").c_str());
+	physical_bytes = atoll(RedisMgr::GetInstance()->HGet(BLOB_STAT, "physical").c_str());
+	if (physical_bytes <= 0) {
+		return 1.0;
+	}
+	return (double)logical_bytes / physical_bytes;
+}
+
+void BlobStore::Start() {
+	_gc_thread = std::thread(&BlobStore::RunGC, this);
+}
+
+void BlobStore::Stop() {
+	if (_b_stop.exchange(true)) {
+		return;
+	}
+	_cond.notify_all();
+	if (_gc_thread.joinable()) {
+		_gc_thread.join();
+	}
+}
+
+void BlobStore::RunGC() {
+	while (!_b_stop) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait_for(lock, std::chrono::seconds(_gc_interval), [this]() {
+				return _b_stop.load();
+				});
+		}
+		if (_b_stop) {
+			break;
+		}
+
+		CollectFiles();
+		CollectBlobs();
+		CollectParts();
+		long long logical = 0, physical = 0;
+		double ratio = DedupRatio(logical, physical);
+		std::cout << "blob store gc done, logical bytes " << logical << ", physical bytes "
+			<< physical << ", dedup ratio " << ratio << std::endl;
+	}
+}
+
+void BlobStore::CollectBlobs() {
+	boost::system::error_code ec;
+	auto now = std::time(nullptr);
+	for (boost::filesystem::recursive_directory_iterator it(_blob_root, ec), end; !ec && it != end; it.increment(ec)) {
+		if (!boost::filesystem::is_regular_file(it->status())) {
+			continue;
+		}
+
+		auto hash = it->path().filename().string();
+		if (!IsValidHash(hash)) {
+			continue;
+		}
+
+		//引用归零后还要等待一段时间，防止和并发的秒传请求冲突
+		auto ref = atoll(RedisMgr::GetInstance()->HGet(BLOB_REF, hash).c_str());
+		boost::system::error_code file_ec;
+		auto mtime = boost::filesystem::last_write_time(it->path(), file_ec);
+		if (ref > 0 || file_ec || now - mtime < _gc_grace) {
+			continue;
+		}
+
+		//锁外的检查只用来跳过大部分blob，删除前在锁内重新读，期间可能有秒传或者上传加了引用
+		std::lock_guard<std::mutex> lock(_mutex);
+		ref = atoll(RedisMgr::GetInstance()->HGet(BLOB_REF, hash).c_str());
+		mtime = boost::filesystem::last_write_time(it->path(), file_ec);
+		if (ref > 0 || file_ec || std::time(nullptr) - mtime < _gc_grace) {
+			continue;
+		}
+		auto size = (long long)boost::filesystem::file_size(it->path(), file_ec);
+		if (boost::filesystem::remove(it->path(), file_ec)) {
+			long long value = 0;
+			RedisMgr::GetInstance()->HDel(BLOB_REF, hash);
+			RedisMgr::GetInstance()->HIncrBy(BLOB_STAT, "physical", -size, value);
+			std::cout << "blob " << hash << " collected" << std::endl;
+		}
+	}
+}
+
+void BlobStore::CollectParts() {
+	if (_part_expire <= 0) {
+		return;
+	}
+
+	boost::system::error_code ec;
+	auto now = std::time(nullptr);
+	for (boost::filesystem::directory_iterator it(_root, ec), end; !ec && it != end; it.increment(ec)) {
+		if (it->path().extension() != ".part") {
+			continue;
+		}
+
+		//长时间没有续传的半截文件
+		boost::system::error_code file_ec;
+		auto mtime = boost::filesystem::last_write_time(it->path(), file_ec);
+		if (!file_ec && now - mtime > _part_expire) {
+			boost::filesystem::remove(it->path(), file_ec);
+			std::cout << "expired upload " << it->path().filename().string() << " removed" << std::endl;
+		}
+	}
+}
+
+void BlobStore::CollectFiles() {
+	if (_file_expire <= 0) {
+		return;
+	}
+
+	//记录按绑定时间排列，从最早的开始取，没到期就放回去；先取出再处理，多台服务器同时回收时每条只处理一次
+	auto now = std::time(nullptr);
+	std::string entry;
+	while (!_b_stop && RedisMgr::GetInstance()->LPop(FILE_LINK_LOG, entry)) {
+		auto pos = entry.find('|');
+		if (pos == std::string::npos) {
+			continue;
+		}
+		auto link_time = atoll(entry.substr(0, pos).c_str());
+		if (now - link_time < _file_expire) {
+			RedisMgr::GetInstance()->LPush(FILE_LINK_LOG, entry);
+			break;
+		}
+		auto file_id = entry.substr(pos + 1);
+		Release(file_id);
+		std::cout << "file " << file_id << " expired" << std::endl;
+	}
+}
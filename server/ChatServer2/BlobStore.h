@@ -0,0 +1,57 @@
+#pragma once
+#include "Singleton.h"
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// BlobStore：按SHA-256内容寻址的去重存储，放在文件传输服务后面
+// 文件内容保存在 [FileServer] Path/blobs/ab/cd/<hash>，按哈希前两个字节分两级目录
+// 每个file_id是对某个blob的一次引用，映射和引用计数保存在redis中，多台服务器共享存储目录时也能共用
+// 同样内容的文件只存一份，客户端上传前先用哈希询问，已经存在则直接加引用，不需要再传
+// file_id第一次绑定时记下上传者uid，之后不能再绑定到别的内容，也不能被别人绑定
+// 秒传把"知道内容的哈希和大小"当作拥有这份内容的证明：拿到别人文件哈希的人不用上传就能引用这份内容，
+// 也能用哈希试探服务器上有没有某个文件。所以哈希只回给上传者，不能放进发给其他用户的消息里
+// 后台线程定期回收引用计数归零的blob和长时间没有传完的.part文件；FileExpire大于0时，
+// 绑定时间超过FileExpire秒的file_id释放引用，不再能下载
+class BlobStore : public Singleton<BlobStore>
+{
+	friend class Singleton<BlobStore>;
+public:
+	~BlobStore();
+	// 秒传：内容已经存在时给file_id加一个引用，不存在或者file_id已经被绑定过返回false
+	bool AddRef(const std::string& file_id, int uid, const std::string& hash, long long size);
+	// 上传完成后计算.part文件的哈希并放入存储，内容已经存在时删除.part只加引用
+	bool Commit(const std::string& file_id, int uid, const std::string& part_path, std::string& hash);
+	// 根据file_id找到blob文件路径
+	bool Resolve(const std::string& file_id, std::string& path);
+	// 释放file_id的引用，计数归零的blob由后台回收
+	void Release(const std::string& file_id);
+	// 去重率 = 所有引用的总大小 / 实际存储的大小
+	double DedupRatio(long long& logical_bytes, long long& physical_bytes);
+	void Start();
+	void Stop();
+	static bool IsValidHash(const std::string& hash);
+private:
+	BlobStore();
+	std::string BlobPath(const std::string& hash);
+	// 建立file_id到blob的引用，调用时持有_mutex；file_id已经绑定到别的内容或者别的用户时返回false
+	bool Link(const std::string& file_id, int uid, const std::string& hash, long long size);
+	void RunGC();
+	void CollectBlobs();
+	void CollectParts();
+	// 释放绑定时间超过FileExpire的file_id
+	void CollectFiles();
+
+	std::string _root;
+	std::string _blob_root;
+	int _gc_interval;
+	int _gc_grace;
+	int _part_expire;
+	int _file_expire;
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::thread _gc_thread;
+	std::atomic<bool> _b_stop;
+};
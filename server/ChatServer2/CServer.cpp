@@ -2,13 +2,23 @@
 #include <iostream>
 #include "AsioIOServicePool.h"
 #include "UserMgr.h"
+#include "LogicSystem.h"
+#include <chrono>
 CServer::CServer(boost::asio::io_context& io_context, short port):_io_context(io_context), _port(port),
-_acceptor(io_context, tcp::endpoint(tcp::v4(),port))
+_acceptor(io_context, tcp::endpoint(tcp::v4(),port)), _b_handoff(false), _b_accepting(false)
 {
 	cout << "Server start success, listen on port : " << _port << endl;
 	StartAccept();
 }
 
+//接管旧进程的监听socket，端口已经处于监听状态，不需要重新绑定
+CServer::CServer(boost::asio::io_context& io_context, short port, int listen_fd) :_io_context(io_context), _port(port),
+_acceptor(io_context, tcp::v4(), listen_fd), _b_handoff(false), _b_accepting(false)
+{
+	cout << "Server take over success, listen on port : " << _port << endl;
+	StartAccept();
+}
+
 CServer::~CServer() {
 	cout << "Server destruct listen on port : " << _port << endl;
 }
@@ -23,19 +33,26 @@ void CServer::HandleAccept(shared_ptr<CSession> new_session, const boost::system
 		cout << "session accept failed, error is " << error.what() << endl;
 	}
 
+	//平滑升级中不再接受新连接，监听socket要交给新进程
+	if (_b_handoff) {
+		_b_accepting = false;
+		return;
+	}
+
 	StartAccept();
 }
 
 void CServer::StartAccept() {
 	auto &io_context = AsioIOServicePool::GetInstance()->GetIOService();
 	shared_ptr<CSession> new_session = make_shared<CSession>(io_context, this);
+	_b_accepting = true;
 	_acceptor.async_accept(new_session->GetSocket(), std::bind(&CServer::HandleAccept, this, new_session, placeholders::_1));
 }
 
 void CServer::ClearSession(std::string uuid) {
 	
 	if (_sessions.find(uuid) != _sessions.end()) {
-		//ƳûsessionĹ
+		//移除用户和session的关联
 		UserMgr::GetInstance()->RmvUserSession(_sessions[uuid]->GetUserId());
 	}
 
@@ -45,3 +62,125 @@ void CServer::ClearSession(std::string uuid) {
 	}
 	
 }
+
+void CServer::SetHandoffHooks(std::function<void()> on_prepare, std::function<void()> on_abort) {
+	_on_handoff_prepare = on_prepare;
+	_on_handoff_abort = on_abort;
+}
+
+bool CServer::PrepareHandoff(int& listen_fd, std::vector<int>& session_fds, Json::Value& state) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(HANDOFF_TIMEOUT_SEC);
+
+	// 先停止接收对端的通知，导出会话之后不会再有通知发进来
+	if (_on_handoff_prepare) {
+		_on_handoff_prepare();
+	}
+
+	// 停止accept，等accept回调退出后会话表就不会再增加
+	_b_handoff = true;
+	boost::asio::post(_io_context, [this]() {
+		boost::system::error_code ec;
+		_acceptor.cancel(ec);
+	});
+
+	while (_b_accepting) {
+		if (std::chrono::steady_clock::now() > deadline) {
+			cout << "handoff wait accept stop timeout" << endl;
+			AbortHandoff();
+			return false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	// 冻结所有会话，等待读写都停下来，期间断开的会话会从会话表中移除
+	{
+		lock_guard<mutex> lock(_mutex);
+		for (auto& iter : _sessions) {
+			iter.second->PrepareHandoff();
+		}
+	}
+
+	for (;;) {
+		bool b_parked = true;
+		{
+			lock_guard<mutex> lock(_mutex);
+			for (auto& iter : _sessions) {
+				if (!iter.second->IsParked()) {
+					b_parked = false;
+					break;
+				}
+			}
+		}
+
+		if (b_parked) {
+			break;
+		}
+
+		if (std::chrono::steady_clock::now() > deadline) {
+			cout << "handoff wait sessions park timeout" << endl;
+			AbortHandoff();
+			return false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	// 已经投递到逻辑队列的消息处理完，回包会留在各个会话的发送队列中一起交接
+	LogicSystem::GetInstance()->WaitIdle();
+
+	lock_guard<mutex> lock(_mutex);
+	listen_fd = _acceptor.native_handle();
+	state["sessions"] = Json::arrayValue;
+	for (auto& iter : _sessions) {
+		session_fds.push_back(iter.second->GetSocket().native_handle());
+		state["sessions"].append(iter.second->DumpHandoff());
+	}
+
+	return true;
+}
+
+void CServer::AbortHandoff() {
+	_b_handoff = false;
+	if (_on_handoff_abort) {
+		_on_handoff_abort();
+	}
+	{
+		lock_guard<mutex> lock(_mutex);
+		for (auto& iter : _sessions) {
+			iter.second->Resume();
+		}
+	}
+
+	boost::asio::post(_io_context, [this]() {
+		if (!_b_accepting) {
+			StartAccept();
+		}
+	});
+}
+
+void CServer::ResumeSessions(const std::vector<int>& session_fds, const Json::Value& state) {
+	auto& sessions = state["sessions"];
+	for (Json::ArrayIndex i = 0; i < sessions.size() && i < session_fds.size(); ++i) {
+		auto& io_context = AsioIOServicePool::GetInstance()->GetIOService();
+		auto session = make_shared<CSession>(io_context, this);
+		boost::system::error_code ec;
+		session->GetSocket().assign(tcp::v4(), session_fds[i], ec);
+		if (ec) {
+			cout << "assign handoff socket failed, error is " << ec.message() << endl;
+			continue;
+		}
+
+		session->LoadHandoff(sessions[i]);
+		// 已登录的会话重新绑定uid，redis中的uip_记录指向的还是本服务器，不需要修改
+		if (session->GetUserId() > 0) {
+			UserMgr::GetInstance()->SetUserSession(session->GetUserId(), session);
+		}
+
+		{
+			lock_guard<mutex> lock(_mutex);
+			_sessions.insert(make_pair(session->GetSessionId(), session));
+		}
+		session->Resume();
+	}
+
+	cout << "resume handoff sessions count is " << _sessions.size() << endl;
+}
@@ -4,14 +4,28 @@
 #include <memory.h>
 #include <map>
 #include <mutex>
+#include <atomic>
+#include <vector>
+#include <functional>
+#include <json/json.h>
 using namespace std;
 using boost::asio::ip::tcp;
 class CServer
 {
 public:
 	CServer(boost::asio::io_context& io_context, short port);
+	//平滑升级时使用旧进程交出的监听socket构造
+	CServer(boost::asio::io_context& io_context, short port, int listen_fd);
 	~CServer();
 	void ClearSession(std::string);
+	//平滑升级开始时停止接收对端通知，失败时恢复；on_prepare返回前在途的通知要处理完
+	void SetHandoffHooks(std::function<void()> on_prepare, std::function<void()> on_abort);
+	//平滑升级：停止accept并冻结所有会话，导出监听socket、会话socket和会话状态
+	bool PrepareHandoff(int& listen_fd, std::vector<int>& session_fds, Json::Value& state);
+	//交接失败，恢复accept和所有会话的读写
+	void AbortHandoff();
+	//新进程根据旧进程交出的socket和状态恢复会话
+	void ResumeSessions(const std::vector<int>& session_fds, const Json::Value& state);
 private:
 	void HandleAccept(shared_ptr<CSession>, const boost::system::error_code & error);
 	void StartAccept();
@@ -20,5 +34,11 @@ private:
 	tcp::acceptor _acceptor;
 	std::map<std::string, shared_ptr<CSession>> _sessions;
 	std::mutex _mutex;
+	//平滑升级中，不再接受新连接
+	std::atomic<bool> _b_handoff;
+	//是否有accept操作在进行
+	std::atomic<bool> _b_accepting;
+	std::function<void()> _on_handoff_prepare;
+	std::function<void()> _on_handoff_abort;
 };
 
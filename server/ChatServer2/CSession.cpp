@@ -6,9 +6,14 @@
 #include <json/value.h>
 #include <json/reader.h>
 #include "LogicSystem.h"
+#include "HandoffMgr.h"
+#include "CompressMgr.h"
+#include "TraceMgr.h"
 
 CSession::CSession(boost::asio::io_context& io_context, CServer* server):
-	_socket(io_context), _server(server), _b_close(false),_b_head_parse(false), _user_uid(0){
+	_socket(io_context), _server(server), _b_close(false),_b_head_parse(false), _user_uid(0),
+	_b_handoff(false), _b_read_parked(false), _b_write_parked(false), _resume_len(0),
+	_b_compress(false), _b_compress_dict(false){
 	boost::uuids::uuid  a_uuid = boost::uuids::random_generator()();
 	_session_id = boost::uuids::to_string(a_uuid);
 	_recv_head_node = make_shared<MsgNode>(HEAD_TOTAL_LEN);
@@ -47,8 +52,9 @@ void CSession::Send(std::string msg, short msgid) {
 		return;
 	}
 
-	_send_que.push(make_shared<SendNode>(msg.c_str(), msg.length(), msgid));
-	if (send_que_size > 0) {
+	_send_que.push(MakeSendNode(msg.c_str(), msg.length(), msgid));
+	//平滑升级冻结期间只入队不发送，队列会随会话一起交给新进程
+	if (send_que_size > 0 || _b_handoff) {
 		return;
 	}
 	auto& msgnode = _send_que.front();
@@ -64,8 +70,8 @@ void CSession::Send(char* msg, short max_length, short msgid) {
 		return;
 	}
 
-	_send_que.push(make_shared<SendNode>(msg, max_length, msgid));
-	if (send_que_size>0) {
+	_send_que.push(MakeSendNode(msg, max_length, msgid));
+	if (send_que_size>0 || _b_handoff) {
 		return;
 	}
 	auto& msgnode = _send_que.front();
@@ -73,6 +79,71 @@ void CSession::Send(char* msg, short max_length, short msgid) {
 		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
 }
 
+void CSession::SetCompress(bool b_dict) {
+	_b_compress_dict = b_dict;
+	_b_compress = true;
+}
+
+void CSession::SendAck(const std::string& msgid, long long seq, long long ts) {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	Json::Value ack;
+	ack["msgid"] = msgid;
+	ack["seq"] = (Json::Int64)seq;
+	ack["ts"] = (Json::Int64)ts;
+	_pending_acks.append(ack);
+
+	// 有写操作在进行时先攒着，HandleWrite写完当前节点后合并成一帧发送
+	// 攒够一帧的上限时直接入队，避免单帧过大
+	if (_pending_acks.size() >= MAX_ACK_BATCH) {
+		PushAcks();
+	}
+	if (!_send_que.empty() || _b_handoff) {
+		return;
+	}
+
+	PushAcks();
+	auto& msgnode = _send_que.front();
+	boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+		std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+}
+
+void CSession::PushAcks() {
+	if (_pending_acks.empty()) {
+		return;
+	}
+
+	Json::Value rtvalue;
+	rtvalue["error"] = ErrorCodes::Success;
+	rtvalue["acks"] = _pending_acks;
+	_pending_acks = Json::Value(Json::arrayValue);
+
+	// 确认帧不需要缩进，用FastWriter输出紧凑格式
+	Json::FastWriter writer;
+	writer.omitEndingLineFeed();
+	std::string return_str = writer.write(rtvalue);
+	_send_que.push(MakeSendNode(return_str.c_str(), return_str.length(), ID_TEXT_CHAT_MSG_RSP));
+}
+
+std::shared_ptr<SendNode> CSession::MakeSendNode(const char* msg, short max_length, short msgid) {
+	auto compress_mgr = CompressMgr::GetInstance();
+	//发出的帧抽样用于训练字典
+	compress_mgr->AddSample(msg, max_length);
+	std::string compressed;
+	std::shared_ptr<SendNode> node;
+	if (_b_compress && compress_mgr->Compress(msg, max_length, _b_compress_dict, compressed)) {
+		node = make_shared<SendNode>(compressed.data(), compressed.size(), msgid | MSG_COMPRESS_FLAG);
+	}
+	else {
+		node = make_shared<SendNode>(msg, max_length, msgid);
+	}
+	//在追踪中发出的消息记下入队时间
+	node->_trace_id = TraceMgr::Current();
+	if (node->_trace_id != 0) {
+		node->_enqueue_us = TraceMgr::NowMicros();
+	}
+	return node;
+}
+
 void CSession::Close() {
 	_socket.close();
 	_b_close = true;
@@ -87,6 +158,12 @@ void CSession::AsyncReadBody(int total_len)
 	auto self = shared_from_this();
 	asyncReadFull(total_len, [self, this, total_len](const boost::system::error_code& ec, std::size_t bytes_transfered) {
 		try {
+			//平滑升级取消了读操作，保存半包等待交接
+			if (ec == boost::asio::error::operation_aborted && _b_handoff) {
+				ParkRead(bytes_transfered, true);
+				return;
+			}
+
 			if (ec) {
 				std::cout << "handle read failed, error is " << ec.what() << endl;
 				Close();
@@ -105,10 +182,52 @@ void CSession::AsyncReadBody(int total_len)
 			memcpy(_recv_msg_node->_data , _data , bytes_transfered);
 			_recv_msg_node->_cur_len += bytes_transfered;
 			_recv_msg_node->_data[_recv_msg_node->_total_len] = '\0';
+			short raw_id = 0;
+			memcpy(&raw_id, _recv_head_node->_data, HEAD_ID_LEN);
+			raw_id = boost::asio::detail::socket_ops::network_to_host_short(raw_id);
+			short msg_id = raw_id & ~(MSG_COMPRESS_FLAG | MSG_TRACE_FLAG);
+			const char* body = _recv_msg_node->_data;
+			std::size_t body_len = bytes_transfered;
+			//消息头中带追踪标志时消息体前面是trace id
+			uint64_t trace_id = 0;
+			if (raw_id & MSG_TRACE_FLAG) {
+				if (body_len < TRACE_ID_LEN) {
+					std::cout << "trace msg too short, msg_id is " << msg_id << endl;
+					Close();
+					_server->ClearSession(_session_id);
+					return;
+				}
+				trace_id = ParseTraceId(body);
+				body += TRACE_ID_LEN;
+				body_len -= TRACE_ID_LEN;
+			}
+			//消息头中带压缩标志时先解压
+			if (raw_id & MSG_COMPRESS_FLAG) {
+				std::string plain;
+				if (!CompressMgr::GetInstance()->Decompress(body, body_len,
+					MAX_LENGTH, plain)) {
+					std::cout << "decompress msg failed, msg_id is " << msg_id << endl;
+					Close();
+					_server->ClearSession(_session_id);
+					return;
+				}
+				_recv_msg_node = make_shared<RecvNode>(plain.size(), msg_id);
+				memcpy(_recv_msg_node->_data, plain.data(), plain.size());
+				_recv_msg_node->_cur_len = plain.size();
+			}
+			else if (raw_id & MSG_TRACE_FLAG) {
+				auto plain_node = make_shared<RecvNode>(body_len, msg_id);
+				memcpy(plain_node->_data, body, body_len);
+				plain_node->_cur_len = body_len;
+				_recv_msg_node = plain_node;
+			}
+			if (trace_id == 0) {
+				trace_id = TraceMgr::GetInstance()->Sample();
+			}
 			cout << "receive data is " << _recv_msg_node->_data << endl;
-			//˴ϢͶݵ߼
-			LogicSystem::GetInstance()->PostMsgToQue(make_shared<LogicNode>(shared_from_this(), _recv_msg_node));
-			//ͷ¼
+			//此处将消息投递到逻辑队列中
+			LogicSystem::GetInstance()->PostMsgToQue(make_shared<LogicNode>(shared_from_this(), _recv_msg_node, trace_id));
+			//继续监听头部接受事件
 			AsyncReadHead(HEAD_TOTAL_LEN);
 		}
 		catch (std::exception& e) {
@@ -122,6 +241,12 @@ void CSession::AsyncReadHead(int total_len)
 	auto self = shared_from_this();
 	asyncReadFull(HEAD_TOTAL_LEN, [self, this](const boost::system::error_code& ec, std::size_t bytes_transfered) {
 		try {
+			//平滑升级取消了读操作，保存半包等待交接
+			if (ec == boost::asio::error::operation_aborted && _b_handoff) {
+				ParkRead(bytes_transfered, false);
+				return;
+			}
+
 			if (ec) {
 				std::cout << "handle read failed, error is " << ec.what() << endl;
 				Close();
@@ -140,25 +265,20 @@ void CSession::AsyncReadHead(int total_len)
 			_recv_head_node->Clear();
 			memcpy(_recv_head_node->_data, _data, bytes_transfered);
 
-			//ȡͷMSGID
+			//获取头部MSGID和长度，已转为本地字节序，压缩标志在消息体读完后再处理
 			short msg_id = 0;
-			memcpy(&msg_id, _recv_head_node->_data, HEAD_ID_LEN);
-			//ֽתΪֽ
-			msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+			short msg_len = 0;
+			ParseMsgHead(_recv_head_node->_data, msg_id, msg_len);
 			std::cout << "msg_id is " << msg_id << endl;
-			//idǷ
+			//id非法
 			if (msg_id > MAX_LENGTH) {
 				std::cout << "invalid msg_id is " << msg_id << endl;
 				_server->ClearSession(_session_id);
 				return;
 			}
-			short msg_len = 0;
-			memcpy(&msg_len, _recv_head_node->_data + HEAD_ID_LEN, HEAD_DATA_LEN);
-			//ֽתΪֽ
-			msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
 			std::cout << "msg_len is " << msg_len << endl;
 
-			//idǷ
+			//id非法
 			if (msg_len > MAX_LENGTH) {
 				std::cout << "invalid data length is " << msg_len << endl;
 				_server->ClearSession(_session_id);
@@ -175,12 +295,26 @@ void CSession::AsyncReadHead(int total_len)
 }
 
 void CSession::HandleWrite(const boost::system::error_code& error, std::shared_ptr<CSession> shared_self) {
-	//쳣
+	//增加异常处理
 	try {
 		if (!error) {
 			std::lock_guard<std::mutex> lock(_send_lock);
 			//cout << "send data " << _send_que.front()->_data+HEAD_LENGTH << endl;
+			auto& sent = _send_que.front();
+			if (sent->_trace_id != 0) {
+				TraceMgr::GetInstance()->Record(sent->_trace_id, "tcp.send", std::to_string(_user_uid),
+					sent->_enqueue_us, TraceMgr::NowMicros() - sent->_enqueue_us);
+			}
 			_send_que.pop();
+			//写操作期间攒下的消息确认合并成一帧放到队尾
+			PushAcks();
+			//平滑升级中不再继续发送，写操作停下来后再取消读
+			if (_b_handoff) {
+				_b_write_parked = true;
+				CancelRead();
+				return;
+			}
+
 			if (!_send_que.empty()) {
 				auto& msgnode = _send_que.front();
 				boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
@@ -199,38 +333,184 @@ void CSession::HandleWrite(const boost::system::error_code& error, std::shared_p
 	
 }
 
-//ȡ
+//读取完整长度
 void CSession::asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code&, std::size_t)> handler )
 {
+	//从交接的半包恢复时，_data中已经有部分数据
+	if (_resume_len > 0) {
+		auto read_len = _resume_len;
+		_resume_len = 0;
+		asyncReadLen(read_len, maxLength, handler);
+		return;
+	}
+
 	::memset(_data, 0, MAX_LENGTH);
 	asyncReadLen(0, maxLength, handler);
 }
 
-//ȡָֽ
+//读取指定字节数
 void CSession::asyncReadLen(std::size_t read_len, std::size_t total_len, 
 	std::function<void(const boost::system::error_code&, std::size_t)> handler)
 {
 	auto self = shared_from_this();
+	//平滑升级中不再发起新的读操作，按取消处理
+	if (_b_handoff) {
+		handler(boost::asio::error::operation_aborted, read_len);
+		return;
+	}
+
 	_socket.async_read_some(boost::asio::buffer(_data + read_len, total_len-read_len),
 		[read_len, total_len, handler, self](const boost::system::error_code& ec, std::size_t  bytesTransfered) {
 			if (ec) {
-				// ִ󣬵ûص
+				// 出现错误，调用回调函数
 				handler(ec, read_len + bytesTransfered);
 				return;
 			}
 
 			if (read_len + bytesTransfered >= total_len) {
-				//ȹ˾͵ûص
+				//长度够了就调用回调函数
 				handler(ec, read_len + bytesTransfered);
 				return;
 			}
 
-			// ûдҳȲȡ
+			// 没有错误，且长度不足则继续读取
 			self->asyncReadLen(read_len + bytesTransfered, total_len, handler);
 	});
 }
 
-LogicNode::LogicNode(shared_ptr<CSession>  session, 
-	shared_ptr<RecvNode> recvnode):_session(session),_recvnode(recvnode) {
-	
+void CSession::PrepareHandoff() {
+	{
+		std::lock_guard<std::mutex> lock(_send_lock);
+		_b_handoff = true;
+		// 发送队列不为空说明还有写操作在进行，等HandleWrite写完当前节点再取消读
+		// 因为cancel会同时取消读和写，写到一半的节点无法交接
+		_b_write_parked = _send_que.empty();
+		if (!_b_write_parked) {
+			return;
+		}
+	}
+
+	CancelRead();
+}
+
+bool CSession::IsParked() {
+	std::lock_guard<std::mutex> lock(_send_lock);
+	return _b_read_parked && _b_write_parked;
+}
+
+void CSession::CancelRead() {
+	auto self = shared_from_this();
+	// socket不是线程安全的，投递到会话所在的io_context上执行
+	boost::asio::post(_socket.get_executor(), [self, this]() {
+		boost::system::error_code ec;
+		_socket.cancel(ec);
+	});
+}
+
+void CSession::ParkRead(std::size_t bytes_transfered, bool b_body) {
+	_handoff_partial.clear();
+	if (b_body) {
+		// 消息头已经解析过了，连同消息头一起保存
+		_handoff_partial.append(_recv_head_node->_data, HEAD_TOTAL_LEN);
+	}
+	_handoff_partial.append(_data, bytes_transfered);
+	_b_read_parked = true;
+}
+
+Json::Value CSession::DumpHandoff() {
+	Json::Value state;
+	state["session_id"] = _session_id;
+	state["uid"] = _user_uid;
+	state["partial"] = HandoffMgr::HexEncode(_handoff_partial);
+	state["compress"] = _b_compress.load();
+	state["compress_dict"] = _b_compress_dict.load();
+	state["send_que"] = Json::arrayValue;
+
+	std::lock_guard<std::mutex> lock(_send_lock);
+	// 冻结期间攒下的确认也一起交给新进程
+	PushAcks();
+	auto send_que = _send_que;
+	while (!send_que.empty()) {
+		auto& msgnode = send_que.front();
+		short msg_id = 0;
+		memcpy(&msg_id, msgnode->_data, HEAD_ID_LEN);
+		msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+
+		Json::Value msg;
+		msg["id"] = msg_id;
+		msg["data"] = HandoffMgr::HexEncode(std::string(msgnode->_data + HEAD_TOTAL_LEN,
+			msgnode->_total_len - HEAD_TOTAL_LEN));
+		state["send_que"].append(msg);
+		send_que.pop();
+	}
+
+	return state;
+}
+
+void CSession::LoadHandoff(const Json::Value& state) {
+	_session_id = state["session_id"].asString();
+	_user_uid = state["uid"].asInt();
+	_handoff_partial = HandoffMgr::HexDecode(state["partial"].asString());
+	_b_compress = state["compress"].asBool();
+	_b_compress_dict = state["compress_dict"].asBool();
+
+	std::lock_guard<std::mutex> lock(_send_lock);
+	// Resume之前保持冻结，防止其他线程Send时提前发起写操作
+	_b_handoff = true;
+	_b_read_parked = true;
+	_b_write_parked = true;
+	for (auto& msg : state["send_que"]) {
+		auto data = HandoffMgr::HexDecode(msg["data"].asString());
+		_send_que.push(make_shared<SendNode>(data.c_str(), data.length(), msg["id"].asInt()));
+	}
+}
+
+void CSession::Resume() {
+	auto self = shared_from_this();
+	boost::asio::post(_socket.get_executor(), [self, this]() {
+		{
+			std::lock_guard<std::mutex> lock(_send_lock);
+			_b_handoff = false;
+			// 写操作已经停下来的才需要重新发起，否则HandleWrite会接着发送队列中的数据
+			if (_b_write_parked && !_send_que.empty()) {
+				auto& msgnode = _send_que.front();
+				boost::asio::async_write(_socket, boost::asio::buffer(msgnode->_data, msgnode->_total_len),
+					std::bind(&CSession::HandleWrite, this, std::placeholders::_1, SharedSelf()));
+			}
+			_b_write_parked = false;
+		}
+
+		if (_b_read_parked) {
+			_b_read_parked = false;
+			ResumeRead();
+		}
+	});
+}
+
+void CSession::ResumeRead() {
+	auto partial = std::move(_handoff_partial);
+	_handoff_partial.clear();
+
+	// 消息头还没读完，继续读消息头
+	if (partial.size() < HEAD_TOTAL_LEN) {
+		::memset(_data, 0, MAX_LENGTH);
+		memcpy(_data, partial.data(), partial.size());
+		_resume_len = partial.size();
+		AsyncReadHead(HEAD_TOTAL_LEN);
+		return;
+	}
+
+	// 消息头已经读完，恢复消息头并继续读消息体
+	_recv_head_node->Clear();
+	memcpy(_recv_head_node->_data, partial.data(), HEAD_TOTAL_LEN);
+
+	short msg_id = 0;
+	short msg_len = 0;
+	ParseMsgHead(_recv_head_node->_data, msg_id, msg_len);
+
+	_recv_msg_node = make_shared<RecvNode>(msg_len, msg_id);
+	::memset(_data, 0, MAX_LENGTH);
+	memcpy(_data, partial.data() + HEAD_TOTAL_LEN, partial.size() - HEAD_TOTAL_LEN);
+	_resume_len = partial.size() - HEAD_TOTAL_LEN;
+	AsyncReadBody(msg_len);
 }
@@ -8,6 +8,9 @@
 #include <queue>
 #include <mutex>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <json/json.h>
 #include "const.h"
 #include "MsgNode.h"
 using namespace std;
@@ -38,7 +41,30 @@ public:
 	std::shared_ptr<CSession> SharedSelf();
 	void AsyncReadBody(int length);
 	void AsyncReadHead(int total_len);
+	// 平滑升级：冻结读写，当前的写操作完成后取消读
+	void PrepareHandoff();
+	// 读写是否都已经停下来
+	bool IsParked();
+	// 导出会话状态(会话id、uid、半包、发送队列)交给新进程
+	Json::Value DumpHandoff();
+	// 新进程根据旧进程导出的状态恢复会话
+	void LoadHandoff(const Json::Value& state);
+	// 恢复读写
+	void Resume();
+	// 登录时协商压缩，b_dict表示客户端和服务器的字典一致
+	void SetCompress(bool b_dict);
+	// 发送消息确认，一次写操作期间产生的确认合并成一帧发送
+	void SendAck(const std::string& msgid, long long seq, long long ts);
 private:
+	// 把攒下的确认打包成一帧放入发送队列，调用方持有_send_lock
+	void PushAcks();
+	std::shared_ptr<SendNode> MakeSendNode(const char* msg, short max_length, short msgid);
+	// 取消正在进行的读操作
+	void CancelRead();
+	// 读操作被取消时保存已经读到的半包
+	void ParkRead(std::size_t bytes_transfered, bool b_body);
+	// 从保存的半包继续读取
+	void ResumeRead();
 	void asyncReadFull(std::size_t maxLength, std::function<void(const boost::system::error_code& , std::size_t)> handler);
 	void asyncReadLen(std::size_t  read_len, std::size_t total_len,
 		std::function<void(const boost::system::error_code&, std::size_t)> handler);
@@ -52,19 +78,40 @@ private:
 	bool _b_close;
 	std::queue<shared_ptr<SendNode> > _send_que;
 	std::mutex _send_lock;
-	//յϢṹ
+	//收到的消息结构
 	std::shared_ptr<RecvNode> _recv_msg_node;
 	bool _b_head_parse;
-	//յͷṹ
+	//收到的头部结构
 	std::shared_ptr<MsgNode> _recv_head_node;
 	int _user_uid;
+
+	// 平滑升级中，读写冻结
+	std::atomic<bool> _b_handoff;
+	// 读操作已经停止
+	std::atomic<bool> _b_read_parked;
+	// 写操作已经停止，受_send_lock保护
+	bool _b_write_parked;
+	// 冻结时未读完的半包(包含已读到的消息头)
+	std::string _handoff_partial;
+	// 恢复读取时_data中已有的字节数
+	std::size_t _resume_len;
+	// 客户端支持解压缩
+	std::atomic<bool> _b_compress;
+	// 客户端加载了相同的字典
+	std::atomic<bool> _b_compress_dict;
+	// 等待合并发送的消息确认，受_send_lock保护
+	Json::Value _pending_acks;
 };
 
 class LogicNode {
-	friend class LogicSystem;
+	friend class LogicQueue;
 public:
-	LogicNode(shared_ptr<CSession>, shared_ptr<RecvNode>);
+	LogicNode(shared_ptr<CSession>, shared_ptr<RecvNode>, uint64_t trace_id = 0);
 private:
 	shared_ptr<CSession> _session;
 	shared_ptr<RecvNode> _recvnode;
+	// 投递到逻辑队列的时间，用于统计排队等待时间
+	std::chrono::steady_clock::time_point _enqueue_time;
+	// 帧头带过来或者抽样生成的trace id，为0表示不追踪
+	uint64_t _trace_id;
 };
@@ -5,64 +5,147 @@
 
 #include "CSession.h"
 #include "MysqlMgr.h"
+#include "MetricsMgr.h"
+#include "BrokerChannel.h"
+
+// 对端通道的默认参数
+#define PEER_DEFAULT_DEADLINE_MS  500
+#define PEER_DEFAULT_MAX_INFLIGHT  1000
+#define PEER_DEFAULT_BREAKER_FAILURES  5
+#define PEER_DEFAULT_BREAKER_OPEN_MS  5000
+#define PEER_DEFAULT_BATCH_SIZE  256
+#define PEER_DEFAULT_BATCH_BYTES  65536
+#define PEER_DEFAULT_FLUSH_US  200
+// broker模式下追加收件箱的连接数
+#define BROKER_PUBLISH_CONNECTIONS  2
+
+static int CfgIntOr(const std::string& key, int def) {
+	auto value = ConfigMgr::Inst()["PeerServer"][key];
+	return value.empty() ? def : atoi(value.c_str());
+}
 
 ChatGrpcClient::ChatGrpcClient()
 {
 	auto& cfg = ConfigMgr::Inst();
-	auto server_list = cfg["PeerServer"]["Servers"];
-
-	std::vector<std::string> words;
+	_config._batch_size = (std::max)(CfgIntOr("BatchSize", PEER_DEFAULT_BATCH_SIZE), 1);
+	_config._batch_bytes = (std::max)(CfgIntOr("BatchBytes", PEER_DEFAULT_BATCH_BYTES), 1);
+	_config._flush_us = (std::max)(CfgIntOr("FlushUs", PEER_DEFAULT_FLUSH_US), 0);
+	// 流上没有单次调用的超时，DeadlineMs用作确认超时
+	_config._ack_timeout_ms = CfgIntOr("DeadlineMs", PEER_DEFAULT_DEADLINE_MS);
+	_config._max_pending = (std::max)(CfgIntOr("MaxInflight", PEER_DEFAULT_MAX_INFLIGHT), 1);
+	_config._breaker_failures = CfgIntOr("BreakerFailures", PEER_DEFAULT_BREAKER_FAILURES);
+	_config._breaker_open_ms = CfgIntOr("BreakerOpenMs", PEER_DEFAULT_BREAKER_OPEN_MS);
+	_self_name = cfg["SelfServer"]["Name"];
+	_fallback_count = MetricsMgr::GetInstance()->GetCounter("chat_peer_fallback_total");
+	std::atomic_store(&_peers, std::shared_ptr<const PeerMap>(std::make_shared<PeerMap>()));
+	if (cfg["PeerServer"]["Transport"] == "broker") {
+		_broker_store = RedisMgr::GetInstance()->OpenStore(BROKER_PUBLISH_CONNECTIONS);
+		std::cout << "peer transport: broker" << std::endl;
+	}
 
-	std::stringstream ss(server_list);
-	std::string word;
+	// 订阅时立即按当前成员表打开通道
+	MembershipMgr::GetInstance()->Subscribe([this](std::shared_ptr<const Membership> members) {
+		UpdatePeers(members);
+	});
+}
 
-	while (std::getline(ss, word, ',')) {
-		words.push_back(word);
+ChatGrpcClient::~ChatGrpcClient() {
+	// 每个通道发完积压的事件并等对端确认后再退出
+	auto peers = std::atomic_load(&_peers);
+	for (auto& peer : *peers) {
+		peer.second._channel->Stop();
 	}
+}
 
-	for (auto& word : words) {
-		if (cfg[word]["Name"].empty()) {
+void ChatGrpcClient::UpdatePeers(std::shared_ptr<const Membership> members) {
+	auto current = std::atomic_load(&_peers);
+	auto next = std::make_shared<PeerMap>();
+	for (auto& item : members->_servers) {
+		auto& info = item.second;
+		if (info.name() == _self_name) {
+			continue;
+		}
+		// 地址没变的对端沿用原来的通道，流和未确认的事件不受影响；broker模式下地址就是对端的收件箱
+		auto address = _broker_store ? PEER_INBOX_PREFIX + info.name() : info.rpc_host() + ":" + info.rpc_port();
+		auto find_iter = current->find(info.name());
+		if (find_iter != current->end() && find_iter->second._address == address) {
+			(*next)[info.name()] = find_iter->second;
 			continue;
 		}
-		_pools[cfg[word]["Name"]] = std::make_unique<ChatConPool>(5, cfg[word]["Host"], cfg[word]["Port"]);
+		// 换了地址的对端先把旧通道发完再建新通道：两个通道共用seq，旧通道后发出的小seq会被对端当成重复丢掉
+		if (find_iter != current->end()) {
+			find_iter->second._channel->Stop();
+		}
+		std::cout << "open peer [" << info.name() << "] " << address << std::endl;
+		PeerEntry entry;
+		entry._address = address;
+		auto fallback = [this](PeerEventItem& item) {
+			OnFallback(item);
+		};
+		if (_broker_store) {
+			entry._channel = std::make_shared<BrokerChannel>(_self_name, info.name(), _broker_store, _config, fallback);
+		}
+		else {
+			entry._channel = std::make_shared<PeerChannel>(_self_name, info.name(), info.rpc_host(), info.rpc_port(),
+				_config, fallback);
+		}
+		(*next)[info.name()] = entry;
 	}
 
-}
+	std::vector<std::shared_ptr<PeerSender>> removed;
+	for (auto& item : *current) {
+		auto find_iter = next->find(item.first);
+		if (find_iter == next->end() || find_iter->second._channel != item.second._channel) {
+			std::cout << "close peer [" << item.first << "] " << item.second._address << std::endl;
+			removed.push_back(item.second._channel);
+		}
+	}
+	std::atomic_store(&_peers, std::shared_ptr<const PeerMap>(next));
 
-AddFriendRsp ChatGrpcClient::NotifyAddFriend(std::string server_ip, const AddFriendReq& req)
-{
-	AddFriendRsp rsp;
-	Defer defer([&rsp, &req]() {
-		rsp.set_error(ErrorCodes::Success);
-		rsp.set_applyuid(req.applyuid());
-		rsp.set_touid(req.touid());
-		});
-
-	auto find_iter = _pools.find(server_ip);
-	if (find_iter == _pools.end()) {
-		return rsp;
+	// 新的通道表发布后不会再有调用方拿到这些通道；已经拿到的调用方在Stop之后投递的事件走降级
+	for (auto& channel : removed) {
+		channel->Stop();
 	}
-	
-	auto &pool = find_iter->second;
-	ClientContext context;
-	auto stub = pool->getConnection();
-	Status status = stub->NotifyAddFriend(&context, req, &rsp);
-	Defer defercon([&stub, this, &pool]() {
-		pool->returnConnection(std::move(stub));
-		});
-
-	if (!status.ok()) {
-		rsp.set_error(ErrorCodes::RPCFailed);
-		return rsp;
+}
+
+std::shared_ptr<PeerSender> ChatGrpcClient::FindChannel(const std::string& server_ip, const char* method) {
+	auto peers = std::atomic_load(&_peers);
+	auto find_iter = peers->find(server_ip);
+	if (find_iter == peers->end()) {
+		std::cout << method << " unknown peer [" << server_ip << "]" << std::endl;
+		return nullptr;
 	}
+	return find_iter->second._channel;
+}
 
-	return rsp;
+void ChatGrpcClient::OnFallback(PeerEventItem& item) {
+	if (item._event.body_case() == message::PeerEvent::kTextMsg) {
+		std::cout << "notify text msg uid " << item._touid << " fallback to offline" << std::endl;
+		SaveOfflineText(item._touid, item._offline);
+		return;
+	}
+	_fallback_count->fetch_add(1, std::memory_order_relaxed);
+	std::cout << "notify uid " << item._touid << " dropped, synced at login" << std::endl;
 }
 
+//对端不可用时不需要额外处理，申请已经写入mysql和同步日志，接收方登录时增量同步
+void ChatGrpcClient::NotifyAddFriend(std::string server_ip, const AddFriendReq& req)
+{
+	auto channel = FindChannel(server_ip, "NotifyAddFriend");
+	if (channel == nullptr) {
+		_fallback_count->fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	PeerEventItem item;
+	*item._event.mutable_add_friend() = req;
+	item._touid = req.touid();
+	channel->Post(std::move(item));
+}
 
 bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
 {
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -81,8 +164,8 @@ bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<
 			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
 	}
 	else {
-		//redisûѯmysql
-		//ѯݿ
+		//redis中没有则查询mysql
+		//查询数据库
 		std::shared_ptr<UserInfo> user_info = nullptr;
 		user_info = MysqlMgr::GetInstance()->GetUser(uid);
 		if (user_info == nullptr) {
@@ -91,7 +174,7 @@ bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<
 
 		userinfo = user_info;
 
-		//ݿдredis
+		//将数据库内容写入redis缓存
 		Json::Value redis_root;
 		redis_root["uid"] = uid;
 		redis_root["pwd"] = userinfo->pwd;
@@ -106,70 +189,42 @@ bool ChatGrpcClient::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<
 
 }
 
-AuthFriendRsp ChatGrpcClient::NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req) {
-	AuthFriendRsp rsp;
-	rsp.set_error(ErrorCodes::Success);
-
-	Defer defer([&rsp, &req]() {
-		rsp.set_fromuid(req.fromuid());
-		rsp.set_touid(req.touid());
-		});
-
-	auto find_iter = _pools.find(server_ip);
-	if (find_iter == _pools.end()) {
-		return rsp;
+void ChatGrpcClient::NotifyAuthFriend(std::string server_ip, const AuthFriendReq& req) {
+	auto channel = FindChannel(server_ip, "NotifyAuthFriend");
+	if (channel == nullptr) {
+		_fallback_count->fetch_add(1, std::memory_order_relaxed);
+		return;
 	}
 
-	auto& pool = find_iter->second;
-	ClientContext context;
-	auto stub = pool->getConnection();
-	Status status = stub->NotifyAuthFriend(&context, req, &rsp);
-	Defer defercon([&stub, this, &pool]() {
-		pool->returnConnection(std::move(stub));
-		});
-
-	if (!status.ok()) {
-		rsp.set_error(ErrorCodes::RPCFailed);
-		return rsp;
-	}
-
-	return rsp;
+	PeerEventItem item;
+	*item._event.mutable_auth_friend() = req;
+	item._touid = req.touid();
+	channel->Post(std::move(item));
 }
 
-TextChatMsgRsp ChatGrpcClient::NotifyTextChatMsg(std::string server_ip, 
-	const TextChatMsgReq& req, const Json::Value& rtvalue) {
-	
-	TextChatMsgRsp rsp;
-	rsp.set_error(ErrorCodes::Success);
-
-	Defer defer([&rsp, &req]() {
-		rsp.set_fromuid(req.fromuid());
-		rsp.set_touid(req.touid());
-		for (const auto& text_data : req.textmsgs()) {
-			TextChatData* new_msg = rsp.add_textmsgs();
-			new_msg->set_msgid(text_data.msgid());
-			new_msg->set_msgcontent(text_data.msgcontent());
-		}
-		
-		});
-
-	auto find_iter = _pools.find(server_ip);
-	if (find_iter == _pools.end()) {
-		return rsp;
+//对端熔断、积压过多或者没有等到确认时写入接收方的离线消息列表，登录时下发
+void ChatGrpcClient::NotifyTextChatMsg(std::string server_ip, const TextChatMsgReq& req, const Json::Value& rtvalue) {
+	auto channel = FindChannel(server_ip, "NotifyTextChatMsg");
+	if (channel == nullptr) {
+		SaveOfflineText(req.touid(), rtvalue);
+		return;
 	}
 
-	auto& pool = find_iter->second;
-	ClientContext context;
-	auto stub = pool->getConnection();
-	Status status = stub->NotifyTextChatMsg(&context, req, &rsp);
-	Defer defercon([&stub, this, &pool]() {
-		pool->returnConnection(std::move(stub));
-		});
-
-	if (!status.ok()) {
-		rsp.set_error(ErrorCodes::RPCFailed);
-		return rsp;
-	}
+	PeerEventItem item;
+	*item._event.mutable_text_msg() = req;
+	item._touid = req.touid();
+	item._offline = rtvalue;
+	channel->Post(std::move(item));
+}
 
-	return rsp;
-}
\ No newline at end of file
+void ChatGrpcClient::SaveOfflineText(int touid, const Json::Value& rtvalue) {
+	_fallback_count->fetch_add(1, std::memory_order_relaxed);
+	auto key = OFFLINE_MSG_PREFIX + std::to_string(touid);
+	auto redis = RedisMgr::GetInstance();
+	if (!redis->RPush(key, rtvalue.toStyledString())) {
+		std::cout << "save offline msg of uid " << touid << " failed" << std::endl;
+		return;
+	}
+	// 接收方长时间不登录时只保留最近的MAX_OFFLINE_MSG条
+	redis->LTrim(key, -MAX_OFFLINE_MSG, -1);
+}
@@ -10,6 +10,21 @@
 #include "ConfigMgr.h"
 #include "RedisMgr.h"
 #include "ChatServiceImpl.h"
+#include "HandoffMgr.h"
+#include "DrainMgr.h"
+#include "FileServer.h"
+#include "FileBench.h"
+#include "BlobStore.h"
+#include "CompressMgr.h"
+#include "CompressBench.h"
+#include "RpcBench.h"
+#include "RouteBench.h"
+#include "PeerInbox.h"
+#include "MembershipMgr.h"
+#include "ChatGrpcClient.h"
+#include "MetricsMgr.h"
+#include "TraceMgr.h"
+#include <sstream>
 
 using namespace std;
 bool bstop = false;
@@ -22,37 +37,203 @@ int main()
 	auto server_name = cfg["SelfServer"]["Name"];
 	try {
 		auto pool = AsioIOServicePool::GetInstance();
-		//将登录数设置为0
-		RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name,"0");
+
+		//平滑升级：如果旧进程还在运行，接管它的监听socket和所有会话
+		int listen_fd = -1;
+		std::vector<int> session_fds;
+		Json::Value handoff_state;
+		bool b_old_found = false;
+		bool b_takeover = HandoffMgr::GetInstance()->TakeOver(listen_fd, session_fds, handoff_state, b_old_found);
+		//收到socket后立即确认并等旧进程提交，旧进程超时恢复会话时本进程退出
+		if (b_takeover && !HandoffMgr::GetInstance()->AckTakeOver(listen_fd, session_fds)) {
+			RedisMgr::GetInstance()->Close();
+			return EXIT_FAILURE;
+		}
+		if (!b_takeover && b_old_found) {
+			std::cout << "take over failed, old server keeps serving" << std::endl;
+			RedisMgr::GetInstance()->Close();
+			return EXIT_FAILURE;
+		}
+
+		//将登录数设置为0，接管时沿用旧进程的登录数
+		if (!b_takeover) {
+			RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, "0");
+			//重新启动的服务器可以正常分配用户
+			RedisMgr::GetInstance()->HDel(DRAIN_SERVERS, server_name);
+		}
+
+		if (RedisMgr::GetInstance()->IsMemory()) {
+			int seed_users = atoi(cfg["Storage"]["SeedUsers"].c_str());
+			int uid_start = atoi(cfg["Storage"]["SeedUidStart"].c_str());
+			auto token_prefix = cfg["Storage"]["SeedTokenPrefix"];
+			for (int i = 0; i < seed_users; ++i) {
+				auto uid_str = std::to_string(uid_start + i);
+				RedisMgr::GetInstance()->Set(USERTOKENPREFIX + uid_str, token_prefix + uid_str);
+			}
+		}
 
 		//定义一个GrpcServer
 
 		std::string server_address(cfg["SelfServer"]["Host"] + ":" + cfg["SelfServer"]["RPCPort"]);
 		ChatServiceImpl service;
-		grpc::ServerBuilder builder;
-		// 监听端口和添加服务
-		builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-		builder.RegisterService(&service);
-		// 构建并启动gRPC服务器
-		std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-		std::cout << "RPC Server listening on " << server_address << std::endl;
+		// 异步gRPC服务，完成队列、轮询线程和工作线程数在 [Grpc] 中配置
+		AsyncRpcServer rpc_server;
+		if (!rpc_server.Start(server_address, service.GetService())) {
+			RedisMgr::GetInstance()->Close();
+			return EXIT_FAILURE;
+		}
+		service.Serve(rpc_server);
+		MetricsMgr::GetInstance()->Start();
 
 		//单独启动一个线程处理grpc服务
-		std::thread  grpc_server_thread([&server]() {
-				server->Wait();
+		std::thread  grpc_server_thread([&rpc_server]() {
+				rpc_server.Wait();
 			});
 
 		boost::asio::io_context  io_context;
 		boost::asio::signal_set signals(io_context, SIGINT, SIGTERM);
-		signals.async_wait([&io_context, pool, &server](auto, auto) {
+		signals.async_wait([&io_context, pool, &rpc_server](auto, auto) {
 			io_context.stop();
 			pool->Stop();
-			server->Shutdown();
+			rpc_server.Shutdown();
+			});
+
+#ifdef SIGUSR1
+		//Linux下收到SIGUSR1开始排空，把在线用户分批迁移到其他服务器
+		boost::asio::signal_set drain_signals(io_context, SIGUSR1);
+		drain_signals.async_wait([](auto, auto) {
+			DrainMgr::GetInstance()->Drain();
 			});
+#endif
+		//文件传输使用单独的端口和io线程
+		auto file_port = atoi(cfg["FileServer"]["Port"].c_str());
+		auto file_path = cfg["FileServer"]["Path"];
+		std::unique_ptr<FileServer> file_server;
+		if (file_port > 0) {
+			file_server = std::make_unique<FileServer>(file_port, file_path,
+				atoi(cfg["FileServer"]["Threads"].c_str()));
+			BlobStore::GetInstance()->Start();
+		}
+
+		//控制台输入drain开始排空，输入filebench [MB] [KB]测试文件传输吞吐量，输入blobstat查看去重率，
+		//输入traindict用抽样的帧训练压缩字典，输入compressbench [级别]测试压缩率和耗时
+		//输入rpcbench [p99毫秒] [chat|status]测试固定p99下的RPC吞吐量，输入members查看当前成员表
+		//输入routebench [每个节点的事件数] [mesh|broker|all]对比网格和broker两种跨服务器路由
+		std::thread([file_port, file_path]() {
+			std::string cmd;
+			while (std::getline(std::cin, cmd)) {
+				std::istringstream iss(cmd);
+				std::string name;
+				iss >> name;
+				if (name == "drain") {
+					DrainMgr::GetInstance()->Drain();
+				}
+				else if (name == "filebench" && file_port > 0) {
+					long long total_mb = 100, chunk_kb = 1024;
+					iss >> total_mb >> chunk_kb;
+					FileBench::Run(file_port, file_path, total_mb, chunk_kb);
+				}
+				else if (name == "blobstat" && file_port > 0) {
+					long long logical = 0, physical = 0;
+					double ratio = BlobStore::GetInstance()->DedupRatio(logical, physical);
+					std::cout << "blob store logical bytes " << logical << ", physical bytes " << physical
+						<< ", dedup ratio " << ratio << std::endl;
+				}
+				else if (name == "traindict") {
+					CompressMgr::GetInstance()->TrainDict();
+				}
+				else if (name == "compressbench") {
+					int level = CompressMgr::GetInstance()->GetLevel();
+					iss >> level;
+					CompressBench::Run(level);
+				}
+				else if (name == "rpcbench") {
+					int p99_ms = 10;
+					std::string target = "chat";
+					iss >> p99_ms >> target;
+					RpcBench::Run(p99_ms, target);
+				}
+				else if (name == "routebench") {
+					int events = 10000;
+					std::string mode = "all";
+					iss >> events >> mode;
+					RouteBench::Run(events, mode);
+				}
+				else if (name == "members") {
+					auto members = MembershipMgr::GetInstance()->Snapshot();
+					std::cout << "membership version " << members->_version << std::endl;
+					for (auto& item : members->_servers) {
+						std::cout << item.first << " client " << item.second.host() << ":" << item.second.port()
+							<< " rpc " << item.second.rpc_host() << ":" << item.second.rpc_port() << std::endl;
+					}
+				}
+			}
+			}).detach();
+
 		auto port_str = cfg["SelfServer"]["Port"];
-		CServer s(io_context, atoi(port_str.c_str()));
+		std::shared_ptr<CServer> s;
+		if (b_takeover) {
+			s = std::make_shared<CServer>(io_context, atoi(port_str.c_str()), listen_fd);
+			s->ResumeSessions(session_fds, handoff_state);
+		}
+		else {
+			s = std::make_shared<CServer>(io_context, atoi(port_str.c_str()));
+		}
+
+		//broker模式下从本服务器的收件箱读取对端的通知
+		std::unique_ptr<PeerInbox> inbox;
+		if (cfg["PeerServer"]["Transport"] == "broker") {
+			inbox = std::make_unique<PeerInbox>(server_name, RedisMgr::GetInstance()->OpenStore(1),
+				[&service](const message::PeerBatch& batch) {
+				message::PeerAck ack;
+				service.DeliverBatch(nullptr, batch, &ack);
+			});
+			inbox->Start();
+		}
+
+		//交接会话前停止处理对端通知，收件箱留给新进程，流上后到的批次拒绝
+		s->SetHandoffHooks([&service, &inbox]() {
+			if (inbox) {
+				inbox->Stop();
+			}
+			service.PauseDelivery();
+			}, [&service, &inbox]() {
+			service.ResumeDelivery();
+			if (inbox) {
+				inbox->Start();
+			}
+			});
+
+		//等待下一次升级，连接交给新进程后和收到退出信号一样停止服务
+		HandoffMgr::GetInstance()->Listen(s.get(), [&io_context, pool, &rpc_server]() {
+			io_context.stop();
+			pool->Stop();
+			rpc_server.Shutdown();
+			});
+
+		//CServer开始监听后再注册，对端通道随成员表变化打开和关闭
+		MembershipMgr::GetInstance()->Start();
+		ChatGrpcClient::GetInstance();
+
 		io_context.run();
-		RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
+		if (inbox) {
+			inbox->Stop();
+		}
+		//连接交给新进程时不注销，由新进程继续心跳
+		MembershipMgr::GetInstance()->Stop(!HandoffMgr::GetInstance()->IsHandedOff());
+		if (file_server) {
+			file_server->Stop();
+			BlobStore::GetInstance()->Stop();
+		}
+		HandoffMgr::GetInstance()->Stop();
+		DrainMgr::GetInstance()->Stop();
+		MetricsMgr::GetInstance()->Stop();
+		TraceMgr::GetInstance()->Stop();
+		//连接交给新进程时登录数由新进程继续维护
+		if (!HandoffMgr::GetInstance()->IsHandedOff()) {
+			RedisMgr::GetInstance()->HDel(LOGIN_COUNT, server_name);
+			RedisMgr::GetInstance()->HDel(DRAIN_SERVERS, server_name);
+		}
 		RedisMgr::GetInstance()->Close();
 		grpc_server_thread.join();
 	}
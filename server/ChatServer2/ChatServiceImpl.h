@@ -2,8 +2,12 @@
 #include <grpcpp/grpcpp.h>
 #include "message.grpc.pb.h"
 #include "message.pb.h"
+#include <map>
 #include <mutex>
+#include <condition_variable>
 #include "data.h"
+#include "MetricsMgr.h"
+#include "AsyncRpcServer.h"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -19,23 +23,55 @@ using message::ChatService;
 using message::TextChatMsgReq;
 using message::TextChatMsgRsp;
 using message::TextChatData;
+using message::PeerEvent;
+using message::PeerBatch;
+using message::PeerAck;
 
 
-class ChatServiceImpl final: public ChatService::Service
+// 请求由AsyncRpcServer的完成队列接收，处理函数在它的工作线程上执行
+class ChatServiceImpl final
 {
 public:
 	ChatServiceImpl();
+	ChatService::AsyncService* GetService() { return &_service; }
+	void Serve(AsyncRpcServer& server);
 	Status NotifyAddFriend(ServerContext* context, const AddFriendReq* request,
-		AddFriendRsp* reply) override;
+		AddFriendRsp* reply);
 
 	Status NotifyAuthFriend(ServerContext* context, 
-		const AuthFriendReq* request, AuthFriendRsp* response) override;
+		const AuthFriendReq* request, AuthFriendRsp* response);
 
 	Status NotifyTextChatMsg(::grpc::ServerContext* context, 
-		const TextChatMsgReq* request, TextChatMsgRsp* response) override;
+		const TextChatMsgReq* request, TextChatMsgRsp* response);
+
+	//暂停投递时整批不处理，返回false
+	bool DeliverBatch(ServerContext* context, const PeerBatch& batch, PeerAck* ack);
+
+	//平滑升级导出会话前暂停处理对端通知，等在途的处理完再返回
+	void PauseDelivery();
+	void ResumeDelivery();
 
 	bool GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo);
 
 private:
+	ChatService::AsyncService _service;
+
+	// 每个RPC的延迟统计，等待时间是请求到达到工作线程开始处理
+	LatencyMetric* _add_friend_metric;
+	LatencyMetric* _auth_friend_metric;
+	LatencyMetric* _text_chat_metric;
+
+	friend class DeliveryScope;
+	bool EnterDelivery();
+	void LeaveDelivery();
+	std::mutex _delivery_mutex;
+	std::condition_variable _delivery_cond;
+	bool _b_delivery_paused;
+	int _delivering;
+
+	bool AcceptSeq(const std::string& from_server, uint64_t epoch, uint64_t seq);
+	std::mutex _seq_mutex;
+	// 每个对端服务的(epoch, 已处理的最大seq)
+	std::map<std::string, std::pair<uint64_t, uint64_t>> _peer_seqs;
 };
 
@@ -0,0 +1,57 @@
+#include "CircuitBreaker.h"
+#include <iostream>
+
+CircuitBreaker::CircuitBreaker(const std::string& name, int failures, int open_ms)
+	: _name(name), _failures(failures > 0 ? failures : 1), _open_time(open_ms > 0 ? open_ms : 1),
+	_state(CLOSED), _fail_count(0), _b_probing(false) {
+}
+
+bool CircuitBreaker::Allow() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_state == CLOSED) {
+		return true;
+	}
+
+	if (_state == OPEN) {
+		if (std::chrono::steady_clock::now() < _open_until) {
+			return false;
+		}
+		_state = HALF_OPEN;
+		_b_probing = false;
+		std::cout << "peer [" << _name << "] breaker half open" << std::endl;
+	}
+
+	// 半开状态同一时间只放行一个探测调用
+	if (_b_probing) {
+		return false;
+	}
+	_b_probing = true;
+	return true;
+}
+
+void CircuitBreaker::OnSuccess() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_state != CLOSED) {
+		std::cout << "peer [" << _name << "] breaker closed" << std::endl;
+	}
+	_state = CLOSED;
+	_fail_count = 0;
+	_b_probing = false;
+}
+
+void CircuitBreaker::OnFailure() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	++_fail_count;
+	// 半开时探测失败立即重新熔断，关闭状态下累计到阈值才熔断
+	if (_state == HALF_OPEN || (_state == CLOSED && _fail_count >= _failures)) {
+		_state = OPEN;
+		_open_until = std::chrono::steady_clock::now() + _open_time;
+		_b_probing = false;
+		std::cout << "peer [" << _name << "] breaker open after " << _fail_count << " failures" << std::endl;
+	}
+}
+
+CircuitBreaker::State CircuitBreaker::GetState() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _state;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <string>
+
+// CircuitBreaker：对端服务的熔断器，发起调用前Allow，调用结束后OnSuccess/OnFailure
+// 连续失败failures次后熔断(Open)，open_ms毫秒内的调用直接走降级；
+// 到期后进入半开(HalfOpen)只放行一个探测调用，探测成功恢复(Closed)，失败重新熔断
+class CircuitBreaker
+{
+public:
+	enum State {
+		CLOSED = 0,
+		OPEN = 1,
+		HALF_OPEN = 2,
+	};
+
+	CircuitBreaker(const std::string& name, int failures, int open_ms);
+	bool Allow();
+	void OnSuccess();
+	void OnFailure();
+	State GetState();
+private:
+	std::string _name;
+	int _failures;
+	std::chrono::milliseconds _open_time;
+	std::mutex _mutex;
+	State _state;
+	int _fail_count;
+	std::chrono::steady_clock::time_point _open_until;
+	// 半开时已经放出去的探测调用还没有结果
+	bool _b_probing;
+};
@@ -0,0 +1,205 @@
+#include "CompressBench.h"
+#include "CompressMgr.h"
+#include "const.h"
+#include <json/json.h>
+#include <zstd.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <string>
+
+//使用真实抽样时要求的最少样本数
+#define BENCH_MIN_SAMPLES 200
+//生成的样本数
+#define BENCH_GEN_SAMPLES 4000
+
+namespace {
+	const char* kWords[] = { "hello", "ok", "晚上一起吃饭吗", "收到", "明天开会", "哈哈哈",
+		"文件发你了", "好的", "在吗", "周末有空吗", "项目进度怎么样了", "谢谢" };
+
+	std::string RandomText(std::mt19937& rng, int words) {
+		std::string text;
+		for (int i = 0; i < words; ++i) {
+			text += kWords[rng() % (sizeof(kWords) / sizeof(kWords[0]))];
+			text += " ";
+		}
+		return text;
+	}
+
+	Json::Value RandomUser(std::mt19937& rng) {
+		Json::Value user;
+		int uid = 1000 + rng() % 100000;
+		user["uid"] = uid;
+		user["name"] = "user" + std::to_string(uid);
+		user["nick"] = "nick" + std::to_string(uid);
+		user["desc"] = RandomText(rng, 1 + rng() % 4);
+		user["icon"] = ":/res/head_" + std::to_string(1 + rng() % 5) + ".jpg";
+		user["sex"] = (int)(rng() % 2);
+		user["back"] = "";
+		return user;
+	}
+
+	std::string MakeBoostUuid(std::mt19937& rng) {
+		static const char* hex = "0123456789abcdef";
+		std::string uuid = "{";
+		for (int i = 0; i < 32; ++i) {
+			if (i == 8 || i == 12 || i == 16 || i == 20) {
+				uuid += "-";
+			}
+			uuid += hex[rng() % 16];
+		}
+		return uuid + "}";
+	}
+
+	// 按协议格式生成样本，大小覆盖各个分档
+	std::vector<std::string> GenerateSamples() {
+		std::mt19937 rng(20240601);
+		std::vector<std::string> samples;
+		for (int i = 0; i < BENCH_GEN_SAMPLES; ++i) {
+			Json::Value root;
+			switch (i % 4) {
+			case 0: {
+				// 登录回包，带好友列表和申请列表
+				root = RandomUser(rng);
+				root["error"] = 0;
+				root["token"] = MakeBoostUuid(rng);
+				root["friend_ver"] = (int)(rng() % 1000);
+				root["friend_sync"] = "full";
+				int friends = 1 + rng() % 60;
+				for (int f = 0; f < friends; ++f) {
+					root["friend_list"].append(RandomUser(rng));
+				}
+				int applies = rng() % 10;
+				for (int a = 0; a < applies; ++a) {
+					auto apply = RandomUser(rng);
+					apply["status"] = (int)(rng() % 2);
+					root["apply_list"].append(apply);
+				}
+				break;
+			}
+			case 1:
+			case 2: {
+				// 文本消息通知，text_array中一到多条消息
+				root["error"] = 0;
+				root["fromuid"] = 1000 + (int)(rng() % 100000);
+				root["touid"] = 1000 + (int)(rng() % 100000);
+				int msgs = 1 + rng() % 12;
+				for (int m = 0; m < msgs; ++m) {
+					Json::Value msg;
+					msg["msgid"] = MakeBoostUuid(rng);
+					msg["content"] = RandomText(rng, 1 + rng() % 8);
+					root["text_array"].append(msg);
+				}
+				break;
+			}
+			default:
+				// 搜索、加好友这类小回包
+				root = RandomUser(rng);
+				root["error"] = 0;
+				break;
+			}
+			samples.push_back(root.toStyledString());
+		}
+		return samples;
+	}
+
+	struct BenchClass {
+		const char* name;
+		std::size_t max_len;
+		std::size_t count = 0;
+		std::size_t raw_bytes = 0;
+		std::size_t plain_bytes = 0;
+		std::size_t dict_bytes = 0;
+		double plain_comp_ns = 0;
+		double plain_decomp_ns = 0;
+		double dict_comp_ns = 0;
+		double dict_decomp_ns = 0;
+	};
+
+	// 压缩解压一帧，累加压缩后长度和耗时
+	void BenchFrame(const std::string& frame, ZSTD_CCtx* cctx, ZSTD_DCtx* dctx, const ZSTD_CDict* cdict,
+		const ZSTD_DDict* ddict, int level, std::size_t& bytes, double& comp_ns, double& decomp_ns) {
+		std::string out(ZSTD_compressBound(frame.size()), '\0');
+		std::string back(frame.size(), '\0');
+		auto start = std::chrono::steady_clock::now();
+		auto len = cdict ? ZSTD_compress_usingCDict(cctx, &out[0], out.size(), frame.data(), frame.size(), cdict)
+			: ZSTD_compressCCtx(cctx, &out[0], out.size(), frame.data(), frame.size(), level);
+		auto mid = std::chrono::steady_clock::now();
+		auto ret = ddict ? ZSTD_decompress_usingDDict(dctx, &back[0], back.size(), out.data(), len, ddict)
+			: ZSTD_decompressDCtx(dctx, &back[0], back.size(), out.data(), len);
+		auto end = std::chrono::steady_clock::now();
+		if (ZSTD_isError(len) || ZSTD_isError(ret) || back != frame) {
+			std::cout << "compressbench: round trip failed" << std::endl;
+			return;
+		}
+		bytes += len;
+		comp_ns += std::chrono::duration<double, std::nano>(mid - start).count();
+		decomp_ns += std::chrono::duration<double, std::nano>(end - mid).count();
+	}
+}
+
+void CompressBench::Run(int level) {
+	auto samples = CompressMgr::GetInstance()->GetSamples();
+	bool b_real = samples.size() >= BENCH_MIN_SAMPLES;
+	if (!b_real) {
+		samples = GenerateSamples();
+	}
+
+	//每4个一组交替用于训练字典和测试，各种样本两边都有，测试样本不参与训练
+	std::vector<std::string> train, test;
+	for (std::size_t i = 0; i < samples.size(); ++i) {
+		((i / 4) % 2 == 0 ? train : test).push_back(samples[i]);
+	}
+
+	std::string dict;
+	if (!CompressMgr::TrainDict(train, COMPRESS_DICT_SIZE, dict)) {
+		std::cout << "compressbench: train dict failed" << std::endl;
+		return;
+	}
+
+	auto cctx = ZSTD_createCCtx();
+	auto dctx = ZSTD_createDCtx();
+	auto cdict = ZSTD_createCDict(dict.data(), dict.size(), level);
+	auto ddict = ZSTD_createDDict(dict.data(), dict.size());
+	Defer defer([cctx, dctx, cdict, ddict]() {
+		ZSTD_freeCCtx(cctx);
+		ZSTD_freeDCtx(dctx);
+		ZSTD_freeCDict(cdict);
+		ZSTD_freeDDict(ddict);
+	});
+
+	std::vector<BenchClass> classes = { {"<256", 256}, {"256-1K", 1024}, {"1K-4K", 4096},
+		{"4K-16K", 16384}, {">=16K", (std::size_t)-1} };
+	for (auto& frame : test) {
+		auto iter = classes.begin();
+		while (frame.size() >= iter->max_len) {
+			++iter;
+		}
+		iter->count++;
+		iter->raw_bytes += frame.size();
+		BenchFrame(frame, cctx, dctx, nullptr, nullptr, level, iter->plain_bytes, iter->plain_comp_ns, iter->plain_decomp_ns);
+		BenchFrame(frame, cctx, dctx, cdict, ddict, level, iter->dict_bytes, iter->dict_comp_ns, iter->dict_decomp_ns);
+	}
+
+	std::cout << "compressbench: " << (b_real ? "sampled" : "generated") << " frames " << samples.size()
+		<< ", level " << level << ", dict " << dict.size() << " bytes, threshold " << COMPRESS_MIN_LEN << std::endl;
+	std::cout << std::left << std::setw(8) << "class" << std::setw(8) << "frames" << std::setw(10) << "avg_len"
+		<< std::setw(10) << "ratio" << std::setw(12) << "comp_us" << std::setw(12) << "decomp_us"
+		<< std::setw(10) << "ratio_d" << std::setw(12) << "comp_us_d" << std::setw(12) << "decomp_us_d" << std::endl;
+	std::cout << std::fixed << std::setprecision(2);
+	for (auto& c : classes) {
+		if (c.count == 0) {
+			continue;
+		}
+		std::cout << std::setw(8) << c.name << std::setw(8) << c.count << std::setw(10) << c.raw_bytes / c.count
+			<< std::setw(10) << (double)c.raw_bytes / c.plain_bytes
+			<< std::setw(12) << c.plain_comp_ns / c.count / 1000 << std::setw(12) << c.plain_decomp_ns / c.count / 1000
+			<< std::setw(10) << (double)c.raw_bytes / c.dict_bytes
+			<< std::setw(12) << c.dict_comp_ns / c.count / 1000 << std::setw(12) << c.dict_decomp_ns / c.count / 1000
+			<< std::endl;
+	}
+	std::cout.unsetf(std::ios::fixed);
+	std::cout << std::right << std::setprecision(6);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Singleton.h"
+#include <string>
+#include <vector>
+#include <mutex>
+#include <zstd.h>
+
+// CompressMgr：聊天协议的按帧压缩
+// 客户端登录时声明支持zstd，协商成功后超过 [Compress] MinLen 的帧用zstd压缩，
+// 消息id最高位(MSG_COMPRESS_FLAG)标记压缩帧，小帧和压缩后没有变小的帧原样发送。
+// 两端加载了同一个字典(按字典id判断)时使用字典压缩，登录回包、离线消息这类重复度高的json压缩率更高。
+// 配置了 SampleCount 时按蓄水池抽样保存发出的帧，控制台输入traindict用抽样训练字典并写到 Dict 路径，重启后生效。
+class CompressMgr : public Singleton<CompressMgr>
+{
+	friend class Singleton<CompressMgr>;
+public:
+	~CompressMgr();
+	bool IsEnabled();
+	// 当前加载的字典id，没有字典时为0
+	unsigned int GetDictId();
+	// 压缩一帧，低于阈值、压缩失败或者没有变小时返回false，调用方按原文发送
+	bool Compress(const char* data, std::size_t len, bool b_dict, std::string& out);
+	int GetLevel();
+	// 解压一帧，解压后长度超过max_len或者字典不匹配时返回false
+	bool Decompress(const char* data, std::size_t len, std::size_t max_len, std::string& out);
+	// 抽样保存发出的帧，用于训练字典
+	void AddSample(const char* data, std::size_t len);
+	// 用抽样训练字典并保存到配置的路径
+	bool TrainDict();
+	// 当前抽样到的帧
+	std::vector<std::string> GetSamples();
+	// 用样本训练字典，失败返回false
+	static bool TrainDict(const std::vector<std::string>& samples, std::size_t dict_size, std::string& dict);
+private:
+	CompressMgr();
+	bool LoadDict(const std::string& dict);
+
+	bool _b_enable;
+	int _level;
+	std::size_t _min_len;
+	std::string _dict_path;
+	std::size_t _dict_size;
+	std::size_t _sample_max;
+	ZSTD_CDict* _cdict;
+	ZSTD_DDict* _ddict;
+	unsigned int _dict_id;
+	std::mutex _sample_mutex;
+	std::vector<std::string> _samples;
+	std::size_t _sample_seen;
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include "Singleton.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+// DrainMgr：下线服务器前把在线用户平滑迁移到其他服务器
+// 开始排空后在redis中标记本服务器，StatusServer不再往这里分配新用户，
+// 然后按批次(每批数量、间隔、随机抖动由 [Drain] 配置)给在线用户发送迁移通知，
+// 通知中带上StatusServer分配的新服务器地址和token，客户端直接重连新服务器，
+// 不需要重新走GateServer的http登录，避免大量用户同时重登把GateServer和mysql打满。
+class DrainMgr : public Singleton<DrainMgr>
+{
+	friend class Singleton<DrainMgr>;
+public:
+	~DrainMgr();
+	// 开始排空，重复调用只生效一次
+	void Drain();
+	bool IsDraining();
+	void Stop();
+private:
+	DrainMgr();
+	void Run();
+	bool MigrateUser(int uid);
+
+	int _wave_size;
+	int _wave_interval;
+	int _jitter;
+	std::atomic<bool> _b_draining;
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _cond;
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include <string>
+
+// FileBench：文件传输吞吐量测试
+// 在控制台输入 filebench [总大小MB] [块大小KB]，通过本机回环连接文件服务，
+// 先分块上传再完整下载同一个文件，分别打印吞吐量，测试结束后删除临时token并释放测试文件的引用
+class FileBench
+{
+public:
+	static void Run(short port, const std::string& path, long long total_mb, long long chunk_kb);
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include "Singleton.h"
+#include <json/json.h>
+#include <json/value.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+class CServer;
+
+// HandoffMgr：平滑升级时在新旧进程之间交接连接
+// 旧进程在 [Handoff] Path 配置的unix域socket上等待新进程，新进程启动时连上来，
+// 旧进程冻结所有会话后通过 SCM_RIGHTS 把监听socket和客户端socket连同会话状态
+// (uid、未读完的半包、发送队列)一起交给新进程，新进程收到后立即确认，旧进程回复提交后退出，
+// 新进程收到提交才恢复会话；任何一步超时旧进程都恢复自己的会话，新进程放弃接管，同一个socket不会被两个进程读写。
+// 整个过程客户端的tcp连接不会断开。仅支持Linux，其他平台TakeOver始终返回false。
+class HandoffMgr : public Singleton<HandoffMgr>
+{
+	friend class Singleton<HandoffMgr>;
+public:
+	~HandoffMgr();
+	// 新进程启动时调用，如果有旧进程在运行则接收它交出的socket和会话状态；
+	// 返回false并且b_old_found为true时旧进程还在服务，新进程不能按普通方式启动
+	bool TakeOver(int& listen_fd, std::vector<int>& session_fds, Json::Value& state, bool& b_old_found);
+	// TakeOver成功后立即调用，确认并等待旧进程提交；返回false时已经关闭收到的句柄，新进程应该退出
+	bool AckTakeOver(int listen_fd, const std::vector<int>& session_fds);
+	// 开始监听升级请求，交接成功后调用on_handoff让进程退出
+	void Listen(CServer* server, std::function<void()> on_handoff);
+	void Stop();
+	// 连接是否已经交给了新进程，交出后退出时不能清理登录计数
+	bool IsHandedOff();
+
+	static std::string HexEncode(const std::string& data);
+	static std::string HexDecode(const std::string& hex);
+private:
+	HandoffMgr();
+	void Run();
+	bool HandOff(int conn_fd);
+	bool SendFds(int conn_fd, const std::vector<int>& fds);
+	bool RecvFds(int conn_fd, int count, std::vector<int>& fds);
+	bool WriteAll(int fd, const char* data, std::size_t len);
+	bool ReadAll(int fd, char* data, std::size_t len);
+	void SetRecvTimeout(int fd, int seconds);
+
+	std::string _path;
+	int _listen_fd;
+	int _takeover_fd;
+	CServer* _server;
+	std::function<void()> _on_handoff;
+	std::thread _thread;
+	std::atomic<bool> _b_stop;
+	std::atomic<bool> _b_handed_off;
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <queue>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include "CSession.h"
+#include "MetricsMgr.h"
+
+typedef  function<void(shared_ptr<CSession>, const short &msg_id, const string &msg_data)> FunCallBack;
+
+// 逻辑队列：单个工作线程按投递顺序取出消息，按msg_id查找处理函数并调用
+// 只依赖会话、指标和追踪，不依赖存储和gRPC，LogicSystem和基准测试共用
+class LogicQueue
+{
+public:
+	LogicQueue();
+	// 处理完队列中剩余的消息后退出工作线程
+	~LogicQueue();
+	void PostMsgToQue(shared_ptr<LogicNode> msg);
+	// 等待队列中的消息全部处理完
+	void WaitIdle();
+	// 注册消息处理函数，已注册的id会被覆盖
+	void RegisterCallBack(short msg_id, FunCallBack callback);
+private:
+	void DealMsg();
+	// 调用消息对应的回调，并记录排队和执行时间，调用时持有_mutex
+	void DealNode(shared_ptr<LogicNode> msg_node);
+	std::thread _worker_thread;
+	std::queue<shared_ptr<LogicNode>> _msg_que;
+	std::mutex _mutex;
+	std::condition_variable _consume;
+	bool _b_stop;
+	// 队列长度，投递和处理完时更新，导出指标时不加锁读
+	std::atomic<size_t> _que_len;
+	std::map<short, FunCallBack> _fun_callbacks;
+	// 每种消息的延迟统计，和_fun_callbacks一起注册，处理消息时不再查MetricsMgr
+	std::map<short, LatencyMetric*> _msg_metrics;
+	std::atomic<uint64_t>* _unknown_msg_count;
+};
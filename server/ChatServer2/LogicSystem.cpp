@@ -5,86 +5,47 @@
 #include "RedisMgr.h"
 #include "UserMgr.h"
 #include "ChatGrpcClient.h"
+#include "CompressMgr.h"
+#include "TraceMgr.h"
+#include <chrono>
 
 using namespace std;
 
-LogicSystem::LogicSystem():_b_stop(false){
+LogicSystem::LogicSystem(){
 	RegisterCallBacks();
-	_worker_thread = std::thread (&LogicSystem::DealMsg, this);
 }
 
 LogicSystem::~LogicSystem(){
-	_b_stop = true;
-	_consume.notify_one();
-	_worker_thread.join();
 }
 
 void LogicSystem::PostMsgToQue(shared_ptr < LogicNode> msg) {
-	std::unique_lock<std::mutex> unique_lk(_mutex);
-	_msg_que.push(msg);
-	//0Ϊ1֪ͨź
-	if (_msg_que.size() == 1) {
-		unique_lk.unlock();
-		_consume.notify_one();
-	}
+	_queue.PostMsgToQue(msg);
 }
 
-void LogicSystem::DealMsg() {
-	for (;;) {
-		std::unique_lock<std::mutex> unique_lk(_mutex);
-		//ж϶Ϊȴͷ
-		while (_msg_que.empty() && !_b_stop) {
-			_consume.wait(unique_lk);
-		}
-
-		//жǷΪر״̬߼ִ˳ѭ
-		if (_b_stop ) {
-			while (!_msg_que.empty()) {
-				auto msg_node = _msg_que.front();
-				cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-				auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-				if (call_back_iter == _fun_callbacks.end()) {
-					_msg_que.pop();
-					continue;
-				}
-				call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id,
-					std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-				_msg_que.pop();
-			}
-			break;
-		}
+//平滑升级导出会话状态前调用
+void LogicSystem::WaitIdle() {
+	_queue.WaitIdle();
+}
 
-		//ûͣ˵
-		auto msg_node = _msg_que.front();
-		cout << "recv_msg id  is " << msg_node->_recvnode->_msg_id << endl;
-		auto call_back_iter = _fun_callbacks.find(msg_node->_recvnode->_msg_id);
-		if (call_back_iter == _fun_callbacks.end()) {
-			_msg_que.pop();
-			std::cout << "msg id [" << msg_node->_recvnode->_msg_id << "] handler not found" << std::endl;
-			continue;
-		}
-		call_back_iter->second(msg_node->_session, msg_node->_recvnode->_msg_id, 
-			std::string(msg_node->_recvnode->_data, msg_node->_recvnode->_cur_len));
-		_msg_que.pop();
-	}
+void LogicSystem::RegisterCallBack(short msg_id, FunCallBack callback) {
+	_queue.RegisterCallBack(msg_id, callback);
 }
 
 void LogicSystem::RegisterCallBacks() {
-	_fun_callbacks[MSG_CHAT_LOGIN] = std::bind(&LogicSystem::LoginHandler, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(MSG_CHAT_LOGIN, std::bind(&LogicSystem::LoginHandler, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_SEARCH_USER_REQ] = std::bind(&LogicSystem::SearchInfo, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(ID_SEARCH_USER_REQ, std::bind(&LogicSystem::SearchInfo, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_ADD_FRIEND_REQ] = std::bind(&LogicSystem::AddFriendApply, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(ID_ADD_FRIEND_REQ, std::bind(&LogicSystem::AddFriendApply, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_AUTH_FRIEND_REQ] = std::bind(&LogicSystem::AuthFriendApply, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
+	RegisterCallBack(ID_AUTH_FRIEND_REQ, std::bind(&LogicSystem::AuthFriendApply, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 
-	_fun_callbacks[ID_TEXT_CHAT_MSG_REQ] = std::bind(&LogicSystem::DealChatTextMsg, this,
-		placeholders::_1, placeholders::_2, placeholders::_3);
-	
+	RegisterCallBack(ID_TEXT_CHAT_MSG_REQ, std::bind(&LogicSystem::DealChatTextMsg, this,
+		placeholders::_1, placeholders::_2, placeholders::_3));
 }
 
 void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short &msg_id, const string &msg_data) {
@@ -96,13 +57,21 @@ void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short &msg_id
 	std::cout << "user login uid is  " << uid << " user token  is "
 		<< token << endl;
 
+	//登录成功后在登录回包之后下发离线消息
+	bool b_login = false;
+	Defer offline_defer([this, &b_login, uid, session]() {
+		if (b_login) {
+			DeliverOfflineMsgs(uid, session);
+		}
+		});
+
 	Json::Value  rtvalue;
 	Defer defer([this, &rtvalue, session]() {
 		std::string return_str = rtvalue.toStyledString();
 		session->Send(return_str, MSG_CHAT_LOGIN_RSP);
 		});
 
-	//redisȡûtokenǷȷ
+	//从redis获取用户token是否正确
 	std::string uid_str = std::to_string(uid);
 	std::string token_key = USERTOKENPREFIX + uid_str;
 	std::string token_value = "";
@@ -135,40 +104,24 @@ void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short &msg_id
 	rtvalue["sex"] = user_info->sex;
 	rtvalue["icon"] = user_info->icon;
 
-	//ݿȡб
-	std::vector<std::shared_ptr<ApplyInfo>> apply_list;
-	auto b_apply = GetFriendApplyInfo(uid,apply_list);
-	if (b_apply) {
-		for (auto & apply : apply_list) {
-			Json::Value obj;
-			obj["name"] = apply->_name;
-			obj["uid"] = apply->_uid;
-			obj["icon"] = apply->_icon;
-			obj["nick"] = apply->_nick;
-			obj["sex"] = apply->_sex;
-			obj["desc"] = apply->_desc;
-			obj["status"] = apply->_status;
-			rtvalue["apply_list"].append(obj);
-		}
+	//客户端声明支持zstd时协商压缩，两端字典id一致才用字典
+	auto compress_mgr = CompressMgr::GetInstance();
+	if (compress_mgr->IsEnabled() && root["compress"].asString() == "zstd") {
+		bool b_dict = compress_mgr->GetDictId() != 0 && root["dict_id"].asUInt() == compress_mgr->GetDictId();
+		session->SetCompress(b_dict);
+		rtvalue["compress"] = "zstd";
+		rtvalue["dict_id"] = b_dict ? compress_mgr->GetDictId() : 0;
 	}
 
-	//ȡб
-	std::vector<std::shared_ptr<UserInfo>> friend_list;
-	bool b_friend_list = GetFriendList(uid, friend_list);
-	for (auto& friend_ele : friend_list) {
-		Json::Value obj;
-		obj["name"] = friend_ele->name;
-		obj["uid"] = friend_ele->uid;
-		obj["icon"] = friend_ele->icon;
-		obj["nick"] = friend_ele->nick;
-		obj["sex"] = friend_ele->sex;
-		obj["desc"] = friend_ele->desc;
-		obj["back"] = friend_ele->back;
-		rtvalue["friend_list"].append(obj);
-	}
+	//资料在上次登录后被修改过时先记入好友的变更日志
+	CheckProfileChange(uid, user_info);
+
+	//好友申请列表和好友列表，客户端带上本地版本号时只下发增量
+	FillApplySync(uid, root, rtvalue);
+	FillFriendSync(uid, root, rtvalue);
 
 	auto server_name = ConfigMgr::Inst().GetValue("SelfServer", "Name");
-	//¼
+	//将登录数量增加
 	auto rd_res = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server_name);
 	int count = 0;
 	if (!rd_res.empty()) {
@@ -178,13 +131,14 @@ void LogicSystem::LoginHandler(shared_ptr<CSession> session, const short &msg_id
 	count++;
 	auto count_str = std::to_string(count);
 	RedisMgr::GetInstance()->HSet(LOGIN_COUNT, server_name, count_str);
-	//sessionûuid
+	//session绑定用户uid
 	session->SetUserId(uid);
-	//Ϊûõ¼ip server
+	//为用户设置登录ip server的名字
 	std::string  ipkey = USERIPPREFIX + uid_str;
 	RedisMgr::GetInstance()->Set(ipkey, server_name);
-	//uidsession󶨹,Ժ˲
+	//uid和session绑定管理,方便以后踢人操作
 	UserMgr::GetInstance()->SetUserSession(uid, session);
+	b_login = true;
 
 	return;
 }
@@ -233,10 +187,12 @@ void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short&
 		session->Send(return_str, ID_ADD_FRIEND_RSP);
 		});
 
-	//ȸݿ
+	//先更新数据库
 	MysqlMgr::GetInstance()->AddFriendApply(uid, touid);
+	//记录接收者申请列表的变更，供增量同步使用
+	RecordApplyChange(touid, "add", uid, 0);
 
-	//ѯredis touidӦserver ip
+	//查询redis 查找touid对应的server ip
 	auto to_str = std::to_string(touid);
 	auto to_ip_key = USERIPPREFIX + to_str;
 	std::string to_ip_value = "";
@@ -248,11 +204,11 @@ void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short&
 
 	auto& cfg = ConfigMgr::Inst();
 	auto self_name = cfg["SelfServer"]["Name"];
-	//ֱ֪ͨԷϢ
+	//直接通知对方有申请消息
 	if (to_ip_value == self_name) {
 		auto session = UserMgr::GetInstance()->GetSession(touid);
 		if (session) {
-			//ڴֱӷ֪ͨԷ
+			//在内存中则直接发送通知对方
 			Json::Value  notify;
 			notify["error"] = ErrorCodes::Success;
 			notify["applyuid"] = uid;
@@ -281,7 +237,7 @@ void LogicSystem::AddFriendApply(std::shared_ptr<CSession> session, const short&
 		add_req.set_nick(apply_info->nick);
 	}
 
-	//֪ͨ
+	//发送通知
 	ChatGrpcClient::GetInstance()->NotifyAddFriend(to_ip_value,add_req);
 
 }
@@ -320,13 +276,18 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
 		session->Send(return_str, ID_AUTH_FRIEND_RSP);
 		});
 
-	//ȸݿ
+	//先更新数据库
 	MysqlMgr::GetInstance()->AuthFriendApply(uid, touid);
 
-	//ݿӺ
+	//更新数据库添加好友
 	MysqlMgr::GetInstance()->AddFriend(uid, touid,back_name);
 
-	//ѯredis touidӦserver ip
+	//记录双方好友列表及认证方申请列表的变更
+	RecordApplyChange(uid, "update", touid, 1);
+	RecordFriendChange(uid, "add", touid);
+	RecordFriendChange(touid, "add", uid);
+
+	//查询redis 查找touid对应的server ip
 	auto to_str = std::to_string(touid);
 	auto to_ip_key = USERIPPREFIX + to_str;
 	std::string to_ip_value = "";
@@ -337,11 +298,11 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
 
 	auto& cfg = ConfigMgr::Inst();
 	auto self_name = cfg["SelfServer"]["Name"];
-	//ֱ֪ͨԷ֤ͨϢ
+	//直接通知对方有认证通过消息
 	if (to_ip_value == self_name) {
 		auto session = UserMgr::GetInstance()->GetSession(touid);
 		if (session) {
-			//ڴֱӷ֪ͨԷ
+			//在内存中则直接发送通知对方
 			Json::Value  notify;
 			notify["error"] = ErrorCodes::Success;
 			notify["fromuid"] = uid;
@@ -372,7 +333,7 @@ void LogicSystem::AuthFriendApply(std::shared_ptr<CSession> session, const short
 	auth_req.set_fromuid(uid);
 	auth_req.set_touid(touid);
 
-	//֪ͨ
+	//发送通知
 	ChatGrpcClient::GetInstance()->NotifyAuthFriend(to_ip_value, auth_req);
 }
 
@@ -390,15 +351,30 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 	rtvalue["error"] = ErrorCodes::Success;
 	rtvalue["text_array"] = arrays;
 	rtvalue["fromuid"] = uid;
+
 	rtvalue["touid"] = touid;
 
-	Defer defer([this, &rtvalue, session]() {
-		std::string return_str = rtvalue.toStyledString();
-		session->Send(return_str, ID_TEXT_CHAT_MSG_RSP);
+	//按会话分配递增的序号，两个方向的消息共用一个序号空间
+	auto conv_key = uid < touid ? std::to_string(uid) + "_" + std::to_string(touid)
+		: std::to_string(touid) + "_" + std::to_string(uid);
+	long long last_seq = 0;
+	RedisMgr::GetInstance()->HIncrBy(MSG_SEQ, conv_key, arrays.size(), last_seq);
+	long long ts = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+
+	//确认只带msgid、序号和时间戳，由会话合并后发送
+	Defer defer([session, arrays, last_seq, ts]() {
+		long long seq = last_seq > 0 ? last_seq - arrays.size() + 1 : 0;
+		for (const auto& txt_obj : arrays) {
+			session->SendAck(txt_obj["msgid"].asString(), seq, ts);
+			if (seq > 0) {
+				++seq;
+			}
+		}
 		});
 
 
-	//ѯredis touidӦserver ip
+	//查询redis 查找touid对应的server ip
 	auto to_str = std::to_string(touid);
 	auto to_ip_key = USERIPPREFIX + to_str;
 	std::string to_ip_value = "";
@@ -409,11 +385,11 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 
 	auto& cfg = ConfigMgr::Inst();
 	auto self_name = cfg["SelfServer"]["Name"];
-	//ֱ֪ͨԷ֤ͨϢ
+	//直接通知对方有认证通过消息
 	if (to_ip_value == self_name) {
 		auto session = UserMgr::GetInstance()->GetSession(touid);
 		if (session) {
-			//ڴֱӷ֪ͨԷ
+			//在内存中则直接发送通知对方
 			std::string return_str = rtvalue.toStyledString();
 			session->Send(return_str, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
 		}
@@ -436,12 +412,26 @@ void LogicSystem::DealChatTextMsg(std::shared_ptr<CSession> session, const short
 	}
 
 
-	//֪ͨ todo...
+	//发送通知 todo...
 	ChatGrpcClient::GetInstance()->NotifyTextChatMsg(to_ip_value, text_msg_req, rtvalue);
 }
 
 
 
+void LogicSystem::DeliverOfflineMsgs(int uid, std::shared_ptr<CSession> session) {
+	//只删除已经读出来的部分，读取之后新转存的消息留到下次登录
+	auto key = OFFLINE_MSG_PREFIX + std::to_string(uid);
+	std::vector<std::string> msgs;
+	if (!RedisMgr::GetInstance()->LRange(key, 0, -1, msgs) || msgs.empty()) {
+		return;
+	}
+	for (auto& msg : msgs) {
+		session->Send(msg, ID_NOTIFY_TEXT_CHAT_MSG_REQ);
+	}
+	RedisMgr::GetInstance()->LTrim(key, static_cast<int>(msgs.size()), -1);
+	std::cout << "deliver " << msgs.size() << " offline msgs to uid " << uid << std::endl;
+}
+
 bool LogicSystem::isPureDigit(const std::string& str)
 {
 	for (char c : str) {
@@ -458,7 +448,7 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 
 	std::string base_key = USER_BASE_INFO + uid_str;
 
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -488,8 +478,8 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 	}
 
 	auto uid = std::stoi(uid_str);
-	//redisûѯmysql
-	//ѯݿ
+	//redis中没有则查询mysql
+	//查询数据库
 	std::shared_ptr<UserInfo> user_info = nullptr;
 	user_info = MysqlMgr::GetInstance()->GetUser(uid);
 	if (user_info == nullptr) {
@@ -497,7 +487,7 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 		return;
 	}
 
-	//ݿдredis
+	//将数据库内容写入redis缓存
 	Json::Value redis_root;
 	redis_root["uid"] = user_info->uid;
 	redis_root["pwd"] = user_info->pwd;
@@ -510,7 +500,7 @@ void LogicSystem::GetUserByUid(std::string uid_str, Json::Value& rtvalue)
 
 	RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
 
-	//
+	//返回数据
 	rtvalue["uid"] = user_info->uid;
 	rtvalue["pwd"] = user_info->pwd;
 	rtvalue["name"] = user_info->name;
@@ -527,7 +517,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 
 	std::string base_key = NAME_INFO + name;
 
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -554,8 +544,8 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 		return;
 	}
 
-	//redisûѯmysql
-	//ѯݿ
+	//redis中没有则查询mysql
+	//查询数据库
 	std::shared_ptr<UserInfo> user_info = nullptr;
 	user_info = MysqlMgr::GetInstance()->GetUser(name);
 	if (user_info == nullptr) {
@@ -563,7 +553,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 		return;
 	}
 
-	//ݿдredis
+	//将数据库内容写入redis缓存
 	Json::Value redis_root;
 	redis_root["uid"] = user_info->uid;
 	redis_root["pwd"] = user_info->pwd;
@@ -575,7 +565,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 
 	RedisMgr::GetInstance()->Set(base_key, redis_root.toStyledString());
 	
-	//
+	//返回数据
 	rtvalue["uid"] = user_info->uid;
 	rtvalue["pwd"] = user_info->pwd;
 	rtvalue["name"] = user_info->name;
@@ -587,7 +577,7 @@ void LogicSystem::GetUserByName(std::string name, Json::Value& rtvalue)
 
 bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<UserInfo>& userinfo)
 {
-	//ȲredisвѯûϢ
+	//优先查redis中查询用户信息
 	std::string info_str = "";
 	bool b_base = RedisMgr::GetInstance()->Get(base_key, info_str);
 	if (b_base) {
@@ -606,8 +596,8 @@ bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<Use
 			<< userinfo->name << " pwd is " << userinfo->pwd << " email is " << userinfo->email << endl;
 	}
 	else {
-		//redisûѯmysql
-		//ѯݿ
+		//redis中没有则查询mysql
+		//查询数据库
 		std::shared_ptr<UserInfo> user_info = nullptr;
 		user_info = MysqlMgr::GetInstance()->GetUser(uid);
 		if (user_info == nullptr) {
@@ -616,7 +606,7 @@ bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<Use
 
 		userinfo = user_info;
 
-		//ݿдredis
+		//将数据库内容写入redis缓存
 		Json::Value redis_root;
 		redis_root["uid"] = uid;
 		redis_root["pwd"] = userinfo->pwd;
@@ -632,11 +622,263 @@ bool LogicSystem::GetBaseInfo(std::string base_key, int uid, std::shared_ptr<Use
 }
 
 bool LogicSystem::GetFriendApplyInfo(int to_uid, std::vector<std::shared_ptr<ApplyInfo>> &list) {
-	//mysqlȡб
+	//从mysql获取好友申请列表
 	return MysqlMgr::GetInstance()->GetApplyList(to_uid, list, 0, 10);
 }
 
 bool LogicSystem::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo>>& user_list) {
-	//mysqlȡб
+	//从mysql获取好友列表
 	return MysqlMgr::GetInstance()->GetFriendList(self_id, user_list);
 }
+
+void LogicSystem::FillApplySync(int uid, const Json::Value& root, Json::Value& rtvalue) {
+	auto cur_ver = GetSyncVer(APPLY_VER_PREFIX + std::to_string(uid));
+	rtvalue["apply_ver"] = cur_ver;
+
+	//客户端带了版本号，尝试下发增量
+	if (root.isMember("apply_ver")) {
+		auto client_ver = root["apply_ver"].asInt();
+		if (client_ver == cur_ver) {
+			rtvalue["apply_sync"] = "none";
+			return;
+		}
+
+		std::vector<Json::Value> entries;
+		if (GetSyncLog(APPLY_LOG_PREFIX + std::to_string(uid), client_ver, cur_ver, entries)) {
+			//同一个申请人只保留最后一次变更
+			std::map<int, int> apply_status;
+			for (auto& entry : entries) {
+				apply_status[entry["uid"].asInt()] = entry["status"].asInt();
+			}
+
+			rtvalue["apply_sync"] = "delta";
+			rtvalue["apply_list"] = Json::arrayValue;
+			for (auto& apply : apply_status) {
+				auto user_info = std::make_shared<UserInfo>();
+				if (!GetBaseInfo(USER_BASE_INFO + std::to_string(apply.first), apply.first, user_info)) {
+					continue;
+				}
+				Json::Value obj;
+				obj["name"] = user_info->name;
+				obj["uid"] = apply.first;
+				obj["icon"] = user_info->icon;
+				obj["nick"] = user_info->nick;
+				obj["sex"] = user_info->sex;
+				obj["desc"] = user_info->desc;
+				obj["status"] = apply.second;
+				rtvalue["apply_list"].append(obj);
+			}
+			return;
+		}
+	}
+
+	//版本过旧或者首次登录，下发全量
+	rtvalue["apply_sync"] = "full";
+	std::vector<std::shared_ptr<ApplyInfo>> apply_list;
+	auto b_apply = GetFriendApplyInfo(uid, apply_list);
+	if (b_apply) {
+		for (auto& apply : apply_list) {
+			Json::Value obj;
+			obj["name"] = apply->_name;
+			obj["uid"] = apply->_uid;
+			obj["icon"] = apply->_icon;
+			obj["nick"] = apply->_nick;
+			obj["sex"] = apply->_sex;
+			obj["desc"] = apply->_desc;
+			obj["status"] = apply->_status;
+			rtvalue["apply_list"].append(obj);
+		}
+	}
+}
+
+void LogicSystem::FillFriendSync(int uid, const Json::Value& root, Json::Value& rtvalue) {
+	auto cur_ver = GetSyncVer(FRIEND_VER_PREFIX + std::to_string(uid));
+	rtvalue["friend_ver"] = cur_ver;
+
+	if (root.isMember("friend_ver")) {
+		auto client_ver = root["friend_ver"].asInt();
+		if (client_ver == cur_ver) {
+			rtvalue["friend_sync"] = "none";
+			return;
+		}
+
+		std::vector<Json::Value> entries;
+		if (GetSyncLog(FRIEND_LOG_PREFIX + std::to_string(uid), client_ver, cur_ver, entries)) {
+			//按版本顺序回放，得到新增/变更和删除的好友
+			std::set<int> upsert_set;
+			std::set<int> del_set;
+			for (auto& entry : entries) {
+				auto peer_uid = entry["uid"].asInt();
+				if (entry["op"].asString() == "del") {
+					upsert_set.erase(peer_uid);
+					del_set.insert(peer_uid);
+					continue;
+				}
+				del_set.erase(peer_uid);
+				upsert_set.insert(peer_uid);
+			}
+
+			//备注名存在好友关系上，不在用户资料里，从好友表取；取不到时退回全量同步
+			std::vector<std::shared_ptr<UserInfo>> friend_list;
+			if (upsert_set.empty() || GetFriendList(uid, friend_list)) {
+				std::map<int, std::string> back_map;
+				for (auto& friend_ele : friend_list) {
+					back_map[friend_ele->uid] = friend_ele->back;
+				}
+				rtvalue["friend_sync"] = "delta";
+				rtvalue["friend_list"] = Json::arrayValue;
+				rtvalue["friend_del"] = Json::arrayValue;
+				for (auto peer_uid : upsert_set) {
+					auto back_iter = back_map.find(peer_uid);
+					if (back_iter == back_map.end()) {
+						continue;
+					}
+					auto user_info = std::make_shared<UserInfo>();
+					if (!GetBaseInfo(USER_BASE_INFO + std::to_string(peer_uid), peer_uid, user_info)) {
+						continue;
+					}
+					Json::Value obj;
+					obj["name"] = user_info->name;
+					obj["uid"] = peer_uid;
+					obj["icon"] = user_info->icon;
+					obj["nick"] = user_info->nick;
+					obj["sex"] = user_info->sex;
+					obj["desc"] = user_info->desc;
+					obj["back"] = back_iter->second;
+					rtvalue["friend_list"].append(obj);
+				}
+
+				for (auto peer_uid : del_set) {
+					rtvalue["friend_del"].append(peer_uid);
+				}
+				return;
+			}
+		}
+	}
+
+	rtvalue["friend_sync"] = "full";
+	std::vector<std::shared_ptr<UserInfo>> friend_list;
+	bool b_friend_list = GetFriendList(uid, friend_list);
+	for (auto& friend_ele : friend_list) {
+		Json::Value obj;
+		obj["name"] = friend_ele->name;
+		obj["uid"] = friend_ele->uid;
+		obj["icon"] = friend_ele->icon;
+		obj["nick"] = friend_ele->nick;
+		obj["sex"] = friend_ele->sex;
+		obj["desc"] = friend_ele->desc;
+		obj["back"] = friend_ele->back;
+		rtvalue["friend_list"].append(obj);
+	}
+}
+
+void LogicSystem::RecordApplyChange(int uid, const std::string& op, int peer_uid, int status) {
+	Json::Value entry;
+	entry["op"] = op;
+	entry["uid"] = peer_uid;
+	entry["status"] = status;
+	auto uid_str = std::to_string(uid);
+	RecordSyncChange(APPLY_VER_PREFIX + uid_str, APPLY_LOG_PREFIX + uid_str, entry);
+}
+
+void LogicSystem::RecordFriendChange(int uid, const std::string& op, int peer_uid) {
+	Json::Value entry;
+	entry["op"] = op;
+	entry["uid"] = peer_uid;
+	auto uid_str = std::to_string(uid);
+	RecordSyncChange(FRIEND_VER_PREFIX + uid_str, FRIEND_LOG_PREFIX + uid_str, entry);
+}
+
+void LogicSystem::RecordProfileChange(int uid) {
+	std::vector<std::shared_ptr<UserInfo>> friend_list;
+	if (!GetFriendList(uid, friend_list)) {
+		return;
+	}
+
+	//好友增量同步时按uid重新读取基本信息，只记一条upd
+	for (auto& friend_ele : friend_list) {
+		RecordFriendChange(friend_ele->uid, "upd", uid);
+	}
+}
+
+void LogicSystem::CheckProfileChange(int uid, const std::shared_ptr<UserInfo>& user_info) {
+	Json::Value profile;
+	profile["name"] = user_info->name;
+	profile["nick"] = user_info->nick;
+	profile["icon"] = user_info->icon;
+	profile["desc"] = user_info->desc;
+	profile["sex"] = user_info->sex;
+	Json::FastWriter writer;
+	auto profile_str = writer.write(profile);
+
+	auto profile_key = USER_PROFILE_PREFIX + std::to_string(uid);
+	std::string last_str = "";
+	bool b_last = RedisMgr::GetInstance()->Get(profile_key, last_str);
+	if (b_last && last_str == profile_str) {
+		return;
+	}
+
+	RedisMgr::GetInstance()->Set(profile_key, profile_str);
+	//第一次登录没有记录，不算修改
+	if (b_last) {
+		std::cout << "user " << uid << " profile changed, record friend sync" << endl;
+		RecordProfileChange(uid);
+	}
+}
+
+void LogicSystem::RecordSyncChange(const std::string& ver_key, const std::string& log_key, Json::Value entry) {
+	long long ver = 0;
+	if (!RedisMgr::GetInstance()->Incr(ver_key, ver)) {
+		return;
+	}
+
+	entry["ver"] = (int)ver;
+	Json::FastWriter writer;
+	RedisMgr::GetInstance()->RPush(log_key, writer.write(entry));
+	//只保留最近的变更，更早的版本直接走全量
+	RedisMgr::GetInstance()->LTrim(log_key, -MAX_SYNC_LOG_LEN, -1);
+}
+
+int LogicSystem::GetSyncVer(const std::string& ver_key) {
+	std::string ver_str = "";
+	if (!RedisMgr::GetInstance()->Get(ver_key, ver_str) || ver_str.empty()) {
+		return 0;
+	}
+
+	return std::stoi(ver_str);
+}
+
+bool LogicSystem::GetSyncLog(const std::string& log_key, int client_ver, int cur_ver, std::vector<Json::Value>& entries) {
+	//客户端版本比服务器还新(比如redis被清空)，只能下发全量
+	if (client_ver <= 0 || client_ver > cur_ver) {
+		return false;
+	}
+
+	std::vector<std::string> values;
+	if (!RedisMgr::GetInstance()->LRange(log_key, 0, -1, values)) {
+		return false;
+	}
+
+	std::map<int, Json::Value> ver_entries;
+	Json::Reader reader;
+	for (auto& value : values) {
+		Json::Value entry;
+		if (!reader.parse(value, entry)) {
+			continue;
+		}
+		auto ver = entry["ver"].asInt();
+		if (ver > client_ver && ver <= cur_ver) {
+			ver_entries[ver] = entry;
+		}
+	}
+
+	//日志必须完整覆盖 (client_ver, cur_ver]，否则说明被裁剪过或者还有写入未完成
+	if ((int)ver_entries.size() != cur_ver - client_ver) {
+		return false;
+	}
+
+	for (auto& ver_entry : ver_entries) {
+		entries.push_back(ver_entry.second);
+	}
+	return true;
+}
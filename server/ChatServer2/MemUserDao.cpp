@@ -0,0 +1,249 @@
+#include "MemUserDao.h"
+#include "ConfigMgr.h"
+#include <iostream>
+#include <algorithm>
+
+MemUserDao::MemUserDao(size_t shard_count) : _next_uid(1), _next_apply_id(0) {
+	size_t count = 1;
+	while (count < shard_count) {
+		count <<= 1;
+	}
+	for (size_t i = 0; i < count; ++i) {
+		_shards.emplace_back(new UserShard());
+	}
+	_shard_mask = count - 1;
+
+	auto& cfg = ConfigMgr::Inst();
+	int seed_users = atoi(cfg["Storage"]["SeedUsers"].c_str());
+	if (seed_users > 0) {
+		SeedUsers(seed_users, atoi(cfg["Storage"]["SeedUidStart"].c_str()));
+	}
+	std::cout << "mem user dao start with " << count << " shards, " << seed_users << " seed users" << std::endl;
+}
+
+MemUserDao::~MemUserDao() {
+
+}
+
+MemUserDao::UserShard& MemUserDao::GetShard(int uid) {
+	return *_shards[static_cast<size_t>(uid) & _shard_mask];
+}
+
+bool MemUserDao::AddUser(const UserInfo& user) {
+	if (_name_index.count(user.name) > 0 || _email_index.count(user.email) > 0) {
+		return false;
+	}
+
+	_name_index[user.name] = user.uid;
+	_email_index[user.email] = user.uid;
+	_next_uid = (std::max)(_next_uid, user.uid + 1);
+	auto& shard = GetShard(user.uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	shard._users[user.uid] = user;
+	return true;
+}
+
+void MemUserDao::SeedUsers(int count, int uid_start) {
+	std::lock_guard<std::mutex> lock(_index_mutex);
+	for (int i = 0; i < count; ++i) {
+		UserInfo user;
+		user.uid = uid_start + i;
+		auto uid_str = std::to_string(user.uid);
+		user.name = "bot_" + uid_str;
+		user.email = "bot_" + uid_str + "@loadgen";
+		user.nick = user.name;
+		user.icon = ":/res/head_1.jpg";
+		AddUser(user);
+	}
+}
+
+int MemUserDao::FindUid(const std::string& name) {
+	std::lock_guard<std::mutex> lock(_index_mutex);
+	auto iter = _name_index.find(name);
+	if (iter == _name_index.end()) {
+		return -1;
+	}
+	return iter->second;
+}
+
+// 和reg_user存储过程一样，名字或者邮箱已经存在返回0，成功返回新的uid
+int MemUserDao::RegUser(const std::string& name, const std::string& email, const std::string& pwd) {
+	std::lock_guard<std::mutex> lock(_index_mutex);
+	UserInfo user;
+	user.uid = _next_uid;
+	user.name = name;
+	user.email = email;
+	user.pwd = pwd;
+	user.nick = name;
+	if (!AddUser(user)) {
+		return 0;
+	}
+	return user.uid;
+}
+
+bool MemUserDao::CheckEmail(const std::string& name, const std::string& email) {
+	auto user = GetUser(name);
+	return user != nullptr && user->email == email;
+}
+
+bool MemUserDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
+	int uid = FindUid(name);
+	if (uid < 0) {
+		return false;
+	}
+
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._users.find(uid);
+	if (iter == shard._users.end()) {
+		return false;
+	}
+	iter->second.pwd = newpwd;
+	return true;
+}
+
+bool MemUserDao::CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) {
+	auto user = GetUser(name);
+	if (user == nullptr || user->pwd != pwd) {
+		return false;
+	}
+
+	userInfo.name = name;
+	userInfo.email = user->email;
+	userInfo.uid = user->uid;
+	userInfo.pwd = user->pwd;
+	return true;
+}
+
+bool MemUserDao::AddFriendApply(const int& from, const int& to) {
+	auto& shard = GetShard(to);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto& applies = shard._applies[to];
+	// 重复申请保持原来的记录，和ON DUPLICATE KEY UPDATE的效果一致
+	for (auto& apply : applies) {
+		if (apply._from_uid == from) {
+			return true;
+		}
+	}
+
+	ApplyRecord apply;
+	apply._id = ++_next_apply_id;
+	apply._from_uid = from;
+	apply._status = 0;
+	applies.push_back(apply);
+	return true;
+}
+
+bool MemUserDao::AuthFriendApply(const int& from, const int& to) {
+	//反过来的申请时from，验证时to
+	auto& shard = GetShard(from);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._applies.find(from);
+	if (iter == shard._applies.end()) {
+		return true;
+	}
+
+	for (auto& apply : iter->second) {
+		if (apply._from_uid == to) {
+			apply._status = 1;
+		}
+	}
+	return true;
+}
+
+bool MemUserDao::AddFriend(const int& from, const int& to, std::string back_name) {
+	// 两个用户可能在不同的分片，按固定顺序同时加锁，和mysql的事务一样要么都加上要么都不加
+	auto& from_shard = GetShard(from);
+	auto& to_shard = GetShard(to);
+	std::unique_lock<std::mutex> from_lock(from_shard._mutex, std::defer_lock);
+	std::unique_lock<std::mutex> to_lock(to_shard._mutex, std::defer_lock);
+	if (&from_shard == &to_shard) {
+		from_lock.lock();
+	}
+	else {
+		std::lock(from_lock, to_lock);
+	}
+
+	// INSERT IGNORE，已经是好友的保留原来的备注
+	from_shard._friends[from].emplace(to, back_name);
+	to_shard._friends[to].emplace(from, "");
+	return true;
+}
+
+std::shared_ptr<UserInfo> MemUserDao::GetUser(int uid) {
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._users.find(uid);
+	if (iter == shard._users.end()) {
+		return nullptr;
+	}
+	return std::make_shared<UserInfo>(iter->second);
+}
+
+std::shared_ptr<UserInfo> MemUserDao::GetUser(std::string name) {
+	int uid = FindUid(name);
+	if (uid < 0) {
+		return nullptr;
+	}
+	return GetUser(uid);
+}
+
+bool MemUserDao::GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int begin, int limit) {
+	std::vector<ApplyRecord> records;
+	{
+		auto& shard = GetShard(touid);
+		std::lock_guard<std::mutex> lock(shard._mutex);
+		auto iter = shard._applies.find(touid);
+		if (iter == shard._applies.end()) {
+			return true;
+		}
+
+		// 申请id是递增的，返回id大于begin的前limit条
+		for (auto& apply : iter->second) {
+			if (apply._id <= begin) {
+				continue;
+			}
+			if (static_cast<int>(records.size()) >= limit) {
+				break;
+			}
+			records.push_back(apply);
+		}
+	}
+
+	// 申请人的信息在别的分片，释放锁之后再查，和join一样跳过不存在的用户
+	for (auto& apply : records) {
+		auto user = GetUser(apply._from_uid);
+		if (user == nullptr) {
+			continue;
+		}
+		applyList.push_back(std::make_shared<ApplyInfo>(apply._from_uid, user->name, "", "",
+			user->nick, user->sex, apply._status));
+	}
+	return true;
+}
+
+bool MemUserDao::GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info_list) {
+	std::vector<int> friend_ids;
+	{
+		auto& shard = GetShard(self_id);
+		std::lock_guard<std::mutex> lock(shard._mutex);
+		auto iter = shard._friends.find(self_id);
+		if (iter == shard._friends.end()) {
+			return true;
+		}
+		for (auto& item : iter->second) {
+			friend_ids.push_back(item.first);
+		}
+	}
+
+	for (auto friend_id : friend_ids) {
+		auto user_info = GetUser(friend_id);
+		if (user_info == nullptr) {
+			continue;
+		}
+		// 和MysqlDao一样备注用好友的名字
+		user_info->back = user_info->name;
+		user_info_list.push_back(user_info);
+	}
+	return true;
+}
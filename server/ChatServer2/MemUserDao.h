@@ -0,0 +1,57 @@
+#pragma once
+#include "UserDao.h"
+#include <unordered_map>
+#include <map>
+#include <mutex>
+#include <atomic>
+
+// MemUserDao：进程内的UserDao实现，不需要mysql，用于单机部署和压测
+// 用户、好友列表和收到的好友申请按uid分片保存，每个分片一把锁；
+// 用户名和邮箱的索引只在注册、按名字查询时使用，单独一把锁。
+// [Storage] SeedUsers大于0时启动预置SeedUsers个用户(uid从SeedUidStart开始)，和LoadGen的压测用户一致
+class MemUserDao : public UserDao
+{
+public:
+	MemUserDao(size_t shard_count);
+	~MemUserDao();
+	int RegUser(const std::string& name, const std::string& email, const std::string& pwd) override;
+	bool CheckEmail(const std::string& name, const std::string & email) override;
+	bool UpdatePwd(const std::string& name, const std::string& newpwd) override;
+	bool CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) override;
+	bool AddFriendApply(const int& from, const int& to) override;
+	bool AuthFriendApply(const int& from, const int& to) override;
+	bool AddFriend(const int& from, const int& to, std::string back_name) override;
+	std::shared_ptr<UserInfo> GetUser(int uid) override;
+	std::shared_ptr<UserInfo> GetUser(std::string name) override;
+	bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int offset, int limit) override;
+	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info) override;
+private:
+	struct ApplyRecord {
+		int _id;
+		int _from_uid;
+		int _status;
+	};
+
+	struct UserShard {
+		std::mutex _mutex;
+		std::unordered_map<int, UserInfo> _users;
+		// self_id -> (friend_id -> 备注)
+		std::unordered_map<int, std::map<int, std::string>> _friends;
+		// to_uid -> 按申请id递增排列的申请
+		std::unordered_map<int, std::vector<ApplyRecord>> _applies;
+	};
+
+	UserShard& GetShard(int uid);
+	// 加入一个新用户，名字或者邮箱已经存在返回false，调用前需要持有_index_mutex
+	bool AddUser(const UserInfo& user);
+	void SeedUsers(int count, int uid_start);
+	int FindUid(const std::string& name);
+
+	std::vector<std::unique_ptr<UserShard>> _shards;
+	size_t _shard_mask;
+	std::mutex _index_mutex;
+	std::unordered_map<std::string, int> _name_index;
+	std::unordered_map<std::string, int> _email_index;
+	int _next_uid;
+	std::atomic<int> _next_apply_id;
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include "Singleton.h"
+#include "message.pb.h"
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// 某个版本的ChatServer成员表，发布之后不再修改
+struct Membership {
+	Membership() : _version(0) {}
+	uint64_t _version;
+	std::unordered_map<std::string, message::ChatServerInfo> _servers;
+};
+
+//MembershipMgr：向StatusServer注册本服务器并定期心跳续约，配置在 [Membership] 中
+// 心跳带上本地成员表的版本，StatusServer的成员表有变化时在响应里返回完整的列表；
+// 新成员表整体替换旧的快照(RCU)：读者用Snapshot取出shared_ptr后无锁读取，旧快照在最后一个读者释放后销毁。
+// 成员表变化后在心跳线程上依次回调订阅者，ChatGrpcClient据此打开或关闭对端通道，不需要重启
+class MembershipMgr : public Singleton<MembershipMgr>
+{
+	friend class Singleton<MembershipMgr>;
+public:
+	typedef std::function<void(std::shared_ptr<const Membership>)> Listener;
+
+	~MembershipMgr();
+	void Start();
+	// leave为true时通知StatusServer立即移除本服务器；连接交给新进程时由新进程继续心跳，不注销
+	void Stop(bool leave);
+	std::shared_ptr<const Membership> Snapshot();
+	// 本服务器注册的信息，StatusServer分配服务器时返回的就是这里的host和port
+	const message::ChatServerInfo& Self() const;
+	// 订阅时立即用当前快照回调一次，之后每次成员表变化回调
+	void Subscribe(Listener listener);
+private:
+	MembershipMgr();
+	void Run();
+	bool Heartbeat(bool leave);
+
+	message::ChatServerInfo _self;
+	int _heartbeat_ms;
+	std::shared_ptr<const Membership> _members;
+	// 回调订阅者和发布快照互斥，订阅者按版本顺序收到成员表
+	std::mutex _listener_mutex;
+	std::vector<Listener> _listeners;
+	// 上一次心跳是否成功，只在心跳线程上访问
+	bool _b_online;
+	bool _b_start;
+	bool _b_stop;
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::thread _thread;
+};
@@ -30,17 +30,41 @@ public:
 };
 
 class RecvNode :public MsgNode {
-	friend class LogicSystem;
+	friend class LogicQueue;
 public:
 	RecvNode(short max_len, short msg_id);
 private:
 	short _msg_id;
 };
 
+//解析消息头，返回去掉压缩和追踪标志的消息id和消息体长度，都是主机字节序
+//读取消息头和平滑升级后恢复半包时共用
+inline void ParseMsgHead(const char* head, short& msg_id, short& msg_len) {
+	memcpy(&msg_id, head, HEAD_ID_LEN);
+	msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+	msg_id &= ~(MSG_COMPRESS_FLAG | MSG_TRACE_FLAG);
+	memcpy(&msg_len, head + HEAD_ID_LEN, HEAD_DATA_LEN);
+	msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
+}
+
+//解析消息体前面的trace id，高32位在前，都是网络字节序
+inline uint64_t ParseTraceId(const char* data) {
+	uint32_t high = 0;
+	uint32_t low = 0;
+	memcpy(&high, data, 4);
+	memcpy(&low, data + 4, 4);
+	high = boost::asio::detail::socket_ops::network_to_host_long(high);
+	low = boost::asio::detail::socket_ops::network_to_host_long(low);
+	return (static_cast<uint64_t>(high) << 32) | low;
+}
+
 class SendNode:public MsgNode {
 	friend class LogicSystem;
 public:
 	SendNode(const char* msg,short max_len, short msg_id);
+	//在追踪中入队的消息记录trace id和入队时间
+	uint64_t _trace_id;
+	int64_t _enqueue_us;
 private:
 	short _msg_id;
 };
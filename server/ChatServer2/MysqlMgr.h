@@ -1,9 +1,11 @@
 #pragma once
 #include "const.h"
-#include "MysqlDao.h"
+#include "UserDao.h"
 #include "Singleton.h"
 #include <vector>
 
+// MysqlMgr：业务代码访问用户数据的统一入口，具体实现由 [Storage] DaoBackend 决定
+// mysql(默认)使用MysqlDao；memory使用进程内的MemUserDao，不需要mysql
 class MysqlMgr: public Singleton<MysqlMgr>
 {
 	friend class Singleton<MysqlMgr>;
@@ -22,6 +24,6 @@ public:
 	bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info);
 private:
 	MysqlMgr();
-	MysqlDao  _dao;
+	std::unique_ptr<UserDao>  _dao;
 };
 
@@ -0,0 +1,125 @@
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include "message.grpc.pb.h"
+#include "message.pb.h"
+#include "CircuitBreaker.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <json/json.h>
+
+// 一个发给对端的事件，_offline是对端不可用时写入接收方离线消息列表的内容，只有聊天消息有
+struct PeerEventItem {
+	PeerEventItem() : _touid(0), _bytes(0), _start_us(0), _b_written(false) {}
+	message::PeerEvent _event;
+	int _touid;
+	Json::Value _offline;
+	size_t _bytes;
+	int64_t _start_us;
+	// 已经写到流上过，对端可能已经处理
+	bool _b_written;
+	std::chrono::steady_clock::time_point _enqueue_time;
+	std::chrono::steady_clock::time_point _send_time;
+};
+
+struct PeerChannelConfig {
+	int _batch_size;
+	size_t _batch_bytes;
+	int _flush_us;
+	int _ack_timeout_ms;
+	size_t _max_pending;
+	int _breaker_failures;
+	int _breaker_open_ms;
+};
+
+// PeerSeq：发往每个对端的事件序号，进程内共享
+// epoch在进程启动后只生成一次，每个对端一个seq计数器；成员表变化重建到同一个对端的通道时，
+// 新通道接着旧通道的seq往下编，对端按(epoch, seq)去重的状态不会因为换通道被重置
+class PeerSeq
+{
+public:
+	static uint64_t Epoch();
+	// 到对端name的seq计数器，同一个对端的通道共用
+	static std::shared_ptr<std::atomic<uint64_t>> Counter(const std::string& name);
+};
+
+// PeerSender：把事件发给一个对端ChatServer，网格模式下是PeerChannel，broker模式下是BrokerChannel
+class PeerSender
+{
+public:
+	typedef std::function<void(PeerEventItem&)> Fallback;
+
+	virtual ~PeerSender() {}
+	// 放进发送队列后立即返回，发不出去的事件交给fallback
+	virtual void Post(PeerEventItem item) = 0;
+	// 发完或者降级处理完积压的事件后返回，之后Post的事件直接降级
+	virtual void Stop() = 0;
+};
+
+// PeerChannel：到一个对端ChatServer的长连接双向流 DeliverStream
+// Post把事件放进待发送队列后立即返回，发送线程在攒够BatchSize个(或BatchBytes字节)事件、或者最早的事件等了FlushUs微秒后，
+// 把队列里的事件合成一个PeerBatch写出去；对端处理完一批回复累计确认PeerAck，确认之前事件留在未确认队列。
+// 流断开后重新建流，未确认的事件按原来的seq重发，对端按(epoch, seq)去重；
+// 熔断、建流失败、积压超过MaxInflight时事件交给fallback降级；Write因为对端不读而阻塞超过AckTimeoutMs时看门狗取消流；
+// Stop时写出过但没等到确认的事件对端可能已经处理，不再降级，避免接收方从离线消息里再收到一次
+class PeerChannel : public PeerSender
+{
+public:
+	PeerChannel(const std::string& self_name, const std::string& name, const std::string& host,
+		const std::string& port, const PeerChannelConfig& config, Fallback fallback);
+	~PeerChannel();
+	void Post(PeerEventItem item) override;
+	// 发完待发送的事件并等对端确认，最多等AckTimeoutMs，剩下的事件走降级
+	void Stop() override;
+private:
+	typedef grpc::ClientReaderWriter<message::PeerBatch, message::PeerAck> Stream;
+
+	void WriteLoop();
+	void ReadLoop(Stream* stream);
+	void WatchLoop();
+	bool OpenStream(std::unique_lock<std::mutex>& lock);
+	void CloseStream(std::unique_lock<std::mutex>& lock);
+	void WriteBatch(std::unique_lock<std::mutex>& lock);
+	// 没写出过的事件降级，写出过的对端可能已经处理，只计数不降级
+	void FallbackAll(std::unique_lock<std::mutex>& lock);
+
+	std::string _self_name;
+	std::string _name;
+	std::unique_ptr<message::ChatService::Stub> _stub;
+	PeerChannelConfig _config;
+	Fallback _fallback;
+	CircuitBreaker _breaker;
+	// 进程内共用，对端据此区分重启前后的seq，见PeerSeq
+	uint64_t _epoch;
+	std::shared_ptr<std::atomic<uint64_t>> _next_seq;
+
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	std::deque<PeerEventItem> _pending;
+	size_t _pending_bytes;
+	std::deque<PeerEventItem> _unacked;
+	bool _b_broken;
+	// 读线程已经退出，流已经结束
+	bool _b_read_closed;
+	bool _b_stop;
+	// 发送线程已经退出，看门狗线程随之退出
+	bool _b_write_exit;
+	// 发送线程阻塞在建流、Write、WritesDone里的截止时间，不在阻塞调用里时是max；
+	// 超过截止时间看门狗取消这个流，阻塞的调用返回失败
+	std::chrono::steady_clock::time_point _call_deadline;
+	// 只有发送线程建流和关流，读线程只用Read
+	std::unique_ptr<grpc::ClientContext> _context;
+	std::unique_ptr<Stream> _stream;
+	std::thread _read_thread;
+	std::thread _write_thread;
+	std::thread _watch_thread;
+
+	std::atomic<uint64_t>* _batch_count;
+	std::atomic<uint64_t>* _event_count;
+	std::atomic<uint64_t>* _resend_count;
+	std::atomic<uint64_t>* _unknown_count;
+};
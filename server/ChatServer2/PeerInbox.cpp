@@ -0,0 +1,84 @@
+#include "PeerInbox.h"
+#include "ConfigMgr.h"
+#include "MetricsMgr.h"
+#include "const.h"
+
+// [Broker] 没有配置时的默认值
+#define BROKER_DEFAULT_READ_COUNT  64
+#define BROKER_DEFAULT_BLOCK_MS  100
+// 读取失败(redis不可用)后的重试间隔
+#define BROKER_RETRY_MS  1000
+
+static int CfgIntOr(const std::string& key, int def) {
+	auto value = ConfigMgr::Inst()["Broker"][key];
+	return value.empty() ? def : atoi(value.c_str());
+}
+
+PeerInbox::PeerInbox(const std::string& name, std::shared_ptr<KvStore> store, Handler handler)
+	: _name(name), _inbox(PEER_INBOX_PREFIX + name), _store(store), _handler(handler), _b_stop(false) {
+	_read_count = (std::max)(CfgIntOr("ReadCount", BROKER_DEFAULT_READ_COUNT), 1);
+	_block_ms = (std::max)(CfgIntOr("BlockMs", BROKER_DEFAULT_BLOCK_MS), 1);
+
+	auto metrics = MetricsMgr::GetInstance();
+	_batch_count = metrics->GetCounter("chat_inbox_batch_total");
+	_error_count = metrics->GetCounter("chat_inbox_error_total");
+}
+
+PeerInbox::~PeerInbox() {
+	Stop();
+}
+
+void PeerInbox::Start() {
+	// Stop之后可以重新Start，平滑升级失败时从保存的位置继续消费
+	if (_thread.joinable()) {
+		return;
+	}
+	_b_stop = false;
+	_thread = std::thread([this]() {
+		Run();
+	});
+}
+
+void PeerInbox::Stop() {
+	_b_stop = true;
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+void PeerInbox::Run() {
+	// 第一次启动时没有位置，从收件箱里现有的第一条开始
+	auto last_id = _store->HGet(PEER_INBOX_OFFSET, _name);
+	if (last_id.empty()) {
+		last_id = "0";
+	}
+	std::cout << "peer inbox [" << _inbox << "] consume from " << last_id << std::endl;
+
+	std::vector<std::pair<std::string, std::string>> entries;
+	while (!_b_stop) {
+		entries.clear();
+		if (!_store->XRead(_inbox, last_id, _read_count, _block_ms, entries)) {
+			_error_count->fetch_add(1, std::memory_order_relaxed);
+			std::cout << "peer inbox [" << _inbox << "] read failed" << std::endl;
+			std::this_thread::sleep_for(std::chrono::milliseconds(BROKER_RETRY_MS));
+			continue;
+		}
+		if (entries.empty()) {
+			continue;
+		}
+
+		message::PeerBatch batch;
+		for (auto& entry : entries) {
+			// 解析失败的批次跳过，不能卡住后面的消息
+			if (!batch.ParseFromString(entry.second)) {
+				_error_count->fetch_add(1, std::memory_order_relaxed);
+				std::cout << "peer inbox [" << _inbox << "] bad batch " << entry.first << std::endl;
+				continue;
+			}
+			_handler(batch);
+		}
+		_batch_count->fetch_add(entries.size(), std::memory_order_relaxed);
+		last_id = entries.back().first;
+		_store->HSet(PEER_INBOX_OFFSET, _name, last_id);
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "KvStore.h"
+#include "message.pb.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+//PeerInbox：broker模式下消费本服务器的收件箱 PEER_INBOX_PREFIX+服务器名，配置在 [Broker] 中
+// 读线程每次阻塞读取最多ReadCount条(每条是对端BrokerChannel追加的一个PeerBatch)，没有消息时最多等BlockMs，
+// 按顺序交给handler处理后把最后一条的id写入 PEER_INBOX_OFFSET，重启后从这里继续读；
+// 处理完还没写入位置时进程退出的那几批会重新处理，由handler按(epoch, seq)去重
+class PeerInbox
+{
+public:
+	typedef std::function<void(const message::PeerBatch&)> Handler;
+
+	// store：读线程专用的存储，阻塞读取会一直占用一个连接
+	PeerInbox(const std::string& name, std::shared_ptr<KvStore> store, Handler handler);
+	~PeerInbox();
+	void Start();
+	// 等读线程处理完当前这批并保存位置后返回，最多多等一个BlockMs
+	void Stop();
+private:
+	void Run();
+
+	std::string _name;
+	std::string _inbox;
+	std::shared_ptr<KvStore> _store;
+	Handler _handler;
+	int _read_count;
+	int _block_ms;
+	std::atomic<bool> _b_stop;
+	std::thread _thread;
+
+	std::atomic<uint64_t>* _batch_count;
+	std::atomic<uint64_t>* _error_count;
+};
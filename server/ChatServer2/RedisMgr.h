@@ -1,154 +1,12 @@
 #pragma once
 #include "const.h"
-#include "hiredis.h"
-#include <queue>
-#include <atomic>
-#include <mutex>
+#include "KvStore.h"
+#include <vector>
 #include "Singleton.h"
-class RedisConPool {
-public:
-	RedisConPool(size_t poolSize, const char* host, int port, const char* pwd)
-		: poolSize_(poolSize), host_(host), port_(port), b_stop_(false), pwd_(pwd), counter_(0){
-		for (size_t i = 0; i < poolSize_; ++i) {
-			auto* context = redisConnect(host, port);
-			if (context == nullptr || context->err != 0) {
-				if (context != nullptr) {
-					redisFree(context);
-				}
-				continue;
-			}
-
-			auto reply = (redisReply*)redisCommand(context, "AUTH %s", pwd);
-			if (reply->type == REDIS_REPLY_ERROR) {
-				std::cout << "֤ʧ" << std::endl;
-				//ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-				freeReplyObject(reply);
-				continue;
-			}
-
-			//ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-			freeReplyObject(reply);
-			std::cout << "֤ɹ" << std::endl;
-			connections_.push(context);
-		}
-
-		check_thread_ = std::thread([this]() {
-			while (!b_stop_) {
-				counter_++;
-				if (counter_ >= 60) {
-					checkThread();
-					counter_ = 0;
-				}
-
-				std::this_thread::sleep_for(std::chrono::seconds(1)); // ÿ 30 뷢һ PING 
-			}	
-		});
-
-	}
-
-	~RedisConPool() {
-
-	}
-
-	void ClearConnections() {
-		std::lock_guard<std::mutex> lock(mutex_);
-		while (!connections_.empty()) {
-			auto* context = connections_.front();
-			redisFree(context);
-			connections_.pop();
-		}
-	}
-
-	redisContext* getConnection() {
-		std::unique_lock<std::mutex> lock(mutex_);
-		cond_.wait(lock, [this] { 
-			if (b_stop_) {
-				return true;
-			}
-			return !connections_.empty(); 
-			});
-		//ֱֹͣӷؿָ
-		if (b_stop_) {
-			return  nullptr;
-		}
-		auto* context = connections_.front();
-		connections_.pop();
-		return context;
-	}
-
-	void returnConnection(redisContext* context) {
-		std::lock_guard<std::mutex> lock(mutex_);
-		if (b_stop_) {
-			return;
-		}
-		connections_.push(context);
-		cond_.notify_one();
-	}
-
-	void Close() {
-		b_stop_ = true;
-		cond_.notify_all();
-		check_thread_.join();
-	}
-
-private:
-	void checkThread() {
-		std::lock_guard<std::mutex> lock(mutex_);
-		if (b_stop_) {
-			return;
-		}
-		auto pool_size = connections_.size();
-		for (int i = 0; i < pool_size && !b_stop_; i++) {
-			auto* context = connections_.front();
-			connections_.pop();
-			try {
-				auto reply = (redisReply*)redisCommand(context, "PING");
-				if (!reply) {
-					std::cout << "reply is null, redis ping failed: " << std::endl;
-					connections_.push(context);
-					continue;
-				}
-				freeReplyObject(reply);
-				connections_.push(context);
-			}
-			catch(std::exception& exp){
-				std::cout << "Error keeping connection alive: " << exp.what() << std::endl;
-				redisFree(context);
-				context = redisConnect(host_, port_);
-				if (context == nullptr || context->err != 0) {
-					if (context != nullptr) {
-						redisFree(context);
-					}
-					continue;
-				}
-
-				auto reply = (redisReply*)redisCommand(context, "AUTH %s", pwd_);
-				if (reply->type == REDIS_REPLY_ERROR) {
-					std::cout << "֤ʧ" << std::endl;
-					//ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-					freeReplyObject(reply);
-					continue;
-				}
-
-				//ִгɹ ͷredisCommandִк󷵻صredisReplyռõڴ
-				freeReplyObject(reply);
-				std::cout << "֤ɹ" << std::endl;
-				connections_.push(context);
-			}
-		}
-	}
-	std::atomic<bool> b_stop_;
-	size_t poolSize_;
-	const char* host_;
-	const char* pwd_;
-	int port_;
-	std::queue<redisContext*> connections_;
-	std::mutex mutex_;
-	std::condition_variable cond_;
-	std::thread  check_thread_;
-	int counter_;
-};
 
+// RedisMgr：业务代码访问键值存储的统一入口，具体实现由 [Storage] KvBackend 决定
+// redis(默认)使用hiredis连接池；memory使用进程内的MemKvStore，不需要redis，
+// 数据只在本进程内可见并且重启后丢失，用于单机部署和压测
 class RedisMgr: public Singleton<RedisMgr>, 
 	public std::enable_shared_from_this<RedisMgr>
 {
@@ -161,18 +19,32 @@ public:
 	bool LPop(const std::string &key, std::string& value);
 	bool RPush(const std::string& key, const std::string& value);
 	bool RPop(const std::string& key, std::string& value);
+	bool LRange(const std::string& key, int start, int stop, std::vector<std::string>& values);
+	bool LTrim(const std::string& key, int start, int stop);
+	bool Incr(const std::string& key, long long& value);
+	bool HIncrBy(const std::string& key, const std::string& hkey, long long delta, long long& value);
 	bool HSet(const std::string &key, const std::string  &hkey, const std::string &value);
 	bool HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen);
 	std::string HGet(const std::string &key, const std::string &hkey);
 	bool HDel(const std::string& key, const std::string& field);
 	bool Del(const std::string &key);
 	bool ExistsKey(const std::string &key);
+	bool Expire(const std::string& key, int seconds);
+	bool XAdd(const std::string& key, const std::string& value, long long maxlen, std::string& id);
+	bool XRead(const std::string& key, const std::string& last_id, int count, int block_ms,
+		std::vector<std::pair<std::string, std::string>>& entries);
+	// 打开一个独立的存储：redis下是新的连接池，给阻塞读取流的线程用，不占用公共连接池；
+	// memory下返回同一个进程内存储，数据互相可见
+	std::shared_ptr<KvStore> OpenStore(size_t pool_size);
 	void Close() {
-		_con_pool->Close();
-		_con_pool->ClearConnections();
+		_store->Close();
+	}
+	// 是否使用进程内存储
+	bool IsMemory() const {
+		return _b_memory;
 	}
 private:
 	RedisMgr();
-	unique_ptr<RedisConPool>  _con_pool;
+	std::shared_ptr<KvStore> _store;
+	bool _b_memory;
 };
-
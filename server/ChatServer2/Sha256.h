@@ -0,0 +1,26 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Sha256：计算文件内容哈希，用于按内容去重存储
+// x86 CPU支持SHA扩展指令(SHA-NI)时使用硬件指令，否则使用软件实现，运行时检测
+class Sha256
+{
+public:
+	Sha256();
+	void Update(const void* data, std::size_t len);
+	// 结束计算，返回64位小写十六进制字符串
+	std::string HexDigest();
+	// 计算整个文件的哈希，失败返回false
+	static bool HashFile(const std::string& path, std::string& hex, long long& size);
+	// 当前CPU是否支持SHA扩展指令
+	static bool HasHardwareSupport();
+private:
+	void Transform(const uint8_t* data, std::size_t blocks);
+
+	uint32_t _state[8];
+	uint8_t _buf[64];
+	std::size_t _buf_len;
+	uint64_t _total_len;
+};
@@ -15,6 +15,8 @@ using message::GetChatServerReq;
 using message::GetChatServerRsp;
 using message::LoginRsp;
 using message::LoginReq;
+using message::HeartbeatReq;
+using message::HeartbeatRsp;
 using message::StatusService;
 
 class StatusConPool {
@@ -46,7 +48,7 @@ public:
 			}
 			return !connections_.empty();
 			});
-		//ֱֹͣӷؿָ
+		//如果停止则直接返回空指针
 		if (b_stop_) {
 			return  nullptr;
 		}
@@ -88,6 +90,8 @@ public:
 	}
 	GetChatServerRsp GetChatServer(int uid);
 	LoginRsp Login(int uid, std::string token);
+	// 带超时的心跳，StatusServer不可用时不会卡住心跳线程
+	HeartbeatRsp Heartbeat(const HeartbeatReq& request, int timeout_ms);
 private:
 	StatusGrpcClient();
 	std::unique_ptr<StatusConPool> pool_;
@@ -0,0 +1,240 @@
+#include "TraceMgr.h"
+#include "ConfigMgr.h"
+#include <boost/asio.hpp>
+#include <json/json.h>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+// 每个线程缓冲区最多保存的span数，后台线程来不及收集时丢弃新的span
+#define TRACE_BUFFER_MAX  8192
+
+static thread_local uint64_t t_trace_id = 0;
+
+TraceScope::TraceScope(uint64_t trace_id) : _prev(t_trace_id) {
+	t_trace_id = trace_id;
+}
+
+TraceScope::~TraceScope() {
+	t_trace_id = _prev;
+}
+
+TraceSpan::TraceSpan(const char* name, const char* tag) : _trace_id(t_trace_id), _name(name), _tag(tag), _start_us(0) {
+	if (_trace_id != 0) {
+		_start_us = TraceMgr::NowMicros();
+	}
+}
+
+TraceSpan::~TraceSpan() {
+	if (_trace_id != 0) {
+		TraceMgr::GetInstance()->Record(_trace_id, _name, _tag, _start_us, TraceMgr::NowMicros() - _start_us);
+	}
+}
+
+TraceMgr::TraceMgr() : _sample_count(0), _id_base(0), _id_count(0), _collector_port(0), _dropped(0), _b_stop(false) {
+	auto& cfg = ConfigMgr::Inst();
+	_server_name = cfg["Trace"]["Name"];
+	if (_server_name.empty()) {
+		_server_name = cfg["SelfServer"]["Name"];
+	}
+	int sample_every = atoi(cfg["Trace"]["SampleEvery"].c_str());
+	_sample_every = sample_every > 0 ? sample_every : 0;
+	_path = cfg["Trace"]["Path"];
+	auto collector = cfg["Trace"]["Collector"];
+	auto pos = collector.rfind(':');
+	if (pos != std::string::npos) {
+		_collector_host = collector.substr(0, pos);
+		_collector_port = static_cast<unsigned short>(atoi(collector.substr(pos + 1).c_str()));
+	}
+	_flush_ms = atoi(cfg["Trace"]["FlushMs"].c_str());
+	if (_flush_ms <= 0) {
+		_flush_ms = 1000;
+	}
+
+	// 没有输出目的地时不记录，Record和TraceSpan只做一次判断
+	_b_enable = !_path.empty() || _collector_port != 0;
+	if (!_b_enable) {
+		return;
+	}
+
+	// 高32位随机，低32位递增，多个进程同时生成也不会重复
+	std::random_device rd;
+	_id_base = (static_cast<uint64_t>(rd()) << 32);
+	if (_id_base == 0) {
+		_id_base = static_cast<uint64_t>(1) << 32;
+	}
+
+	_flush_thread = std::thread([this]() {
+		std::unique_lock<std::mutex> lock(_stop_mutex);
+		while (!_b_stop) {
+			_stop_cond.wait_for(lock, std::chrono::milliseconds(_flush_ms));
+			lock.unlock();
+			Flush();
+			lock.lock();
+		}
+	});
+	std::cout << "trace start, sample every " << _sample_every << ", path " << _path << std::endl;
+}
+
+TraceMgr::~TraceMgr() {
+	Stop();
+}
+
+void TraceMgr::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(_stop_mutex);
+		if (_b_stop) {
+			return;
+		}
+		_b_stop = true;
+	}
+	_stop_cond.notify_one();
+	if (_flush_thread.joinable()) {
+		_flush_thread.join();
+	}
+	// 退出前把剩下的span写出去
+	if (_b_enable) {
+		Flush();
+	}
+}
+
+uint64_t TraceMgr::Sample() {
+	if (!_b_enable || _sample_every == 0) {
+		return 0;
+	}
+	if (_sample_count.fetch_add(1, std::memory_order_relaxed) % _sample_every != 0) {
+		return 0;
+	}
+	return _id_base | (_id_count.fetch_add(1, std::memory_order_relaxed) & 0xffffffff);
+}
+
+uint64_t TraceMgr::Current() {
+	return t_trace_id;
+}
+
+int64_t TraceMgr::NowMicros() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+std::string TraceMgr::ToHex(uint64_t trace_id) {
+	char buf[17];
+	snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(trace_id));
+	return buf;
+}
+
+uint64_t TraceMgr::FromHex(const std::string& hex) {
+	if (hex.empty() || hex.size() > 16) {
+		return 0;
+	}
+	char* end = nullptr;
+	auto trace_id = strtoull(hex.c_str(), &end, 16);
+	if (end != hex.c_str() + hex.size()) {
+		return 0;
+	}
+	return trace_id;
+}
+
+TraceMgr::ThreadBuffer* TraceMgr::GetThreadBuffer() {
+	// 缓冲区由TraceMgr持有，线程退出后剩下的span也能被收集
+	static thread_local ThreadBuffer* t_buffer = nullptr;
+	if (t_buffer == nullptr) {
+		auto buffer = std::make_shared<ThreadBuffer>();
+		std::lock_guard<std::mutex> lock(_buffers_mutex);
+		_buffers.push_back(buffer);
+		t_buffer = buffer.get();
+	}
+	return t_buffer;
+}
+
+void TraceMgr::Record(uint64_t trace_id, const char* name, const std::string& tag, int64_t start_us, int64_t dur_us) {
+	if (!_b_enable || trace_id == 0) {
+		return;
+	}
+
+	auto* buffer = GetThreadBuffer();
+	// 只有后台线程收集时才会和本线程竞争这把锁
+	std::lock_guard<std::mutex> lock(buffer->_mutex);
+	if (buffer->_spans.size() >= TRACE_BUFFER_MAX) {
+		_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	SpanRecord span;
+	span._trace_id = trace_id;
+	span._name = name;
+	span._tag = tag;
+	span._start_us = start_us;
+	span._dur_us = dur_us;
+	buffer->_spans.push_back(std::move(span));
+}
+
+void TraceMgr::Flush() {
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+	{
+		std::lock_guard<std::mutex> lock(_buffers_mutex);
+		buffers = _buffers;
+	}
+
+	std::vector<SpanRecord> spans;
+	for (auto& buffer : buffers) {
+		std::vector<SpanRecord> thread_spans;
+		{
+			std::lock_guard<std::mutex> lock(buffer->_mutex);
+			thread_spans.swap(buffer->_spans);
+		}
+		spans.insert(spans.end(), std::make_move_iterator(thread_spans.begin()),
+			std::make_move_iterator(thread_spans.end()));
+	}
+
+	auto dropped = _dropped.exchange(0);
+	if (dropped > 0) {
+		std::cout << "trace buffer full, dropped " << dropped << " spans" << std::endl;
+	}
+	if (!spans.empty()) {
+		WriteSpans(spans);
+	}
+}
+
+void TraceMgr::WriteSpans(const std::vector<SpanRecord>& spans) {
+	Json::FastWriter writer;
+	std::string lines;
+	for (auto& span : spans) {
+		Json::Value root;
+		root["trace"] = ToHex(span._trace_id);
+		root["server"] = _server_name;
+		root["span"] = span._name;
+		root["tag"] = span._tag;
+		root["start_us"] = (Json::Int64)span._start_us;
+		root["dur_us"] = (Json::Int64)span._dur_us;
+		lines += writer.write(root);
+	}
+
+	if (!_path.empty()) {
+		std::ofstream ofs(_path, std::ios::app | std::ios::binary);
+		if (!ofs) {
+			std::cout << "open trace file " << _path << " failed" << std::endl;
+		}
+		else {
+			ofs << lines;
+		}
+	}
+
+	if (_collector_port != 0) {
+		// 每个span一个UDP包，收集端按行解析；发送失败直接丢弃，不影响服务
+		try {
+			boost::asio::io_context ioc;
+			boost::asio::ip::udp::socket socket(ioc);
+			boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::make_address(_collector_host), _collector_port);
+			socket.open(endpoint.protocol());
+			std::istringstream iss(lines);
+			std::string line;
+			while (std::getline(iss, line)) {
+				boost::system::error_code ec;
+				socket.send_to(boost::asio::buffer(line), endpoint, 0, ec);
+			}
+		}
+		catch (std::exception& exp) {
+			std::cout << "send trace to collector failed, " << exp.what() << std::endl;
+		}
+	}
+}
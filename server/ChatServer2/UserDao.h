@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include "data.h"
+
+// UserDao：用户、好友和好友申请的数据访问接口
+// MysqlDao访问mysql，MemUserDao是进程内实现，由MysqlMgr根据配置选择
+class UserDao
+{
+public:
+	virtual ~UserDao() {}
+	virtual int RegUser(const std::string& name, const std::string& email, const std::string& pwd) = 0;
+	virtual bool CheckEmail(const std::string& name, const std::string & email) = 0;
+	virtual bool UpdatePwd(const std::string& name, const std::string& newpwd) = 0;
+	virtual bool CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) = 0;
+	virtual bool AddFriendApply(const int& from, const int& to) = 0;
+	virtual bool AuthFriendApply(const int& from, const int& to) = 0;
+	virtual bool AddFriend(const int& from, const int& to, std::string back_name) = 0;
+	virtual std::shared_ptr<UserInfo> GetUser(int uid) = 0;
+	virtual std::shared_ptr<UserInfo> GetUser(std::string name) = 0;
+	virtual bool GetApplyList(int touid, std::vector<std::shared_ptr<ApplyInfo>>& applyList, int offset, int limit) = 0;
+	virtual bool GetFriendList(int self_id, std::vector<std::shared_ptr<UserInfo> >& user_info) = 0;
+};
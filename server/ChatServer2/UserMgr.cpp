@@ -27,8 +27,8 @@ void UserMgr::SetUserSession(int uid, std::shared_ptr<CSession> session)
 void UserMgr::RmvUserSession(int uid)
 { 
 	auto uid_str = std::to_string(uid);
-	//Ϊٴε¼Իɱɾkeyעkey
-	// п¼ɾkeyҲkey
+	//因为再次登录可能是其他服务器，所以会造成本服务器删除key，其他服务器注册key的情况
+	// 有可能其他服务登录，本服删除key造成找不到key的情况
 	//RedisMgr::GetInstance()->Del(USERIPPREFIX + uid_str);
 
 	{
@@ -38,6 +38,18 @@ void UserMgr::RmvUserSession(int uid)
 
 }
 
+std::vector<int> UserMgr::GetUids()
+{
+	std::vector<int> uids;
+	std::lock_guard<std::mutex> lock(_session_mtx);
+	uids.reserve(_uid_to_session.size());
+	for (auto& iter : _uid_to_session) {
+		uids.push_back(iter.first);
+	}
+
+	return uids;
+}
+
 UserMgr::UserMgr()
 {
 
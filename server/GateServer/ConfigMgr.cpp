@@ -1,22 +1,22 @@
 #include "ConfigMgr.h"
 ConfigMgr::ConfigMgr(){
-	// ȡǰĿ¼  
+	// 获取当前工作目录  
 	boost::filesystem::path current_path = boost::filesystem::current_path();
-	// config.iniļ·  
+	// 构建config.ini文件的完整路径  
 	boost::filesystem::path config_path = current_path / "config.ini";
 	std::cout << "Config path: " << config_path << std::endl;
 
-	// ʹBoost.PropertyTreeȡINIļ  
+	// 使用Boost.PropertyTree来读取INI文件  
 	boost::property_tree::ptree pt;
 	boost::property_tree::read_ini(config_path.string(), pt);
 
 
-	// INIļеsection  
+	// 遍历INI文件中的所有section  
 	for (const auto& section_pair : pt) {
 		const std::string& section_name = section_pair.first;
 		const boost::property_tree::ptree& section_tree = section_pair.second;
 
-		// ÿsectionеkey-value  
+		// 对于每个section，遍历其所有的key-value对  
 		std::map<std::string, std::string> section_config;
 		for (const auto& key_value_pair : section_tree) {
 			const std::string& key = key_value_pair.first;
@@ -25,11 +25,11 @@ ConfigMgr::ConfigMgr(){
 		}
 		SectionInfo sectionInfo;
 		sectionInfo._section_datas = section_config;
-		// sectionkey-valueԱ浽config_map  
+		// 将section的key-value对保存到config_map中  
 		_config_map[section_name] = sectionInfo;
 	}
 
-	// еsectionkey-value  
+	// 输出所有的section和key-value对  
 	for (const auto& section_entry : _config_map) {
 		const std::string& section_name = section_entry.first;
 		SectionInfo section_config = section_entry.second;
@@ -12,6 +12,8 @@
 #include "RedisMgr.h"
 #include "MysqlMgr.h"
 #include "AsioIOServicePool.h"
+#include "MetricsMgr.h"
+#include "TraceMgr.h"
 
 void TestRedis() {
 	//连接redis 需要启动才可以进行连接
@@ -157,9 +159,13 @@ int main()
         server->Start();
 
 		std::cout << "Gate Server listen on port: " << gate_port << std::endl;
+		// 按 [Metrics] Port 启动指标监听，Prometheus从 /metrics 抓取
+		MetricsMgr::GetInstance()->Start();
 
 		// 运行 I/O 服务
         ioc.run();
+		MetricsMgr::GetInstance()->Stop();
+		TraceMgr::GetInstance()->Stop();
 
 		// 关闭 Redis 连接
 		RedisMgr::GetInstance()->Close();
@@ -55,5 +55,8 @@ private:
 
     // 用于存储 GET 请求的查询参数，使用键值对的方式存储
     std::unordered_map<std::string, std::string> _get_params;
+
+    // 开始读取请求的时间，LogicSystem 用它统计请求从读取到开始处理的等待时间
+    std::chrono::steady_clock::time_point _start_time;
 };
 
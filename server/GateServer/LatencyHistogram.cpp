@@ -0,0 +1,126 @@
+#include "LatencyHistogram.h"
+#include <cmath>
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 最高位1的位置，value必须大于0
+static int Log2Floor(uint64_t value) {
+#ifdef _MSC_VER
+	unsigned long index = 0;
+	_BitScanReverse64(&index, value);
+	return static_cast<int>(index);
+#else
+	return 63 - __builtin_clzll(value);
+#endif
+}
+
+LatencyHistogram::LatencyHistogram(int64_t highest, int significant)
+	: _highest(highest), _total(0), _sum(0), _max(0) {
+	// 每段至少要有2*10^significant个细分桶，才能保证significant位有效数字
+	int64_t largest_single_unit = 2 * static_cast<int64_t>(std::pow(10, significant));
+	int sub_bucket_count_magnitude = static_cast<int>(std::ceil(std::log2(static_cast<double>(largest_single_unit))));
+	_sub_bucket_half_count_magnitude = sub_bucket_count_magnitude - 1;
+	_sub_bucket_count = 1 << sub_bucket_count_magnitude;
+	_sub_bucket_half_count = _sub_bucket_count / 2;
+	_sub_bucket_mask = _sub_bucket_count - 1;
+
+	// 第一段覆盖[0, sub_bucket_count)，之后每段量程翻倍，直到覆盖上限
+	int64_t smallest_untrackable = _sub_bucket_count;
+	_bucket_count = 1;
+	while (smallest_untrackable <= _highest) {
+		smallest_untrackable <<= 1;
+		++_bucket_count;
+	}
+
+	// 除第一段外每段的前一半和上一段重叠，只保存后一半
+	_counts_len = (_bucket_count + 1) * _sub_bucket_half_count;
+	_counts.reset(new std::atomic<uint64_t>[_counts_len]);
+	for (int i = 0; i < _counts_len; ++i) {
+		_counts[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+int LatencyHistogram::BucketIndex(int64_t value) const {
+	int pow2_ceiling = Log2Floor(static_cast<uint64_t>(value | _sub_bucket_mask)) + 1;
+	return pow2_ceiling - (_sub_bucket_half_count_magnitude + 1);
+}
+
+int LatencyHistogram::CountsIndex(int64_t value) const {
+	int bucket_index = BucketIndex(value);
+	int sub_bucket_index = static_cast<int>(value >> bucket_index);
+	return ((bucket_index + 1) << _sub_bucket_half_count_magnitude) + (sub_bucket_index - _sub_bucket_half_count);
+}
+
+int64_t LatencyHistogram::ValueFromIndex(int index) const {
+	int bucket_index = (index >> _sub_bucket_half_count_magnitude) - 1;
+	int sub_bucket_index = (index & (_sub_bucket_half_count - 1)) + _sub_bucket_half_count;
+	if (bucket_index < 0) {
+		sub_bucket_index -= _sub_bucket_half_count;
+		bucket_index = 0;
+	}
+	return static_cast<int64_t>(sub_bucket_index) << bucket_index;
+}
+
+int64_t LatencyHistogram::HighestEquivalent(int64_t value) const {
+	int bucket_index = BucketIndex(value);
+	int64_t lowest = (value >> bucket_index) << bucket_index;
+	return lowest + (static_cast<int64_t>(1) << bucket_index) - 1;
+}
+
+void LatencyHistogram::Record(int64_t value) {
+	value = (std::max)(static_cast<int64_t>(0), (std::min)(value, _highest));
+	_counts[CountsIndex(value)].fetch_add(1, std::memory_order_relaxed);
+	_total.fetch_add(1, std::memory_order_relaxed);
+	_sum.fetch_add(static_cast<uint64_t>(value), std::memory_order_relaxed);
+
+	// 大多数样本都不会刷新最大值，只有比当前最大值大时才CAS
+	uint64_t cur_max = _max.load(std::memory_order_relaxed);
+	while (static_cast<uint64_t>(value) > cur_max
+		&& !_max.compare_exchange_weak(cur_max, static_cast<uint64_t>(value), std::memory_order_relaxed)) {
+	}
+}
+
+void LatencyHistogram::GetSnapshot(Snapshot& snapshot) const {
+	// 各个计数不是同一时刻读出来的，导出前以桶计数之和为准重新算总数，保证分位数和le桶自洽
+	snapshot._counts.resize(_counts_len);
+	uint64_t total = 0;
+	for (int i = 0; i < _counts_len; ++i) {
+		snapshot._counts[i] = _counts[i].load(std::memory_order_relaxed);
+		total += snapshot._counts[i];
+	}
+	snapshot._total = total;
+	snapshot._sum = _sum.load(std::memory_order_relaxed);
+	snapshot._max = _max.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::Percentile(const Snapshot& snapshot, double percentile) const {
+	if (snapshot._total == 0) {
+		return 0;
+	}
+
+	percentile = (std::max)(0.0, (std::min)(percentile, 100.0));
+	uint64_t target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * snapshot._total));
+	target = (std::max)(target, static_cast<uint64_t>(1));
+	uint64_t seen = 0;
+	for (size_t i = 0; i < snapshot._counts.size(); ++i) {
+		seen += snapshot._counts[i];
+		if (seen >= target) {
+			return (std::min)(HighestEquivalent(ValueFromIndex(static_cast<int>(i))), static_cast<int64_t>(snapshot._max));
+		}
+	}
+	return static_cast<int64_t>(snapshot._max);
+}
+
+uint64_t LatencyHistogram::CountAtOrBelow(const Snapshot& snapshot, int64_t value) const {
+	uint64_t count = 0;
+	for (size_t i = 0; i < snapshot._counts.size(); ++i) {
+		// 下标按值递增，桶的下界超过value之后的桶都不算
+		if (ValueFromIndex(static_cast<int>(i)) > value) {
+			break;
+		}
+		count += snapshot._counts[i];
+	}
+	return count;
+}
@@ -3,6 +3,7 @@
 #include <functional>
 #include <map>
 #include "const.h"
+#include "MetricsMgr.h"
 
 class HttpConnection;
 typedef std::function<void(std::shared_ptr<HttpConnection>)> HttpHandler;
@@ -17,7 +18,14 @@ public:
 	bool HandlePost(std::string, std::shared_ptr<HttpConnection>);
 private:
 	LogicSystem();
+	// 查找并调用路由对应的处理函数，记录等待和执行时间，找不到返回false
+	bool Dispatch(std::map<std::string, HttpHandler>& handlers, std::map<std::string, LatencyMetric*>& metrics,
+		const std::string& path, std::shared_ptr<HttpConnection> con);
 	std::map<std::string, HttpHandler> _post_handlers;
 	std::map<std::string, HttpHandler> _get_handlers;
+	// 每个路由的延迟统计，注册路由时创建
+	std::map<std::string, LatencyMetric*> _post_metrics;
+	std::map<std::string, LatencyMetric*> _get_metrics;
+	std::atomic<uint64_t>* _not_found_count;
 };
 
@@ -0,0 +1,82 @@
+#pragma once
+#include "KvStore.h"
+#include <unordered_map>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+// MemKvStore：进程内的KvStore实现，不需要redis，用于单机部署和压测
+// 按key的哈希分成shard_count个分片，每个分片一把锁，不同分片上的操作互不阻塞。
+// 支持字符串、列表和哈希三种类型，对已有键做类型不符的操作和redis一样返回失败。
+// 过期的键在访问时删除，后台线程每秒再清理一遍没有被访问到的过期键。
+class MemKvStore : public KvStore
+{
+public:
+	// shard_count会向上取整为2的幂
+	MemKvStore(size_t shard_count);
+	~MemKvStore();
+	bool Get(const std::string& key, std::string& value) override;
+	bool Set(const std::string& key, const std::string& value) override;
+	bool LPush(const std::string& key, const std::string& value) override;
+	bool LPop(const std::string& key, std::string& value) override;
+	bool RPush(const std::string& key, const std::string& value) override;
+	bool RPop(const std::string& key, std::string& value) override;
+	bool LRange(const std::string& key, int start, int stop, std::vector<std::string>& values) override;
+	bool LTrim(const std::string& key, int start, int stop) override;
+	bool Incr(const std::string& key, long long& value) override;
+	bool HIncrBy(const std::string& key, const std::string& hkey, long long delta, long long& value) override;
+	bool HSet(const std::string& key, const std::string& hkey, const std::string& value) override;
+	bool HSet(const char* key, const char* hkey, const char* hvalue, size_t hvaluelen) override;
+	std::string HGet(const std::string& key, const std::string& hkey) override;
+	bool HDel(const std::string& key, const std::string& field) override;
+	bool Del(const std::string& key) override;
+	bool ExistsKey(const std::string& key) override;
+	bool Expire(const std::string& key, int seconds) override;
+	void Close() override;
+private:
+	typedef std::chrono::steady_clock KvClock;
+	enum KvType {
+		KV_STRING,
+		KV_LIST,
+		KV_HASH,
+	};
+
+	// 列表和哈希按需分配，字符串键不额外占用容器的内存
+	struct KvEntry {
+		KvEntry(KvType type);
+		KvType _type;
+		std::string _str;
+		std::unique_ptr<std::deque<std::string>> _list;
+		std::unique_ptr<std::unordered_map<std::string, std::string>> _hash;
+		bool _b_expire;
+		KvClock::time_point _expire;
+	};
+
+	struct KvShard {
+		KvShard() : _b_has_expire(false) {}
+		std::mutex _mutex;
+		std::unordered_map<std::string, KvEntry> _map;
+		// 分片里是否可能有带过期时间的键，没有的分片后台清理时直接跳过
+		bool _b_has_expire;
+	};
+
+	KvShard& GetShard(const std::string& key);
+	// 以下两个函数必须持有分片的锁调用
+	// 查找未过期的键，过期的直接删除，找不到返回nullptr
+	KvEntry* Find(KvShard& shard, const std::string& key);
+	// 查找或者创建指定类型的键，已有键的类型不一致返回nullptr
+	KvEntry* FindOrCreate(KvShard& shard, const std::string& key, KvType type);
+	bool Push(const std::string& key, const std::string& value, bool b_left);
+	bool Pop(const std::string& key, std::string& value, bool b_left);
+	// 按redis的规则把负数下标换算成正数，区间为空返回false
+	static bool NormalizeRange(long long size, int start, int stop, long long& begin, long long& end);
+	void SweepExpired();
+
+	std::vector<std::unique_ptr<KvShard>> _shards;
+	size_t _shard_mask;
+	std::atomic<bool> _b_stop;
+	std::thread _sweep_thread;
+};
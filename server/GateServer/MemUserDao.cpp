@@ -0,0 +1,124 @@
+#include "MemUserDao.h"
+#include <iostream>
+
+MemUserDao::MemUserDao(size_t shard_count) : _next_uid(1) {
+	size_t count = 1;
+	while (count < shard_count) {
+		count <<= 1;
+	}
+	for (size_t i = 0; i < count; ++i) {
+		_shards.emplace_back(new UserShard());
+	}
+	_shard_mask = count - 1;
+	std::cout << "mem user dao start with " << count << " shards" << std::endl;
+}
+
+MemUserDao::~MemUserDao() {
+
+}
+
+MemUserDao::UserShard& MemUserDao::GetShard(int uid) {
+	return *_shards[static_cast<size_t>(uid) & _shard_mask];
+}
+
+int MemUserDao::FindUid(const std::unordered_map<std::string, int>& index, const std::string& key) {
+	std::lock_guard<std::mutex> lock(_index_mutex);
+	auto iter = index.find(key);
+	if (iter == index.end()) {
+		return -1;
+	}
+	return iter->second;
+}
+
+bool MemUserDao::GetUser(int uid, UserInfo& user) {
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._users.find(uid);
+	if (iter == shard._users.end()) {
+		return false;
+	}
+	user = iter->second;
+	return true;
+}
+
+int MemUserDao::RegUser(const std::string& name, const std::string& email, const std::string& pwd) {
+	return RegUserTransaction(name, email, pwd, "");
+}
+
+// GateServer不读取头像，进程内存储不保存icon
+int MemUserDao::RegUserTransaction(const std::string& name, const std::string& email, const std::string& pwd,
+	const std::string& icon) {
+	std::lock_guard<std::mutex> lock(_index_mutex);
+	if (_email_index.count(email) > 0) {
+		std::cout << "email " << email << " exist";
+		return 0;
+	}
+	if (_name_index.count(name) > 0) {
+		std::cout << "name " << name << " exist";
+		return 0;
+	}
+
+	UserInfo user;
+	user.uid = _next_uid++;
+	user.name = name;
+	user.email = email;
+	user.pwd = pwd;
+	_name_index[name] = user.uid;
+	_email_index[email] = user.uid;
+
+	auto& shard = GetShard(user.uid);
+	std::lock_guard<std::mutex> shard_lock(shard._mutex);
+	shard._users[user.uid] = user;
+	return user.uid;
+}
+
+bool MemUserDao::CheckEmail(const std::string& name, const std::string& email) {
+	UserInfo user;
+	int uid = FindUid(_name_index, name);
+	if (uid < 0 || !GetUser(uid, user)) {
+		return false;
+	}
+	return user.email == email;
+}
+
+bool MemUserDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
+	int uid = FindUid(_name_index, name);
+	if (uid < 0) {
+		return false;
+	}
+
+	auto& shard = GetShard(uid);
+	std::lock_guard<std::mutex> lock(shard._mutex);
+	auto iter = shard._users.find(uid);
+	if (iter == shard._users.end()) {
+		return false;
+	}
+	iter->second.pwd = newpwd;
+	return true;
+}
+
+bool MemUserDao::CheckPwd(const std::string& email, const std::string& pwd, UserInfo& userInfo) {
+	UserInfo user;
+	int uid = FindUid(_email_index, email);
+	if (uid < 0 || !GetUser(uid, user)) {
+		return false;
+	}
+
+	if (pwd != user.pwd) {
+		return false;
+	}
+	userInfo = user;
+	return true;
+}
+
+bool MemUserDao::TestProcedure(const std::string& email, int& uid, std::string& name) {
+	UserInfo user;
+	int find_uid = FindUid(_email_index, email);
+	if (find_uid < 0 || !GetUser(find_uid, user)) {
+		return false;
+	}
+
+	uid = user.uid;
+	name = user.name;
+	return true;
+}
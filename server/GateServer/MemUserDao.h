@@ -0,0 +1,38 @@
+#pragma once
+#include "UserDao.h"
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+// MemUserDao：进程内的UserDao实现，不需要mysql，用于单机部署和压测
+// 用户按uid分片保存，每个分片一把锁；用户名和邮箱到uid的索引单独一把锁
+class MemUserDao : public UserDao
+{
+public:
+	MemUserDao(size_t shard_count);
+	~MemUserDao();
+	int RegUser(const std::string& name, const std::string& email, const std::string& pwd) override;
+	int RegUserTransaction(const std::string& name, const std::string& email, const std::string& pwd, const std::string& icon) override;
+	bool CheckEmail(const std::string& name, const std::string & email) override;
+	bool UpdatePwd(const std::string& name, const std::string& newpwd) override;
+	bool CheckPwd(const std::string& email, const std::string& pwd, UserInfo& userInfo) override;
+	bool TestProcedure(const std::string& email, int& uid, std::string& name) override;
+private:
+	struct UserShard {
+		std::mutex _mutex;
+		std::unordered_map<int, UserInfo> _users;
+	};
+
+	UserShard& GetShard(int uid);
+	// 按索引找到uid，找不到返回-1
+	int FindUid(const std::unordered_map<std::string, int>& index, const std::string& key);
+	bool GetUser(int uid, UserInfo& user);
+
+	std::vector<std::unique_ptr<UserShard>> _shards;
+	size_t _shard_mask;
+	std::mutex _index_mutex;
+	std::unordered_map<std::string, int> _name_index;
+	std::unordered_map<std::string, int> _email_index;
+	int _next_uid;
+};
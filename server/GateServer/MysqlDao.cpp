@@ -1,4 +1,5 @@
 #include "MysqlDao.h"
+#include "MetricsMgr.h"
 #include "ConfigMgr.h"
 
 MysqlDao::MysqlDao()
@@ -18,26 +19,31 @@ MysqlDao::~MysqlDao(){
 
 int MysqlDao::RegUser(const std::string& name, const std::string& email, const std::string& pwd)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "RegUser");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
-		// ׼ô洢
+		// 准备调用存储过程
 		unique_ptr < sql::PreparedStatement > stmt(con->_con->prepareStatement("CALL reg_user(?,?,?,@result)"));
-		// 
+		// 设置输入参数
 		stmt->setString(1, name);
 		stmt->setString(2, email);
 		stmt->setString(3, pwd);
 
-		// PreparedStatementֱ֧עҪʹûỰȡֵ
+		// 由于PreparedStatement不直接支持注册输出参数，我们需要使用会话变量或其他方法来获取输出参数的值
 
-		  // ִд洢
+		  // 执行存储过程
 		stmt->execute();
-		// 洢˻ỰʽȡִֵSELECTѯȡ
-	   // 磬洢һỰ@result洢ȡ
+		timer.Executed();
+		// 如果存储过程设置了会话变量或有其他方式获取输出参数的值，你可以在这里执行SELECT查询来获取它们
+	   // 例如，如果存储过程设置了一个会话变量@result来存储输出结果，可以这样获取：
 	   unique_ptr<sql::Statement> stmtResult(con->_con->createStatement());
 	  unique_ptr<sql::ResultSet> res(stmtResult->executeQuery("SELECT @result AS result"));
+	  timer.Executed();
 	  if (res->next()) {
 	       int result = res->getInt("result");
 	      cout << "Result: " << result << endl;
@@ -59,7 +65,10 @@ int MysqlDao::RegUser(const std::string& name, const std::string& email, const s
 int MysqlDao::RegUserTransaction(const std::string& name, const std::string& email, const std::string& pwd, 
 	const std::string& icon)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "RegUserTransaction");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -69,18 +78,19 @@ int MysqlDao::RegUserTransaction(const std::string& name, const std::string& ema
 	});
 
 	try {
-		//ʼ
+		//开始事务
 		con->_con->setAutoCommit(false);
-		//ִеһݿemailû
-			// ׼ѯ
+		//执行第一个数据库操作，根据email查找用户
+			// 准备查询语句
 
 		std::unique_ptr<sql::PreparedStatement> pstmt_email(con->_con->prepareStatement("SELECT 1 FROM user WHERE email = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt_email->setString(1, email);
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res_email(pstmt_email->executeQuery());
+		timer.Executed();
 
 		auto email_exist = res_email->next();
 		if (email_exist) {
@@ -89,14 +99,15 @@ int MysqlDao::RegUserTransaction(const std::string& name, const std::string& ema
 			return 0;
 		}
 
-		// ׼ѯûǷظ
+		// 准备查询用户名是否重复
 		std::unique_ptr<sql::PreparedStatement> pstmt_name(con->_con->prepareStatement("SELECT 1 FROM user WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt_name->setString(1, name);
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res_name(pstmt_name->executeQuery());
+		timer.Executed();
 
 		auto name_exist = res_name->next();
 		if (name_exist) {
@@ -105,17 +116,19 @@ int MysqlDao::RegUserTransaction(const std::string& name, const std::string& ema
 			return 0;
 		}
 
-		// ׼ûid
+		// 准备更新用户id
 		std::unique_ptr<sql::PreparedStatement> pstmt_upid(con->_con->prepareStatement("UPDATE user_id SET id = id + 1"));
 
-		// ִи
+		// 执行更新
 		pstmt_upid->executeUpdate();
+		timer.Executed();
 
-		// ȡº id ֵ
+		// 获取更新后的 id 值
 		std::unique_ptr<sql::PreparedStatement> pstmt_uid(con->_con->prepareStatement("SELECT id FROM user_id"));
 		std::unique_ptr<sql::ResultSet> res_uid(pstmt_uid->executeQuery());
+		timer.Executed();
 		int newId = 0;
-		// 
+		// 处理结果集
 		if (res_uid->next()) {
 			newId = res_uid->getInt("id");
 		}
@@ -125,7 +138,7 @@ int MysqlDao::RegUserTransaction(const std::string& name, const std::string& ema
 			return -1;
 		}
 
-		// userϢ
+		// 插入user信息
 		std::unique_ptr<sql::PreparedStatement> pstmt_insert(con->_con->prepareStatement("INSERT INTO user (uid, name, email, pwd, nick, icon) "
 			"VALUES (?, ?, ?, ?,?,?)"));
 		pstmt_insert->setInt(1,newId);
@@ -134,15 +147,16 @@ int MysqlDao::RegUserTransaction(const std::string& name, const std::string& ema
 		pstmt_insert->setString(4, pwd);
 		pstmt_insert->setString(5, name);
 		pstmt_insert->setString(6, icon);
-		//ִв
+		//执行插入
 		pstmt_insert->executeUpdate();
-		// ύ
+		timer.Executed();
+		// 提交事务
 		con->_con->commit();
 		std::cout << "newuser insert into user success" << std::endl;
 		return newId;
 	}
 	catch (sql::SQLException& e) {
-		// 󣬻ع
+		// 如果发生错误，回滚事务
 		if (con) {
 			con->_con->rollback();
 		}
@@ -154,22 +168,26 @@ int MysqlDao::RegUserTransaction(const std::string& name, const std::string& ema
 }
 
 bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "CheckEmail");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
 
-		// ׼ѯ
+		// 准备查询语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT email FROM user WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt->setString(1, name);
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			std::cout << "Check Email: " << res->getString("email") << std::endl;
 			if (email != res->getString("email")) {
@@ -191,21 +209,25 @@ bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
 }
 
 bool MysqlDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "UpdatePwd");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
 
-		// ׼ѯ
+		// 准备查询语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("UPDATE user SET pwd = ? WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt->setString(2, name);
 		pstmt->setString(1, newpwd);
 
-		// ִи
+		// 执行更新
 		int updateCount = pstmt->executeUpdate();
+		timer.Executed();
 
 		std::cout << "Updated rows: " << updateCount << std::endl;
 		pool_->returnConnection(std::move(con));
@@ -221,7 +243,10 @@ bool MysqlDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
 }
 
 bool MysqlDao::CheckPwd(const std::string& email, const std::string& pwd, UserInfo& userInfo) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "CheckPwd");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -233,17 +258,18 @@ bool MysqlDao::CheckPwd(const std::string& email, const std::string& pwd, UserIn
 	try {
 	
 
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT * FROM user WHERE email = ?"));
-		pstmt->setString(1, email); // username滻ΪҪѯû
+		pstmt->setString(1, email); // 将username替换为你要查询的用户名
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 		std::string origin_pwd = "";
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			origin_pwd = res->getString("pwd");
-			// ѯ
+			// 输出查询到的密码
 			std::cout << "Password: " << origin_pwd << std::endl;
 			break;
 		}
@@ -266,7 +292,10 @@ bool MysqlDao::CheckPwd(const std::string& email, const std::string& pwd, UserIn
 }
 
 bool MysqlDao::TestProcedure(const std::string& email, int& uid, string& name) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "TestProcedure");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
@@ -275,19 +304,21 @@ bool MysqlDao::TestProcedure(const std::string& email, int& uid, string& name) {
 		Defer defer([this, &con]() {
 			pool_->returnConnection(std::move(con));
 			});
-		// ׼ô洢
+		// 准备调用存储过程
 		unique_ptr < sql::PreparedStatement > stmt(con->_con->prepareStatement("CALL test_procedure(?,@userId,@userName)"));
-		// 
+		// 设置输入参数
 		stmt->setString(1, email);
 		
-		// PreparedStatementֱ֧עҪʹûỰȡֵ
+		// 由于PreparedStatement不直接支持注册输出参数，我们需要使用会话变量或其他方法来获取输出参数的值
 
-		  // ִд洢
+		  // 执行存储过程
 		stmt->execute();
-		// 洢˻ỰʽȡִֵSELECTѯȡ
-	   // 磬洢һỰ@result洢ȡ
+		timer.Executed();
+		// 如果存储过程设置了会话变量或有其他方式获取输出参数的值，你可以在这里执行SELECT查询来获取它们
+	   // 例如，如果存储过程设置了一个会话变量@result来存储输出结果，可以这样获取：
 		unique_ptr<sql::Statement> stmtResult(con->_con->createStatement());
 		unique_ptr<sql::ResultSet> res(stmtResult->executeQuery("SELECT @userId AS uid"));
+		timer.Executed();
 		if (!(res->next())) {
 			return false;
 		}
@@ -297,6 +328,7 @@ bool MysqlDao::TestProcedure(const std::string& email, int& uid, string& name) {
 		
 		stmtResult.reset(con->_con->createStatement());
 		res.reset(stmtResult->executeQuery("SELECT @userName AS name"));
+		timer.Executed();
 		if (!(res->next())) {
 			return false;
 		}
@@ -1,6 +1,7 @@
 #pragma once
 #include "const.h"
 #include <thread>
+#include "UserDao.h"
 
 class SqlConnection {
 public:
@@ -18,9 +19,9 @@ public:
 				sql::mysql::MySQL_Driver* driver = sql::mysql::get_mysql_driver_instance();
 				auto*  con = driver->connect(url_, user_, pass_);
 				con->setSchema(schema_);
-				// ȡǰʱ
+				// 获取当前时间戳
 				auto currentTime = std::chrono::system_clock::now().time_since_epoch();
-				// ʱתΪ
+				// 将时间戳转换为秒
 				long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(currentTime).count();
 				pool_.push(std::make_unique<SqlConnection>(con, timestamp));
 			}
@@ -35,7 +36,7 @@ public:
 			_check_thread.detach();
 		}
 		catch (sql::SQLException& e) {
-			// 쳣
+			// 处理异常
 			std::cout << "mysql pool init failed, error is " << e.what()<< std::endl;
 		}
 	}
@@ -43,9 +44,9 @@ public:
 	void checkConnection() {
 		std::lock_guard<std::mutex> guard(mutex_);
 		int poolsize = pool_.size();
-		// ȡǰʱ
+		// 获取当前时间戳
 		auto currentTime = std::chrono::system_clock::now().time_since_epoch();
-		// ʱתΪ
+		// 将时间戳转换为秒
 		long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(currentTime).count();
 		for (int i = 0; i < poolsize; i++) {
 			auto con = std::move(pool_.front());
@@ -66,7 +67,7 @@ public:
 			}
 			catch (sql::SQLException& e) {
 				std::cout << "Error keeping connection alive: " << e.what() << std::endl;
-				// ´Ӳ滻ɵ
+				// 重新创建连接并替换旧的连接
 				sql::mysql::MySQL_Driver* driver = sql::mysql::get_mysql_driver_instance();
 				auto* newcon = driver->connect(url_, user_, pass_);
 				newcon->setSchema(schema_);
@@ -127,24 +128,17 @@ private:
 	std::thread _check_thread;
 };
 
-struct UserInfo {
-	std::string name;
-	std::string pwd;
-	int uid;
-	std::string email;
-};
-
-class MysqlDao
+class MysqlDao : public UserDao
 {
 public:
 	MysqlDao();
 	~MysqlDao();
-	int RegUser(const std::string& name, const std::string& email, const std::string& pwd);
-	int RegUserTransaction(const std::string& name, const std::string& email, const std::string& pwd, const std::string& icon);
-	bool CheckEmail(const std::string& name, const std::string & email);
-	bool UpdatePwd(const std::string& name, const std::string& newpwd);
-	bool CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo);
-	bool TestProcedure(const std::string& email, int& uid, string& name);
+	int RegUser(const std::string& name, const std::string& email, const std::string& pwd) override;
+	int RegUserTransaction(const std::string& name, const std::string& email, const std::string& pwd, const std::string& icon) override;
+	bool CheckEmail(const std::string& name, const std::string & email) override;
+	bool UpdatePwd(const std::string& name, const std::string& newpwd) override;
+	bool CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) override;
+	bool TestProcedure(const std::string& email, int& uid, string& name) override;
 private:
 	std::unique_ptr<MySqlPool> pool_;
 };
@@ -1,4 +1,7 @@
 #include "MysqlMgr.h"
+#include "MysqlDao.h"
+#include "MemUserDao.h"
+#include "ConfigMgr.h"
 
 
 MysqlMgr::~MysqlMgr() {
@@ -7,26 +10,34 @@ MysqlMgr::~MysqlMgr() {
 
 int MysqlMgr::RegUser(const std::string& name, const std::string& email, const std::string& pwd, const std::string& icon)
 {
-	return _dao.RegUserTransaction(name, email, pwd, icon);
+	return _dao->RegUserTransaction(name, email, pwd, icon);
 }
 
 bool MysqlMgr::CheckEmail(const std::string& name, const std::string& email) {
-	return _dao.CheckEmail(name, email);
+	return _dao->CheckEmail(name, email);
 }
 
 bool MysqlMgr::UpdatePwd(const std::string& name, const std::string& pwd) {
-	return _dao.UpdatePwd(name, pwd);
+	return _dao->UpdatePwd(name, pwd);
 }
 
 MysqlMgr::MysqlMgr() {
+	auto& cfg = ConfigMgr::Inst();
+	if (cfg["Storage"]["DaoBackend"] == "memory") {
+		auto shards = cfg["Storage"]["Shards"];
+		_dao.reset(new MemUserDao(shards.empty() ? MEM_STORE_SHARDS : atoi(shards.c_str())));
+		return;
+	}
+
+	_dao.reset(new MysqlDao());
 }
 
 bool MysqlMgr::CheckPwd(const std::string& email, const std::string& pwd, UserInfo& userInfo) {
-	return _dao.CheckPwd(email, pwd, userInfo);
+	return _dao->CheckPwd(email, pwd, userInfo);
 }
 
 bool MysqlMgr::TestProcedure(const std::string& email, int& uid, string& name) {
-	return _dao.TestProcedure(email,uid, name);
+	return _dao->TestProcedure(email,uid, name);
 }
 
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "const.h"
-#include "MysqlDao.h"
+#include "UserDao.h"
+// MysqlMgr：业务代码访问用户数据的统一入口，具体实现由 [Storage] DaoBackend 决定
+// mysql(默认)使用MysqlDao；memory使用进程内的MemUserDao，不需要mysql
 class MysqlMgr: public Singleton<MysqlMgr>
 {
 	friend class Singleton<MysqlMgr>;
@@ -14,6 +16,6 @@ public:
 	bool TestProcedure(const std::string &email, int& uid, string & name);
 private:
 	MysqlMgr();
-	MysqlDao  _dao;
+	std::unique_ptr<UserDao>  _dao;
 };
 
@@ -1,12 +1,23 @@
 #include "StatusGrpcClient.h"
+#include "TraceMgr.h"
+
+// 当前线程在追踪中时把trace id放进metadata带给对端
+static void InjectTrace(ClientContext& context) {
+	auto trace_id = TraceMgr::Current();
+	if (trace_id != 0) {
+		context.AddMetadata(TRACE_METADATA_KEY, TraceMgr::ToHex(trace_id));
+	}
+}
 
 GetChatServerRsp StatusGrpcClient::GetChatServer(int uid)
 {
 	ClientContext context;
+	InjectTrace(context);
 	GetChatServerRsp reply;
 	GetChatServerReq request;
 	request.set_uid(uid);
 	auto stub = pool_->getConnection();
+	TraceSpan trace_span("grpc.client", "GetChatServer");
 	Status status = stub->GetChatServer(&context, request, &reply);
 
 	Defer defer([&stub, this]() {
@@ -25,12 +36,14 @@ GetChatServerRsp StatusGrpcClient::GetChatServer(int uid)
 LoginRsp StatusGrpcClient::Login(int uid, std::string token)
 {
 	ClientContext context;
+	InjectTrace(context);
 	LoginRsp reply;
 	LoginReq request;
 	request.set_uid(uid);
 	request.set_token(token);
 
 	auto stub = pool_->getConnection();
+	TraceSpan trace_span("grpc.client", "Login");
 	Status status = stub->Login(&context, request, &reply);
 
 	Defer defer([&stub, this]() {
@@ -16,98 +16,98 @@ using message::LoginRsp;
 using message::LoginReq;
 using message::StatusService;
 
-// StatusConPool ࣺgRPC ӳأڹ StatusService::Stub 
+// StatusConPool 类：gRPC 连接池，用于管理多个 StatusService::Stub 连接
 class StatusConPool {
 public:
     /**
-     * @brief 캯ʼӳأָ gRPC Ӳ
+     * @brief 构造函数，初始化连接池，创建指定数量的 gRPC 连接并存入队列
      * 
-     * @param poolSize ӳصĴС
-     * @param host gRPC ַ
-     * @param port gRPC Ķ˿
+     * @param poolSize 连接池的大小
+     * @param host gRPC 服务器的主机地址
+     * @param port gRPC 服务器的端口
      */
     StatusConPool(size_t poolSize, std::string host, std::string port)
         : poolSize_(poolSize), host_(host), port_(port), b_stop_(false) {
         
-        //  poolSize_  gRPC ӲӶ
+        // 创建 poolSize_ 个 gRPC 连接并将其加入连接队列
         for (size_t i = 0; i < poolSize_; ++i) {
-            //  gRPC ӣʹòȫͨƾ֤InsecureChannelCredentials
+            // 创建 gRPC 连接，使用不安全的通道凭证（InsecureChannelCredentials）
             std::shared_ptr<Channel> channel = grpc::CreateChannel(host + ":" + port,
                 grpc::InsecureChannelCredentials());
 
-            //  gRPC  Stub Ӷ
+            // 将 gRPC 服务的 Stub 对象存入连接队列
             connections_.push(StatusService::NewStub(channel));
         }
     }
 
     /**
-     * @brief ȷڶʱرӳ
+     * @brief 析构函数，确保在对象销毁时关闭连接池
      */
     ~StatusConPool() {
-        // ȷ̰߳ȫ
+        // 加锁以确保线程安全
         std::lock_guard<std::mutex> lock(mutex_);
-        Close();  // رӳ
-        // Ӷ
+        Close();  // 关闭连接池
+        // 清空连接队列
         while (!connections_.empty()) {
             connections_.pop();
         }
     }
 
     /**
-     * @brief ӳлȡһ gRPC 
+     * @brief 从连接池中获取一个 gRPC 连接
      * 
-     * @return std::unique_ptr<StatusService::Stub> ȡ gRPC Stub 
+     * @return std::unique_ptr<StatusService::Stub> 获取到的 gRPC Stub 对象
      */
     std::unique_ptr<StatusService::Stub> getConnection() {
         std::unique_lock<std::mutex> lock(mutex_);
-        // ȴӳпӣӳֹͣ
+        // 等待连接池中有可用连接，或连接池已停止
         cond_.wait(lock, [this] {
             if (b_stop_) {
                 return true;
             }
-            return !connections_.empty();  // ֻҪпӾͲٵȴ
+            return !connections_.empty();  // 只要有可用连接就不再等待
         });
-        // ӳֱֹͣӷؿָ
+        // 如果连接池已停止，直接返回空指针
         if (b_stop_) {
             return nullptr;
         }
-        // ȡһ gRPC ӲӶƳ
+        // 获取一个 gRPC 连接并从队列中移除
         auto context = std::move(connections_.front());
         connections_.pop();
         return context;
     }
 
     /**
-     * @brief  gRPC ӹ黹ӳ
+     * @brief 将 gRPC 连接归还到连接池
      * 
-     * @param context Ҫ黹 gRPC Stub 
+     * @param context 要归还的 gRPC Stub 对象
      */
     void returnConnection(std::unique_ptr<StatusService::Stub> context) {
         std::lock_guard<std::mutex> lock(mutex_);
         if (b_stop_) {
-            return;  // ӳֹͣٹ黹
+            return;  // 如果连接池已停止，不再归还连接
         }
-        // ·
+        // 将连接重新放入队列
         connections_.push(std::move(context));
-        cond_.notify_one();  // ֪ͨȴе߳µӿ
+        cond_.notify_one();  // 通知等待中的线程有新的连接可用
     }
 
     /**
-     * @brief رӳأֹͣӲ
+     * @brief 关闭连接池，停止所有连接操作
      */
     void Close() {
-        b_stop_ = true;           // ӳֹͣ
-        cond_.notify_all();       // еȴе߳
+        b_stop_ = true;           // 标记连接池已停止
+        cond_.notify_all();       // 唤醒所有等待中的线程
     }
 
 private:
-    std::atomic<bool> b_stop_;   // ӳǷֹͣ
-    size_t poolSize_;            // ӳشС
-    std::string host_;           // gRPC ַ
-    std::string port_;           // gRPC Ķ˿
-    std::queue<std::unique_ptr<StatusService::Stub>> connections_; // 洢 gRPC ӵĶ
-    std::mutex mutex_;           // ȷ̰߳ȫ
-    std::condition_variable cond_; // ߳ͬ
+    std::atomic<bool> b_stop_;   // 标记连接池是否已停止
+    size_t poolSize_;            // 连接池大小
+    std::string host_;           // gRPC 服务器的主机地址
+    std::string port_;           // gRPC 服务器的端口
+    std::queue<std::unique_ptr<StatusService::Stub>> connections_; // 存储 gRPC 连接的队列
+    std::mutex mutex_;           // 互斥锁，确保线程安全
+    std::condition_variable cond_; // 条件变量，用于线程同步
 };
 
 
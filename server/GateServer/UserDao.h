@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+
+struct UserInfo {
+	std::string name;
+	std::string pwd;
+	int uid;
+	std::string email;
+};
+
+// UserDao：注册、登录和重置密码用到的用户数据访问接口
+// MysqlDao访问mysql，MemUserDao是进程内实现，由MysqlMgr根据配置选择
+class UserDao
+{
+public:
+	virtual ~UserDao() {}
+	virtual int RegUser(const std::string& name, const std::string& email, const std::string& pwd) = 0;
+	// 名字或者邮箱已经存在返回0，出错返回-1，成功返回新的uid
+	virtual int RegUserTransaction(const std::string& name, const std::string& email, const std::string& pwd, const std::string& icon) = 0;
+	virtual bool CheckEmail(const std::string& name, const std::string & email) = 0;
+	virtual bool UpdatePwd(const std::string& name, const std::string& newpwd) = 0;
+	virtual bool CheckPwd(const std::string& email, const std::string& pwd, UserInfo& userInfo) = 0;
+	virtual bool TestProcedure(const std::string& email, int& uid, std::string& name) = 0;
+};
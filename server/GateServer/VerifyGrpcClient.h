@@ -17,78 +17,78 @@ using message::VarifyService;
 
 class RPConPool {
 public:
-    // 캯ʼӳأָ gRPC Ӳ
+    // 构造函数，初始化连接池，创建指定数量的 gRPC 连接并存入队列
     RPConPool(size_t poolSize, std::string host, std::string port)
         : poolSize_(poolSize), host_(host), port_(port), b_stop_(false) {
         
-        //  poolSize_  gRPC ӲӶ
+        // 创建 poolSize_ 个 gRPC 连接并将其加入连接队列
         for (size_t i = 0; i < poolSize_; ++i) {
-            //  gRPC ӣʹ insecure channelǼܣ
+            // 创建 gRPC 连接，使用 insecure channel（非加密）
             std::shared_ptr<Channel> channel = grpc::CreateChannel(host + ":" + port,
                 grpc::InsecureChannelCredentials());
             
-            //  gRPC  Stub 
+            // 将 gRPC 服务的 Stub 对象存入队列中
             connections_.push(VarifyService::NewStub(channel));
         }
     }
 
-    // ȷڶʱرӳ
+    // 析构函数，确保在对象销毁时关闭连接池
     ~RPConPool() {
-        // ȷ̰߳ȫ
+        // 加锁以确保线程安全
         std::lock_guard<std::mutex> lock(mutex_);
-        Close();  // رӳ
-        // Ӷ
+        Close();  // 关闭连接池
+        // 清空连接队列
         while (!connections_.empty()) {
             connections_.pop();
         }
     }
 
-    // ӳлȡһ gRPC 
+    // 从连接池中获取一个 gRPC 连接
     std::unique_ptr<VarifyService::Stub> getConnection() {
         std::unique_lock<std::mutex> lock(mutex_);
-        // ȴӳпӣӳѹرգֱӷ
+        // 等待连接池中有可用连接，如果连接池已关闭，则直接返回
         cond_.wait(lock, [this] {
             if (b_stop_) {
                 return true;
             }
-            return !connections_.empty();  // ֻҪпӾͲٵȴ
+            return !connections_.empty();  // 只要有可用连接就不再等待
         });
-        // ӳֹͣؿָ
+        // 如果连接池已停止，返回空指针
         if (b_stop_) {
             return nullptr;
         }
-        // ȡһ gRPC 
+        // 获取一个 gRPC 连接
         auto context = std::move(connections_.front());
         connections_.pop();
         return context;
     }
 
-    //  gRPC ӹ黹ӳ
+    // 将 gRPC 连接归还到连接池
     void returnConnection(std::unique_ptr<VarifyService::Stub> context) {
-        // ȷ̰߳ȫ
+        // 加锁确保线程安全
         std::lock_guard<std::mutex> lock(mutex_);
         if (b_stop_) {
-            return;  // ӳֹͣٹ黹
+            return;  // 如果连接池已停止，不再归还连接
         }
-        // ·
+        // 将连接重新放入队列
         connections_.push(std::move(context));
-        cond_.notify_one();  // ֪ͨȴе߳µӿ
+        cond_.notify_one();  // 通知等待中的线程有新的连接可用
     }
 
-    // رӳأֹͣӲ
+    // 关闭连接池，停止所有连接操作
     void Close() {
-        b_stop_ = true;  // ӳֹͣ
-        cond_.notify_all();  // еȴе߳
+        b_stop_ = true;  // 标记连接池已停止
+        cond_.notify_all();  // 唤醒所有等待中的线程
     }
 
 private:
-    atomic<bool> b_stop_;   // ڱӳǷֹͣ
-    size_t poolSize_;       // ӳشС
-    std::string host_;      // gRPC ַ
-    std::string port_;      // gRPC Ķ˿
-    std::queue<std::unique_ptr<VarifyService::Stub>> connections_;     // 洢 gRPC ӵĶ
-    std::mutex mutex_;                         // ȷ̰߳ȫ
-    std::condition_variable cond_;             // ߳ͬ
+    atomic<bool> b_stop_;   // 用于标记连接池是否已停止
+    size_t poolSize_;       // 连接池大小
+    std::string host_;      // gRPC 服务器的主机地址
+    std::string port_;      // gRPC 服务器的端口
+    std::queue<std::unique_ptr<VarifyService::Stub>> connections_;     // 存储 gRPC 连接的队列
+    std::mutex mutex_;                         // 互斥锁，确保线程安全
+    std::condition_variable cond_;             // 条件变量，用于线程同步
 };
 
 class VerifyGrpcClient:public Singleton<VerifyGrpcClient>
@@ -99,31 +99,31 @@ public:
 		
 	}
     GetVarifyRsp GetVarifyCode(std::string email) {
-        ClientContext context;           //  gRPC ͻ
-        GetVarifyRsp reply;              // ڴ洢 gRPC õӦ
-        GetVarifyReq request;            // ڴ洢 gRPC õ
-        request.set_email(email);        // е email ֶ
+        ClientContext context;           // 创建 gRPC 客户端上下文
+        GetVarifyRsp reply;              // 用于存储 gRPC 调用的响应
+        GetVarifyReq request;            // 用于存储 gRPC 调用的请求数据
+        request.set_email(email);        // 设置请求中的 email 字段
 
-        // ӳлȡһ gRPC 
+        // 从连接池中获取一个 gRPC 连接
         auto stub = pool_->getConnection();
-        if (!stub) { // Ƿɹȡ
+        if (!stub) { // 检查是否成功获取连接
             GetVarifyRsp error_reply;
-            error_reply.set_error(ErrorCodes::RPCFailed); // ô
+            error_reply.set_error(ErrorCodes::RPCFailed); // 设置错误代码
             return error_reply;
         }
 
-        //  gRPC  GetVarifyCode                                   ˴ʹõͬд
+        // 调用 gRPC 服务的 GetVarifyCode 方法                                  此处使用的是同步读写
         Status status = stub->GetVarifyCode(&context, request, &reply);
 
         if (status.ok()) {
-            // óɹӷصӳ
+            // 如果调用成功，将连接返回到连接池
             pool_->returnConnection(std::move(stub));
-            return reply;  // صý
+            return reply;  // 返回调用结果
         }
         else {
-            // ʧܣӷصӳأô
+            // 如果调用失败，将连接返回到连接池，并设置错误码
             pool_->returnConnection(std::move(stub));
-            reply.set_error(ErrorCodes::RPCFailed); // ôΪ RPC ʧ
+            reply.set_error(ErrorCodes::RPCFailed); // 设置错误代码为 RPC 失败
             return reply;
         }
     }
@@ -133,7 +133,7 @@ public:
 private:
 	VerifyGrpcClient();
 
-	std::unique_ptr<RPConPool> pool_;       // ָӳصָ룬ڹ gRPC 
+	std::unique_ptr<RPConPool> pool_;       // 指向连接池的智能指针，用于管理 gRPC 连接
 };
 
 
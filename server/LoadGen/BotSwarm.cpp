@@ -0,0 +1,392 @@
+#include "BotSwarm.h"
+#include "ConfigMgr.h"
+#include "hiredis.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <future>
+#include <json/json.h>
+#include <json/value.h>
+
+// 配置缺省时使用的默认值
+static std::string CfgOr(const std::string& key, const std::string& def) {
+	auto value = ConfigMgr::Inst()["LoadGen"][key];
+	return value.empty() ? def : value;
+}
+
+static const char* TypeName(int type) {
+	switch (type) {
+	case LOAD_LOGIN:
+		return "login";
+	case LOAD_TEXT:
+		return "text";
+	case LOAD_SEARCH:
+		return "search";
+	case LOAD_APPLY:
+		return "apply";
+	default:
+		return "unknown";
+	}
+}
+
+BotSwarm::Worker::Worker() : _rng(std::random_device{}()), _text_count(0) {
+	_work.reset(new boost::asio::executor_work_guard<boost::asio::io_context::executor_type>(
+		boost::asio::make_work_guard(_ioc)));
+	_timer.reset(new boost::asio::steady_timer(_ioc));
+}
+
+BotSwarm::BotSwarm() {
+	_host = CfgOr("Host", "127.0.0.1");
+	_port = static_cast<unsigned short>(atoi(CfgOr("Port", "8090").c_str()));
+	_users = atoi(CfgOr("Users", "1000").c_str());
+	_uid_start = atoi(CfgOr("UidStart", "100000").c_str());
+	_token_prefix = CfgOr("TokenPrefix", "loadgen_");
+	// 聊天和搜索的目标用户范围，默认是自己这批机器人；跨服务器测试时指向另一个LoadGen的机器人
+	_target_uid_start = atoi(CfgOr("TargetUidStart", std::to_string(_uid_start)).c_str());
+	_target_users = (std::max)(1, atoi(CfgOr("TargetUsers", std::to_string(_users)).c_str()));
+	_threads = (std::max)(1, atoi(CfgOr("Threads", "4").c_str()));
+	_duration = atoi(CfgOr("Duration", "60").c_str());
+	_text_rate = atof(CfgOr("TextRate", "1000").c_str());
+	_search_rate = atof(CfgOr("SearchRate", "100").c_str());
+	_apply_rate = atof(CfgOr("ApplyRate", "10").c_str());
+	_text_len = atoi(CfgOr("TextLen", "64").c_str());
+	_login_timeout = atoi(CfgOr("LoginTimeout", "30").c_str());
+	_drain_sec = atoi(CfgOr("DrainSec", "3").c_str());
+	_trace_every = atoi(CfgOr("TraceEvery", "0").c_str());
+	_start_delay = atoi(CfgOr("StartDelay", "0").c_str());
+
+	double total_rate = _text_rate + _search_rate + _apply_rate;
+	_interval = total_rate > 0 ? std::chrono::duration_cast<LoadClock::duration>(
+		std::chrono::duration<double>(_threads / total_rate)) : LoadClock::duration::zero();
+
+	for (int i = 0; i < _threads; ++i) {
+		_workers.emplace_back(new Worker());
+	}
+}
+
+BotSwarm::~BotSwarm() {
+	for (auto& worker : _workers) {
+		worker->_work.reset();
+		worker->_ioc.stop();
+		if (worker->_thread.joinable()) {
+			worker->_thread.join();
+		}
+	}
+}
+
+std::string BotSwarm::MakeToken(int uid) {
+	return _token_prefix + std::to_string(uid);
+}
+
+bool BotSwarm::SeedUsers() {
+	auto& cfg = ConfigMgr::Inst();
+	auto host = cfg["Redis"]["Host"];
+	auto port = atoi(cfg["Redis"]["Port"].c_str());
+	auto pwd = cfg["Redis"]["Passwd"];
+
+	redisContext* context = redisConnect(host.c_str(), port);
+	if (context == nullptr || context->err != 0) {
+		std::cout << "seed users connect redis failed" << std::endl;
+		if (context != nullptr) {
+			redisFree(context);
+		}
+		return false;
+	}
+
+	bool b_success = true;
+	Defer defer([context]() {
+		redisFree(context);
+	});
+
+	if (!pwd.empty()) {
+		auto reply = (redisReply*)redisCommand(context, "AUTH %s", pwd.c_str());
+		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR) {
+			std::cout << "seed users redis auth failed" << std::endl;
+			if (reply != nullptr) {
+				freeReplyObject(reply);
+			}
+			return false;
+		}
+		freeReplyObject(reply);
+	}
+
+	// 用管道批量写入，每批只等一次往返
+	const int batch = 500;
+	Json::FastWriter writer;
+	for (int begin = 0; begin < _users && b_success; begin += batch) {
+		int end = (std::min)(begin + batch, _users);
+		for (int i = begin; i < end; ++i) {
+			int uid = _uid_start + i;
+			auto uid_str = std::to_string(uid);
+			Json::Value base;
+			base["uid"] = uid;
+			base["pwd"] = "";
+			base["name"] = "bot_" + uid_str;
+			base["email"] = "bot_" + uid_str + "@loadgen";
+			base["nick"] = "bot_" + uid_str;
+			base["desc"] = "";
+			base["sex"] = 0;
+			base["icon"] = ":/res/head_1.jpg";
+			auto token_key = USERTOKENPREFIX + uid_str;
+			auto token = MakeToken(uid);
+			auto base_key = USER_BASE_INFO + uid_str;
+			auto base_str = writer.write(base);
+			redisAppendCommand(context, "SET %s %s", token_key.c_str(), token.c_str());
+			redisAppendCommand(context, "SET %s %b", base_key.c_str(), base_str.data(), base_str.size());
+		}
+
+		for (int i = begin; i < end; ++i) {
+			for (int j = 0; j < 2; ++j) {
+				redisReply* reply = nullptr;
+				if (redisGetReply(context, (void**)&reply) != REDIS_OK || reply == nullptr) {
+					b_success = false;
+					break;
+				}
+				if (reply->type == REDIS_REPLY_ERROR) {
+					b_success = false;
+				}
+				freeReplyObject(reply);
+			}
+			if (!b_success) {
+				break;
+			}
+		}
+	}
+
+	std::cout << "seed " << _users << " users from uid " << _uid_start
+		<< (b_success ? " success" : " failed") << std::endl;
+	return b_success;
+}
+
+template <typename Func>
+void BotSwarm::RunOn(Worker* worker, Func func) {
+	std::promise<void> done;
+	auto future = done.get_future();
+	boost::asio::post(worker->_ioc, [&func, &done]() {
+		func();
+		done.set_value();
+	});
+	future.wait();
+}
+
+int BotSwarm::WaitLogin(int timeout_sec) {
+	auto deadline = LoadClock::now() + std::chrono::seconds(timeout_sec);
+	int ready = 0;
+	while (true) {
+		ready = 0;
+		int finished = 0;
+		for (auto& worker : _workers) {
+			Worker* w = worker.get();
+			RunOn(w, [w, &ready, &finished]() {
+				for (auto& bot : w->_bots) {
+					if (bot->IsReady()) {
+						++ready;
+						++finished;
+					}
+					else if (bot->IsClosed()) {
+						++finished;
+					}
+				}
+			});
+		}
+
+		if (finished >= _users || LoadClock::now() >= deadline) {
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(500));
+	}
+	return ready;
+}
+
+void BotSwarm::Schedule(Worker* worker) {
+	worker->_timer->expires_at(worker->_next);
+	worker->_timer->async_wait([this, worker](const boost::system::error_code& ec) {
+		if (ec) {
+			return;
+		}
+
+		// 定时器醒晚了就把错过的请求一次补发，保证到达率不受调度抖动影响
+		auto now = LoadClock::now();
+		while (worker->_next <= now && worker->_next < _end) {
+			Dispatch(worker, worker->_next);
+			worker->_next += _interval;
+		}
+
+		if (worker->_next < _end) {
+			Schedule(worker);
+		}
+	});
+}
+
+void BotSwarm::Dispatch(Worker* worker, LoadClock::time_point intended) {
+	if (worker->_bots.empty()) {
+		return;
+	}
+
+	std::uniform_real_distribution<double> type_dist(0, _text_rate + _search_rate + _apply_rate);
+	double pick = type_dist(worker->_rng);
+	LoadMsgType type = pick < _text_rate ? LOAD_TEXT :
+		(pick < _text_rate + _search_rate ? LOAD_SEARCH : LOAD_APPLY);
+
+	std::uniform_int_distribution<size_t> bot_dist(0, worker->_bots.size() - 1);
+	auto& bot = worker->_bots[bot_dist(worker->_rng)];
+	if (!bot->IsReady()) {
+		worker->_stats._dropped[type]++;
+		return;
+	}
+
+	// 目标用户从目标范围中选，不选自己
+	std::uniform_int_distribution<int> uid_dist(0, _target_users - 1);
+	int touid = _target_uid_start + uid_dist(worker->_rng);
+	if (touid == bot->GetUid()) {
+		touid = _target_uid_start + (touid - _target_uid_start + 1) % _target_users;
+	}
+
+	switch (type) {
+	case LOAD_TEXT: {
+		static const std::string content_pattern = "load test message from bot swarm ";
+		std::string content;
+		while (static_cast<int>(content.length()) < _text_len) {
+			content += content_pattern;
+		}
+		content.resize(_text_len);
+		// trace id高32位随机，低32位是本线程的序号，保证不为0
+		uint64_t trace_id = 0;
+		if (_trace_every > 0 && worker->_text_count++ % _trace_every == 0) {
+			trace_id = (static_cast<uint64_t>(worker->_rng()) << 32) | static_cast<uint32_t>(worker->_text_count);
+		}
+		bot->SendText(touid, content, intended, trace_id);
+		break;
+	}
+	case LOAD_SEARCH:
+		bot->SendSearch(touid, intended);
+		break;
+	default:
+		bot->SendApply(touid, intended);
+		break;
+	}
+}
+
+long long BotSwarm::Run() {
+	tcp::endpoint endpoint(boost::asio::ip::make_address(_host), _port);
+	for (int i = 0; i < _users; ++i) {
+		auto& worker = _workers[i % _threads];
+		int uid = _uid_start + i;
+		worker->_bots.push_back(std::make_shared<LoadBot>(worker->_ioc, uid, MakeToken(uid), worker->_stats));
+	}
+
+	for (auto& worker : _workers) {
+		Worker* w = worker.get();
+		w->_thread = std::thread([w]() {
+			w->_ioc.run();
+		});
+		for (auto& bot : w->_bots) {
+			boost::asio::post(w->_ioc, [bot, endpoint]() {
+				bot->Start(endpoint);
+			});
+		}
+	}
+
+	std::cout << "logging in " << _users << " bots to " << _host << ":" << _port
+		<< " with " << _threads << " threads" << std::endl;
+	int ready = WaitLogin(_login_timeout);
+	std::cout << ready << "/" << _users << " bots logged in" << std::endl;
+
+	if (ready > 0 && _interval > LoadClock::duration::zero()) {
+		// 多个LoadGen同时压测时等其他LoadGen的机器人也登录完，否则发给它们的消息找不到会话
+		if (_start_delay > 0) {
+			std::this_thread::sleep_for(std::chrono::seconds(_start_delay));
+		}
+		std::cout << "driving text " << _text_rate << "/s, search " << _search_rate
+			<< "/s, apply " << _apply_rate << "/s for " << _duration << "s" << std::endl;
+		auto start = LoadClock::now();
+		_end = start + std::chrono::seconds(_duration);
+		for (int i = 0; i < _threads; ++i) {
+			Worker* w = _workers[i].get();
+			// 各线程的发送时刻错开，合起来仍然是均匀的到达间隔
+			w->_next = start + _interval * i / _threads;
+			boost::asio::post(w->_ioc, [this, w]() {
+				Schedule(w);
+			});
+		}
+
+		std::this_thread::sleep_for(std::chrono::seconds(_duration));
+		// 等待还在路上的回包，超过这个时间还没回来的算作丢失
+		std::this_thread::sleep_for(std::chrono::seconds(_drain_sec));
+	}
+
+	for (auto& worker : _workers) {
+		Worker* w = worker.get();
+		RunOn(w, [w]() {
+			w->_timer->cancel();
+			for (auto& bot : w->_bots) {
+				bot->Close();
+			}
+		});
+		w->_work.reset();
+		w->_thread.join();
+	}
+
+	return Report(static_cast<double>(_duration));
+}
+
+long long BotSwarm::Report(double seconds) {
+	LoadStats total;
+	for (auto& worker : _workers) {
+		total.Merge(worker->_stats);
+	}
+
+	std::cout << std::left << std::setw(8) << "type"
+		<< std::right << std::setw(10) << "sent"
+		<< std::setw(10) << "ok"
+		<< std::setw(8) << "error"
+		<< std::setw(8) << "lost"
+		<< std::setw(9) << "dropped"
+		<< std::setw(11) << "ops/s"
+		<< std::setw(10) << "p50(ms)"
+		<< std::setw(10) << "p90(ms)"
+		<< std::setw(10) << "p99(ms)"
+		<< std::setw(11) << "p99.9(ms)"
+		<< std::setw(10) << "max(ms)" << std::endl;
+
+	std::cout << std::fixed << std::setprecision(3);
+	for (int type = 0; type < LOAD_TYPE_COUNT; ++type) {
+		auto& hist = total._latency[type];
+		long long lost = total._sent[type] - total._ok[type] - total._error[type];
+		// 登录在压测开始前完成，不计算吞吐量
+		double ops = (type == LOAD_LOGIN || seconds <= 0) ? 0 : total._ok[type] / seconds;
+		std::cout << std::left << std::setw(8) << TypeName(type)
+			<< std::right << std::setw(10) << total._sent[type]
+			<< std::setw(10) << total._ok[type]
+			<< std::setw(8) << total._error[type]
+			<< std::setw(8) << lost
+			<< std::setw(9) << total._dropped[type]
+			<< std::setw(11) << std::setprecision(1) << ops << std::setprecision(3)
+			<< std::setw(10) << hist.Percentile(50) / 1000.0
+			<< std::setw(10) << hist.Percentile(90) / 1000.0
+			<< std::setw(10) << hist.Percentile(99) / 1000.0
+			<< std::setw(11) << hist.Percentile(99.9) / 1000.0
+			<< std::setw(10) << hist.Max() / 1000.0 << std::endl;
+	}
+	std::cout.unsetf(std::ios::fixed);
+
+	std::cout << "notify received: text " << total._notify_text
+		<< ", apply " << total._notify_apply << std::endl;
+	std::cout << "disconnected after login: " << total._disconnected << std::endl;
+
+	if (total._traced.empty()) {
+		return total._disconnected;
+	}
+	auto top = (std::min)(total._traced.size(), static_cast<size_t>(TRACE_REPORT_TOP));
+	std::partial_sort(total._traced.begin(), total._traced.begin() + top, total._traced.end(),
+		[](const std::pair<long long, uint64_t>& a, const std::pair<long long, uint64_t>& b) {
+		return a.first > b.first;
+	});
+	std::cout << "slowest traced text msgs (" << total._traced.size() << " traced), run LoadGen traceview <trace> <trace files...>:" << std::endl;
+	for (size_t i = 0; i < top; ++i) {
+		char trace_hex[17];
+		snprintf(trace_hex, sizeof(trace_hex), "%016llx", static_cast<unsigned long long>(total._traced[i].second));
+		std::cout << "  trace " << trace_hex << " latency " << total._traced[i].first / 1000.0 << " ms" << std::endl;
+	}
+	return total._disconnected;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <boost/asio.hpp>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <random>
+#include "const.h"
+#include "LoadBot.h"
+
+// BotSwarm：压测调度，配置在 [LoadGen] 中
+// Users个机器人(uid从UidStart开始)平均分给Threads个线程，每个线程一个io_context。
+// 登录完成后按固定到达率发送请求：三类请求的总速率为TextRate+SearchRate+ApplyRate(条/秒)，
+// 每个线程按固定间隔产生请求，按速率比例随机选类型、随机选本线程的机器人和目标用户。
+// 服务器变慢时不会降低发送速率(开环)，延迟从计划时刻开始算，能反映排队造成的延迟。
+// TraceEvery不为0时每TraceEvery条聊天请求在帧头带一个trace id，报告中列出最慢的几条，用 LoadGen traceview 还原链路。
+class BotSwarm
+{
+public:
+	BotSwarm();
+	~BotSwarm();
+	// 把压测用户的token和基本信息写入redis，ChatServer登录时优先从redis读取，不需要mysql中有这些用户
+	bool SeedUsers();
+	// 登录所有机器人，压测Duration秒后打印吞吐量和延迟分位数，返回登录后被断开的连接数
+	long long Run();
+private:
+	struct Worker {
+		Worker();
+		boost::asio::io_context _ioc;
+		std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> _work;
+		std::unique_ptr<boost::asio::steady_timer> _timer;
+		std::vector<std::shared_ptr<LoadBot>> _bots;
+		LoadStats _stats;
+		std::mt19937 _rng;
+		LoadClock::time_point _next;
+		// 本线程已经发出的聊天请求数，每TraceEvery条带一个trace id
+		long long _text_count;
+		std::thread _thread;
+	};
+
+	std::string MakeToken(int uid);
+	// 等待所有机器人登录完成或者失败，超时返回已经登录的数量
+	int WaitLogin(int timeout_sec);
+	void Schedule(Worker* worker);
+	void Dispatch(Worker* worker, LoadClock::time_point intended);
+	long long Report(double seconds);
+	// 在worker线程上执行func并等待完成
+	template <typename Func>
+	void RunOn(Worker* worker, Func func);
+
+	std::string _host;
+	unsigned short _port;
+	int _users;
+	int _uid_start;
+	int _target_uid_start;
+	int _target_users;
+	std::string _token_prefix;
+	int _threads;
+	int _duration;
+	double _text_rate;
+	double _search_rate;
+	double _apply_rate;
+	int _text_len;
+	int _login_timeout;
+	int _drain_sec;
+	int _trace_every;
+	int _start_delay;
+	// 每个线程两次请求之间的间隔
+	LoadClock::duration _interval;
+	LoadClock::time_point _end;
+	std::vector<std::unique_ptr<Worker>> _workers;
+};
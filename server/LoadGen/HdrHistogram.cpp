@@ -0,0 +1,132 @@
+#include "HdrHistogram.h"
+#include <cmath>
+#include <climits>
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 最高位1的位置，value必须大于0
+static int Log2Floor(uint64_t value) {
+#ifdef _MSC_VER
+	unsigned long index = 0;
+	_BitScanReverse64(&index, value);
+	return static_cast<int>(index);
+#else
+	return 63 - __builtin_clzll(value);
+#endif
+}
+
+HdrHistogram::HdrHistogram(int64_t highest, int significant)
+	: _highest(highest), _total(0), _min(LLONG_MAX), _max(0), _sum(0) {
+	// 每段至少要有2*10^significant个细分桶，才能保证significant位有效数字
+	int64_t largest_single_unit = 2 * static_cast<int64_t>(std::pow(10, significant));
+	int sub_bucket_count_magnitude = static_cast<int>(std::ceil(std::log2(static_cast<double>(largest_single_unit))));
+	_sub_bucket_half_count_magnitude = sub_bucket_count_magnitude - 1;
+	_sub_bucket_count = 1 << sub_bucket_count_magnitude;
+	_sub_bucket_half_count = _sub_bucket_count / 2;
+	_sub_bucket_mask = _sub_bucket_count - 1;
+
+	// 第一段覆盖[0, sub_bucket_count)，之后每段量程翻倍，直到覆盖上限
+	int64_t smallest_untrackable = _sub_bucket_count;
+	_bucket_count = 1;
+	while (smallest_untrackable <= _highest) {
+		smallest_untrackable <<= 1;
+		++_bucket_count;
+	}
+
+	// 除第一段外每段的前一半和上一段重叠，只保存后一半
+	_counts.assign((_bucket_count + 1) * _sub_bucket_half_count, 0);
+}
+
+int HdrHistogram::BucketIndex(int64_t value) const {
+	int pow2_ceiling = Log2Floor(static_cast<uint64_t>(value | _sub_bucket_mask)) + 1;
+	return pow2_ceiling - (_sub_bucket_half_count_magnitude + 1);
+}
+
+int HdrHistogram::CountsIndex(int64_t value) const {
+	int bucket_index = BucketIndex(value);
+	int sub_bucket_index = static_cast<int>(value >> bucket_index);
+	return ((bucket_index + 1) << _sub_bucket_half_count_magnitude) + (sub_bucket_index - _sub_bucket_half_count);
+}
+
+int64_t HdrHistogram::ValueFromIndex(int index) const {
+	int bucket_index = (index >> _sub_bucket_half_count_magnitude) - 1;
+	int sub_bucket_index = (index & (_sub_bucket_half_count - 1)) + _sub_bucket_half_count;
+	if (bucket_index < 0) {
+		sub_bucket_index -= _sub_bucket_half_count;
+		bucket_index = 0;
+	}
+	return static_cast<int64_t>(sub_bucket_index) << bucket_index;
+}
+
+int64_t HdrHistogram::HighestEquivalent(int64_t value) const {
+	int bucket_index = BucketIndex(value);
+	int64_t lowest = (value >> bucket_index) << bucket_index;
+	return lowest + (static_cast<int64_t>(1) << bucket_index) - 1;
+}
+
+void HdrHistogram::Record(int64_t value) {
+	value = std::max<int64_t>(0, std::min(value, _highest));
+	++_counts[CountsIndex(value)];
+	++_total;
+	_sum += static_cast<double>(value);
+	_min = std::min(_min, value);
+	_max = std::max(_max, value);
+}
+
+void HdrHistogram::Merge(const HdrHistogram& other) {
+	if (other._counts.size() != _counts.size()) {
+		return;
+	}
+
+	for (size_t i = 0; i < _counts.size(); ++i) {
+		_counts[i] += other._counts[i];
+	}
+	_total += other._total;
+	_sum += other._sum;
+	_min = std::min(_min, other._min);
+	_max = std::max(_max, other._max);
+}
+
+int64_t HdrHistogram::Percentile(double percentile) const {
+	if (_total == 0) {
+		return 0;
+	}
+
+	percentile = std::max(0.0, std::min(percentile, 100.0));
+	int64_t target = static_cast<int64_t>(std::ceil(percentile / 100.0 * _total));
+	target = std::max<int64_t>(target, 1);
+	int64_t seen = 0;
+	for (size_t i = 0; i < _counts.size(); ++i) {
+		seen += _counts[i];
+		if (seen >= target) {
+			return std::min(HighestEquivalent(ValueFromIndex(static_cast<int>(i))), _max);
+		}
+	}
+	return _max;
+}
+
+int64_t HdrHistogram::Count() const {
+	return _total;
+}
+
+int64_t HdrHistogram::Min() const {
+	return _total == 0 ? 0 : _min;
+}
+
+int64_t HdrHistogram::Max() const {
+	return _max;
+}
+
+double HdrHistogram::Mean() const {
+	return _total == 0 ? 0 : _sum / _total;
+}
+
+void HdrHistogram::Reset() {
+	std::fill(_counts.begin(), _counts.end(), 0);
+	_total = 0;
+	_sum = 0;
+	_min = LLONG_MAX;
+	_max = 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+
+// HdrHistogram：高动态范围直方图，用来统计延迟分位数
+// 按2的幂把量程分成若干段，每段内再线性细分，保证每个值都保留significant位有效数字，
+// 记录和查询都只是一次下标计算，内存只和量程的对数成正比，不会因为样本多而增长。
+// 不是线程安全的，每个压测线程各自记录，结束后Merge到一起再查询
+class HdrHistogram
+{
+public:
+	HdrHistogram(int64_t highest, int significant);
+	// 记录一个值，小于0按0记录，超过上限按上限记录
+	void Record(int64_t value);
+	// 合并另一个量程和精度相同的直方图
+	void Merge(const HdrHistogram& other);
+	// 返回percentile(0~100)分位的值，精度内取这个桶的上界
+	int64_t Percentile(double percentile) const;
+	int64_t Count() const;
+	int64_t Min() const;
+	int64_t Max() const;
+	double Mean() const;
+	void Reset();
+private:
+	int BucketIndex(int64_t value) const;
+	int CountsIndex(int64_t value) const;
+	int64_t ValueFromIndex(int index) const;
+	// 和value落在同一个桶内的最大值
+	int64_t HighestEquivalent(int64_t value) const;
+
+	int64_t _highest;
+	int _sub_bucket_half_count_magnitude;
+	int _sub_bucket_half_count;
+	int _sub_bucket_count;
+	int64_t _sub_bucket_mask;
+	int _bucket_count;
+	std::vector<int64_t> _counts;
+	int64_t _total;
+	int64_t _min;
+	int64_t _max;
+	double _sum;
+};
@@ -0,0 +1,297 @@
+#include "LoadBot.h"
+#include <iostream>
+#include <cstring>
+#include <json/json.h>
+#include <json/value.h>
+#include <json/reader.h>
+
+LoadStats::LoadStats() : _notify_text(0), _notify_apply(0), _disconnected(0) {
+	for (int i = 0; i < LOAD_TYPE_COUNT; ++i) {
+		_latency.emplace_back(LATENCY_MAX_US, LATENCY_SIGNIFICANT);
+		_sent[i] = 0;
+		_ok[i] = 0;
+		_error[i] = 0;
+		_dropped[i] = 0;
+	}
+}
+
+void LoadStats::Merge(const LoadStats& other) {
+	for (int i = 0; i < LOAD_TYPE_COUNT; ++i) {
+		_latency[i].Merge(other._latency[i]);
+		_sent[i] += other._sent[i];
+		_ok[i] += other._ok[i];
+		_error[i] += other._error[i];
+		_dropped[i] += other._dropped[i];
+	}
+	_notify_text += other._notify_text;
+	_notify_apply += other._notify_apply;
+	_disconnected += other._disconnected;
+	_traced.insert(_traced.end(), other._traced.begin(), other._traced.end());
+}
+
+LoadBot::LoadBot(boost::asio::io_context& ioc, int uid, const std::string& token, LoadStats& stats)
+	: _socket(ioc), _uid(uid), _token(token), _stats(stats), _b_ready(false), _b_close(false), _msg_seq(0) {
+}
+
+void LoadBot::Start(const tcp::endpoint& endpoint) {
+	auto self = shared_from_this();
+	_login_time = LoadClock::now();
+	_socket.async_connect(endpoint, [self, this](const boost::system::error_code& ec) {
+		if (ec) {
+			std::cout << "bot " << _uid << " connect failed, error is " << ec.message() << std::endl;
+			_stats._error[LOAD_LOGIN]++;
+			Close();
+			return;
+		}
+
+		boost::system::error_code opt_ec;
+		_socket.set_option(tcp::no_delay(true), opt_ec);
+
+		Json::Value root;
+		root["uid"] = _uid;
+		root["token"] = _token;
+		Json::FastWriter writer;
+		_stats._sent[LOAD_LOGIN]++;
+		Send(MSG_CHAT_LOGIN, writer.write(root));
+		ReadHead();
+	});
+}
+
+bool LoadBot::IsReady() const {
+	return _b_ready && !_b_close;
+}
+
+bool LoadBot::IsClosed() const {
+	return _b_close;
+}
+
+int LoadBot::GetUid() const {
+	return _uid;
+}
+
+bool LoadBot::SendText(int touid, const std::string& content, LoadClock::time_point intended, uint64_t trace_id) {
+	auto msgid = std::to_string(_uid) + "_" + std::to_string(++_msg_seq);
+	Json::Value text;
+	text["msgid"] = msgid;
+	text["content"] = content;
+	Json::Value root;
+	root["fromuid"] = _uid;
+	root["touid"] = touid;
+	root["text_array"].append(text);
+
+	Json::FastWriter writer;
+	if (!Send(ID_TEXT_CHAT_MSG_REQ, writer.write(root), trace_id)) {
+		_stats._dropped[LOAD_TEXT]++;
+		return false;
+	}
+	_stats._sent[LOAD_TEXT]++;
+	TextPending pending;
+	pending._intended = intended;
+	pending._trace_id = trace_id;
+	_text_pending[msgid] = pending;
+	return true;
+}
+
+bool LoadBot::SendSearch(int uid, LoadClock::time_point intended) {
+	Json::Value root;
+	root["uid"] = std::to_string(uid);
+	Json::FastWriter writer;
+	if (!Send(ID_SEARCH_USER_REQ, writer.write(root))) {
+		_stats._dropped[LOAD_SEARCH]++;
+		return false;
+	}
+	_stats._sent[LOAD_SEARCH]++;
+	_search_pending.push_back(intended);
+	return true;
+}
+
+bool LoadBot::SendApply(int touid, LoadClock::time_point intended) {
+	Json::Value root;
+	root["uid"] = _uid;
+	root["applyname"] = "bot_" + std::to_string(_uid);
+	root["bakname"] = "bot_" + std::to_string(touid);
+	root["touid"] = touid;
+	Json::FastWriter writer;
+	if (!Send(ID_ADD_FRIEND_REQ, writer.write(root))) {
+		_stats._dropped[LOAD_APPLY]++;
+		return false;
+	}
+	_stats._sent[LOAD_APPLY]++;
+	_apply_pending.push_back(intended);
+	return true;
+}
+
+void LoadBot::Close() {
+	if (_b_close) {
+		return;
+	}
+	_b_close = true;
+	boost::system::error_code ec;
+	_socket.close(ec);
+}
+
+void LoadBot::OnError() {
+	if (_b_ready && !_b_close) {
+		std::cout << "bot " << _uid << " disconnected" << std::endl;
+		_stats._disconnected++;
+	}
+	Close();
+}
+
+bool LoadBot::Send(short msg_id, const std::string& body, uint64_t trace_id) {
+	size_t trace_len = trace_id != 0 ? TRACE_ID_LEN : 0;
+	size_t body_len = trace_len + body.length();
+	if (_b_close || body_len > MAX_LENGTH || _send_que.size() >= MAX_SENDQUE) {
+		return false;
+	}
+
+	std::string frame(HEAD_TOTAL_LEN + body_len, '\0');
+	if (trace_id != 0) {
+		msg_id |= MSG_TRACE_FLAG;
+		uint32_t net_high = boost::asio::detail::socket_ops::host_to_network_long(static_cast<uint32_t>(trace_id >> 32));
+		uint32_t net_low = boost::asio::detail::socket_ops::host_to_network_long(static_cast<uint32_t>(trace_id));
+		memcpy(&frame[HEAD_TOTAL_LEN], &net_high, 4);
+		memcpy(&frame[HEAD_TOTAL_LEN + 4], &net_low, 4);
+	}
+	short net_id = boost::asio::detail::socket_ops::host_to_network_short(msg_id);
+	short net_len = boost::asio::detail::socket_ops::host_to_network_short(static_cast<short>(body_len));
+	memcpy(&frame[0], &net_id, HEAD_ID_LEN);
+	memcpy(&frame[HEAD_ID_LEN], &net_len, HEAD_DATA_LEN);
+	memcpy(&frame[HEAD_TOTAL_LEN + trace_len], body.data(), body.length());
+
+	bool b_writing = !_send_que.empty();
+	_send_que.push_back(std::move(frame));
+	if (!b_writing) {
+		DoWrite();
+	}
+	return true;
+}
+
+void LoadBot::DoWrite() {
+	auto self = shared_from_this();
+	auto& frame = _send_que.front();
+	boost::asio::async_write(_socket, boost::asio::buffer(frame),
+		[self, this](const boost::system::error_code& ec, std::size_t) {
+		if (ec) {
+			OnError();
+			return;
+		}
+
+		_send_que.pop_front();
+		if (!_send_que.empty()) {
+			DoWrite();
+		}
+	});
+}
+
+void LoadBot::ReadHead() {
+	auto self = shared_from_this();
+	boost::asio::async_read(_socket, boost::asio::buffer(_head, HEAD_TOTAL_LEN),
+		[self, this](const boost::system::error_code& ec, std::size_t) {
+		if (ec) {
+			OnError();
+			return;
+		}
+
+		short msg_id = 0;
+		short msg_len = 0;
+		memcpy(&msg_id, _head, HEAD_ID_LEN);
+		memcpy(&msg_len, _head + HEAD_ID_LEN, HEAD_DATA_LEN);
+		msg_id = boost::asio::detail::socket_ops::network_to_host_short(msg_id);
+		msg_len = boost::asio::detail::socket_ops::network_to_host_short(msg_len);
+		ReadBody(msg_id, msg_len);
+	});
+}
+
+void LoadBot::ReadBody(short msg_id, short msg_len) {
+	// 下行帧长度字段是有符号short，收到负数说明帧格式错了
+	if (msg_len < 0) {
+		std::cout << "bot " << _uid << " invalid frame len " << msg_len << std::endl;
+		Close();
+		return;
+	}
+
+	auto self = shared_from_this();
+	_body.resize(msg_len);
+	boost::asio::async_read(_socket, boost::asio::buffer(_body.data(), _body.size()),
+		[self, this, msg_id](const boost::system::error_code& ec, std::size_t) {
+		if (ec) {
+			OnError();
+			return;
+		}
+
+		HandleMsg(msg_id, std::string(_body.data(), _body.size()));
+		if (!_b_close) {
+			ReadHead();
+		}
+	});
+}
+
+void LoadBot::HandleMsg(short msg_id, const std::string& body) {
+	// 压测机器人不协商压缩，正常不会收到压缩帧
+	if (msg_id & MSG_COMPRESS_FLAG) {
+		return;
+	}
+
+	Json::Reader reader;
+	Json::Value root;
+	bool b_parse = reader.parse(body, root);
+	bool b_success = b_parse && root["error"].asInt() == ErrorCodes::Success;
+
+	switch (msg_id) {
+	case MSG_CHAT_LOGIN_RSP:
+		Record(LOAD_LOGIN, _login_time, b_success);
+		_b_ready = b_success;
+		if (!b_success) {
+			std::cout << "bot " << _uid << " login failed, error is " << root["error"].asInt() << std::endl;
+			Close();
+		}
+		break;
+	case ID_TEXT_CHAT_MSG_RSP:
+		for (const auto& ack : root["acks"]) {
+			auto iter = _text_pending.find(ack["msgid"].asString());
+			if (iter == _text_pending.end()) {
+				continue;
+			}
+			Record(LOAD_TEXT, iter->second._intended, b_success);
+			if (b_success && iter->second._trace_id != 0) {
+				auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+					LoadClock::now() - iter->second._intended).count();
+				_stats._traced.emplace_back(latency, iter->second._trace_id);
+			}
+			_text_pending.erase(iter);
+		}
+		break;
+	case ID_SEARCH_USER_RSP:
+		if (!_search_pending.empty()) {
+			Record(LOAD_SEARCH, _search_pending.front(), b_success);
+			_search_pending.pop_front();
+		}
+		break;
+	case ID_ADD_FRIEND_RSP:
+		if (!_apply_pending.empty()) {
+			Record(LOAD_APPLY, _apply_pending.front(), b_success);
+			_apply_pending.pop_front();
+		}
+		break;
+	case ID_NOTIFY_TEXT_CHAT_MSG_REQ:
+		_stats._notify_text++;
+		break;
+	case ID_NOTIFY_ADD_FRIEND_REQ:
+		_stats._notify_apply++;
+		break;
+	default:
+		break;
+	}
+}
+
+void LoadBot::Record(LoadMsgType type, LoadClock::time_point intended, bool b_success) {
+	if (!b_success) {
+		_stats._error[type]++;
+		return;
+	}
+
+	auto latency = std::chrono::duration_cast<std::chrono::microseconds>(LoadClock::now() - intended).count();
+	_stats._latency[type].Record(latency);
+	_stats._ok[type]++;
+}
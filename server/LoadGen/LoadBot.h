@@ -0,0 +1,79 @@
+#pragma once
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include "const.h"
+#include "HdrHistogram.h"
+
+// 每个压测线程一份统计，只在本线程的io_context上修改，结束后合并
+struct LoadStats {
+	LoadStats();
+	void Merge(const LoadStats& other);
+
+	// 从计划发送时刻到收到回包的延迟(微秒)，计划时刻而不是实际发送时刻，避免协同遗漏
+	std::vector<HdrHistogram> _latency;
+	long long _sent[LOAD_TYPE_COUNT];
+	long long _ok[LOAD_TYPE_COUNT];
+	long long _error[LOAD_TYPE_COUNT];
+	// 到了计划时刻但机器人还没登录或者发送队列已满，没有发出去
+	long long _dropped[LOAD_TYPE_COUNT];
+	// 作为接收方收到的聊天通知和好友申请通知
+	long long _notify_text;
+	long long _notify_apply;
+	// 登录成功后连接被断开(读写出错)的机器人数，平滑升级期间应该为0
+	long long _disconnected;
+	// 带trace id发出的聊天消息的(延迟微秒, trace id)，报告时列出最慢的几条
+	std::vector<std::pair<long long, uint64_t>> _traced;
+};
+
+// LoadBot：一个模拟用户，按CSession的帧格式(2字节id+2字节长度，网络字节序)收发消息
+// 只在所属的io_context线程上调用，内部不加锁
+class LoadBot : public std::enable_shared_from_this<LoadBot>
+{
+public:
+	LoadBot(boost::asio::io_context& ioc, int uid, const std::string& token, LoadStats& stats);
+	// 连接ChatServer并发送登录请求
+	void Start(const tcp::endpoint& endpoint);
+	bool IsReady() const;
+	bool IsClosed() const;
+	int GetUid() const;
+	// 以下请求的延迟都从intended(计划发送时刻)开始计算，trace_id不为0时在帧头带上trace id
+	bool SendText(int touid, const std::string& content, LoadClock::time_point intended, uint64_t trace_id = 0);
+	bool SendSearch(int uid, LoadClock::time_point intended);
+	bool SendApply(int touid, LoadClock::time_point intended);
+	void Close();
+private:
+	bool Send(short msg_id, const std::string& body, uint64_t trace_id = 0);
+	void DoWrite();
+	void ReadHead();
+	void ReadBody(short msg_id, short msg_len);
+	void HandleMsg(short msg_id, const std::string& body);
+	void Record(LoadMsgType type, LoadClock::time_point intended, bool b_success);
+	// 读写出错时关闭连接，已经登录的计入断开
+	void OnError();
+
+	tcp::socket _socket;
+	int _uid;
+	std::string _token;
+	LoadStats& _stats;
+	bool _b_ready;
+	bool _b_close;
+	char _head[HEAD_TOTAL_LEN];
+	std::vector<char> _body;
+	std::deque<std::string> _send_que;
+	LoadClock::time_point _login_time;
+	// 服务器按收到的顺序逐条处理同一个会话的请求，搜索和好友申请的回包按先进先出对应
+	std::deque<LoadClock::time_point> _search_pending;
+	std::deque<LoadClock::time_point> _apply_pending;
+	// 聊天确认按msgid对应，服务器可能把多条确认合并成一帧
+	struct TextPending {
+		LoadClock::time_point _intended;
+		uint64_t _trace_id;
+	};
+	std::unordered_map<std::string, TextPending> _text_pending;
+	long long _msg_seq;
+};
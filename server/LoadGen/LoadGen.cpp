@@ -0,0 +1,43 @@
+// LoadGen.cpp : 此文件包含 "main" 函数。程序执行将在此处开始并结束。
+// ChatServer协议层压测工具，不需要Qt客户端，配置见config.ini中的 [LoadGen]
+// LoadGen traceview <trace id> <trace文件...>  从各服务的追踪文件还原一条消息的链路
+//
+
+#include <iostream>
+#include "const.h"
+#include "ConfigMgr.h"
+#include "BotSwarm.h"
+#include "TraceView.h"
+
+int main(int argc, char* argv[])
+{
+	if (argc >= 2 && std::string(argv[1]) == "traceview") {
+		if (argc < 4) {
+			std::cout << "usage: LoadGen traceview <trace id> <trace files...>" << std::endl;
+			return EXIT_FAILURE;
+		}
+		return TraceView(argv[2], std::vector<std::string>(argv + 3, argv + argc));
+	}
+
+	try {
+		auto& cfg = ConfigMgr::Inst();
+		BotSwarm swarm;
+		// 压测用户的token写入redis，已经写过或者服务器用的是同一批token时可以关掉
+		if (cfg["LoadGen"]["Seed"] != "0" && !swarm.SeedUsers()) {
+			return EXIT_FAILURE;
+		}
+
+		// 配置了MaxDisconnects时断开数超过它返回失败，平滑升级测试(handoff_test.sh)用0检查客户端没有重连
+		long long disconnected = swarm.Run();
+		auto max_disconnects = cfg["LoadGen"]["MaxDisconnects"];
+		if (!max_disconnects.empty() && disconnected > atoll(max_disconnects.c_str())) {
+			std::cout << disconnected << " bots disconnected, more than " << max_disconnects << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (std::exception& e) {
+		std::cerr << "Exception: " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return 0;
+}
@@ -0,0 +1,181 @@
+#include "TraceView.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <json/json.h>
+#include <json/value.h>
+#include <json/reader.h>
+
+// 瀑布图中时间条的宽度(字符)
+#define TRACE_BAR_WIDTH 40
+
+struct ViewSpan {
+	std::string _server;
+	std::string _name;
+	std::string _tag;
+	long long _start;
+	long long _end;
+};
+
+// 关键路径上的一段，span为-1表示没有span覆盖
+struct PathSegment {
+	int _span;
+	long long _start;
+	long long _end;
+};
+
+// trace id统一成16位小写十六进制，命令行里可以省略前导0
+static std::string NormalizeTraceId(const std::string& trace_id) {
+	std::string normalized;
+	for (auto c : trace_id) {
+		normalized += static_cast<char>(tolower(static_cast<unsigned char>(c)));
+	}
+	if (normalized.size() < 16) {
+		normalized.insert(0, 16 - normalized.size(), '0');
+	}
+	return normalized;
+}
+
+static std::string SpanLabel(const ViewSpan& span) {
+	std::string label = span._server + " " + span._name;
+	if (!span._tag.empty()) {
+		label += "[" + span._tag + "]";
+	}
+	return label;
+}
+
+static bool LoadSpans(const std::string& trace_id, const std::vector<std::string>& files, std::vector<ViewSpan>& spans) {
+	for (auto& file : files) {
+		std::ifstream ifs(file);
+		if (!ifs) {
+			std::cout << "open trace file " << file << " failed" << std::endl;
+			return false;
+		}
+
+		std::string line;
+		Json::Reader reader;
+		while (std::getline(ifs, line)) {
+			Json::Value root;
+			if (line.empty() || !reader.parse(line, root) || root["trace"].asString() != trace_id) {
+				continue;
+			}
+			ViewSpan span;
+			span._server = root["server"].asString();
+			span._name = root["span"].asString();
+			span._tag = root["tag"].asString();
+			span._start = root["start_us"].asInt64();
+			span._end = span._start + (std::max)(root["dur_us"].asInt64(), static_cast<Json::Int64>(0));
+			spans.push_back(span);
+		}
+	}
+	return true;
+}
+
+// 每一段时间取覆盖它的span中开始最晚的，开始时间相同取结束最早的，也就是嵌套最深的一层
+static std::vector<PathSegment> CriticalPath(const std::vector<ViewSpan>& spans) {
+	std::vector<long long> bounds;
+	for (auto& span : spans) {
+		bounds.push_back(span._start);
+		bounds.push_back(span._end);
+	}
+	std::sort(bounds.begin(), bounds.end());
+	bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+	std::vector<PathSegment> path;
+	for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+		long long begin = bounds[i];
+		long long end = bounds[i + 1];
+		int owner = -1;
+		for (size_t j = 0; j < spans.size(); ++j) {
+			auto& span = spans[j];
+			if (span._start > begin || span._end < end) {
+				continue;
+			}
+			if (owner < 0 || span._start > spans[owner]._start
+				|| (span._start == spans[owner]._start && span._end < spans[owner]._end)) {
+				owner = static_cast<int>(j);
+			}
+		}
+
+		if (!path.empty() && path.back()._span == owner) {
+			path.back()._end = end;
+			continue;
+		}
+		PathSegment segment;
+		segment._span = owner;
+		segment._start = begin;
+		segment._end = end;
+		path.push_back(segment);
+	}
+	return path;
+}
+
+int TraceView(const std::string& trace_id, const std::vector<std::string>& files) {
+	auto normalized = NormalizeTraceId(trace_id);
+	std::vector<ViewSpan> spans;
+	if (!LoadSpans(normalized, files, spans)) {
+		return EXIT_FAILURE;
+	}
+	if (spans.empty()) {
+		std::cout << "no span of trace " << normalized << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// 开始时间相同的外层span排在前面
+	std::sort(spans.begin(), spans.end(), [](const ViewSpan& a, const ViewSpan& b) {
+		return a._start != b._start ? a._start < b._start : a._end > b._end;
+	});
+	long long origin = spans.front()._start;
+	long long finish = origin;
+	for (auto& span : spans) {
+		finish = (std::max)(finish, span._end);
+	}
+	long long total = (std::max)(finish - origin, 1LL);
+
+	std::cout << "trace " << normalized << ", " << spans.size() << " spans, total "
+		<< std::fixed << std::setprecision(3) << (finish - origin) / 1000.0 << " ms" << std::endl;
+	std::cout << std::right << std::setw(10) << "start(ms)" << std::setw(10) << "dur(ms)" << "  "
+		<< std::left << std::setw(TRACE_BAR_WIDTH) << "timeline" << "  span" << std::endl;
+	for (auto& span : spans) {
+		int bar_begin = static_cast<int>((span._start - origin) * TRACE_BAR_WIDTH / total);
+		int bar_end = static_cast<int>((span._end - origin) * TRACE_BAR_WIDTH / total);
+		bar_begin = (std::min)(bar_begin, TRACE_BAR_WIDTH - 1);
+		bar_end = (std::max)(bar_end, bar_begin + 1);
+		std::string bar(TRACE_BAR_WIDTH, ' ');
+		std::fill(bar.begin() + bar_begin, bar.begin() + (std::min)(bar_end, TRACE_BAR_WIDTH), '=');
+		std::cout << std::right << std::setw(10) << (span._start - origin) / 1000.0
+			<< std::setw(10) << (span._end - span._start) / 1000.0 << "  "
+			<< std::left << bar << "  " << SpanLabel(span) << std::endl;
+	}
+
+	auto path = CriticalPath(spans);
+	std::cout << std::endl << "critical path:" << std::endl;
+	std::map<std::string, long long> by_stage;
+	for (auto& segment : path) {
+		long long dur = segment._end - segment._start;
+		std::string label = segment._span < 0 ? "untraced" : SpanLabel(spans[segment._span]);
+		std::string stage = segment._span < 0 ? "untraced" : spans[segment._span]._name;
+		by_stage[stage] += dur;
+		std::cout << std::right << std::setw(10) << (segment._start - origin) / 1000.0
+			<< std::setw(10) << dur / 1000.0
+			<< std::setw(7) << std::setprecision(1) << dur * 100.0 / total << "%" << std::setprecision(3)
+			<< "  " << label << std::endl;
+	}
+
+	// 同一阶段在多个服务上的耗时合在一起，按耗时从大到小排
+	std::vector<std::pair<long long, std::string>> stages;
+	for (auto& item : by_stage) {
+		stages.emplace_back(item.second, item.first);
+	}
+	std::sort(stages.rbegin(), stages.rend());
+	std::cout << std::endl << "time by stage:" << std::endl;
+	for (auto& stage : stages) {
+		std::cout << std::right << std::setw(10) << stage.first / 1000.0 << " ms"
+			<< std::setw(7) << std::setprecision(1) << stage.first * 100.0 / total << "%" << std::setprecision(3)
+			<< "  " << stage.second << std::endl;
+	}
+	std::cout.unsetf(std::ios::fixed);
+	return 0;
+}
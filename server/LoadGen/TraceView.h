@@ -0,0 +1,10 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// TraceView：离线还原一条消息的链路，输入是各服务 [Trace] Path 写出的span文件(每行一个json)
+// 先按开始时间打印所有span的瀑布图；再按时间扫描，每一小段时间归给覆盖它的最内层span(开始最晚的)，
+// 没有span覆盖的时间记为untraced(网络或者没有埋点的代码)，相邻的同一个span合并后就是关键路径，
+// 最后按阶段汇总关键路径上的耗时，能直接看出慢在排队、存储、gRPC还是发包。
+// 各服务的时间戳是各自机器的system_clock，跨机器时结果依赖时钟同步
+int TraceView(const std::string& trace_id, const std::vector<std::string>& files);
@@ -0,0 +1,73 @@
+#pragma once
+#include <boost/asio.hpp>
+#include <chrono>
+#include <functional>
+
+using tcp = boost::asio::ip::tcp;
+using LoadClock = std::chrono::steady_clock;
+
+enum ErrorCodes {
+	Success = 0,
+};
+
+// Defer类
+class Defer {
+public:
+	// 接受一个lambda表达式或者函数指针
+	Defer(std::function<void()> func) : func_(func) {}
+
+	// 析构函数中执行传入的函数
+	~Defer() {
+		func_();
+	}
+
+private:
+	std::function<void()> func_;
+};
+
+//头部总长度
+#define HEAD_TOTAL_LEN 4
+//头部id长度
+#define HEAD_ID_LEN 2
+//头部数据长度
+#define HEAD_DATA_LEN 2
+//消息id最高位表示消息体经过zstd压缩，压测机器人不协商压缩，收到时只去掉标志位
+#define MSG_COMPRESS_FLAG 0x8000
+//消息id次高位表示消息体前面带8字节的trace id(网络字节序，高32位在前)，服务器按这个id记录整条链路
+#define MSG_TRACE_FLAG 0x4000
+#define TRACE_ID_LEN 8
+//报告中列出的最慢的追踪消息条数
+#define TRACE_REPORT_TOP 5
+//服务器接收消息体的上限，和ChatServer的MAX_LENGTH一致
+#define MAX_LENGTH  1024*2
+//每个机器人发送队列上限，超过说明服务器已经处理不过来
+#define MAX_SENDQUE 1000
+//延迟直方图记录的上限(微秒)，超过的按上限记录
+#define LATENCY_MAX_US (60LL * 1000 * 1000)
+//延迟直方图保留的有效数字位数
+#define LATENCY_SIGNIFICANT 3
+
+enum MSG_IDS {
+	MSG_CHAT_LOGIN = 1005, //用户登陆
+	MSG_CHAT_LOGIN_RSP = 1006, //用户登陆回包
+	ID_SEARCH_USER_REQ = 1007, //用户搜索请求
+	ID_SEARCH_USER_RSP = 1008, //搜索用户回包
+	ID_ADD_FRIEND_REQ = 1009, //申请添加好友请求
+	ID_ADD_FRIEND_RSP = 1010, //申请添加好友回复
+	ID_NOTIFY_ADD_FRIEND_REQ = 1011,  //通知用户添加好友申请
+	ID_TEXT_CHAT_MSG_REQ = 1017, //文本聊天信息请求
+	ID_TEXT_CHAT_MSG_RSP = 1018, //文本聊天信息回复(合并的确认)
+	ID_NOTIFY_TEXT_CHAT_MSG_REQ = 1019, //通知用户文本聊天信息
+};
+
+//压测统计的消息类型
+enum LoadMsgType {
+	LOAD_LOGIN = 0,
+	LOAD_TEXT,
+	LOAD_SEARCH,
+	LOAD_APPLY,
+	LOAD_TYPE_COUNT
+};
+
+#define USERTOKENPREFIX  "utoken_"
+#define USER_BASE_INFO "ubaseinfo_"
@@ -0,0 +1,309 @@
+#!/bin/bash
+# 平滑升级测试：LoadGen压测期间启动第二个ChatServer进程接管连接，检查旧进程交接成功并退出、机器人没有断开
+# 用法：handoff_test.sh <ChatServer可执行文件> <LoadGen可执行文件> [机器人数] [压测秒数]
+# ChatServer使用memory存储(不需要redis和mysql)，配置从 server/ChatServer/config.ini 复制后修改，
+# 端口和正式部署一样用config.ini里的默认值，在临时目录里运行，不影响源码目录；
+# StatusServer不需要启动，心跳失败不影响测试
+# 设置了 REDIS_HOST 和 STATUS_HOST 时再跑跨服务器测试：A、B两个ChatServer通过redis和StatusServer互相发现，
+# 两个LoadGen分别连A和B并且只给对方的机器人发消息，压测中途交接A，检查每条发出去的消息要么收到了通知、要么在离线列表里
+#   REDIS_HOST REDIS_PORT(默认6380) REDIS_PASSWD(默认空)  已启动的redis，会删除测试用户的离线消息
+#   STATUS_HOST STATUS_PORT(默认50052)                     已启动并连接同一个redis的StatusServer
+set -u
+
+CHAT_SERVER=$(realpath "${1:?usage: handoff_test.sh <ChatServer> <LoadGen> [users] [seconds]}")
+LOAD_GEN=$(realpath "${2:?usage: handoff_test.sh <ChatServer> <LoadGen> [users] [seconds]}")
+USERS=${3:-200}
+DURATION=${4:-15}
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+WORK_DIR=$(mktemp -d /tmp/handoff_test.XXXXXX)
+PORT=$(awk -F= '/^\[SelfServer\]/{s=1;next} /^\[/{s=0} s&&$1~/^Port/{gsub(/ /,"",$2);print $2}' "$SCRIPT_DIR/../ChatServer/config.ini")
+
+OLD_PID=
+NEW_PID=
+B_PID=
+cleanup() {
+	[ -n "$OLD_PID" ] && kill "$OLD_PID" 2>/dev/null
+	[ -n "$NEW_PID" ] && kill "$NEW_PID" 2>/dev/null
+	[ -n "$B_PID" ] && kill "$B_PID" 2>/dev/null
+	wait 2>/dev/null
+}
+trap cleanup EXIT
+
+# set_ini 文件 section key value：修改已有的键，没有时加在section末尾，没有section时追加
+set_ini() {
+	awk -v sec="[$2]" -v key="$3" -v val="$4" '
+		function flush() { if (in_sec && !done) { print key " = " val; done = 1 } }
+		/^\[/ { flush(); in_sec = ($0 == sec); if (in_sec) found = 1 }
+		in_sec && $0 ~ "^" key "[ \t]*=" { print key " = " val; done = 1; next }
+		{ print }
+		END { flush(); if (!found) { print sec; print key " = " val } }
+	' "$1" > "$1.tmp" && mv "$1.tmp" "$1"
+}
+
+# get_ini 文件 section key：读取已有的键
+get_ini() {
+	awk -F= -v sec="[$2]" -v key="$3" '
+		/^\[/ { in_sec = ($0 == sec); next }
+		in_sec { k = $1; gsub(/[ \t]/, "", k); if (k == key) { v = $2; gsub(/[ \t]/, "", v); print v; exit } }
+	' "$1"
+}
+
+# wait_listen 日志文件：等ChatServer打开交接监听，说明各个端口都已经绑定
+wait_listen() {
+	for i in $(seq 1 50); do
+		grep -q "handoff listen on" "$1" && return 0
+		sleep 0.2
+	done
+	return 1
+}
+
+# 旧进程交接成功后自己退出
+wait_old_exit() {
+	for i in $(seq 1 50); do
+		kill -0 "$OLD_PID" 2>/dev/null || break
+		sleep 0.2
+	done
+}
+
+# check_handoff 目录：旧进程交接成功并退出，新进程还在运行
+check_handoff() {
+	local ok=0
+	if ! grep -q "handoff success" "$1/old.log"; then
+		echo "FAIL: old ChatServer did not hand off, see $1/old.log"
+		ok=1
+	fi
+	if kill -0 "$OLD_PID" 2>/dev/null; then
+		echo "FAIL: old ChatServer still running after handoff"
+		ok=1
+	fi
+	if ! kill -0 "$NEW_PID" 2>/dev/null; then
+		echo "FAIL: new ChatServer exited, see $1/new.log"
+		ok=1
+	fi
+	return $ok
+}
+
+mkdir -p "$WORK_DIR/server" "$WORK_DIR/loadgen"
+cfg="$WORK_DIR/server/config.ini"
+cp "$SCRIPT_DIR/../ChatServer/config.ini" "$cfg"
+set_ini "$cfg" Storage KvBackend memory
+set_ini "$cfg" Storage DaoBackend memory
+set_ini "$cfg" Storage SeedUsers "$USERS"
+set_ini "$cfg" Storage SeedUidStart 100000
+set_ini "$cfg" Storage SeedTokenPrefix loadgen_
+set_ini "$cfg" Handoff Path "$WORK_DIR/handoff.sock"
+set_ini "$cfg" Trace Path "$WORK_DIR/trace.log"
+
+lcfg="$WORK_DIR/loadgen/config.ini"
+cp "$SCRIPT_DIR/config.ini" "$lcfg"
+set_ini "$lcfg" LoadGen Host 127.0.0.1
+set_ini "$lcfg" LoadGen Port "$PORT"
+set_ini "$lcfg" LoadGen Users "$USERS"
+set_ini "$lcfg" LoadGen UidStart 100000
+set_ini "$lcfg" LoadGen TokenPrefix loadgen_
+set_ini "$lcfg" LoadGen Seed 0
+set_ini "$lcfg" LoadGen Duration "$DURATION"
+set_ini "$lcfg" LoadGen MaxDisconnects 0
+
+cd "$WORK_DIR/server"
+"$CHAT_SERVER" < /dev/null > old.log 2>&1 &
+OLD_PID=$!
+if ! wait_listen old.log; then
+	echo "FAIL: old ChatServer did not start, see $WORK_DIR/server/old.log"
+	exit 1
+fi
+
+cd "$WORK_DIR/loadgen"
+"$LOAD_GEN" > loadgen.log 2>&1 &
+LOAD_PID=$!
+for i in $(seq 1 150); do
+	grep -q "bots logged in" loadgen.log && break
+	sleep 0.2
+done
+
+# 压测进行到一半时启动新进程接管
+sleep $((DURATION / 2))
+cd "$WORK_DIR/server"
+"$CHAT_SERVER" < /dev/null > new.log 2>&1 &
+NEW_PID=$!
+
+wait "$LOAD_PID"
+LOAD_STATUS=$?
+wait_old_exit
+
+FAILED=0
+check_handoff "$WORK_DIR/server" || FAILED=1
+if ! grep -q "^$USERS/$USERS bots logged in" "$WORK_DIR/loadgen/loadgen.log"; then
+	echo "FAIL: not all bots logged in, see $WORK_DIR/loadgen/loadgen.log"
+	FAILED=1
+fi
+if [ "$LOAD_STATUS" -ne 0 ]; then
+	echo "FAIL: LoadGen reported disconnects, see $WORK_DIR/loadgen/loadgen.log"
+	FAILED=1
+fi
+grep "bots logged in\|disconnected after login" "$WORK_DIR/loadgen/loadgen.log"
+
+if [ "$FAILED" -ne 0 ]; then
+	exit 1
+fi
+echo "PASS: handoff with 0 disconnects"
+kill "$NEW_PID" 2>/dev/null
+wait "$NEW_PID" 2>/dev/null
+OLD_PID=
+NEW_PID=
+
+if [ -z "${REDIS_HOST:-}" ] || [ -z "${STATUS_HOST:-}" ]; then
+	echo "SKIP: cross-server handoff, set REDIS_HOST and STATUS_HOST to run it"
+	rm -rf "$WORK_DIR"
+	exit 0
+fi
+
+# 跨服务器测试：A用默认端口，交接A；B换一组端口
+REDIS_PORT=${REDIS_PORT:-6380}
+REDIS_PASSWD=${REDIS_PASSWD:-}
+STATUS_PORT=${STATUS_PORT:-50052}
+A_UID=100000
+B_UID=$((A_UID + USERS))
+B_PORT=$((PORT + 100))
+REDIS_CLI=(redis-cli -h "$REDIS_HOST" -p "$REDIS_PORT")
+[ -n "$REDIS_PASSWD" ] && REDIS_CLI+=(-a "$REDIS_PASSWD" --no-auth-warning)
+
+# offline_count 起始uid 人数：这些用户离线消息列表的总长度
+offline_count() {
+	local total=0 n
+	for uid in $(seq "$1" $(($1 + $2 - 1))); do
+		n=$("${REDIS_CLI[@]}" LLEN "offlinemsg_$uid")
+		total=$((total + n))
+	done
+	echo "$total"
+}
+
+for uid in $(seq "$A_UID" $((B_UID + USERS - 1))); do
+	"${REDIS_CLI[@]}" DEL "offlinemsg_$uid" > /dev/null
+done
+
+# make_server 目录 名字 端口偏移：两个ChatServer共用redis和StatusServer，存储里预置两批机器人
+make_server() {
+	mkdir -p "$1"
+	local c="$1/config.ini"
+	cp "$SCRIPT_DIR/../ChatServer/config.ini" "$c"
+	set_ini "$c" Storage KvBackend redis
+	set_ini "$c" Storage DaoBackend memory
+	set_ini "$c" Storage SeedUsers $((USERS * 2))
+	set_ini "$c" Storage SeedUidStart "$A_UID"
+	set_ini "$c" Redis Host "$REDIS_HOST"
+	set_ini "$c" Redis Port "$REDIS_PORT"
+	set_ini "$c" Redis Passwd "$REDIS_PASSWD"
+	set_ini "$c" StatusServer Host "$STATUS_HOST"
+	set_ini "$c" StatusServer Port "$STATUS_PORT"
+	set_ini "$c" SelfServer Name "$2"
+	set_ini "$c" Trace Name "$2"
+	set_ini "$c" Handoff Path "$1/handoff.sock"
+	set_ini "$c" Trace Path "$1/trace.log"
+	if [ "$3" -ne 0 ]; then
+		local sec key
+		for sec_key in SelfServer:Port SelfServer:RPCPort FileServer:Port Metrics:Port; do
+			sec=${sec_key%%:*}
+			key=${sec_key#*:}
+			set_ini "$c" "$sec" "$key" $(($(get_ini "$c" "$sec" "$key") + $3))
+		done
+	fi
+}
+
+# make_loadgen 目录 端口 起始uid 目标起始uid：只给另一个LoadGen的机器人发消息，不发申请
+make_loadgen() {
+	mkdir -p "$1"
+	local c="$1/config.ini"
+	cp "$SCRIPT_DIR/config.ini" "$c"
+	set_ini "$c" Redis Host "$REDIS_HOST"
+	set_ini "$c" Redis Port "$REDIS_PORT"
+	set_ini "$c" Redis Passwd "$REDIS_PASSWD"
+	set_ini "$c" LoadGen Host 127.0.0.1
+	set_ini "$c" LoadGen Port "$2"
+	set_ini "$c" LoadGen Users "$USERS"
+	set_ini "$c" LoadGen UidStart "$3"
+	set_ini "$c" LoadGen TargetUidStart "$4"
+	set_ini "$c" LoadGen TargetUsers "$USERS"
+	set_ini "$c" LoadGen TokenPrefix loadgen_
+	set_ini "$c" LoadGen Seed 1
+	set_ini "$c" LoadGen Duration "$DURATION"
+	set_ini "$c" LoadGen StartDelay 5
+	set_ini "$c" LoadGen ApplyRate 0
+	set_ini "$c" LoadGen MaxDisconnects 0
+}
+
+# text_ok 日志：LoadGen报告里text一行的ok列
+text_ok() {
+	awk '$1=="text"{print $3}' "$1"
+}
+
+# notify_text 日志：收到的聊天通知数
+notify_text() {
+	sed -n 's/^notify received: text \([0-9]*\).*/\1/p' "$1"
+}
+
+CROSS_DIR="$WORK_DIR/cross"
+make_server "$CROSS_DIR/a" chatserver_handoff_a 0
+make_server "$CROSS_DIR/b" chatserver_handoff_b 100
+make_loadgen "$CROSS_DIR/loadgen_a" "$PORT" "$A_UID" "$B_UID"
+make_loadgen "$CROSS_DIR/loadgen_b" "$B_PORT" "$B_UID" "$A_UID"
+
+cd "$CROSS_DIR/a"
+"$CHAT_SERVER" < /dev/null > old.log 2>&1 &
+OLD_PID=$!
+cd "$CROSS_DIR/b"
+"$CHAT_SERVER" < /dev/null > b.log 2>&1 &
+B_PID=$!
+if ! wait_listen "$CROSS_DIR/a/old.log" || ! wait_listen "$CROSS_DIR/b/b.log"; then
+	echo "FAIL: cross-server ChatServers did not start, see $CROSS_DIR"
+	exit 1
+fi
+
+# LoadGen登录后等StartDelay秒再压测，两边的机器人都登录完才开始互相发消息
+cd "$CROSS_DIR/loadgen_a"
+"$LOAD_GEN" > loadgen.log 2>&1 &
+LOAD_A_PID=$!
+cd "$CROSS_DIR/loadgen_b"
+"$LOAD_GEN" > loadgen.log 2>&1 &
+LOAD_B_PID=$!
+
+sleep $((5 + DURATION / 2))
+cd "$CROSS_DIR/a"
+"$CHAT_SERVER" < /dev/null > new.log 2>&1 &
+NEW_PID=$!
+
+wait "$LOAD_A_PID"
+LOAD_A_STATUS=$?
+wait "$LOAD_B_PID"
+LOAD_B_STATUS=$?
+wait_old_exit
+
+FAILED=0
+check_handoff "$CROSS_DIR/a" || FAILED=1
+if [ "$LOAD_A_STATUS" -ne 0 ] || [ "$LOAD_B_STATUS" -ne 0 ]; then
+	echo "FAIL: LoadGen reported disconnects, see $CROSS_DIR/loadgen_*/loadgen.log"
+	FAILED=1
+fi
+
+# 发给对方的每条消息要么对方收到了通知，要么转存到了对方的离线列表，不丢也不重复
+# check_delivery 接收方名字 接收方LoadGen目录 接收方起始uid 发送方LoadGen目录
+check_delivery() {
+	local sent received offline
+	sent=$(text_ok "$4/loadgen.log")
+	received=$(notify_text "$2/loadgen.log")
+	offline=$(offline_count "$3" "$USERS")
+	echo "to $1: sent $sent, notified $received, offline $offline"
+	if [ -z "$sent" ] || [ -z "$received" ] || [ "$sent" -ne $((received + offline)) ]; then
+		echo "FAIL: messages to $1 lost or duplicated"
+		return 1
+	fi
+	return 0
+}
+check_delivery A "$CROSS_DIR/loadgen_a" "$A_UID" "$CROSS_DIR/loadgen_b" || FAILED=1
+check_delivery B "$CROSS_DIR/loadgen_b" "$B_UID" "$CROSS_DIR/loadgen_a" || FAILED=1
+
+if [ "$FAILED" -ne 0 ]; then
+	exit 1
+fi
+echo "PASS: cross-server handoff without lost or duplicated messages"
+rm -rf "$WORK_DIR"
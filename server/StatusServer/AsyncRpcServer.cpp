@@ -0,0 +1,116 @@
+#include "AsyncRpcServer.h"
+#include "ConfigMgr.h"
+
+// [Grpc] 没有配置时的默认值
+#define GRPC_DEFAULT_CQ_COUNT  2
+#define GRPC_DEFAULT_CQ_THREADS  1
+#define GRPC_DEFAULT_WORKERS  4
+#define GRPC_DEFAULT_SHUTDOWN_MS  1000
+
+static int CfgIntOr(const std::string& key, int def) {
+	auto value = ConfigMgr::Inst()["Grpc"][key];
+	return value.empty() ? def : atoi(value.c_str());
+}
+
+AsyncRpcServer::AsyncRpcServer() : _b_start(false), _b_stop(false), _b_done(false) {
+	_cq_count = (std::max)(CfgIntOr("CqCount", GRPC_DEFAULT_CQ_COUNT), 1);
+	_cq_threads = (std::max)(CfgIntOr("CqThreads", GRPC_DEFAULT_CQ_THREADS), 1);
+	_worker_count = (std::max)(CfgIntOr("Workers", GRPC_DEFAULT_WORKERS), 1);
+	_shutdown_ms = (std::max)(CfgIntOr("ShutdownMs", GRPC_DEFAULT_SHUTDOWN_MS), 0);
+}
+
+AsyncRpcServer::~AsyncRpcServer() {
+	Shutdown();
+}
+
+bool AsyncRpcServer::Start(const std::string& address, grpc::Service* service) {
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+	builder.RegisterService(service);
+	for (int i = 0; i < _cq_count; ++i) {
+		_cqs.push_back(builder.AddCompletionQueue());
+	}
+	_server = builder.BuildAndStart();
+	if (!_server) {
+		std::cout << "RPC Server listen on " << address << " failed" << std::endl;
+		return false;
+	}
+
+	_work.reset(new boost::asio::io_context::work(_executor));
+	for (int i = 0; i < _worker_count; ++i) {
+		_workers.emplace_back([this]() {
+			_executor.run();
+		});
+	}
+	for (auto& cq : _cqs) {
+		auto* raw_cq = cq.get();
+		for (int i = 0; i < _cq_threads; ++i) {
+			_poll_threads.emplace_back([this, raw_cq]() {
+				PollCompletion(raw_cq);
+			});
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_b_start = true;
+	std::cout << "RPC Server listening on " << address << ", " << _cq_count << " cq x " << _cq_threads
+		<< " threads, " << _worker_count << " workers" << std::endl;
+	return true;
+}
+
+void AsyncRpcServer::Shutdown() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_b_start || _b_stop) {
+			return;
+		}
+		_b_stop = true;
+	}
+
+	// 顺序不能变：服务关闭期间在途调用还要靠轮询线程和工作线程走完；
+	// 工作线程退出后不会再有新的操作，完成队列才能关闭并取完剩下的事件
+	_server->Shutdown(std::chrono::system_clock::now() + std::chrono::milliseconds(_shutdown_ms));
+	_work.reset();
+	for (auto& worker : _workers) {
+		worker.join();
+	}
+	for (auto& cq : _cqs) {
+		cq->Shutdown();
+	}
+	for (auto& thread : _poll_threads) {
+		thread.join();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_b_done = true;
+	}
+	_cond.notify_all();
+}
+
+void AsyncRpcServer::Wait() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	_cond.wait(lock, [this]() {
+		return _b_done;
+	});
+}
+
+void AsyncRpcServer::Post(std::function<void()> task) {
+	boost::asio::post(_executor, task);
+}
+
+size_t AsyncRpcServer::CqCount() const {
+	return _cqs.size();
+}
+
+grpc::ServerCompletionQueue* AsyncRpcServer::GetCq(size_t index) {
+	return _cqs[index].get();
+}
+
+void AsyncRpcServer::PollCompletion(grpc::ServerCompletionQueue* cq) {
+	void* tag = nullptr;
+	bool ok = false;
+	while (cq->Next(&tag, &ok)) {
+		static_cast<RpcCall*>(tag)->Proceed(ok);
+	}
+}
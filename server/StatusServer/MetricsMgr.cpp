@@ -0,0 +1,354 @@
+#include "MetricsMgr.h"
+#include "ConfigMgr.h"
+#include "TraceMgr.h"
+#include <sstream>
+#include <vector>
+
+using tcp = boost::asio::ip::tcp;
+
+// 直方图量程60秒，保留2位有效数字
+#define METRICS_HIGHEST_US  60000000
+#define METRICS_SIGNIFICANT  2
+// 请求头最大长度，抓取请求只有一行GET
+#define METRICS_MAX_REQUEST  8192
+
+// 导出的le桶边界(微秒)，从100us到10s
+static const int64_t kLeBounds[] = {
+	100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000,
+	100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000,
+};
+
+static const double kQuantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+LatencyMetric::LatencyMetric()
+	: _wait(METRICS_HIGHEST_US, METRICS_SIGNIFICANT), _exec(METRICS_HIGHEST_US, METRICS_SIGNIFICANT) {
+}
+
+ExecTimer::ExecTimer(LatencyMetric* metric) : _metric(metric), _start(std::chrono::steady_clock::now()) {
+}
+
+ExecTimer::~ExecTimer() {
+	_metric->_exec.Record(MetricsMgr::ToMicros(std::chrono::steady_clock::now() - _start));
+}
+
+StorageMetric::StorageMetric(const std::string& name, bool b_record) : _name(name), _b_record(b_record),
+	_pool_wait(METRICS_HIGHEST_US, METRICS_SIGNIFICANT),
+	_exec(METRICS_HIGHEST_US, METRICS_SIGNIFICANT), _decode(METRICS_HIGHEST_US, METRICS_SIGNIFICANT), _slow_count(0) {
+}
+
+StorageTimer::StorageTimer(StorageMetric* metric)
+	: _metric(metric), _trace_id(TraceMgr::Current()), _start_us(0) {
+	_b_active = _metric->_b_record || _trace_id != 0;
+	if (_b_active) {
+		_start = std::chrono::steady_clock::now();
+	}
+	if (_trace_id != 0) {
+		_start_us = TraceMgr::NowMicros();
+	}
+}
+
+void StorageTimer::Acquired() {
+	if (_b_active) {
+		_acquired = std::chrono::steady_clock::now();
+	}
+}
+
+void StorageTimer::Executed() {
+	if (_b_active) {
+		_executed = std::chrono::steady_clock::now();
+	}
+}
+
+StorageTimer::~StorageTimer() {
+	if (!_b_active) {
+		return;
+	}
+
+	// 连接池关闭时拿不到连接，之后的阶段都没有发生
+	std::chrono::steady_clock::time_point unset;
+	auto end = std::chrono::steady_clock::now();
+	auto acquired = _acquired == unset ? end : _acquired;
+	int64_t pool_wait = MetricsMgr::ToMicros(acquired - _start);
+	int64_t exec = 0;
+	int64_t decode = 0;
+	bool b_executed = _acquired != unset && _executed != unset;
+	if (b_executed) {
+		exec = MetricsMgr::ToMicros(_executed - _acquired);
+		decode = MetricsMgr::ToMicros(end - _executed);
+	}
+	if (_trace_id != 0) {
+		TraceMgr::GetInstance()->Record(_trace_id, "storage", _metric->_name, _start_us, MetricsMgr::ToMicros(end - _start));
+	}
+	if (!_metric->_b_record) {
+		return;
+	}
+
+	_metric->_pool_wait.Record(pool_wait);
+	if (b_executed) {
+		_metric->_exec.Record(exec);
+		_metric->_decode.Record(decode);
+	}
+	MetricsMgr::GetInstance()->OnSlowStorage(_metric, pool_wait, exec, decode);
+}
+
+// 一次抓取连接：读完请求头，返回指标后关闭，和Prometheus的抓取方式一致不做keep-alive
+class MetricsConn : public std::enable_shared_from_this<MetricsConn>
+{
+public:
+	MetricsConn(boost::asio::io_context& ioc) : _socket(ioc), _buffer(METRICS_MAX_REQUEST) {}
+	tcp::socket& GetSocket() {
+		return _socket;
+	}
+
+	void Start() {
+		auto self = shared_from_this();
+		boost::asio::async_read_until(_socket, _buffer, "\r\n\r\n",
+			[self](const boost::system::error_code& ec, std::size_t) {
+			if (ec) {
+				return;
+			}
+			self->HandleReq();
+		});
+	}
+private:
+	void HandleReq() {
+		std::istream is(&_buffer);
+		std::string method;
+		std::string target;
+		is >> method >> target;
+
+		std::string status = "200 OK";
+		std::string body;
+		if (method == "GET" && (target == "/metrics" || target.compare(0, 9, "/metrics?") == 0)) {
+			body = MetricsMgr::GetInstance()->Export();
+		}
+		else {
+			status = "404 Not Found";
+			body = "not found\n";
+		}
+
+		std::ostringstream os;
+		os << "HTTP/1.1 " << status << "\r\n"
+			<< "Content-Type: text/plain; version=0.0.4\r\n"
+			<< "Content-Length: " << body.size() << "\r\n"
+			<< "Connection: close\r\n\r\n"
+			<< body;
+		_response = os.str();
+
+		auto self = shared_from_this();
+		boost::asio::async_write(_socket, boost::asio::buffer(_response),
+			[self](const boost::system::error_code&, std::size_t) {
+			boost::system::error_code ignore_ec;
+			self->_socket.shutdown(tcp::socket::shutdown_both, ignore_ec);
+			self->_socket.close(ignore_ec);
+		});
+	}
+
+	tcp::socket _socket;
+	boost::asio::streambuf _buffer;
+	std::string _response;
+};
+
+MetricsMgr::MetricsMgr() : _b_start(false) {
+	auto& cfg = ConfigMgr::Inst();
+	_b_storage_trace = atoi(cfg["Metrics"]["StorageTrace"].c_str()) != 0;
+	_slow_us = atoll(cfg["Metrics"]["SlowMs"].c_str()) * 1000;
+	int slow_sample = atoi(cfg["Metrics"]["SlowSample"].c_str());
+	_slow_sample = slow_sample > 0 ? slow_sample : 1;
+	_slow_storage_count = GetCounter("storage_slow_ops_total");
+}
+
+MetricsMgr::~MetricsMgr() {
+	Stop();
+}
+
+int64_t MetricsMgr::ToMicros(std::chrono::steady_clock::duration duration) {
+	return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+LatencyMetric* MetricsMgr::GetLatency(const std::string& family, const std::string& label_name, const std::string& label_value) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto& latency_family = _latency_families[family];
+	latency_family._label_name = label_name;
+	auto& metric = latency_family._metrics[label_value];
+	if (metric == nullptr) {
+		metric.reset(new LatencyMetric());
+	}
+	return metric.get();
+}
+
+StorageMetric* MetricsMgr::GetStorage(const std::string& family, const std::string& name) {
+	// 没有开启StorageTrace时也返回对象，追踪中的调用要用名字记录span
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto& metric = _storage_families[family][name];
+	if (metric == nullptr) {
+		metric.reset(new StorageMetric(family + " " + name, _b_storage_trace));
+	}
+	return metric.get();
+}
+
+void MetricsMgr::OnSlowStorage(StorageMetric* metric, int64_t pool_wait_us, int64_t exec_us, int64_t decode_us) {
+	int64_t total = pool_wait_us + exec_us + decode_us;
+	if (_slow_us <= 0 || total < _slow_us) {
+		return;
+	}
+
+	_slow_storage_count->fetch_add(1, std::memory_order_relaxed);
+	// 慢操作成片出现时只抽样打印，避免日志本身拖慢存储调用
+	auto count = metric->_slow_count.fetch_add(1, std::memory_order_relaxed);
+	if (count % _slow_sample != 0) {
+		return;
+	}
+	std::cout << "slow storage op [" << metric->_name << "] total " << total << " us, pool wait " << pool_wait_us
+		<< " us, exec " << exec_us << " us, decode " << decode_us << " us, slow count " << count + 1 << std::endl;
+}
+
+std::atomic<uint64_t>* MetricsMgr::GetCounter(const std::string& name) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto& counter = _counters[name];
+	if (counter == nullptr) {
+		counter.reset(new std::atomic<uint64_t>(0));
+	}
+	return counter.get();
+}
+
+void MetricsMgr::RegGauge(const std::string& name, std::function<double()> func) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_gauges[name] = func;
+}
+
+void MetricsMgr::Start() {
+	auto& cfg = ConfigMgr::Inst();
+	int port = atoi(cfg["Metrics"]["Port"].c_str());
+	if (port <= 0 || _b_start) {
+		return;
+	}
+
+	try {
+		tcp::endpoint endpoint(tcp::v4(), static_cast<unsigned short>(port));
+		_acceptor = std::make_unique<tcp::acceptor>(_io_context);
+		_acceptor->open(endpoint.protocol());
+		_acceptor->set_option(tcp::acceptor::reuse_address(true));
+		_acceptor->bind(endpoint);
+		_acceptor->listen();
+	}
+	catch (std::exception& exp) {
+		std::cout << "metrics listen on port " << port << " failed, " << exp.what() << std::endl;
+		_acceptor.reset();
+		return;
+	}
+
+	_b_start = true;
+	StartAccept();
+	_thread = std::thread([this]() {
+		_io_context.run();
+	});
+	std::cout << "metrics listen on port " << port << std::endl;
+}
+
+void MetricsMgr::Stop() {
+	if (!_b_start) {
+		return;
+	}
+	_b_start = false;
+	_io_context.stop();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+void MetricsMgr::StartAccept() {
+	auto conn = std::make_shared<MetricsConn>(_io_context);
+	_acceptor->async_accept(conn->GetSocket(), [this, conn](const boost::system::error_code& ec) {
+		if (!ec) {
+			conn->Start();
+		}
+		if (_acceptor->is_open()) {
+			StartAccept();
+		}
+	});
+}
+
+static std::string FormatSeconds(double micros) {
+	std::ostringstream os;
+	os << micros / 1000000.0;
+	return os.str();
+}
+
+void MetricsMgr::ExportHistogram(std::string& out, std::string& quantile_out, const std::string& name, const std::string& label_name,
+	const std::string& label_value, const LatencyHistogram& histogram) {
+	LatencyHistogram::Snapshot snapshot;
+	histogram.GetSnapshot(snapshot);
+	std::string label = label_name + "=\"" + label_value + "\"";
+
+	for (auto bound : kLeBounds) {
+		out += name + "_bucket{" + label + ",le=\"" + FormatSeconds(static_cast<double>(bound)) + "\"} "
+			+ std::to_string(histogram.CountAtOrBelow(snapshot, bound)) + "\n";
+	}
+	out += name + "_bucket{" + label + ",le=\"+Inf\"} " + std::to_string(snapshot._total) + "\n";
+	out += name + "_sum{" + label + "} " + FormatSeconds(static_cast<double>(snapshot._sum)) + "\n";
+	out += name + "_count{" + label + "} " + std::to_string(snapshot._total) + "\n";
+
+	// 分位数单独作为一组仪表，名字不能带直方图的后缀，否则解析时会被当成直方图的一部分
+	for (auto quantile : kQuantiles) {
+		std::ostringstream os;
+		os << quantile;
+		quantile_out += name + "_quantile{" + label + ",quantile=\"" + os.str() + "\"} "
+			+ FormatSeconds(static_cast<double>(histogram.Percentile(snapshot, quantile * 100))) + "\n";
+	}
+}
+
+std::string MetricsMgr::Export() {
+	std::string out;
+	std::vector<std::pair<std::string, std::function<double()>>> gauges;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		for (auto& family : _latency_families) {
+			const char* stages[] = { "_wait_seconds", "_exec_seconds" };
+			for (int i = 0; i < 2; ++i) {
+				auto name = family.first + stages[i];
+				out += "# TYPE " + name + " histogram\n";
+				std::string quantile_out = "# TYPE " + name + "_quantile gauge\n";
+				for (auto& item : family.second._metrics) {
+					auto& histogram = i == 0 ? item.second->_wait : item.second->_exec;
+					ExportHistogram(out, quantile_out, name, family.second._label_name, item.first, histogram);
+				}
+				out += quantile_out;
+			}
+		}
+
+		for (auto& family : _storage_families) {
+			if (!_b_storage_trace) {
+				break;
+			}
+			const char* stages[] = { "_pool_wait_seconds", "_exec_seconds", "_decode_seconds" };
+			for (int i = 0; i < 3; ++i) {
+				auto name = "storage_" + family.first + stages[i];
+				out += "# TYPE " + name + " histogram\n";
+				std::string quantile_out = "# TYPE " + name + "_quantile gauge\n";
+				for (auto& item : family.second) {
+					auto& metric = *item.second;
+					auto& histogram = i == 0 ? metric._pool_wait : (i == 1 ? metric._exec : metric._decode);
+					ExportHistogram(out, quantile_out, name, "op", item.first, histogram);
+				}
+				out += quantile_out;
+			}
+		}
+
+		for (auto& counter : _counters) {
+			out += "# TYPE " + counter.first + " counter\n";
+			out += counter.first + " " + std::to_string(counter.second->load(std::memory_order_relaxed)) + "\n";
+		}
+
+		gauges.assign(_gauges.begin(), _gauges.end());
+	}
+
+	// 仪表的回调可能要拿业务模块自己的锁，放在_mutex外面调用，避免和注册时的加锁顺序相反
+	for (auto& gauge : gauges) {
+		std::ostringstream os;
+		os << gauge.second();
+		out += "# TYPE " + gauge.first + " gauge\n";
+		out += gauge.first + " " + os.str() + "\n";
+	}
+	return out;
+}
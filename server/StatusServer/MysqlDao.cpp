@@ -1,4 +1,5 @@
 #include "MysqlDao.h"
+#include "MetricsMgr.h"
 #include "ConfigMgr.h"
 
 MysqlDao::MysqlDao()
@@ -18,26 +19,31 @@ MysqlDao::~MysqlDao(){
 
 int MysqlDao::RegUser(const std::string& name, const std::string& email, const std::string& pwd)
 {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "RegUser");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
-		// ׼ô洢
+		// 准备调用存储过程
 		unique_ptr < sql::PreparedStatement > stmt(con->_con->prepareStatement("CALL reg_user(?,?,?,@result)"));
-		// 
+		// 设置输入参数
 		stmt->setString(1, name);
 		stmt->setString(2, email);
 		stmt->setString(3, pwd);
 
-		// PreparedStatementֱ֧עҪʹûỰȡֵ
+		// 由于PreparedStatement不直接支持注册输出参数，我们需要使用会话变量或其他方法来获取输出参数的值
 
-		  // ִд洢
+		  // 执行存储过程
 		stmt->execute();
-		// 洢˻ỰʽȡִֵSELECTѯȡ
-	   // 磬洢һỰ@result洢ȡ
+		timer.Executed();
+		// 如果存储过程设置了会话变量或有其他方式获取输出参数的值，你可以在这里执行SELECT查询来获取它们
+	   // 例如，如果存储过程设置了一个会话变量@result来存储输出结果，可以这样获取：
 	   unique_ptr<sql::Statement> stmtResult(con->_con->createStatement());
 	  unique_ptr<sql::ResultSet> res(stmtResult->executeQuery("SELECT @result AS result"));
+	  timer.Executed();
 	  if (res->next()) {
 	       int result = res->getInt("result");
 	      cout << "Result: " << result << endl;
@@ -57,22 +63,26 @@ int MysqlDao::RegUser(const std::string& name, const std::string& email, const s
 }
 
 bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "CheckEmail");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
 
-		// ׼ѯ
+		// 准备查询语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT email FROM user WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt->setString(1, name);
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			std::cout << "Check Email: " << res->getString("email") << std::endl;
 			if (email != res->getString("email")) {
@@ -94,21 +104,25 @@ bool MysqlDao::CheckEmail(const std::string& name, const std::string& email) {
 }
 
 bool MysqlDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "UpdatePwd");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	try {
 		if (con == nullptr) {
 			return false;
 		}
 
-		// ׼ѯ
+		// 准备查询语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("UPDATE user SET pwd = ? WHERE name = ?"));
 
-		// 󶨲
+		// 绑定参数
 		pstmt->setString(2, name);
 		pstmt->setString(1, newpwd);
 
-		// ִи
+		// 执行更新
 		int updateCount = pstmt->executeUpdate();
+		timer.Executed();
 
 		std::cout << "Updated rows: " << updateCount << std::endl;
 		pool_->returnConnection(std::move(con));
@@ -124,7 +138,10 @@ bool MysqlDao::UpdatePwd(const std::string& name, const std::string& newpwd) {
 }
 
 bool MysqlDao::CheckPwd(const std::string& name, const std::string& pwd, UserInfo& userInfo) {
+	static StorageMetric* metric = MetricsMgr::GetInstance()->GetStorage("mysql", "CheckPwd");
+	StorageTimer timer(metric);
 	auto con = pool_->getConnection();
+	timer.Acquired();
 	if (con == nullptr) {
 		return false;
 	}
@@ -136,17 +153,18 @@ bool MysqlDao::CheckPwd(const std::string& name, const std::string& pwd, UserInf
 	try {
 	
 
-		// ׼SQL
+		// 准备SQL语句
 		std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT * FROM user WHERE name = ?"));
-		pstmt->setString(1, name); // username滻ΪҪѯû
+		pstmt->setString(1, name); // 将username替换为你要查询的用户名
 
-		// ִвѯ
+		// 执行查询
 		std::unique_ptr<sql::ResultSet> res(pstmt->executeQuery());
+		timer.Executed();
 		std::string origin_pwd = "";
-		// 
+		// 遍历结果集
 		while (res->next()) {
 			origin_pwd = res->getString("pwd");
-			// ѯ
+			// 输出查询到的密码
 			std::cout << "Password: " << origin_pwd << std::endl;
 			break;
 		}
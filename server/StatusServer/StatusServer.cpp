@@ -17,20 +17,22 @@
 #include <thread>
 #include <boost/asio.hpp>
 #include "StatusServiceImpl.h"
+#include "MetricsMgr.h"
+#include "TraceMgr.h"
 void RunServer() {
 	auto & cfg = ConfigMgr::Inst();
 	
 	std::string server_address(cfg["StatusServer"]["Host"]+":"+ cfg["StatusServer"]["Port"]);
 	StatusServiceImpl service;
 
-	grpc::ServerBuilder builder;
-	// 监听端口和添加服务
-	builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-	builder.RegisterService(&service);
-
-	// 构建并启动gRPC服务器
-	std::unique_ptr<grpc::Server> server(builder.BuildAndStart());     // 构建并启动 gRPC 服务器。服务器会监听之前添加的地址，等待客户端连接。
-	std::cout << "Server listening on " << server_address << std::endl;
+	// 构建并启动异步gRPC服务器，完成队列、轮询线程和工作线程数在 [Grpc] 中配置
+	AsyncRpcServer server;
+	if (!server.Start(server_address, service.GetService())) {
+		return;
+	}
+	service.Serve(server);
+	// 按 [Metrics] Port 启动指标监听，Prometheus从 /metrics 抓取
+	MetricsMgr::GetInstance()->Start();
 
 
 	// 创建Boost.Asio的io_context
@@ -42,7 +44,7 @@ void RunServer() {
 	signals.async_wait([&server, &io_context](const boost::system::error_code& error, int signal_number) {
 		if (!error) {
 			std::cout << "Shutting down server..." << std::endl;
-			server->Shutdown(); // 优雅地关闭服务器
+			server.Shutdown(); // 优雅地关闭服务器
 			io_context.stop(); // 停止io_context
 		}
 		});
@@ -51,7 +53,9 @@ void RunServer() {
 	std::thread([&io_context]() { io_context.run(); }).detach();   // 启动一个新的线程来运行 io_context 的事件循环，该事件循环会处理信号捕捉等异步操作。
 
 	// 等待服务器关闭
-	server->Wait();   // 阻塞等待 gRPC 服务器关闭。这个函数会一直等待，直到服务器被关闭（例如在捕捉到信号时）。
+	server.Wait();   // 阻塞等待 gRPC 服务器关闭。这个函数会一直等待，直到服务器被关闭（例如在捕捉到信号时）。
+	MetricsMgr::GetInstance()->Stop();
+	TraceMgr::GetInstance()->Stop();
 
 }
 
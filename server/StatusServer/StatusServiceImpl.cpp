@@ -3,154 +3,289 @@
 #include "const.h"
 #include "RedisMgr.h"
 #include <climits>
+#include "TraceMgr.h"
 
-// һȫΨһʶ (UUID) תΪַ
+// 取对端通过metadata带过来的trace id，没有带时返回0
+static uint64_t ExtractTrace(::grpc::ServerContext* context) {
+	auto& metadata = context->client_metadata();
+	auto iter = metadata.find(TRACE_METADATA_KEY);
+	if (iter == metadata.end()) {
+		return 0;
+	}
+	return TraceMgr::FromHex(std::string(iter->second.data(), iter->second.length()));
+}
+
+// 生成一个全局唯一标识符 (UUID) 并将其转换为字符串。
 std::string generate_unique_string() {
-    // UUIDʹΨһUUID
+    // 创建UUID对象，使用随机生成器生成唯一的UUID
     boost::uuids::uuid uuid = boost::uuids::random_generator()();
 
-    // UUIDתΪַʾʽ
+    // 将UUID对象转换为字符串表示形式
     std::string unique_string = to_string(uuid);
 
-    return unique_string; // ɵΨһַ
+    return unique_string; // 返回生成的唯一字符串
 }
 
-// gRPCȡСϢ
+// gRPC方法：获取负载最小的聊天服务器信息
 Status StatusServiceImpl::GetChatServer(ServerContext* context, const GetChatServerReq* request, GetChatServerRsp* reply)
 {
+    ExecTimer timer(_get_chat_server_metric);
+    TraceScope trace_scope(ExtractTrace(context));
+    TraceSpan trace_span("grpc.server", "GetChatServer");
     std::string prefix("llfc status server has received :  ");
     
-    // ӷблȡǰС
+    // 从服务器列表中获取当前负载最小的聊天服务器
     const auto& server = getChatServer();
+    if (server.name.empty()) {
+        std::cout << "no chat server registered" << std::endl;
+        reply->set_error(ErrorCodes::RPCFailed);
+        return Status::OK;
+    }
     
-    // ӦеͶ˿Ϣ
+    // 设置响应中的聊天服务器主机和端口信息
     reply->set_host(server.host);
     reply->set_port(server.port);
     
-    // óɹ״̬
+    // 设置成功状态码
     reply->set_error(ErrorCodes::Success);
     
-    // Ψһû tokenõӦ
+    // 生成唯一的用户 token，并将其设置到响应中
     reply->set_token(generate_unique_string());
     
-    // ɵ token  Redis¼û token
+    // 将生成的 token 插入 Redis，记录该用户的 token
     insertToken(request->uid(), reply->token());
     
-    // سɹ״̬
+    // 返回成功状态
     return Status::OK;
 }
 
 
-// 캯ʼϢ
-StatusServiceImpl::StatusServiceImpl()
+// [Membership] 没有配置时的默认租约
+#define MEMBER_DEFAULT_LEASE_MS  3000
+
+// 构造函数：聊天服务器不再从配置读取，由ChatServer启动后通过Heartbeat注册
+StatusServiceImpl::StatusServiceImpl() : _b_stop(false)
 {
-    // ȡļеϢ
-    auto& cfg = ConfigMgr::Inst();
-    
-    // лȡб
-    auto server_list = cfg["chatservers"]["Name"];
+    _get_chat_server_metric = MetricsMgr::GetInstance()->GetLatency("status_rpc", "method", "GetChatServer");
+    _login_metric = MetricsMgr::GetInstance()->GetLatency("status_rpc", "method", "Login");
+    _heartbeat_metric = MetricsMgr::GetInstance()->GetLatency("status_rpc", "method", "Heartbeat");
+    _member_change_count = MetricsMgr::GetInstance()->GetCounter("status_member_change_total");
+
+    auto lease_ms = ConfigMgr::Inst()["Membership"]["LeaseMs"];
+    _lease_ms = lease_ms.empty() ? MEMBER_DEFAULT_LEASE_MS : (std::max)(atoi(lease_ms.c_str()), 1);
+
+    // 版本从启动时间开始，StatusServer重启后ChatServer手里的旧版本一定对不上，会收到完整的成员表
+    auto members = std::make_shared<Membership>();
+    members->version = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::atomic_store(&_members, std::shared_ptr<const Membership>(members));
+
+    _sweep_thread = std::thread([this]() {
+        sweepLeases();
+    });
+}
 
-    std::vector<std::string> words;
-    std::stringstream ss(server_list);
-    std::string word;
+StatusServiceImpl::~StatusServiceImpl()
+{
+    {
+        std::lock_guard<std::mutex> lock(_member_mutex);
+        _b_stop = true;
+    }
+    _cond.notify_all();
+    _sweep_thread.join();
+}
+
+void StatusServiceImpl::Serve(AsyncRpcServer& server)
+{
+    server.AddUnary(&_service, &StatusService::AsyncService::RequestGetChatServer,
+        [this](ServerContext* context, const GetChatServerReq* request, GetChatServerRsp* reply) {
+        return GetChatServer(context, request, reply);
+    }, _get_chat_server_metric);
+    server.AddUnary(&_service, &StatusService::AsyncService::RequestLogin,
+        [this](ServerContext* context, const LoginReq* request, LoginRsp* reply) {
+        return Login(context, request, reply);
+    }, _login_metric);
+    server.AddUnary(&_service, &StatusService::AsyncService::RequestHeartbeat,
+        [this](ServerContext* context, const HeartbeatReq* request, HeartbeatRsp* reply) {
+        return Heartbeat(context, request, reply);
+    }, _heartbeat_metric);
+}
 
-    // ַŷָwords
-    while (std::getline(ss, word, ',')) {
-        words.push_back(word);
+// gRPC方法：ChatServer注册、续约和下线
+Status StatusServiceImpl::Heartbeat(ServerContext* context, const HeartbeatReq* request, HeartbeatRsp* reply)
+{
+    ExecTimer timer(_heartbeat_metric);
+    const auto& info = request->server();
+    if (info.name().empty()) {
+        reply->set_error(ErrorCodes::Error_Json);
+        return Status::OK;
     }
 
-    // ƣطϢ
-    for (auto& word : words) {
-        if (cfg[word]["Name"].empty()) {
-            continue; // Ϊգ÷
+    {
+        std::lock_guard<std::mutex> lock(_member_mutex);
+        auto members = std::atomic_load(&_members);
+        auto iter = members->servers.find(info.name());
+        if (request->leave()) {
+            _leases.erase(info.name());
+            if (iter != members->servers.end()) {
+                std::cout << "chat server " << info.name() << " left" << std::endl;
+                publishMembers([&info](Membership& next) {
+                    next.servers.erase(info.name());
+                });
+            }
         }
+        else {
+            _leases[info.name()] = std::chrono::steady_clock::now() + std::chrono::milliseconds(_lease_ms);
+            // 只有新注册或者地址变了才发布新版本，普通的续约不改动成员表
+            if (iter == members->servers.end() || iter->second.host != info.host() || iter->second.port != info.port()
+                || iter->second.rpc_host != info.rpc_host() || iter->second.rpc_port != info.rpc_port()) {
+                std::cout << "chat server " << info.name() << " registered, client " << info.host() << ":" << info.port()
+                    << ", rpc " << info.rpc_host() << ":" << info.rpc_port() << std::endl;
+                publishMembers([&info](Membership& next) {
+                    ChatServer server;
+                    server.name = info.name();
+                    server.host = info.host();
+                    server.port = info.port();
+                    server.rpc_host = info.rpc_host();
+                    server.rpc_port = info.rpc_port();
+                    next.servers[server.name] = server;
+                });
+            }
+        }
+    }
 
-        //  ChatServer ˿ں
-        ChatServer server;
-        server.port = cfg[word]["Port"];
-        server.host = cfg[word]["Host"];
-        server.name = cfg[word]["Name"];
-        
-        // ӳ
-        _servers[server.name] = server;
+    // 在锁外根据快照填响应
+    auto members = std::atomic_load(&_members);
+    reply->set_error(ErrorCodes::Success);
+    reply->set_version(members->version);
+    if (request->version() != members->version) {
+        reply->set_changed(true);
+        for (auto& item : members->servers) {
+            auto* server = reply->add_servers();
+            server->set_name(item.second.name);
+            server->set_host(item.second.host);
+            server->set_port(item.second.port);
+            server->set_rpc_host(item.second.rpc_host);
+            server->set_rpc_port(item.second.rpc_port);
+        }
     }
+    return Status::OK;
 }
 
-// ӷблȡǰС
-ChatServer StatusServiceImpl::getChatServer() {
-    // бķʣֹ
-    std::lock_guard<std::mutex> guard(_server_mtx);
+void StatusServiceImpl::publishMembers(const std::function<void(Membership&)>& modify)
+{
+    auto current = std::atomic_load(&_members);
+    auto next = std::make_shared<Membership>(*current);
+    modify(*next);
+    next->version = current->version + 1;
+    std::atomic_store(&_members, std::shared_ptr<const Membership>(next));
+    _member_change_count->fetch_add(1, std::memory_order_relaxed);
+}
 
-    // һǸСķ
-    auto minServer = _servers.begin()->second;
-    
-    //  Redis лȡ÷
-    auto count_str = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, minServer.name);   //ֶ
-    
-    if (count_str.empty()) {
-        //  Redis ûи÷ϢĬΪֵ
-        minServer.con_count = INT_MAX;
-    } else {
-        // ַתΪ
-        minServer.con_count = std::stoi(count_str);
-    }
+void StatusServiceImpl::sweepLeases()
+{
+    std::unique_lock<std::mutex> lock(_member_mutex);
+    while (!_b_stop) {
+        // 半个租约检查一次，过期的服务器最多多留半个租约
+        _cond.wait_for(lock, std::chrono::milliseconds((std::max)(_lease_ms / 2, 1)));
+        if (_b_stop) {
+            break;
+        }
 
-    // бѰСķ
-    for (auto& server : _servers) {
-        if (server.second.name == minServer.name) {
-            continue; // ǰСط
+        auto now = std::chrono::steady_clock::now();
+        std::vector<std::string> expired;
+        for (auto iter = _leases.begin(); iter != _leases.end();) {
+            if (iter->second > now) {
+                ++iter;
+                continue;
+            }
+            std::cout << "chat server " << iter->first << " lease expired" << std::endl;
+            expired.push_back(iter->first);
+            iter = _leases.erase(iter);
+        }
+        if (expired.empty()) {
+            continue;
         }
+        publishMembers([&expired](Membership& next) {
+            for (auto& name : expired) {
+                next.servers.erase(name);
+            }
+        });
+    }
+}
+
+// 从服务器列表中获取当前负载最小的聊天服务器
+ChatServer StatusServiceImpl::getChatServer() {
+    // 取出当前的成员表快照，遍历期间即使有服务器注册或者过期也不受影响
+    auto members = std::atomic_load(&_members);
+    ChatServer minServer;
+    minServer.con_count = INT_MAX;
+    // 当前选中的服务器是否正在排空
+    bool min_draining = true;
+
+    // 遍历服务器列表，寻找连接数最小的服务器；连接数写在拷贝上，快照保持只读
+    for (auto& item : members->servers) {
+        auto server = item.second;
+        // 从 Redis 获取服务器的连接数
+        auto count_str = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server.name);   //联合字段
 
-        //  Redis ȡ
-        auto count_str = RedisMgr::GetInstance()->HGet(LOGIN_COUNT, server.second.name);
-        
         if (count_str.empty()) {
-            // ڣΪֵ
-            server.second.con_count = INT_MAX;
+            // 如果连接数不存在，设置为最大值
+            server.con_count = INT_MAX;
         } else {
-            // ַתΪ
-            server.second.con_count = std::stoi(count_str);
+            // 将连接数字符串转换为整数
+            server.con_count = std::stoi(count_str);
+        }
+
+        // 正在排空的服务器不再分配新用户，只有全部服务器都在排空时才从中选择
+        bool draining = !RedisMgr::GetInstance()->HGet(DRAIN_SERVERS, server.name).empty();
+        if (draining && !min_draining) {
+            continue;
         }
 
-        // ǰСڵǰСС
-        if (server.second.con_count < minServer.con_count) {
-            minServer = server.second;
+        // 第一个服务器和第一个不在排空的服务器直接替换，否则比较连接数
+        if (minServer.name.empty() || (min_draining && !draining) || server.con_count < minServer.con_count) {
+            minServer = server;
+            min_draining = draining;
         }
     }
 
-    // ظСķ
+    // 返回负载最小的服务器
     return minServer;
 }
 
 
-// gRPCû¼߼
+// gRPC方法：处理用户登录逻辑
 Status StatusServiceImpl::Login(ServerContext* context, const LoginReq* request, LoginRsp* reply)
 {
-    // ȡеûIDtoken
+    ExecTimer timer(_login_metric);
+    TraceScope trace_scope(ExtractTrace(context));
+    TraceSpan trace_span("grpc.server", "Login");
+    // 获取请求中的用户ID和token
     auto uid = request->uid();
     auto token = request->token();
 
-    // û token  Redis еļ
+    // 构造用户 token 在 Redis 中的键
     std::string uid_str = std::to_string(uid);
     std::string token_key = USERTOKENPREFIX + uid_str;
     
-    //  Redis лȡû token
+    // 从 Redis 中获取该用户的 token
     std::string token_value = "";
     bool success = RedisMgr::GetInstance()->Get(token_key, token_value);
     
     if (!success) {
-        //  Redis вڸû token򷵻ЧûID
+        // 如果 Redis 中不存在该用户的 token，则返回无效用户ID错误
         reply->set_error(ErrorCodes::UidInvalid);
         return Status::OK;
     }
 
-    //  token ƥ䣬Ч token 
+    // 如果 token 不匹配，返回无效 token 错误
     if (token_value != token) {
         reply->set_error(ErrorCodes::TokenInvalid);
         return Status::OK;
     }
 
-    //  token ƥ䣬سɹûID token 
+    // 如果 token 匹配，返回成功，并将用户ID和 token 返回
     reply->set_error(ErrorCodes::Success);
     reply->set_uid(uid);
     reply->set_token(token);
@@ -158,14 +293,14 @@ Status StatusServiceImpl::Login(ServerContext* context, const LoginReq* request,
 }
 
 
-// û token  Redis¼¼״̬
+// 将用户的 token 插入 Redis，记录登录状态
 void StatusServiceImpl::insertToken(int uid, std::string token)
 {
-    // û token  Redis еļ
+    // 构造用户 token 在 Redis 中的键
     std::string uid_str = std::to_string(uid);
     std::string token_key = USERTOKENPREFIX + uid_str;
     
-    //  token 洢 Redis 
+    // 将 token 存储到 Redis 中
     RedisMgr::GetInstance()->Set(token_key, token);
 }
 
@@ -1,7 +1,13 @@
 #pragma once
 #include <grpcpp/grpcpp.h>
 #include "message.grpc.pb.h"
+#include "MetricsMgr.h"
+#include "AsyncRpcServer.h"
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -11,6 +17,8 @@ using message::GetChatServerReq;
 using message::GetChatServerRsp;
 using message::LoginReq;
 using message::LoginRsp;
+using message::HeartbeatReq;
+using message::HeartbeatRsp;
 using message::StatusService;
 
 // 定义一个类 ChatServer 用于存储聊天服务器的相关信息，如 host、port 和服务器的名称。
@@ -18,10 +26,11 @@ using message::StatusService;
 class ChatServer {
 public:
     // 默认构造函数
-    ChatServer() : host(""), port(""), name(""), con_count(0) {}
+    ChatServer() : host(""), port(""), name(""), rpc_host(""), rpc_port(""), con_count(0) {}
 
     // 拷贝构造函数，用于根据已有的 ChatServer 对象创建新的对象。
-    ChatServer(const ChatServer& cs) : host(cs.host), port(cs.port), name(cs.name), con_count(cs.con_count) {}
+    ChatServer(const ChatServer& cs) : host(cs.host), port(cs.port), name(cs.name),
+        rpc_host(cs.rpc_host), rpc_port(cs.rpc_port), con_count(cs.con_count) {}
 
     // 赋值操作符重载，支持对象间的赋值。
     ChatServer& operator=(const ChatServer& cs) {
@@ -32,6 +41,8 @@ public:
         host = cs.host;
         name = cs.name;
         port = cs.port;
+        rpc_host = cs.rpc_host;
+        rpc_port = cs.rpc_port;
         con_count = cs.con_count;
         return *this;
     }
@@ -40,47 +51,93 @@ public:
     std::string host;
     std::string port;
     std::string name;
+    // 对端ChatServer之间gRPC通信的地址
+    std::string rpc_host;
+    std::string rpc_port;
     int con_count;
 };
 
+// 某个版本的聊天服务器成员表，发布之后不再修改
+struct Membership {
+    Membership() : version(0) {}
+    uint64_t version;
+    std::unordered_map<std::string, ChatServer> servers;
+};
+
 
 
-// 继承自 gRPC 生成的 StatusService::Service，StatusServiceImpl 实现了两个 gRPC 服务的具体逻辑：
+// StatusServiceImpl 实现了三个 gRPC 服务的具体逻辑：
 // 1. GetChatServer：用于获取适合用户的聊天服务器信息。
 // 2. Login：用于处理用户登录逻辑。
-class StatusServiceImpl final : public StatusService::Service
+// 3. Heartbeat：ChatServer注册和续约，[Membership] LeaseMs内没有心跳的服务器被移出成员表。
+// 成员表按RCU方式更新：写者加锁拷贝一份修改后整体替换，读者原子地取出当前快照后无锁读取。
+// 请求由AsyncRpcServer的完成队列接收，处理函数在它的工作线程上并发执行
+class StatusServiceImpl final
 {
 public:
     // 构造函数
     StatusServiceImpl();
 
-    // GetChatServer：从 gRPC 请求中提取用户信息，返回适合的聊天服务器。            用于响应客户端请求，返回适合负载均衡的聊天服务器。此方法需要重载以符合 gRPC 生成的虚函数签名。
+    // 注册到AsyncRpcServer的服务，Start时传入
+    StatusService::AsyncService* GetService() { return &_service; }
+
+    ~StatusServiceImpl();
+
+    // 服务启动后在每个完成队列上登记各个方法的调用，开始接收请求
+    void Serve(AsyncRpcServer& server);
+
+    // GetChatServer：从 gRPC 请求中提取用户信息，返回适合负载均衡的聊天服务器。
     Status GetChatServer(ServerContext* context, const GetChatServerReq* request,
-                         GetChatServerRsp* reply) override;
+                         GetChatServerRsp* reply);
 
     // Login：处理用户登录请求，返回登录响应。
     Status Login(ServerContext* context, const LoginReq* request,
-                 LoginRsp* reply) override;
+                 LoginRsp* reply);
+
+    // Heartbeat：登记或者续约发起心跳的ChatServer，leave为true时立即移除；成员表有变化时返回完整列表。
+    Status Heartbeat(ServerContext* context, const HeartbeatReq* request,
+                     HeartbeatRsp* reply);
 
 private:
     // insertToken：保存登录用户的 Token，用户标识用户的唯一身份。
     void insertToken(int uid, std::string token);
 
-    // getChatServer：返回一个适合负载均衡的聊天服务器，基于 con_count 来决定。
+    // getChatServer：返回一个适合负载均衡的聊天服务器，基于 con_count 来决定，没有可用服务器时name为空。
     ChatServer getChatServer();
 
-    // _servers：保存所有聊天服务器的信息，键为服务器的名称，值为对应的 ChatServer 对象。
-    std::unordered_map<std::string, ChatServer> _servers;
+    // 在当前成员表的拷贝上修改后发布为新版本，调用方持有_member_mutex
+    void publishMembers(const std::function<void(Membership&)>& modify);
+
+    // 定期移除租约过期的服务器
+    void sweepLeases();
+
+    StatusService::AsyncService _service;
+
+    // _members：当前成员表快照，键为服务器的名称，值为对应的 ChatServer 对象。
+    // 只通过std::atomic_load/atomic_store访问，选服务器的工作线程不需要加锁
+    std::shared_ptr<const Membership> _members;
+
+    // 写者之间互斥，保护_leases和成员表的发布
+    std::mutex _member_mutex;
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> _leases;
+    int _lease_ms;
+    bool _b_stop;
+    std::condition_variable _cond;
+    std::thread _sweep_thread;
 
-    // _server_mtx：用于保护 _servers 的线程安全操作。
-    std::mutex _server_mtx;
+    // 每个RPC的延迟统计，等待时间是请求到达到工作线程开始处理
+    LatencyMetric* _get_chat_server_metric;
+    LatencyMetric* _login_metric;
+    LatencyMetric* _heartbeat_metric;
+    std::atomic<uint64_t>* _member_change_count;
 };
 
 /*
 StatusServiceImpl 类：
 
-GetChatServer：用于响应客户端请求，返回适合负载均衡的聊天服务器。此方法需要重载以符合 gRPC 生成的虚函数签名。
+GetChatServer：用于响应客户端请求，返回适合负载均衡的聊天服务器。
 Login：处理用户登录请求。登录后，服务器会生成并返回一个用户的身份验证 token。
 insertToken：私有方法，存储用户的 token，帮助用户在登录后进行身份验证。
 getChatServer：私有方法，用于返回一个适合用户的聊天服务器。选择依据可以是负载均衡算法，例如选择当前连接数最少的服务器。
+Heartbeat：ChatServer启动后注册并定期续约，扩容缩容不需要修改配置或者重启其他节点。
 */
\ No newline at end of file
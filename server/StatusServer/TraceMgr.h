@@ -0,0 +1,97 @@
+#pragma once
+#include "Singleton.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// gRPC metadata中trace id的键，gRPC要求小写
+#define TRACE_METADATA_KEY  "x-trace-id"
+
+// 一段耗时，_name是固定的阶段名，_tag补充消息id、路由、命令等细节
+struct SpanRecord {
+	uint64_t _trace_id;
+	const char* _name;
+	std::string _tag;
+	int64_t _start_us;
+	int64_t _dur_us;
+};
+
+// 在作用域内把当前线程的trace id设为trace_id，离开时恢复原来的值
+// 逻辑线程、gRPC处理函数进入时设置，之后的存储调用和发包都能取到
+class TraceScope {
+public:
+	TraceScope(uint64_t trace_id);
+	~TraceScope();
+private:
+	uint64_t _prev;
+};
+
+// 记录从构造到析构的一段耗时，当前线程没有trace id时什么都不做
+// name和tag必须是字面量，需要拼接的tag由调用方判断在追踪中再直接调用Record
+class TraceSpan {
+public:
+	TraceSpan(const char* name, const char* tag = "");
+	~TraceSpan();
+private:
+	uint64_t _trace_id;
+	const char* _name;
+	const char* _tag;
+	int64_t _start_us;
+};
+
+// TraceMgr：端到端追踪，配置在 [Trace] 中
+// 入口处每SampleEvery条请求抽样一条生成trace id，客户端帧头、HTTP头或者gRPC metadata带过来的trace id总是记录；
+// 每个线程把span写到自己的缓冲区，后台线程每FlushMs毫秒收集一次，按行写成json到Path，配置了Collector时同时用UDP发送。
+// 时间戳用system_clock的微秒，同一台机器上的多个服务可以直接对齐，跨机器依赖时钟同步
+class TraceMgr : public Singleton<TraceMgr>
+{
+	friend class Singleton<TraceMgr>;
+public:
+	~TraceMgr();
+	// 按抽样率返回新的trace id，不抽样返回0
+	uint64_t Sample();
+	void Record(uint64_t trace_id, const char* name, const std::string& tag, int64_t start_us, int64_t dur_us);
+	bool IsEnable() const {
+		return _b_enable;
+	}
+	void Stop();
+	static uint64_t Current();
+	static int64_t NowMicros();
+	static std::string ToHex(uint64_t trace_id);
+	// 解析失败返回0
+	static uint64_t FromHex(const std::string& hex);
+private:
+	TraceMgr();
+	struct ThreadBuffer {
+		std::mutex _mutex;
+		std::vector<SpanRecord> _spans;
+	};
+
+	ThreadBuffer* GetThreadBuffer();
+	void Flush();
+	void WriteSpans(const std::vector<SpanRecord>& spans);
+
+	bool _b_enable;
+	uint64_t _sample_every;
+	std::atomic<uint64_t> _sample_count;
+	uint64_t _id_base;
+	std::atomic<uint64_t> _id_count;
+	std::string _server_name;
+	std::string _path;
+	std::string _collector_host;
+	unsigned short _collector_port;
+	int _flush_ms;
+	std::atomic<uint64_t> _dropped;
+
+	std::mutex _buffers_mutex;
+	std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+	std::mutex _stop_mutex;
+	std::condition_variable _stop_cond;
+	bool _b_stop;
+	std::thread _flush_thread;
+};
@@ -31,27 +31,27 @@ using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
 
 enum ErrorCodes {
 	Success = 0,
-	Error_Json = 1001,  //Json
-	RPCFailed = 1002,  //RPC
-	VarifyExpired = 1003, //֤
-	VarifyCodeErr = 1004, //֤
-	UserExist = 1005,       //ûѾ
-	PasswdErr = 1006,    //
-	EmailNotMatch = 1007,  //䲻ƥ
-	PasswdUpFailed = 1008,  //ʧ
-	PasswdInvalid = 1009,   //ʧ
-	TokenInvalid = 1010,   //TokenʧЧ
-	UidInvalid = 1011,  //uidЧ
+	Error_Json = 1001,  //Json解析错误
+	RPCFailed = 1002,  //RPC请求错误
+	VarifyExpired = 1003, //验证码过期
+	VarifyCodeErr = 1004, //验证码错误
+	UserExist = 1005,       //用户已经存在
+	PasswdErr = 1006,    //密码错误
+	EmailNotMatch = 1007,  //邮箱不匹配
+	PasswdUpFailed = 1008,  //更新密码失败
+	PasswdInvalid = 1009,   //密码更新失败
+	TokenInvalid = 1010,   //Token失效
+	UidInvalid = 1011,  //uid无效
 };
 
 
-// Defer
+// Defer类
 class Defer {
 public:
-	// һlambdaʽߺָ
+	// 接受一个lambda表达式或者函数指针
 	Defer(std::function<void()> func) : func_(func) {}
 
-	// ִдĺ
+	// 析构函数中执行传入的函数
 	~Defer() {
 		func_();
 	}
@@ -65,5 +65,9 @@ private:
 #define IPCOUNTPREFIX  "ipcount_"
 #define USER_BASE_INFO "ubaseinfo_"
 #define LOGIN_COUNT  "logincount"
+//正在排空的服务器，不再往这些服务器分配用户
+#define DRAIN_SERVERS  "drainservers"
+//进程内存储默认的分片数
+#define MEM_STORE_SHARDS  64
 
 